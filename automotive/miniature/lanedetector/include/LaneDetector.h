@@ -25,6 +25,7 @@
 #include <memory>
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryRing.h"
 
 namespace automotive {
     namespace miniature {
@@ -77,9 +78,19 @@ namespace automotive {
 	             */
 	            bool readSharedImage(odcore::data::Container &c);
 
+	            /**
+	             * This method mirrors the latest complete frame from a
+	             * SharedMemoryRing directly into m_image.
+	             *
+	             * @param si SharedImage describing the ring.
+	             * @return true if a consistent frame was read.
+	             */
+	            bool readSharedImageFromRing(const odcore::data::image::SharedImage &si);
+
             private:
 	            bool m_hasAttachedToSharedImageMemory;
 	            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedImageMemory;
+	            std::shared_ptr<odcore::wrapper::SharedMemoryRing> m_sharedImageRing;
 	            IplImage *m_image;
                 bool m_debug;
 
@@ -50,6 +50,7 @@ namespace automotive {
             TimeTriggeredConferenceClientModule(argc, argv, "LaneDetector"),
             m_hasAttachedToSharedImageMemory(false),
             m_sharedImageMemory(),
+            m_sharedImageRing(),
             m_image(NULL),
             m_debug(false) {}
 
@@ -82,6 +83,11 @@ namespace automotive {
 	        if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
 		        SharedImage si = c.getData<SharedImage> ();
 
+		        // The camera publishes its frames in a SharedMemoryRing.
+		        if (si.getNumberOfSlots() > 0) {
+			        return readSharedImageFromRing(si);
+		        }
+
 		        // Check if we have already attached to the shared memory containing the image from the virtual camera.
 		        if (!m_hasAttachedToSharedImageMemory) {
 			        m_sharedImageMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
@@ -110,6 +116,40 @@ namespace automotive {
 	        return retVal;
         }
 
+        bool LaneDetector::readSharedImageFromRing(const SharedImage &si) {
+	        bool retVal = false;
+
+	        // Check if we have already attached to the ring.
+	        if ( (!m_sharedImageRing.get()) || (!m_sharedImageRing->isValid()) ) {
+		        m_sharedImageRing = odcore::wrapper::SharedMemoryFactory::attachToSharedMemoryRing(si.getName());
+	        }
+
+	        if (m_sharedImageRing->isValid()) {
+		        // Neither the camera nor we need to lock the ring.
+		        const uint64_t frameID = m_sharedImageRing->getLatestFrameID();
+		        const char *frame = m_sharedImageRing->getFrame(frameID);
+
+		        if (frame != NULL) {
+			        const uint32_t numberOfChannels = si.getBytesPerPixel();
+			        if (m_image == NULL) {
+				        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
+			        }
+
+			        if (m_image != NULL) {
+				        // Mirror the image straight out of the shared memory instead of copying it first.
+				        IplImage source;
+				        cvInitImageHeader(&source, cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
+				        cvSetData(&source, const_cast<char*>(frame), si.getWidth() * numberOfChannels);
+				        cvFlip(&source, m_image, -1);
+
+				        // Discard the image if the camera has reused the slot meanwhile.
+				        retVal = m_sharedImageRing->isFrameUnchanged(frameID);
+			        }
+		        }
+	        }
+	        return retVal;
+        }
+
         // This method is called to process an image described by the SharedImage data structure.
         void LaneDetector::processImage() {
             // Example: Show the image.
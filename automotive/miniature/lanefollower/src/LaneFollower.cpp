@@ -46,6 +46,7 @@ namespace automotive {
         LaneFollower::LaneFollower(const int32_t &argc, char **argv) : TimeTriggeredConferenceClientModule(argc, argv, "lanefollower"),
             m_hasAttachedToSharedImageMemory(false),
             m_sharedImageMemory(),
+            m_sharedImageRing(),
             m_image(NULL),
             m_debug(false),
             m_font(),
@@ -82,6 +83,11 @@ namespace automotive {
 	        if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
 		        SharedImage si = c.getData<SharedImage> ();
 
+		        // The camera publishes its frames in a SharedMemoryRing.
+		        if (si.getNumberOfSlots() > 0) {
+			        return readSharedImageFromRing(si);
+		        }
+
 		        // Check if we have already attached to the shared memory.
 		        if (!m_hasAttachedToSharedImageMemory) {
 			        m_sharedImageMemory
@@ -115,6 +121,40 @@ namespace automotive {
 	        return retVal;
         }
 
+        bool LaneFollower::readSharedImageFromRing(const SharedImage &si) {
+	        bool retVal = false;
+
+	        // Check if we have already attached to the ring.
+	        if ( (!m_sharedImageRing.get()) || (!m_sharedImageRing->isValid()) ) {
+		        m_sharedImageRing = odcore::wrapper::SharedMemoryFactory::attachToSharedMemoryRing(si.getName());
+	        }
+
+	        if (m_sharedImageRing->isValid()) {
+		        // Neither the camera nor we need to lock the ring.
+		        const uint64_t frameID = m_sharedImageRing->getLatestFrameID();
+		        const char *frame = m_sharedImageRing->getFrame(frameID);
+
+		        if (frame != NULL) {
+			        const uint32_t numberOfChannels = 3;
+			        if (m_image == NULL) {
+				        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
+			        }
+
+			        if (m_image != NULL) {
+				        // Mirror the image straight out of the shared memory instead of copying it first.
+				        IplImage source;
+				        cvInitImageHeader(&source, cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
+				        cvSetData(&source, const_cast<char*>(frame), si.getWidth() * numberOfChannels);
+				        cvFlip(&source, m_image, -1);
+
+				        // Discard the image if the camera has reused the slot meanwhile.
+				        retVal = m_sharedImageRing->isFrameUnchanged(frameID);
+			        }
+		        }
+	        }
+	        return retVal;
+        }
+
         void LaneFollower::processImage() {
             static bool useRightLaneMarking = true;
             double e = 0;
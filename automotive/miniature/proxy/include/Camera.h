@@ -25,6 +25,7 @@
 
 #include <memory>
 #include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryRing.h"
 #include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
 
 namespace automotive {
@@ -65,8 +66,9 @@ namespace automotive {
                  * @param width
                  * @param height
                  * @param bpp
+                 * @param numberOfSlots Number of slots for a SharedMemoryRing; 0 uses a single locked shared memory segment.
                  */
-                Camera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp);
+                Camera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const uint32_t &numberOfSlots);
 
                 virtual ~Camera();
 
@@ -105,6 +107,7 @@ namespace automotive {
             private:
                 odcore::data::image::SharedImage m_sharedImage;
                 std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                std::shared_ptr<odcore::wrapper::SharedMemoryRing> m_sharedMemoryRing;
                 
             protected:
                 string m_name;
@@ -66,8 +66,9 @@ namespace automotive {
                  * @param width
                  * @param height
                  * @param bpp
+                 * @param numberOfSlots Number of slots for a SharedMemoryRing; 0 uses a single locked shared memory segment.
                  */
-                uEyeCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp);
+                uEyeCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const uint32_t &numberOfSlots);
 
                 virtual ~uEyeCamera();
 
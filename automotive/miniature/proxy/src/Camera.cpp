@@ -29,9 +29,10 @@
 namespace automotive {
     namespace miniature {
 
-        Camera::Camera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp) :
+        Camera::Camera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const uint32_t &numberOfSlots) :
             m_sharedImage(),
             m_sharedMemory(),
+            m_sharedMemoryRing(),
             m_name(name),
             m_id(id),
             m_width(width),
@@ -39,7 +40,14 @@ namespace automotive {
             m_bpp(bpp),
             m_size(0) {
 
-            m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(name, width * height * bpp);
+            if (numberOfSlots > 0) {
+                // Consumers read the latest frame in place while the next one is captured.
+                m_sharedMemoryRing = odcore::wrapper::SharedMemoryFactory::createSharedMemoryRing(name, width * height * bpp, numberOfSlots);
+                m_sharedImage.setNumberOfSlots(numberOfSlots);
+            }
+            else {
+                m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(name, width * height * bpp);
+            }
 
             m_sharedImage.setName(name);
             m_sharedImage.setWidth(width);
@@ -84,6 +92,13 @@ namespace automotive {
                             copyImageTo((char*)m_sharedMemory->getSharedMemory(), m_size);
                         m_sharedMemory->unlock();
                     }
+                    if (m_sharedMemoryRing.get() && m_sharedMemoryRing->isValid()) {
+                        copyImageTo(m_sharedMemoryRing->beginWrite(), m_size);
+                        const uint64_t frameID = m_sharedMemoryRing->endWrite();
+
+                        m_sharedImage.setSlot(m_sharedMemoryRing->getSlot(frameID));
+                        m_sharedImage.setFrameID(frameID);
+                    }
                 }
             }
 
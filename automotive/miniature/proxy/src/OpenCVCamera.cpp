@@ -27,8 +27,8 @@
 namespace automotive {
     namespace miniature {
 
-        OpenCVCamera::OpenCVCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp) :
-            Camera(name, id, width, height, bpp),
+        OpenCVCamera::OpenCVCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const uint32_t &numberOfSlots) :
+            Camera(name, id, width, height, bpp, numberOfSlots),
             m_capture(NULL),
             m_image(NULL) {
 
@@ -86,13 +86,18 @@ namespace automotive {
             const uint32_t WIDTH = getKeyValueConfiguration().getValue<uint32_t>("proxy.camera.width");
             const uint32_t HEIGHT = getKeyValueConfiguration().getValue<uint32_t>("proxy.camera.height");
             const uint32_t BPP = getKeyValueConfiguration().getValue<uint32_t>("proxy.camera.bpp");
+            uint32_t SLOTS = 0;
+            try {
+                SLOTS = getKeyValueConfiguration().getValue<uint32_t>("proxy.camera.slots");
+            }
+            catch(...) {}
 
             if (TYPE.compare("opencv") == 0) {
-                m_camera = unique_ptr<Camera>(new OpenCVCamera(NAME, ID, WIDTH, HEIGHT, BPP));
+                m_camera = unique_ptr<Camera>(new OpenCVCamera(NAME, ID, WIDTH, HEIGHT, BPP, SLOTS));
             }
             if (TYPE.compare("ueye") == 0) {
 #ifdef HAVE_UEYE
-                m_camera = unique_ptr<Camera>(new uEyeCamera(NAME, ID, WIDTH, HEIGHT, BPP));
+                m_camera = unique_ptr<Camera>(new uEyeCamera(NAME, ID, WIDTH, HEIGHT, BPP, SLOTS));
 #endif
             }
 
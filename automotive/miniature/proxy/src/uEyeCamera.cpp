@@ -29,8 +29,8 @@
 namespace automotive {
     namespace miniature {
 
-        uEyeCamera::uEyeCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp) :
-            Camera(name, id, width, height, bpp),
+        uEyeCamera::uEyeCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const uint32_t &numberOfSlots) :
+            Camera(name, id, width, height, bpp, numberOfSlots),
             m_capture(0),
             m_imageMemory(NULL),
             m_ueyeImagePtr(NULL),
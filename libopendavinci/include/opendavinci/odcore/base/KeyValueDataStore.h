@@ -22,6 +22,7 @@
 
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
+#include "opendavinci/odcore/base/LatestValueStore.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/wrapper/KeyValueDatabase.h"
@@ -42,6 +43,11 @@ namespace odcore {
          * Container c(TIMESTAMP, ts);
          * kv.put(key, c);
          * @endcode
+         *
+         * When created without a database, the latest container per key
+         * is kept in memory using a LatestValueStore; in this case, put and
+         * get do not serialize and lock only for swapping a shared pointer,
+         * and getLatest<T>() returns a shared, already decoded object.
          */
         class OPENDAVINCI_API KeyValueDataStore {
             private:
@@ -65,6 +71,12 @@ namespace odcore {
                 KeyValueDataStore& operator=(const KeyValueDataStore&);
 
             public:
+                /**
+                 * Constructor for an in-memory data store keeping the
+                 * latest container per key.
+                 */
+                KeyValueDataStore();
+
                 /**
                  * Constructor.
                  *
@@ -91,8 +103,28 @@ namespace odcore {
                  */
                 data::Container get(const int32_t &key) const;
 
+                /**
+                 * This method returns the decoded value for a key.
+                 *
+                 * @param key The key for which the value has to be returned.
+                 * @return The decoded value or NULL if no value is available.
+                 */
+                template<class T>
+                inline std::shared_ptr<const T> getLatest(const int32_t &key) const {
+                    if (m_latestValues.get()) {
+                        return m_latestValues->getLatest<T>(key);
+                    }
+
+                    const data::Container c = get(key);
+                    if (c.getDataType() == data::Container::UNDEFINEDDATA) {
+                        return std::shared_ptr<const T>();
+                    }
+                    return std::make_shared<const T>(c.getData<T>());
+                }
+
             private:
                 std::shared_ptr<wrapper::KeyValueDatabase> m_keyValueDatabase;
+                std::shared_ptr<LatestValueStore> m_latestValues;
         };
 
     }
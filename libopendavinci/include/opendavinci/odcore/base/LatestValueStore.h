@@ -0,0 +1,177 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_LATESTVALUESTORE_H_
+#define OPENDAVINCI_CORE_BASE_LATESTVALUESTORE_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/SerializableData.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class keeps the latest Container per key in memory. Writers
+         * publish a new immutable entry by swapping a shared pointer with
+         * std::atomic_store; readers copy that pointer with std::atomic_load.
+         * These operations are not lock-free: the standard library guards
+         * them with a small pool of mutexes, which readers and writers may
+         * share for the duration of one pointer copy. Neither readers nor
+         * writers hold a lock while copying or decoding a container. The
+         * set of keys is copied on write under a mutex, which happens only
+         * once per new key.
+         *
+         * Every entry decodes its container at most once: the first call
+         * to getLatest<T>() decodes the payload while concurrent callers
+         * for the same entry wait, and all further callers share the
+         * decoded object until a newer container arrives.
+         *
+         * @code
+         * LatestValueStore lvs;
+         * lvs.put(TimeStamp::ID(), c);
+         * ...
+         * std::shared_ptr<const TimeStamp> ts = lvs.getLatest<TimeStamp>(TimeStamp::ID());
+         * if (ts.get()) {
+         *     cout << ts->toString() << endl;
+         * }
+         * @endcode
+         */
+        class OPENDAVINCI_API LatestValueStore {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                LatestValueStore(const LatestValueStore&);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                LatestValueStore& operator=(const LatestValueStore&);
+
+            private:
+                /**
+                 * Immutable container together with its lazily decoded payload.
+                 */
+                class Entry {
+                    private:
+                        Entry(const Entry&);
+                        Entry& operator=(const Entry&);
+
+                    public:
+                        Entry(const data::Container &container);
+
+                        const data::Container m_container;
+                        std::once_flag m_decodeOnce;
+                        std::shared_ptr<const data::SerializableData> m_decoded;
+                };
+
+                /**
+                 * Holder for the current entry of one key.
+                 */
+                class Slot {
+                    private:
+                        Slot(const Slot&);
+                        Slot& operator=(const Slot&);
+
+                    public:
+                        Slot();
+
+                        std::shared_ptr<Entry> m_entry;
+                };
+
+                typedef map<int32_t, std::shared_ptr<Slot> > MapOfSlots;
+
+            public:
+                LatestValueStore();
+
+                virtual ~LatestValueStore();
+
+                /**
+                 * This method replaces the latest container for a key.
+                 *
+                 * @param key The key.
+                 * @param value The container.
+                 */
+                void put(const int32_t &key, const data::Container &value);
+
+                /**
+                 * This method returns the latest container for a key.
+                 *
+                 * @param key The key.
+                 * @return The latest container or an empty container.
+                 */
+                data::Container get(const int32_t &key) const;
+
+                /**
+                 * This method returns the decoded payload of the latest
+                 * container for a key. The returned object is shared by all
+                 * callers and must not be modified.
+                 *
+                 * @param key The key.
+                 * @return Decoded payload or NULL if no container is available.
+                 */
+                template<class T>
+                inline std::shared_ptr<const T> getLatest(const int32_t &key) const {
+                    std::shared_ptr<Entry> entry = getEntry(key);
+                    if (!entry.get()) {
+                        return std::shared_ptr<const T>();
+                    }
+
+                    std::call_once(entry->m_decodeOnce, [&entry]() {
+                        entry->m_decoded = std::make_shared<const T>(entry->m_container.getData<T>());
+                    });
+
+                    std::shared_ptr<const T> decoded = std::dynamic_pointer_cast<const T>(entry->m_decoded);
+                    if (!decoded.get()) {
+                        // The entry was decoded as a different type already.
+                        decoded = std::make_shared<const T>(entry->m_container.getData<T>());
+                    }
+                    return decoded;
+                }
+
+            private:
+                /**
+                 * This method returns the current entry for a key.
+                 *
+                 * @param key The key.
+                 * @return Entry or NULL.
+                 */
+                std::shared_ptr<Entry> getEntry(const int32_t &key) const;
+
+            private:
+                Mutex m_insertMutex;
+                std::shared_ptr<const MapOfSlots> m_slots;
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_LATESTVALUESTORE_H_*/
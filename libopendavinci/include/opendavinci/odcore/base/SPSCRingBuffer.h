@@ -0,0 +1,209 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_SPSCRINGBUFFER_H_
+#define OPENDAVINCI_CORE_BASE_SPSCRINGBUFFER_H_
+
+#include <atomic>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class is a bounded, lock-free ring buffer for exactly one
+         * producing and one consuming thread. Its slots are allocated once
+         * and reused; pushing a value copies or moves it into a slot and
+         * the consumer processes the value in place. Popping an entry
+         * replaces it by a default constructed value, whose constructor
+         * must not throw; hence, idle slots do not keep the payload (e.g. a
+         * string's capacity) of earlier values:
+         *
+         * @code
+         * SPSCRingBuffer<Packet> ring(1024);
+         *
+         * // Producer thread.
+         * if (!ring.push(std::move(p))) { ... full ... }
+         *
+         * // Consumer thread.
+         * const Packet *entry = NULL;
+         * while (NULL != (entry = ring.front())) {
+         *     process(*entry);
+         *     ring.pop();
+         * }
+         * @endcode
+         */
+        template<typename T>
+        class SPSCRingBuffer {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                SPSCRingBuffer(const SPSCRingBuffer &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                SPSCRingBuffer& operator=(const SPSCRingBuffer &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param capacity Maximum number of entries (rounded up to the next power of two).
+                 */
+                SPSCRingBuffer(const uint32_t &capacity) :
+                    m_mask(getPowerOfTwo(capacity) - 1),
+                    m_slots(m_mask + 1),
+                    m_paddingBeforeHead(),
+                    m_head(0),
+                    m_paddingBeforeTail(),
+                    m_tail(0) {}
+
+                virtual ~SPSCRingBuffer() {}
+
+                /**
+                 * This method returns the maximum number of entries.
+                 *
+                 * @return Capacity.
+                 */
+                uint32_t getCapacity() const {
+                    return m_mask + 1;
+                }
+
+                /**
+                 * This method returns the current number of entries.
+                 *
+                 * @return Number of entries.
+                 */
+                uint32_t getSize() const {
+                    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+                }
+
+                /**
+                 * This method returns true if no entries are available.
+                 *
+                 * @return true if empty.
+                 */
+                bool isEmpty() const {
+                    return (0 == getSize());
+                }
+
+                /**
+                 * This method adds a copy of the given value. It must be
+                 * called only from the producing thread.
+                 *
+                 * @param value Value to be added.
+                 * @return false if the ring buffer is full.
+                 */
+                bool push(const T &value) {
+                    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+                    if ((tail - m_head.load(std::memory_order_acquire)) > m_mask) {
+                        return false;
+                    }
+                    m_slots[tail & m_mask] = value;
+                    m_tail.store(tail + 1, std::memory_order_seq_cst);
+                    return true;
+                }
+
+                /**
+                 * This method moves the given value into the ring buffer.
+                 * It must be called only from the producing thread. The
+                 * value is left untouched if the ring buffer is full.
+                 *
+                 * @param value Value to be added.
+                 * @return false if the ring buffer is full.
+                 */
+                bool push(T &&value) {
+                    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+                    if ((tail - m_head.load(std::memory_order_acquire)) > m_mask) {
+                        return false;
+                    }
+                    m_slots[tail & m_mask] = std::move(value);
+                    m_tail.store(tail + 1, std::memory_order_seq_cst);
+                    return true;
+                }
+
+                /**
+                 * This method returns the oldest entry without removing it.
+                 * It must be called only from the consuming thread.
+                 *
+                 * @return Oldest entry or NULL if empty.
+                 */
+                const T* front() const {
+                    const uint32_t head = m_head.load(std::memory_order_relaxed);
+                    if (head == m_tail.load(std::memory_order_acquire)) {
+                        return NULL;
+                    }
+                    return &m_slots[head & m_mask];
+                }
+
+                /**
+                 * This method removes and releases the oldest entry; its
+                 * slot may be reused by the producer afterwards. It must be
+                 * called only from the consuming thread and only if
+                 * front() != NULL.
+                 */
+                void pop() {
+                    const uint32_t head = m_head.load(std::memory_order_relaxed);
+                    {
+                        // Assigning or swapping with an empty value keeps
+                        // the old buffers of types without move semantics
+                        // (e.g. generated messages with std::string fields).
+                        T &slot = m_slots[head & m_mask];
+                        slot.~T();
+                        new (&slot) T();
+                    }
+                    m_head.store(head + 1, std::memory_order_release);
+                }
+
+            private:
+                static uint32_t getPowerOfTwo(const uint32_t &value) {
+                    uint32_t powerOfTwo = 1;
+                    while (powerOfTwo < value) {
+                        powerOfTwo <<= 1;
+                    }
+                    return powerOfTwo;
+                }
+
+            private:
+                const uint32_t m_mask;
+                vector<T> m_slots;
+
+                // Keep consumer and producer position on separate cache lines.
+                char m_paddingBeforeHead[64];
+                std::atomic<uint32_t> m_head;
+                char m_paddingBeforeTail[64];
+                std::atomic<uint32_t> m_tail;
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_SPSCRINGBUFFER_H_*/
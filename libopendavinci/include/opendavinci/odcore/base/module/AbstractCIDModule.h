@@ -123,6 +123,17 @@ namespace odcore {
                         return m_realtime;
                     }
 
+                    /**
+                     * This method returns true, if --conference=shm is set, i.e.
+                     * containers shall be exchanged via shared memory instead
+                     * of UDP multicast.
+                     *
+                     * @return true if the shared memory conference shall be used.
+                     */
+                    inline bool isSharedMemoryConference() const {
+                        return m_sharedMemoryConference;
+                    }
+
                     /**
                      * This method returns the priority, if --realtime is enabled.
                      *
@@ -142,6 +153,7 @@ namespace odcore {
                     bool m_profiling;
                     bool m_realtime;
                     uint32_t m_realtimePriority;
+                    bool m_sharedMemoryConference;
 
                     /**
                      * This method tries to parse the identifier.
@@ -20,10 +20,13 @@
 #ifndef OPENDAVINCI_CORE_DATA_CONTAINER_H_
 #define OPENDAVINCI_CORE_DATA_CONTAINER_H_
 
-#include <sstream>
+#include <istream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/io/ReadOnlyStreamBuffer.h"
 #include "opendavinci/odcore/serialization/Serializable.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
 
@@ -36,6 +39,10 @@ class SerializableData;
 
         /**
          * Container for all interchangeable data.
+         *
+         * The serialized payload is kept in an immutable, reference-counted
+         * buffer: Copying or assigning a Container shares this buffer instead
+         * of duplicating it and moving a Container transfers it.
          */
         class OPENDAVINCI_API Container : public odcore::serialization::Serializable {
             public:
@@ -44,6 +51,13 @@ class SerializableData;
                     DMCP_CONFIGURATION_REQUEST   =  5,
                 };
 
+            public:
+                /**
+                 * Size of the OpenDaVINCI container header: 0x0D 0xA4 A B C
+                 * where A B C encode the length of the payload.
+                 */
+                static const uint32_t HEADER_SIZE = 5;
+
             public:
                 Container();
 
@@ -69,6 +83,13 @@ class SerializableData;
                  */
                 Container(const Container &obj);
 
+                /**
+                 * Move constructor.
+                 *
+                 * @param obj Reference to an object of this class; it is empty afterwards.
+                 */
+                Container(Container &&obj);
+
                 virtual ~Container();
 
                 /**
@@ -79,6 +100,14 @@ class SerializableData;
                  */
                 Container& operator=(const Container &obj);
 
+                /**
+                 * Move assignment operator.
+                 *
+                 * @param obj Reference to an object of this class; it is empty afterwards.
+                 * @return Reference to this instance.
+                 */
+                Container& operator=(Container &&obj);
+
                 /**
                  * This method returns the data type inside this container.
                  *
@@ -89,6 +118,75 @@ class SerializableData;
                 virtual ostream& operator<<(ostream &out) const;
                 virtual istream& operator>>(istream &in);
 
+                /**
+                 * This method returns the number of bytes needed for the
+                 * wire representation (header and payload) of this container.
+                 *
+                 * @return Number of bytes needed by serializeTo(...).
+                 */
+                uint32_t getSerializedSize() const;
+
+                /**
+                 * This method writes the wire representation of this
+                 * container directly into the given buffer without any
+                 * intermediate streams. The result is identical to the
+                 * output of operator<<.
+                 *
+                 * @param buffer Buffer to write into.
+                 * @param size Size of the buffer.
+                 * @return Number of bytes written or 0 if the buffer is too small.
+                 */
+                uint32_t serializeTo(char *buffer, const uint32_t &size) const;
+
+                /**
+                 * This method decodes a container from its wire
+                 * representation by slicing the given buffer; only the
+                 * contained payload is copied.
+                 *
+                 * @param buffer Buffer to read from.
+                 * @param size Number of valid bytes in the buffer.
+                 * @return Number of bytes consumed or 0 if the buffer does not start with a complete container.
+                 */
+                uint32_t deserializeFrom(const char *buffer, const uint32_t &size);
+
+                /**
+                 * This method reads the data type and the sender stamp from
+                 * the wire representation of a container without decoding
+                 * or copying its payload. It is used to filter containers
+                 * before decoding them.
+                 *
+                 * @param buffer Buffer to read from.
+                 * @param size Number of valid bytes in the buffer.
+                 * @param dataType Data type of the container.
+                 * @param senderStamp Sender stamp of the container.
+                 * @return true if the buffer starts with a complete container.
+                 */
+                static bool peekHeader(const char *buffer, const uint32_t &size, int32_t &dataType, uint32_t &senderStamp);
+
+                /**
+                 * This method returns the size of the wire representation
+                 * of the container at the beginning of the given buffer.
+                 * It is used to iterate over several containers that are
+                 * stored back to back.
+                 *
+                 * @param buffer Buffer to read from.
+                 * @param size Number of valid bytes in the buffer.
+                 * @return Number of bytes of the first container or 0 if the buffer does not start with a complete container.
+                 */
+                static uint32_t peekSize(const char *buffer, const uint32_t &size);
+
+                /**
+                 * This method reads the wire representation of the next
+                 * container from the given stream into the given buffer.
+                 * The buffer is only grown but never shrunk so that its
+                 * capacity can be reused for subsequent containers.
+                 *
+                 * @param in Stream to read from.
+                 * @param buffer Buffer to read into.
+                 * @return Number of bytes read into the buffer or 0 on failure.
+                 */
+                static uint32_t readWireRepresentation(istream &in, vector<char> &buffer);
+
                 /**
                  * This method returns a usable object:
                  *
@@ -101,16 +199,22 @@ class SerializableData;
                  * @return Usable object.
                  */
                 template<class T>
-                inline T getData() {
+                inline T getData() const {
                     T containerData;
-                    // Reset failbit as some Deserializer fully consume the entire stream.
-                    m_serializedData.clear();
-                    // Read from beginning.
-                    m_serializedData.seekg(ios::beg);
-                    m_serializedData >> containerData;
+                    // Read directly from the shared buffer without copying it.
+                    odcore::io::ReadOnlyStreamBuffer buffer(m_serializedData->data(), m_serializedData->size());
+                    istream in(&buffer);
+                    in >> containerData;
                     return containerData;
                 }
 
+                /**
+                 * This method returns the serialized payload of this container.
+                 *
+                 * @return Serialized payload.
+                 */
+                const string& getSerializedData() const;
+
                 /**
                  * This method returns the time stamp when this
                  * container was sent.
@@ -179,9 +283,74 @@ class SerializableData;
                  */
                 uint32_t getSenderStamp() const;
 
+            private:
+                /**
+                 * This method returns the number of bytes used to
+                 * encode the given value as VarInt.
+                 *
+                 * @param value Value to encode.
+                 * @return Number of bytes.
+                 */
+                static uint32_t getVarIntSize(uint64_t value);
+
+                /**
+                 * This method encodes the given value as VarInt.
+                 *
+                 * @param buffer Buffer to write into.
+                 * @param value Value to encode.
+                 * @return Pointer to the byte following the encoded value.
+                 */
+                static char* encodeVarInt(char *buffer, uint64_t value);
+
+                /**
+                 * This method decodes a VarInt.
+                 *
+                 * @param begin First byte to read.
+                 * @param end Byte following the readable area.
+                 * @param value Decoded value.
+                 * @return Pointer to the byte following the encoded value or NULL if the VarInt is truncated.
+                 */
+                static const char* decodeVarInt(const char *begin, const char *end, uint64_t &value);
+
+                /**
+                 * This method returns the length of the nested Proto
+                 * message for the given time stamp.
+                 *
+                 * @param timeStamp Time stamp.
+                 * @return Length of the encoded time stamp.
+                 */
+                static uint32_t getTimeStampSize(const TimeStamp &timeStamp);
+
+                /**
+                 * This method encodes the given time stamp as nested Proto message.
+                 *
+                 * @param buffer Buffer to write into.
+                 * @param id Field identifier.
+                 * @param timeStamp Time stamp to encode.
+                 * @return Pointer to the byte following the encoded field.
+                 */
+                static char* encodeTimeStamp(char *buffer, const uint32_t &id, const TimeStamp &timeStamp);
+
+                /**
+                 * This method decodes a time stamp from a nested Proto message.
+                 *
+                 * @param begin First byte of the nested message.
+                 * @param end Byte following the nested message.
+                 * @param timeStamp Time stamp to decode into.
+                 * @return true if the nested message was decoded successfully.
+                 */
+                static bool decodeTimeStamp(const char *begin, const char *end, TimeStamp &timeStamp);
+
+                /**
+                 * This method returns the buffer shared by all empty containers.
+                 *
+                 * @return Empty buffer.
+                 */
+                static const std::shared_ptr<const string>& getEmptyBuffer();
+
             private:
                 int32_t m_dataType;
-                stringstream m_serializedData;
+                std::shared_ptr<const string> m_serializedData;
 
                 TimeStamp m_sent;
                 TimeStamp m_received;
@@ -27,6 +27,8 @@
 #include "opendavinci/odcore/base/Visitable.h"
 #include "opendavinci/odcore/data/SerializableData.h"
 
+struct tm;
+
 namespace odcore {
     namespace data {
 
@@ -34,11 +36,12 @@ namespace odcore {
 
         /**
          * This class can be used for time computations.
+         *
+         * The human readable fields (year, month, ...) are computed only
+         * when they are queried; thus, creating, copying, and decoding
+         * time stamps does not involve any calendar computations.
          */
         class OPENDAVINCI_API TimeStamp : public odcore::data::TimePoint {
-            private:
-                friend class Container;
-
             private:
                 enum CUMULATIVE_DAYS {
                     January = 31,   // 31
@@ -56,6 +59,11 @@ namespace odcore {
                 };
 
             public:
+                /**
+                 * Constructor for the current time. Unless a controlled
+                 * time factory is installed (e.g. for simulation), the
+                 * system's real time clock is read directly.
+                 */
                 TimeStamp();
 
                 /**
@@ -113,6 +121,25 @@ namespace odcore {
                  */
                 TimeStamp operator-(const TimeStamp& t) const;
 
+                /**
+                 * This method returns the current time; it is equivalent
+                 * to the default constructor.
+                 *
+                 * @return Current time.
+                 */
+                static TimeStamp now();
+
+                /**
+                 * This method returns the current time of the system's
+                 * monotonic clock, which is not affected by changes of the
+                 * system time and ignores any controlled time factory. Such
+                 * time stamps may only be compared with each other, e.g. for
+                 * measuring latencies, and do not denote a date.
+                 *
+                 * @return Current time of the monotonic clock.
+                 */
+                static TimeStamp nowMonotonic();
+
                 bool operator==(const TimeStamp& t) const;
                 bool operator!=(const TimeStamp& t) const;
                 bool operator<(const TimeStamp& t) const;
@@ -228,16 +255,10 @@ namespace odcore {
 
                 /**
                  * This methods computes the human readable representation.
+                 *
+                 * @param tm Broken-down local time.
                  */
-                void computeHumanReadableRepresentation();
-
-            private:
-                uint32_t m_readableYear;
-                uint32_t m_readableMonth;
-                uint32_t m_readableDayOfMonth;
-                uint32_t m_readableHours;
-                uint32_t m_readableMinutes;
-                uint32_t m_readableSeconds;
+                void getHumanReadableRepresentation(struct tm &tm) const;
         };
 
     }
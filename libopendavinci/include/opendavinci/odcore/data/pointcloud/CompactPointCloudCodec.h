@@ -0,0 +1,182 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef OPENDAVINCI_CORE_DATA_POINTCLOUD_COMPACTPOINTCLOUDCODEC_H_
+#define OPENDAVINCI_CORE_DATA_POINTCLOUD_COMPACTPOINTCLOUDCODEC_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/generated/odcore/data/CompactPointCloud.h"
+#include "opendavinci/generated/odcore/data/SharedPointCloud.h"
+
+namespace odcore {
+    namespace data {
+        namespace pointcloud {
+
+            using namespace std;
+
+            /**
+             * This class decodes CompactPointCloud messages into separate
+             * arrays (structure of arrays) of floats and encodes point
+             * clouds described by a SharedPointCloud into CompactPointClouds.
+             *
+             * A CompactPointCloud holds one 16 bit value in network byte
+             * order per layer and azimuth; the layers of one azimuth are
+             * stored next to each other. Hence, the codec needs to know
+             * the vertical angle of each layer in the order in which
+             * they are stored. The sine and cosine of the vertical angles
+             * are computed once; the sine and cosine of the azimuths once
+             * per decoded message.
+             *
+             * Byte swapping, masking of the intensity bits, scaling, and
+             * the conversion from polar to Cartesian coordinates are done
+             * with SSE2 or AVX2 instructions where available.
+             *
+             * @code
+             * vector<float> verticalAngles; // One entry per layer in degrees.
+             * CompactPointCloudCodec codec(verticalAngles);
+             * vector<float> x, y, z, intensity;
+             * const uint32_t numberOfPoints = codec.decode(cpc, x, y, z, intensity);
+             * const vector<float> &distances = codec.getDistances();
+             * @endcode
+             */
+            class OPENDAVINCI_API CompactPointCloudCodec {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    CompactPointCloudCodec(const CompactPointCloudCodec &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    CompactPointCloudCodec& operator=(const CompactPointCloudCodec &);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param verticalAngles Vertical angle in degrees for each layer in the order of the stored distances.
+                     */
+                    CompactPointCloudCodec(const vector<float> &verticalAngles);
+
+                    virtual ~CompactPointCloudCodec();
+
+                    /**
+                     * @return Number of layers per azimuth.
+                     */
+                    uint32_t getNumberOfLayers() const;
+
+                    /**
+                     * This method specifies whether the distances are stored
+                     * in network byte order (default). Recordings created
+                     * before 2017 store them in host byte order.
+                     *
+                     * @param networkByteOrder true if the distances are stored in network byte order.
+                     */
+                    void setNetworkByteOrder(const bool &networkByteOrder);
+
+                    /**
+                     * This method decodes the distances in meters and the
+                     * intensity levels (0 .. 2^numberOfBitsForIntensity - 1)
+                     * of all points.
+                     *
+                     * @param cpc CompactPointCloud to decode.
+                     * @param distance Distances in meters.
+                     * @param intensity Intensity levels.
+                     * @return Number of decoded points.
+                     */
+                    uint32_t decodeDistances(const CompactPointCloud &cpc, vector<float> &distance, vector<float> &intensity) const;
+
+                    /**
+                     * This method decodes all points of the given
+                     * CompactPointCloud into Cartesian coordinates. Points
+                     * without a reflection (distance 0) are located at the
+                     * origin. The distances are available via getDistances()
+                     * afterwards.
+                     *
+                     * @param cpc CompactPointCloud to decode.
+                     * @param x x coordinates.
+                     * @param y y coordinates.
+                     * @param z z coordinates.
+                     * @param intensity Intensity levels.
+                     * @return Number of decoded points.
+                     */
+                    uint32_t decode(const CompactPointCloud &cpc, vector<float> &x, vector<float> &y, vector<float> &z, vector<float> &intensity);
+
+                    /**
+                     * @return Distances in meters of the points decoded by the last call to decode().
+                     */
+                    const vector<float>& getDistances() const;
+
+                    /**
+                     * This method encodes a point cloud with four float
+                     * components per point as described by the given
+                     * SharedPointCloud. The points must be ordered by
+                     * azimuth and by layer within each azimuth. For
+                     * SharedPointCloud::POLAR_INTENSITY, the components are
+                     * distance, azimuth, vertical angle, and intensity; for
+                     * SharedPointCloud::XYZ_INTENSITY, they are x, y, z, and
+                     * intensity. Intensities range from 0 to 255 and are
+                     * reduced to numberOfBitsForIntensity bits.
+                     *
+                     * @param spc Description of the point cloud.
+                     * @param points Point cloud data (e.g. from a shared memory).
+                     * @param distanceEncoding Resolution for the distances.
+                     * @param numberOfBitsForIntensity Number of bits for the intensity (0 .. 8).
+                     * @param intensityPlacement Placement of the intensity bits.
+                     * @return CompactPointCloud; it is empty if the point cloud has an unsupported layout.
+                     */
+                    CompactPointCloud encode(const SharedPointCloud &spc, const float *points, const CompactPointCloud::DISTANCE_ENCODING &distanceEncoding, const uint8_t &numberOfBitsForIntensity, const CompactPointCloud::INTENSITY_PLACEMENT &intensityPlacement) const;
+
+                private:
+                    /**
+                     * This method converts the decoded distances into
+                     * Cartesian coordinates.
+                     *
+                     * @param startAzimuth Azimuth of the first point in degrees.
+                     * @param azimuthIncrement Azimuth increment in degrees.
+                     * @param numberOfAzimuths Number of azimuths.
+                     * @param x x coordinates.
+                     * @param y y coordinates.
+                     * @param z z coordinates.
+                     */
+                    void toCartesian(const float &startAzimuth, const float &azimuthIncrement, const uint32_t &numberOfAzimuths, float *x, float *y, float *z);
+
+                private:
+                    uint32_t m_numberOfLayers;
+                    bool m_networkByteOrder;
+                    vector<float> m_sinVertical;
+                    vector<float> m_cosVertical;
+                    vector<float> m_sinAzimuth;
+                    vector<float> m_cosAzimuth;
+                    vector<float> m_distances;
+            };
+
+        }
+    }
+} // odcore::data::pointcloud
+
+#endif /*OPENDAVINCI_CORE_DATA_POINTCLOUD_COMPACTPOINTCLOUDCODEC_H_*/
@@ -123,6 +123,7 @@ namespace odcore {
                     SupercomponentStateListener* m_listener;
 
                     odcore::base::Condition m_pulseCondition;
+                    bool m_hasReceivedPulse;
                     odcore::base::Mutex m_pulseMessageMutex;
                     odcore::data::dmcp::PulseMessage m_pulseMessage;
             };
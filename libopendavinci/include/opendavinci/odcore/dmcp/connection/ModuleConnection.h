@@ -100,12 +100,53 @@ namespace odcore {
                      */
                     vector<odcore::data::Container> pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout);
 
+                    /**
+                     * This method sends a pulse to the connected module
+                     * without waiting for its ACK confirmation. It allows
+                     * pulsing several modules before waiting for all of them
+                     * using wait_for_pulse_ack(...).
+                     *
+                     * @param pm Pulse to be sent.
+                     */
+                    void send_pulse_ack(const odcore::data::dmcp::PulseMessage &pm);
+
+                    /**
+                     * This method waits for the ACK confirmation to a pulse
+                     * sent by send_pulse_ack(...).
+                     *
+                     * @param timeout Timeout in milliseconds to wait for the ACK message.
+                     */
+                    void wait_for_pulse_ack(const uint32_t &timeout);
+
+                    /**
+                     * This method sends a pulse to the connected module
+                     * without waiting for its ACK confirmation including
+                     * the module's containers (cf. send_pulse_ack(...)).
+                     *
+                     * @param pm Pulse to be sent.
+                     */
+                    void send_pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm);
+
+                    /**
+                     * This method waits for the ACK confirmation to a pulse
+                     * sent by send_pulse_ack_containers(...).
+                     *
+                     * @param timeout Timeout in milliseconds to wait for the ACK message.
+                     * @return Containers to be transferred to supercomponent.
+                     */
+                    vector<odcore::data::Container> wait_for_pulse_ack_containers(const uint32_t &timeout);
+
                     const odcore::data::dmcp::ModuleDescriptor getModuleDescriptor() const;
 
                 protected:
                     virtual void nextContainer(odcore::data::Container &c);
                     virtual void handleConnectionError();
 
+                    /**
+                     * @return true if the connection to the module was lost.
+                     */
+                    bool isConnectionLost();
+
                     std::shared_ptr<odcore::io::Connection> m_connection;
                     ModuleConfigurationProvider& m_configurationProvider;
 
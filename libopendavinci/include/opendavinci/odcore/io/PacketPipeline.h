@@ -20,10 +20,11 @@
 #ifndef OPENDAVINCI_CORE_IO_PACKETPIPELINE_H_
 #define OPENDAVINCI_CORE_IO_PACKETPIPELINE_H_
 
-#include <queue>
+#include <atomic>
 
 #include "opendavinci/odcore/base/Condition.h"
 #include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/SPSCRingBuffer.h"
 #include "opendavinci/odcore/base/Service.h"
 #include "opendavinci/odcore/io/PacketListener.h"
 #include "opendavinci/odcore/io/PacketObserver.h"
@@ -37,8 +38,24 @@ namespace odcore {
         /**
          * This class distributes odcore::data::Packets using an asynchronous pipeline
          * to decouple the processing of the data when invoking a PacketListener at higher levels.
+         *
+         * Packets are passed through a bounded lock-free ring buffer; hence,
+         * nextPacket(...) must be called from one thread only (e.g. a
+         * UDPReceiver's receiving thread). If the ring buffer is full, the
+         * OVERFLOW_POLICY decides whether the new packet is dropped or
+         * whether the caller waits for the pipeline to catch up.
          */
         class PacketPipeline : public odcore::base::Service, public PacketObserver, public PacketListener {
+            public:
+                enum OVERFLOW_POLICY {
+                    DROP_NEWEST,    // Drop the packet to be added.
+                    BLOCK           // Sleep until the pipeline has processed older packets.
+                };
+
+                enum {
+                    DEFAULT_CAPACITY = 4096
+                };
+
             private:
                 /**
                  * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -55,7 +72,13 @@ namespace odcore {
                 PacketPipeline& operator=(const PacketPipeline &);
 
             public:
-                PacketPipeline();
+                /**
+                 * Constructor.
+                 *
+                 * @param capacity Maximum number of packets waiting to be processed.
+                 * @param policy Behavior when capacity packets are waiting already.
+                 */
+                PacketPipeline(const uint32_t &capacity = DEFAULT_CAPACITY, const OVERFLOW_POLICY &policy = BLOCK);
 
                 virtual ~PacketPipeline();
 
@@ -63,6 +86,22 @@ namespace odcore {
 
                 virtual void nextPacket(const odcore::data::Packet &p);
 
+                /**
+                 * This method returns the number of packets that were
+                 * dropped because the pipeline was full.
+                 *
+                 * @return Number of dropped packets.
+                 */
+                uint64_t getNumberOfDroppedPackets() const;
+
+                /**
+                 * This method returns the maximum number of packets that
+                 * were waiting to be processed at the same time.
+                 *
+                 * @return Maximum queue depth.
+                 */
+                uint32_t getMaximumQueueDepth() const;
+
             private:
                 virtual void beforeStop();
 
@@ -74,9 +113,17 @@ namespace odcore {
                 void processQueue();
 
             private:
+                odcore::base::SPSCRingBuffer<odcore::data::Packet> m_queue;
+                const OVERFLOW_POLICY m_policy;
+
                 odcore::base::Condition m_queueCondition;
-                odcore::base::Mutex m_queueMutex;
-                queue<odcore::data::Packet> m_queue;
+                std::atomic<bool> m_consumerWaiting;
+
+                odcore::base::Condition m_spaceCondition;
+                std::atomic<bool> m_producerWaiting;
+
+                std::atomic<uint64_t> m_droppedPackets;
+                std::atomic<uint32_t> m_maximumQueueDepth;
 
                 odcore::base::Mutex m_packetListenerMutex;
                 PacketListener *m_packetListener;
@@ -0,0 +1,90 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_IO_READONLYSTREAMBUFFER_H_
+#define OPENDAVINCI_CORE_IO_READONLYSTREAMBUFFER_H_
+
+#include <streambuf>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace io {
+
+        using namespace std;
+
+        /**
+         * This class provides a read-only std::streambuf view onto an
+         * existing contiguous memory area without copying it. It can be
+         * used to let an istream consume data owned by somebody else:
+         *
+         * @code
+         * const string data = ...;
+         * ReadOnlyStreamBuffer buffer(data.data(), data.size());
+         * istream in(&buffer);
+         * in >> mySerializable;
+         * @endcode
+         *
+         * The memory area must outlive this stream buffer.
+         */
+        class OPENDAVINCI_API ReadOnlyStreamBuffer : public streambuf {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                ReadOnlyStreamBuffer(const ReadOnlyStreamBuffer &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                ReadOnlyStreamBuffer& operator=(const ReadOnlyStreamBuffer &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param data Pointer to the first byte to be read.
+                 * @param size Number of readable bytes.
+                 */
+                ReadOnlyStreamBuffer(const char *data, const size_t &size);
+
+                virtual ~ReadOnlyStreamBuffer();
+
+                /**
+                 * This method returns the position of the next byte to
+                 * be read; together with in_avail() it allows consumers
+                 * to access the remaining bytes without copying them.
+                 *
+                 * @return Pointer to the next byte to be read.
+                 */
+                const char* getCurrentPosition() const;
+
+            protected:
+                virtual pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which = ios_base::in);
+                virtual pos_type seekpos(pos_type pos, ios_base::openmode which = ios_base::in);
+        };
+
+    }
+} // odcore::io
+
+#endif /*OPENDAVINCI_CORE_IO_READONLYSTREAMBUFFER_H_*/
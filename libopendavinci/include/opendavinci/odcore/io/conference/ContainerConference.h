@@ -20,6 +20,10 @@
 #ifndef OPENDAVINCI_CORE_IO_CONFERENCE_CONTAINERCONFERENCE_H_
 #define OPENDAVINCI_CORE_IO_CONFERENCE_CONTAINERCONFERENCE_H_
 
+#include <map>
+#include <set>
+#include <vector>
+
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/io/conference/ContainerObserver.h"
@@ -39,6 +43,17 @@ class ContainerListener;
              * This class provides an interface for a ContainerConference.
              * A ContainerConference is either a UDPMultiCastContainerConference
              * of a pure virtual conference as needed by simulation.
+             *
+             * By default, every container is distributed to the registered
+             * ContainerListener. After adding subscriptions, only containers
+             * of the subscribed data types (and optionally sender stamps)
+             * are distributed; network-based conferences discard all others
+             * before decoding them:
+             *
+             * @code
+             * getConference().addSubscription(odcore::data::TimeStamp::ID());
+             * getConference().addSubscription(opendlv::proxy::V2vRequest::ID(), 2);
+             * @endcode
              */
             class OPENDAVINCI_API ContainerConference : public ContainerObserver {
                 private:
@@ -81,6 +96,17 @@ class ContainerListener;
                      */
                     virtual void send(odcore::data::Container &container) const = 0;
 
+                    /**
+                     * This method sends several containers to this conference.
+                     * The receivers get the containers in the given order.
+                     * Network-based conferences pack as many containers as
+                     * possible into one packet instead of sending them one
+                     * by one.
+                     *
+                     * @param containers Containers to be sent.
+                     */
+                    virtual void sendBatch(vector<odcore::data::Container> &containers) const;
+
                     /**
                      * This method sets a user-defined attribute to be used for
                      * stamping any container that is sent.
@@ -97,6 +123,39 @@ class ContainerListener;
                      */
                     uint32_t getSenderStamp() const;
 
+                    /**
+                     * This method subscribes to all containers of the given
+                     * data type regardless of their sender stamps.
+                     *
+                     * @param dataType Data type to subscribe to.
+                     */
+                    void addSubscription(const int32_t &dataType);
+
+                    /**
+                     * This method subscribes to the containers of the given
+                     * data type having the given sender stamp.
+                     *
+                     * @param dataType Data type to subscribe to.
+                     * @param senderStamp Sender stamp to subscribe to.
+                     */
+                    void addSubscription(const int32_t &dataType, const uint32_t &senderStamp);
+
+                    /**
+                     * This method removes all subscriptions so that all
+                     * containers are distributed again.
+                     */
+                    void clearSubscriptions();
+
+                    /**
+                     * This method returns true if containers with the given
+                     * data type and sender stamp shall be distributed.
+                     *
+                     * @param dataType Data type of the container.
+                     * @param senderStamp Sender stamp of the container.
+                     * @return true if the container shall be distributed.
+                     */
+                    bool isSubscribedTo(const int32_t &dataType, const uint32_t &senderStamp) const;
+
                 protected:
                     /**
                      * This method can be called from any subclass to distribute
@@ -113,12 +172,27 @@ class ContainerListener;
                      */
                     bool hasContainerListener() const;
 
+                    /**
+                     * This method can be called from any subclass to check
+                     * whether an encoded container shall be decoded and
+                     * distributed at all.
+                     *
+                     * @param buffer Wire representation of the container.
+                     * @param size Number of valid bytes in the buffer.
+                     * @return true if the container shall be decoded.
+                     */
+                    bool isSubscribedTo(const char *buffer, const uint32_t &size) const;
+
                 private:
                     mutable base::Mutex m_containerListenerMutex;
                     ContainerListener *m_containerListener;
 
                     mutable base::Mutex m_senderStampMutex;
                     uint32_t m_senderStamp;
+
+                    mutable base::Mutex m_subscriptionsMutex;
+                    // Subscribed data types mapped to their sender stamps; an empty set accepts all sender stamps.
+                    map<int32_t, set<uint32_t> > m_subscriptions;
             };
 
         }
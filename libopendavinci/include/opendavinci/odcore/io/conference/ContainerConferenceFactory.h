@@ -43,6 +43,14 @@ class ContainerConference;
                         MULTICAST_PORT = 12175 // Mariposa Rd, Victorville.
                     };
 
+                    /**
+                     * Transports available for ContainerConferences.
+                     */
+                    enum TRANSPORT {
+                        UDP_MULTICAST,  // Modules may run on different hosts.
+                        SHARED_MEMORY   // All modules run on the same host.
+                    };
+
                 private:
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -84,6 +92,21 @@ class ContainerConference;
                      */
                     virtual std::shared_ptr<ContainerConference> getContainerConference(const string &address, const uint32_t &port = ContainerConferenceFactory::MULTICAST_PORT);
 
+                    /**
+                     * This method sets the transport to be used for
+                     * ContainerConferences created afterwards.
+                     *
+                     * @param transport Transport to be used.
+                     */
+                    void setTransport(const TRANSPORT &transport);
+
+                    /**
+                     * This method returns the transport used for ContainerConferences.
+                     *
+                     * @return Transport to be used.
+                     */
+                    TRANSPORT getTransport() const;
+
                 protected:
                     /**
                      * This method sets the singleton pointer.
@@ -95,6 +118,8 @@ class ContainerConference;
                 private:
                     static base::Mutex m_singletonMutex;
                     static ContainerConferenceFactory* m_singleton;
+
+                    TRANSPORT m_transport;
             };
 
         }
@@ -0,0 +1,200 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_IO_CONFERENCE_SHAREDMEMORYCONTAINERCONFERENCE_H_
+#define OPENDAVINCI_CORE_IO_CONFERENCE_SHAREDMEMORYCONTAINERCONFERENCE_H_
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Service.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/io/conference/ContainerConference.h"
+
+namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace wrapper { class SharedMemory; } }
+
+class SharedMemoryContainerConferenceTest;
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+
+            /**
+             * This class encapsulates a conference about containers for
+             * modules running on the same host. Instead of UDP multicast,
+             * all participants share a ring of slots in a shared memory
+             * segment that is named after the conference's address and port.
+             *
+             * Senders claim the next slot with an atomic counter and encode
+             * the container directly into it; every participant follows the
+             * ring with its own read cursor. Like with UDP multicast, a
+             * participant that falls behind by more than the ring's capacity
+             * loses the overwritten containers and containers sent by a
+             * participant are not delivered back to itself. On Linux, idle
+             * receivers sleep on a futex in the shared segment; on other
+             * platforms, they poll.
+             *
+             * The first participant creates the segment and all further
+             * participants attach to it; hence, the longest running module
+             * (usually odsupercomponent) should join first.
+             */
+            class OPENDAVINCI_API SharedMemoryContainerConference : public ContainerConference, public odcore::base::Service {
+                private:
+                    friend class ContainerConferenceFactory;
+                    friend class ::SharedMemoryContainerConferenceTest;
+
+                public:
+                    enum {
+                        /**
+                         * Number of slots in the ring.
+                         */
+                        NUMBER_OF_SLOTS = 256,
+                        /**
+                         * Maximum size of an encoded container (equals a UDP datagram).
+                         */
+                        MAX_CONTAINER_SIZE = 65507
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    SharedMemoryContainerConference(const SharedMemoryContainerConference &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    SharedMemoryContainerConference& operator=(const SharedMemoryContainerConference &);
+
+                protected:
+                    /**
+                     * Constructor.
+                     *
+                     * @param address Use address for joining.
+                     * @param port Use port for joining.
+                     * @throws ConferenceException if the conference could not be created.
+                     */
+                    SharedMemoryContainerConference(const string &address, const uint32_t &port) throw (exceptions::ConferenceException);
+
+                public:
+                    virtual ~SharedMemoryContainerConference();
+
+                    virtual void send(odcore::data::Container &container) const;
+
+                    /**
+                     * This method returns the number of containers that were
+                     * overwritten before this participant could read them.
+                     *
+                     * @return Number of lost containers.
+                     */
+                    uint64_t getNumberOfLostContainers() const;
+
+                    /**
+                     * This method returns the number of containers that this
+                     * participant dropped because their slot was still being
+                     * written by a stalled sender.
+                     *
+                     * @return Number of dropped containers.
+                     */
+                    uint64_t getNumberOfDroppedContainers() const;
+
+                    /**
+                     * This method returns the name of the shared memory
+                     * segment used for the given conference.
+                     *
+                     * @param address Address of the conference.
+                     * @param port Port of the conference.
+                     * @return Name of the shared memory segment.
+                     */
+                    static const string getSharedMemoryName(const string &address, const uint32_t &port);
+
+                private:
+                    virtual void beforeStop();
+
+                    virtual void run();
+
+                    /**
+                     * This method claims the next slot of the ring.
+                     *
+                     * @param sequence Sequence number of the claimed slot.
+                     * @return true if the slot could be claimed.
+                     */
+                    bool claimSlot(uint64_t &sequence) const;
+
+                    /**
+                     * This method publishes a slot claimed before.
+                     *
+                     * @param sequence Sequence number of the claimed slot.
+                     * @return true if the slot was published.
+                     */
+                    bool publishSlot(const uint64_t &sequence) const;
+
+                    /**
+                     * This method counts a dropped container and marks it
+                     * to be skipped by the receivers.
+                     *
+                     * @param sequence Sequence number of the dropped container.
+                     */
+                    void dropSlot(const uint64_t &sequence) const;
+
+                    /**
+                     * This method distributes all containers that are
+                     * available in the ring.
+                     *
+                     * @return true if at least one slot was consumed.
+                     */
+                    bool readAvailableContainers();
+
+                    /**
+                     * This method wakes up all receivers waiting for new containers.
+                     */
+                    void notifyReceivers() const;
+
+                    /**
+                     * This method waits until new containers might be available.
+                     *
+                     * @param lastNotification Notification counter observed before checking the ring.
+                     */
+                    void waitForContainers(const uint32_t &lastNotification);
+
+                private:
+                    std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                    char *m_ring;
+                    uint32_t m_participantID;
+                    uint64_t m_readCursor;
+                    uint64_t m_lostContainers;
+                    mutable std::atomic<uint64_t> m_droppedContainers;
+                    vector<char> m_buffer;
+            };
+
+        }
+    }
+} // odcore::io::conference
+
+#endif /*OPENDAVINCI_CORE_IO_CONFERENCE_SHAREDMEMORYCONTAINERCONFERENCE_H_*/
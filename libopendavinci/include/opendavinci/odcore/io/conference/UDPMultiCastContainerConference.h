@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
@@ -49,6 +50,16 @@ namespace odcore {
                 private:
                     friend class ContainerConferenceFactory;
 
+                public:
+                    enum {
+                        // Ethernet MTU minus IPv4 and UDP headers; containers sent by sendBatch(...) are packed up to this size.
+                        MAX_DATAGRAM_SIZE = 1472,
+                        // Default number of datagrams sent by sendBatch(...) at once before pausing.
+                        DATAGRAMS_PER_BURST = 32,
+                        // Default pause in microseconds between two bursts sent by sendBatch(...).
+                        PAUSE_BETWEEN_BURSTS = 500
+                    };
+
                 private:
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -81,9 +92,43 @@ namespace odcore {
 
                     virtual void send(odcore::data::Container &container) const;
 
+                    virtual void sendBatch(vector<odcore::data::Container> &containers) const;
+
+                    /**
+                     * This method configures how sendBatch(...) paces its
+                     * datagrams: At most datagramsPerBurst datagrams are
+                     * handed to the socket at once, followed by a pause to
+                     * let slow receivers drain their socket buffers.
+                     *
+                     * @param datagramsPerBurst Number of datagrams per burst (0 sends all datagrams at once).
+                     * @param pauseBetweenBursts Pause in microseconds between two bursts.
+                     */
+                    void setBatchPacing(const uint32_t &datagramsPerBurst, const uint32_t &pauseBetweenBursts);
+
+                private:
+                    /**
+                     * This method sends a burst of datagrams and clears
+                     * the list afterwards. Every burst except for the
+                     * first one is preceded by the configured pause.
+                     *
+                     * @param listOfDatagrams Datagrams to be sent.
+                     * @param isFirstBurst True if no burst was sent before; set to false afterwards.
+                     */
+                    void sendBurst(vector<string> &listOfDatagrams, bool &isFirstBurst) const;
+
+                    /**
+                     * This method sets the time stamps and the sender stamp
+                     * of a container to be sent.
+                     *
+                     * @param container Container to be stamped.
+                     */
+                    void stamp(odcore::data::Container &container) const;
+
                 private:
                     std::shared_ptr<odcore::io::udp::UDPSender> m_sender;
                     std::shared_ptr<odcore::io::udp::UDPReceiver> m_receiver;
+                    uint32_t m_datagramsPerBurst;
+                    uint32_t m_pauseBetweenBursts;
             };
 
         }
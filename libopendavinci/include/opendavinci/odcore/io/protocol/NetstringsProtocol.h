@@ -20,8 +20,8 @@
 #ifndef OPENDAVINCI_CORE_IO_PROTOCOL_NETSTRINGSPROTOCOL_H_
 #define OPENDAVINCI_CORE_IO_PROTOCOL_NETSTRINGSPROTOCOL_H_
 
-#include <sstream>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Mutex.h"
@@ -57,6 +57,12 @@ namespace odcore {
              * np.send(payload);
              *
              * @endcode
+             *
+             * Received data is decoded in linear time: Every byte is parsed
+             * once and the remainder of an incomplete Netstring is moved at
+             * most once to the front of the receive buffer. Netstrings that
+             * announce a payload larger than MAX_PAYLOAD_SIZE are treated as
+             * corrupted data.
              */
             class OPENDAVINCI_API NetstringsProtocol : public StringObserver, public AbstractProtocol {
                 private:
@@ -74,6 +80,11 @@ namespace odcore {
                      */
                     NetstringsProtocol& operator=(const NetstringsProtocol &);
 
+                public:
+                    enum {
+                        MAX_PAYLOAD_SIZE = 64 * 1024 * 1024
+                    };
+
                 public:
                     /**
                      * Constructor.
@@ -106,6 +117,11 @@ namespace odcore {
                 private:
                     void decodeNetstring();
 
+                    /**
+                     * This method discards all buffered data.
+                     */
+                    void resetBuffer();
+
                     /**
                      * This method is used to pass received data thread-safe
                      * to the registered StringListener.
@@ -116,7 +132,14 @@ namespace odcore {
                     StringListener *m_stringListener;
 
                     odcore::base::Mutex m_partialDataMutex;
-                    stringstream m_partialData;
+                    vector<char> m_partialData;
+                    // First byte of the next Netstring in m_partialData.
+                    uint32_t m_begin;
+                    // Length of the payload announced by the current Netstring's prefix or -1 if not yet parsed.
+                    int64_t m_lengthOfPayload;
+                    // Length of the current Netstring's prefix including ':'.
+                    uint32_t m_lengthOfPrefix;
+                    string m_payload;
             };
 
         }
@@ -20,8 +20,10 @@
 #ifndef OPENDAVINCI_CORE_IO_TCP_TCPCONNECTION_H_
 #define OPENDAVINCI_CORE_IO_TCP_TCPCONNECTION_H_
 
-#include <sstream>
+#include <atomic>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Mutex.h"
@@ -69,6 +71,23 @@ namespace odcore {
                      */
                     void send(const string &data);
 
+                    /**
+                     * This method returns the number of bytes including
+                     * the size information that were passed for sending.
+                     *
+                     * @return Number of sent bytes.
+                     */
+                    uint64_t getNumberOfSentBytes() const;
+
+                    /**
+                     * This method returns the number of bytes that were
+                     * passed for sending but are not yet transmitted by
+                     * the operating system.
+                     *
+                     * @return Number of queued bytes or 0 if unknown.
+                     */
+                    virtual uint32_t getNumberOfQueuedBytes();
+
                     /**
                      * This method registers a ConnectionListener that will be
                      * informed about connection errors.
@@ -132,6 +151,17 @@ namespace odcore {
                      */
                     virtual void sendImplementation(const string &data) = 0;
 
+                    /**
+                     * This method sends the given memory areas in their
+                     * order. Subclasses may override this method to avoid
+                     * concatenating the memory areas; the default
+                     * implementation concatenates them and calls
+                     * sendImplementation(const string&).
+                     *
+                     * @param buffers Pairs of pointer and length to be sent.
+                     */
+                    virtual void sendBuffersImplementation(const vector<pair<const char*, uint32_t> > &buffers);
+
                     /**
                      * This method is called be subclasses to invoke
                      * the connection listener.
@@ -139,8 +169,6 @@ namespace odcore {
                     void invokeConnectionListener();
 
                 private:
-                    bool hasCompleteData();
-
                     /**
                      * This method is used to pass received data thread-safe
                      * to the registered StringListener.
@@ -154,9 +182,11 @@ namespace odcore {
                     StringListener *m_stringListener;
 
                     odcore::base::Mutex m_partialDataMutex;
-                    stringstream m_partialData;
+                    vector<char> m_partialData;
+                    string m_payload;
 
                     bool m_raw;
+                    std::atomic<uint64_t> m_numberOfSentBytes;
             };
 
         }
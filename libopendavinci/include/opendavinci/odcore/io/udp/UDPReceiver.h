@@ -137,6 +137,22 @@ namespace odcore {
                      */
                     virtual void setSenderPortToIgnore(const uint16_t &portToIgnore) = 0;
 
+                    /**
+                     * This method returns the number of packets that were
+                     * dropped by the decoupling PacketPipeline.
+                     *
+                     * @return Number of dropped packets.
+                     */
+                    uint64_t getNumberOfDroppedPackets() const;
+
+                    /**
+                     * This method returns the maximum number of packets that
+                     * were waiting in the decoupling PacketPipeline.
+                     *
+                     * @return Maximum queue depth.
+                     */
+                    uint32_t getMaximumQueueDepth() const;
+
                 protected:
                     /**
                      * This method is called from deriving classes to
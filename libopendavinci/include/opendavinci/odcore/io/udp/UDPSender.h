@@ -21,6 +21,7 @@
 #define OPENDAVINCI_CORE_IO_UDP_UDPSENDER_H_
 
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 
@@ -68,6 +69,19 @@ namespace odcore {
                      */
                     virtual void send(const string &data) const = 0;
 
+                    /**
+                     * This method sends a burst of data using UDP; every
+                     * entry is sent as a separate datagram in the given
+                     * order. Implementations may send the entire burst
+                     * with fewer system calls than calling send(...)
+                     * repeatedly. As the datagrams are not paced, callers
+                     * must limit the size of a burst to not overrun the
+                     * receivers' socket buffers.
+                     *
+                     * @param listOfData Data to be sent.
+                     */
+                    virtual void sendBurst(const vector<string> &listOfData) const;
+
                     /**
                      * This method returns the port in use when sending UDP packets.
                      *
@@ -0,0 +1,110 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_SERIALIZATION_FIELDINDEX_H_
+#define OPENDAVINCI_CORE_SERIALIZATION_FIELDINDEX_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace serialization {
+
+        using namespace std;
+
+        /**
+         * This class is a flat index mapping field identifiers to the
+         * location of their encoded values inside a contiguous buffer.
+         * Entries are collected in encoding order and sorted once by
+         * calling sort(); lookups are binary searches afterwards.
+         */
+        class OPENDAVINCI_API FieldIndex {
+            public:
+                /**
+                 * Location of one encoded field.
+                 */
+                struct Entry {
+                    uint32_t m_id;
+                    uint32_t m_type;
+                    uint32_t m_offset;
+                    uint32_t m_length;
+                };
+
+            public:
+                FieldIndex();
+
+                virtual ~FieldIndex();
+
+                /**
+                 * This method removes all entries while keeping the
+                 * allocated memory for reuse.
+                 */
+                void clear();
+
+                /**
+                 * This method adds a new entry.
+                 *
+                 * @param id Field identifier.
+                 * @param type Encoding-specific type of the field.
+                 * @param offset Offset of the field's value inside the buffer.
+                 * @param length Length of the field's value.
+                 */
+                void add(const uint32_t &id, const uint32_t &type, const uint32_t &offset, const uint32_t &length);
+
+                /**
+                 * This method sorts all entries by their identifiers while
+                 * preserving the encoding order for duplicate identifiers.
+                 */
+                void sort();
+
+                /**
+                 * This method returns the first encoded entry for the given
+                 * identifier. sort() must have been called before.
+                 *
+                 * @param id Field identifier.
+                 * @return Entry or NULL if the field is not available.
+                 */
+                const Entry* findFirst(const uint32_t &id) const;
+
+                /**
+                 * This method returns the last encoded entry for the given
+                 * identifier. sort() must have been called before.
+                 *
+                 * @param id Field identifier.
+                 * @return Entry or NULL if the field is not available.
+                 */
+                const Entry* findLast(const uint32_t &id) const;
+
+                /**
+                 * @return Number of entries.
+                 */
+                uint32_t getSize() const;
+
+            private:
+                static bool lessById(const Entry &a, const Entry &b);
+
+            private:
+                vector<Entry> m_entries;
+        };
+
+    }
+} // odcore::serialization
+
+#endif /*OPENDAVINCI_CORE_SERIALIZATION_FIELDINDEX_H_*/
@@ -20,13 +20,13 @@
 #ifndef OPENDAVINCI_CORE_SERIALIZATION_PROTODESERIALIZER_H_
 #define OPENDAVINCI_CORE_SERIALIZATION_PROTODESERIALIZER_H_
 
-#include <map>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/serialization/Deserializer.h"
+#include "opendavinci/odcore/serialization/FieldIndex.h"
 #include "opendavinci/odcore/serialization/ProtoSerializer.h"
 #include "opendavinci/odcore/serialization/ProtoSerializerVisitor.h"
 
@@ -139,6 +139,12 @@ namespace odcore {
         /**
          * This class provides a deserialization to decode data
          * encoded in Google's Protobuf format.
+         *
+         * The encoded message is kept as one contiguous buffer that is
+         * either borrowed from the caller or, when reading from a stream,
+         * read en bloc. The fields are located lazily on the first read
+         * access by building a flat index of (field identifier, offset,
+         * length) tuples; values are decoded directly from memory.
          */
         class ProtoDeserializer : public Deserializer {
             private:
@@ -166,10 +172,27 @@ namespace odcore {
                  */
                 ProtoDeserializer(istream &i);
 
+                /**
+                 * Constructor.
+                 *
+                 * @param data Encoded message that must outlive this deserializer.
+                 * @param size Length of the encoded message.
+                 */
+                ProtoDeserializer(const char *data, const uint32_t &size);
+
                 virtual ~ProtoDeserializer();
 
                 virtual void deserializeDataFrom(istream &in);
 
+                /**
+                 * This method prepares this deserializer to decode the
+                 * given buffer without copying it.
+                 *
+                 * @param data Encoded message that must outlive this deserializer.
+                 * @param size Length of the encoded message.
+                 */
+                void deserializeDataFrom(const char *data, const uint32_t &size);
+
             private:
                 /**
                  * This method decodes a value from a given varint encoding.
@@ -274,9 +297,30 @@ namespace odcore {
                  */
                 uint32_t readAndValidateKey(istream &in, const uint32_t &id, const ProtoSerializer::PROTOBUF_TYPE &expectedType);
 
+                /**
+                 * This method returns the location of the given field and
+                 * builds the index of all fields on first access.
+                 *
+                 * @param id Field identifier.
+                 * @return Entry or NULL if the field is not available.
+                 */
+                const FieldIndex::Entry* findField(const uint32_t &id);
+
+                /**
+                 * This method decodes the VarInt value of the given field.
+                 *
+                 * @param id Field identifier.
+                 * @param value Decoded value; 0 if the field is not encoded as VarInt.
+                 * @return true if the field is available.
+                 */
+                bool readVarInt(const uint32_t &id, uint64_t &value);
+
             private:
-                stringstream m_buffer;
-                map<uint32_t, ProtoKeyValue> m_mapOfKeyValues;
+                vector<char> m_ownedData;
+                const char *m_data;
+                uint32_t m_size;
+                bool m_indexIsValid;
+                FieldIndex m_index;
         };
 
     }
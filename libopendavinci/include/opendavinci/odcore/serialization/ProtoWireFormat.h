@@ -0,0 +1,137 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_SERIALIZATION_PROTOWIREFORMAT_H_
+#define OPENDAVINCI_CORE_SERIALIZATION_PROTOWIREFORMAT_H_
+
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace serialization {
+
+        using namespace std;
+
+        /**
+         * This class encodes and decodes single fields in the same wire
+         * format as ProtoSerializer and ProtoDeserializer, but directly
+         * from and into memory. It is used by the serializeTo/deserializeFrom
+         * methods that odDataStructureGenerator emits for messages
+         * consisting of primitive attributes only:
+         *
+         * @code
+         * char *p = buffer;
+         * p = ProtoWireFormat::write(p, 1, m_speed);
+         * p = ProtoWireFormat::write(p, 2, m_brakeLights);
+         *
+         * const char *p = buffer;
+         * while ( (NULL != p) && (p < end) ) {
+         *     uint32_t id = 0, type = 0;
+         *     if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+         *         switch (id) {
+         *             case 1: p = ProtoWireFormat::read(p, end, type, m_speed); break;
+         *             default: p = ProtoWireFormat::skip(p, end, type);
+         *         }
+         *     }
+         * }
+         * @endcode
+         *
+         * The write methods expect a buffer large enough to hold
+         * getSize(...) bytes. The read methods return NULL if the data
+         * is malformed or truncated; a field of an unexpected type is
+         * skipped and decoded as 0 like in ProtoDeserializer.
+         */
+        class OPENDAVINCI_API ProtoWireFormat {
+            public:
+                virtual ~ProtoWireFormat() {};
+
+                static uint32_t getSize(const uint32_t &id, const bool &v);
+                static uint32_t getSize(const uint32_t &id, const char &v);
+                static uint32_t getSize(const uint32_t &id, const unsigned char &v);
+                static uint32_t getSize(const uint32_t &id, const int8_t &v);
+                static uint32_t getSize(const uint32_t &id, const int16_t &v);
+                static uint32_t getSize(const uint32_t &id, const uint16_t &v);
+                static uint32_t getSize(const uint32_t &id, const int32_t &v);
+                static uint32_t getSize(const uint32_t &id, const uint32_t &v);
+                static uint32_t getSize(const uint32_t &id, const int64_t &v);
+                static uint32_t getSize(const uint32_t &id, const uint64_t &v);
+                static uint32_t getSize(const uint32_t &id, const float &v);
+                static uint32_t getSize(const uint32_t &id, const double &v);
+                static uint32_t getSize(const uint32_t &id, const string &v);
+
+                static char* write(char *buffer, const uint32_t &id, const bool &v);
+                static char* write(char *buffer, const uint32_t &id, const char &v);
+                static char* write(char *buffer, const uint32_t &id, const unsigned char &v);
+                static char* write(char *buffer, const uint32_t &id, const int8_t &v);
+                static char* write(char *buffer, const uint32_t &id, const int16_t &v);
+                static char* write(char *buffer, const uint32_t &id, const uint16_t &v);
+                static char* write(char *buffer, const uint32_t &id, const int32_t &v);
+                static char* write(char *buffer, const uint32_t &id, const uint32_t &v);
+                static char* write(char *buffer, const uint32_t &id, const int64_t &v);
+                static char* write(char *buffer, const uint32_t &id, const uint64_t &v);
+                static char* write(char *buffer, const uint32_t &id, const float &v);
+                static char* write(char *buffer, const uint32_t &id, const double &v);
+                static char* write(char *buffer, const uint32_t &id, const string &v);
+
+                /**
+                 * This method decodes the key of the next field.
+                 *
+                 * @param begin First byte to read.
+                 * @param end Byte following the readable area.
+                 * @param id Field identifier.
+                 * @param type Protobuf wire type of the field.
+                 * @return Pointer to the field's value or NULL.
+                 */
+                static const char* readKey(const char *begin, const char *end, uint32_t &id, uint32_t &type);
+
+                /**
+                 * This method skips the value of a field.
+                 *
+                 * @param begin First byte of the value.
+                 * @param end Byte following the readable area.
+                 * @param type Protobuf wire type of the field.
+                 * @return Pointer to the next key or NULL.
+                 */
+                static const char* skip(const char *begin, const char *end, const uint32_t &type);
+
+                static const char* read(const char *begin, const char *end, const uint32_t &type, bool &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, char &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, unsigned char &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, int8_t &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, int16_t &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, uint16_t &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, int32_t &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, uint32_t &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, int64_t &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, uint64_t &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, float &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, double &v);
+                static const char* read(const char *begin, const char *end, const uint32_t &type, string &v);
+
+            private:
+                static uint32_t getVarIntFieldSize(const uint32_t &id, const uint64_t &value);
+                static char* writeVarIntField(char *buffer, const uint32_t &id, const uint64_t &value);
+                static const char* readVarInt(const char *begin, const char *end, const uint32_t &type, uint64_t &value);
+        };
+
+    }
+} // odcore::serialization
+
+#endif /*OPENDAVINCI_CORE_SERIALIZATION_PROTOWIREFORMAT_H_*/
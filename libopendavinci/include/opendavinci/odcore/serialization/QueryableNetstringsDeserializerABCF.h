@@ -20,13 +20,14 @@
 #ifndef OPENDAVINCI_CORE_SERIALIZATION_QUERYABLENETSTRINGSDESERIALIZERABCF_H_
 #define OPENDAVINCI_CORE_SERIALIZATION_QUERYABLENETSTRINGSDESERIALIZERABCF_H_
 
-#include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/serialization/Serializer.h"
 #include "opendavinci/odcore/serialization/Deserializer.h"
+#include "opendavinci/odcore/serialization/FieldIndex.h"
 
 namespace odcore {
     namespace serialization {
@@ -41,6 +42,10 @@ namespace odcore {
          *
          * '0xAB' '0xCF' 'binary length encoded as varint' 'PAYLOAD' ','
          *
+         * The payload is kept as one contiguous buffer (borrowed when the
+         * source stream is backed by a ReadOnlyStreamBuffer) and its fields
+         * are located lazily on the first read access.
+         *
          * @See Serializable
          */
         class OPENDAVINCI_API QueryableNetstringsDeserializerABCF : public Deserializer {
@@ -164,9 +169,39 @@ namespace odcore {
                  */
                 uint8_t decodeVarInt(istream& in, int64_t &value);
 
+                /**
+                 * This method returns the location of the given field and
+                 * builds the index of all fields on first access.
+                 *
+                 * @param id Field identifier.
+                 * @return Entry or NULL if the field is not available.
+                 */
+                const FieldIndex::Entry* findField(const uint32_t &id);
+
+                /**
+                 * This method decodes the unsigned varint value of the given field.
+                 *
+                 * @param id Field identifier.
+                 * @param value Decoded value.
+                 * @return true if the field is available.
+                 */
+                bool readVarUInt(const uint32_t &id, uint64_t &value);
+
+                /**
+                 * This method decodes the signed varint value of the given field.
+                 *
+                 * @param id Field identifier.
+                 * @param value Decoded value.
+                 * @return true if the field is available.
+                 */
+                bool readVarInt(const uint32_t &id, int64_t &value);
+
             private:
-                stringstream m_buffer;
-                map<uint32_t, streampos> m_values;
+                vector<char> m_ownedData;
+                const char *m_data;
+                uint32_t m_size;
+                bool m_indexIsValid;
+                FieldIndex m_index;
         };
 
     }
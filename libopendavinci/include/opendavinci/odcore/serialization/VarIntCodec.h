@@ -0,0 +1,164 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_SERIALIZATION_VARINTCODEC_H_
+#define OPENDAVINCI_CORE_SERIALIZATION_VARINTCODEC_H_
+
+#include <iostream>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace serialization {
+
+        using namespace std;
+
+        /**
+         * This class encodes and decodes unsigned integral values using
+         * the little endian base-128 encoding (VarInt) from Protobuf that
+         * is shared by the Proto and Queryable Netstrings serializers.
+         * Signed values are mapped with ZigZag encoding beforehand.
+         *
+         * Besides single values, arrays of 32 bit values can be encoded
+         * and decoded en bloc; runs of values smaller than 128 are then
+         * processed with SSE2 or AVX2 instructions where available.
+         */
+        class OPENDAVINCI_API VarIntCodec {
+            public:
+                enum {
+                    /**
+                     * Maximum number of bytes of a 64 bit value.
+                     */
+                    MAX_VARINT_SIZE = 10,
+                    /**
+                     * Maximum number of bytes of a 32 bit value.
+                     */
+                    MAX_VARINT32_SIZE = 5
+                };
+
+            public:
+                virtual ~VarIntCodec() {};
+
+                /**
+                 * This method returns the number of bytes that are
+                 * required to encode the given value.
+                 *
+                 * @param value Value to be encoded.
+                 * @return Number of bytes.
+                 */
+                static uint8_t getSize(const uint64_t &value);
+
+                /**
+                 * This method encodes the given value.
+                 *
+                 * @param buffer Destination providing at least getSize(value) bytes.
+                 * @param value Value to be encoded.
+                 * @return Number of bytes written.
+                 */
+                static uint8_t encode(char *buffer, uint64_t value);
+
+                /**
+                 * This method decodes a value.
+                 *
+                 * @param begin First byte to read.
+                 * @param end Byte following the readable area.
+                 * @param value Decoded value.
+                 * @return Number of bytes read or 0 if the VarInt is truncated or too long.
+                 */
+                static uint8_t decode(const char *begin, const char *end, uint64_t &value);
+
+                /**
+                 * This method encodes the given value to a stream.
+                 *
+                 * @param out Stream to write to.
+                 * @param value Value to be encoded.
+                 * @return Number of bytes written.
+                 */
+                static uint8_t encode(ostream &out, const uint64_t &value);
+
+                /**
+                 * This method decodes a value from a stream. If the
+                 * stream ends prematurely, its failbit and eofbit are set.
+                 *
+                 * @param in Stream to read from.
+                 * @param value Decoded value.
+                 * @return Number of bytes read.
+                 */
+                static uint8_t decode(istream &in, uint64_t &value);
+
+                /**
+                 * This method encodes an array of values.
+                 *
+                 * @param buffer Destination providing at least count * MAX_VARINT32_SIZE bytes.
+                 * @param values Values to be encoded.
+                 * @param count Number of values.
+                 * @return Number of bytes written.
+                 */
+                static uint32_t encode(char *buffer, const uint32_t *values, const uint32_t &count);
+
+                /**
+                 * This method decodes an array of values.
+                 *
+                 * @param begin First byte to read.
+                 * @param end Byte following the readable area.
+                 * @param values Destination providing at least count entries.
+                 * @param count Number of values to decode.
+                 * @return Number of bytes read or 0 if the data is truncated or malformed.
+                 */
+                static uint32_t decode(const char *begin, const char *end, uint32_t *values, const uint32_t &count);
+
+                /**
+                 * This method maps a signed value to an unsigned one
+                 * so that small absolute values result in small numbers.
+                 *
+                 * @param value Signed value.
+                 * @return ZigZag-encoded value.
+                 */
+                static uint32_t encodeZigZag32(const int32_t &value);
+
+                /**
+                 * This method reverts encodeZigZag32.
+                 *
+                 * @param value ZigZag-encoded value.
+                 * @return Signed value.
+                 */
+                static int32_t decodeZigZag32(const uint32_t &value);
+
+                /**
+                 * This method maps a signed value to an unsigned one
+                 * so that small absolute values result in small numbers.
+                 *
+                 * @param value Signed value.
+                 * @return ZigZag-encoded value.
+                 */
+                static uint64_t encodeZigZag64(const int64_t &value);
+
+                /**
+                 * This method reverts encodeZigZag64.
+                 *
+                 * @param value ZigZag-encoded value.
+                 * @return Signed value.
+                 */
+                static int64_t decodeZigZag64(const uint64_t &value);
+        };
+
+    }
+} // odcore::serialization
+
+#endif /*OPENDAVINCI_CORE_SERIALIZATION_VARINTCODEC_H_*/
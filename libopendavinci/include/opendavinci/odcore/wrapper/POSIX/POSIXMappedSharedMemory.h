@@ -0,0 +1,140 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMAPPEDSHAREDMEMORY_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMAPPEDSHAREDMEMORY_H_
+
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryOptions.h"
+#include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
+
+namespace odcore { namespace wrapper { template <odcore::wrapper::SystemLibraryProducts product> class SharedMemoryFactoryWorker; } }
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            /**
+             * This class implements a shared memory using shm_open and
+             * mmap. In contrast to POSIXSharedMemory, the size and a
+             * process-shared mutex are stored in a header at the beginning
+             * of the mapping. Thus, attaching needs only one shm_open and
+             * one mmap and no separate semaphore. On Linux, the mutex is
+             * robust: If a process dies while holding it, the next process
+             * calling lock() takes it over.
+             *
+             * The name is only shortened by a hash when it exceeds NAME_MAX.
+             *
+             * @See SharedMemory, SharedMemoryOptions.
+             */
+            class POSIXMappedSharedMemory : public SharedMemory {
+                private:
+                    friend class SharedMemoryFactoryWorker<SystemLibraryPosix>;
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Name of the shared memory.
+                     * @param size Create a new shared memory with the given size.
+                     * @param options Options for placing the new shared memory.
+                     */
+                    POSIXMappedSharedMemory(const string &name, const uint32_t &size, const SharedMemoryOptions &options);
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Attach to an already existing shared memory.
+                     */
+                    POSIXMappedSharedMemory(const string &name);
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXMappedSharedMemory(const POSIXMappedSharedMemory &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXMappedSharedMemory& operator=(const POSIXMappedSharedMemory &);
+
+                public:
+                    virtual ~POSIXMappedSharedMemory();
+
+                    virtual bool isValid() const;
+
+                    virtual const string getName() const;
+
+                    virtual void lock();
+
+                    virtual void unlock();
+
+                    virtual void* getSharedMemory() const;
+
+                    virtual uint32_t getSize() const;
+
+                    /**
+                     * This method returns the name that is passed to
+                     * shm_open for the given shared memory.
+                     *
+                     * @param name Name of the shared memory.
+                     * @return Name for shm_open.
+                     */
+                    static const string getInternalName(const string &name);
+
+                    /**
+                     * This method removes a (stale) memory-mapped shared memory
+                     * with the given name so that it cannot be attached anymore.
+                     *
+                     * @param name Name of the shared memory.
+                     */
+                    static void remove(const string &name);
+
+                private:
+                    /**
+                     * This method applies the page related options to the mapping.
+                     *
+                     * @param options Options to apply.
+                     */
+                    void applyOptions(const SharedMemoryOptions &options);
+
+                private:
+                    string m_name;
+                    string m_internalName;
+                    bool m_releaseSharedMemory;
+                    char *m_mapping;
+                    uint64_t m_mappingSize;
+                    uint32_t m_size;
+            };
+
+        }
+    }
+} // odcore::wrapper::POSIX
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMAPPEDSHAREDMEMORY_H_*/
@@ -0,0 +1,204 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXREACTOR_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXREACTOR_H_
+
+#include <pthread.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/wrapper/Runnable.h"
+
+namespace odcore { namespace wrapper { class Thread; } }
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            /**
+             * This interface is implemented by classes that want to be
+             * notified by the POSIXReactor about readable file descriptors.
+             */
+            class OPENDAVINCI_API POSIXReactorHandler {
+                public:
+                    virtual ~POSIXReactorHandler();
+
+                    /**
+                     * This method is called from one of the reactor's threads
+                     * when the registered file descriptor is readable. It is
+                     * never called concurrently for the same file descriptor.
+                     *
+                     * @return false if the file descriptor shall not be watched anymore.
+                     */
+                    virtual bool handleReadable() = 0;
+
+                    /**
+                     * This method is called when the reactor is disabled while
+                     * the file descriptor is still registered. The registration
+                     * is dropped afterwards; thus, the handler needs to watch
+                     * its file descriptor on its own from now on.
+                     */
+                    virtual void handleDisabled() = 0;
+            };
+
+            /**
+             * This class realizes an epoll-based I/O reactor: A fixed number
+             * of threads waits for all registered file descriptors instead of
+             * having one thread with a select() loop per socket. The reactor
+             * is opt-in; it is started either programmatically or by setting
+             * the environment variable OPENDAVINCI_REACTOR_THREADS to the
+             * number of threads to be used. If it is not running, sockets
+             * fall back to their own receiving threads.
+             *
+             * The reactor is only available on Linux.
+             *
+             * @code
+             * POSIXReactor &reactor = POSIXReactor::getInstance();
+             * if (reactor.isEnabled() && reactor.add(fd, handler)) {
+             *     ...
+             *     // Returns after a running handleReadable() call has finished.
+             *     reactor.remove(fd);
+             * }
+             * @endcode
+             */
+            class OPENDAVINCI_API POSIXReactor : public Runnable {
+                private:
+                    enum {
+                        MAX_EVENTS = 64
+                    };
+
+                    /**
+                     * Registered file descriptor.
+                     */
+                    struct Registration {
+                        Registration();
+
+                        POSIXReactorHandler *m_handler;
+                        uint64_t m_id;
+                        bool m_busy;
+                        bool m_removed;
+                        pthread_t m_thread;
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXReactor(const POSIXReactor &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXReactor& operator=(const POSIXReactor &);
+
+                    POSIXReactor();
+
+                public:
+                    virtual ~POSIXReactor();
+
+                    /**
+                     * This method returns the process-wide reactor.
+                     *
+                     * @return Reactor.
+                     */
+                    static POSIXReactor& getInstance();
+
+                    /**
+                     * This method starts the reactor's threads.
+                     *
+                     * @param numberOfThreads Number of threads waiting for events.
+                     * @return true if the reactor is running.
+                     */
+                    bool enable(const uint32_t &numberOfThreads);
+
+                    /**
+                     * This method stops the reactor's threads. The handlers
+                     * of all registered file descriptors are notified by
+                     * handleDisabled() to continue with their own threads.
+                     */
+                    void disable();
+
+                    /**
+                     * @return true if the reactor accepts registrations.
+                     */
+                    bool isEnabled();
+
+                    /**
+                     * This method registers a file descriptor.
+                     *
+                     * @param fd File descriptor to be watched for reading.
+                     * @param handler Handler to be called.
+                     * @return true if the file descriptor was registered.
+                     */
+                    bool add(const int32_t &fd, POSIXReactorHandler &handler);
+
+                    /**
+                     * This method unregisters a file descriptor. When it
+                     * returns, the file descriptor's handler is not called
+                     * anymore unless remove() is called from the handler
+                     * itself.
+                     *
+                     * @param fd File descriptor to be removed.
+                     */
+                    void remove(const int32_t &fd);
+
+                    virtual bool isRunning();
+
+                    virtual void run();
+
+                private:
+                    /**
+                     * This method calls the handler for a readable file
+                     * descriptor and re-arms it afterwards.
+                     *
+                     * @param fd Readable file descriptor.
+                     */
+                    void dispatch(const int32_t &fd);
+
+                private:
+                    std::mutex m_registrationsMutex;
+                    std::condition_variable m_handlerFinished;
+                    map<int32_t, Registration> m_registrations;
+                    uint64_t m_nextId;
+
+                    std::mutex m_stateMutex;
+                    int32_t m_epollFD;
+                    int32_t m_wakeupFD;
+                    std::atomic<bool> m_running;
+                    vector<std::shared_ptr<Thread> > m_threads;
+            };
+
+        }
+    }
+} // odcore::wrapper::POSIX
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXREACTOR_H_*/
@@ -23,6 +23,7 @@
 #include "opendavinci/odcore/opendavinci.h"
 
 #include "opendavinci/odcore/wrapper/SharedMemoryFactoryWorker.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXMappedSharedMemory.h"
 #include "opendavinci/odcore/wrapper/POSIX/POSIXSharedMemory.h"
 
 namespace odcore {
@@ -32,12 +33,22 @@ namespace odcore {
 
         template <> class OPENDAVINCI_API SharedMemoryFactoryWorker<SystemLibraryPosix> {
             public:
-                static std::shared_ptr<SharedMemory> createSharedMemory(const string &name, const uint32_t &size) {
+                static std::shared_ptr<SharedMemory> createSharedMemory(const string &name, const uint32_t &size, const SharedMemoryOptions &options) {
+                    if (options.m_memoryMapped) {
+                        return std::shared_ptr<SharedMemory>(new POSIX::POSIXMappedSharedMemory(name, size, options));
+                    }
+
+                    // Attaching prefers memory-mapped shared memory; hence, remove a stale one with this name.
+                    POSIX::POSIXMappedSharedMemory::remove(name);
                     return std::shared_ptr<SharedMemory>(new POSIX::POSIXSharedMemory(name, size));
                 };
 
                 static std::shared_ptr<SharedMemory> attachToSharedMemory(const string &name) {
-                    return std::shared_ptr<SharedMemory>(new POSIX::POSIXSharedMemory(name));
+                    std::shared_ptr<SharedMemory> sharedMemory(new POSIX::POSIXMappedSharedMemory(name));
+                    if (!sharedMemory->isValid()) {
+                        sharedMemory = std::shared_ptr<SharedMemory>(new POSIX::POSIXSharedMemory(name));
+                    }
+                    return sharedMemory;
                 };
         };
 
@@ -20,11 +20,13 @@
 #ifndef OPENDAVINCI_CORE_WRAPPER_POSIXTCPACCEPTOR_H_
 #define OPENDAVINCI_CORE_WRAPPER_POSIXTCPACCEPTOR_H_
 
+#include <atomic>
 #include <memory>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/io/tcp/TCPAcceptor.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
 
 namespace odcore { namespace io { namespace tcp { class TCPAcceptorListener; } } }
 namespace odcore { namespace io { namespace tcp { class TCPConnection; } } }
@@ -37,7 +39,7 @@ namespace odcore {
 
             using namespace std;
 
-            class POSIXTCPAcceptor : public odcore::io::tcp::TCPAcceptor, public Runnable {
+            class POSIXTCPAcceptor : public odcore::io::tcp::TCPAcceptor, public Runnable, public POSIXReactorHandler {
                 private:
                     static const int32_t BACKLOG = 100;
 
@@ -68,10 +70,20 @@ namespace odcore {
                     virtual bool isRunning();
                     virtual void run();
 
+                    virtual bool handleReadable();
+
+                    virtual void handleDisabled();
+
                 protected:
                     void invokeAcceptorListener(std::shared_ptr<odcore::io::tcp::TCPConnection> connection);
 
+                    /**
+                     * This method accepts a pending connection.
+                     */
+                    void acceptConnection();
+
                     unique_ptr<Thread> m_thread;
+                    std::atomic<bool> m_registeredAtReactor;
 
                     unique_ptr<Mutex> m_listenerMutex;
                     odcore::io::tcp::TCPAcceptorListener* m_listener;
@@ -20,12 +20,14 @@
 #ifndef OPENDAVINCI_CORE_WRAPPER_POSIXTCPCONNECTION_H_
 #define OPENDAVINCI_CORE_WRAPPER_POSIXTCPCONNECTION_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/io/tcp/TCPConnection.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
 
 namespace odcore { namespace wrapper { class Mutex; } }
 namespace odcore { namespace wrapper { class Thread; } }
@@ -36,7 +38,11 @@ namespace odcore {
 
             using namespace std;
 
-            class POSIXTCPConnection : public odcore::io::tcp::TCPConnection, public Runnable {
+            /**
+             * This class realizes a TCP connection. Incoming data is either
+             * received by its own thread or, if enabled, by the POSIXReactor.
+             */
+            class POSIXTCPConnection : public odcore::io::tcp::TCPConnection, public Runnable, public POSIXReactorHandler {
                 private:
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -61,16 +67,38 @@ namespace odcore {
 
                     virtual void sendImplementation(const std::string& data);
 
+                    virtual void sendBuffersImplementation(const vector<pair<const char*, uint32_t> > &buffers);
+
+                    virtual uint32_t getNumberOfQueuedBytes();
+
                     virtual void start();
                     virtual void stop();
 
                     virtual bool isRunning();
                     virtual void run();
 
+                    virtual bool handleReadable();
+
+                    virtual void handleDisabled();
+
                 protected:
+                    enum {
+                        // Maximum number of memory areas per system call (IOV_MAX).
+                        MAX_BUFFERS_PER_CALL = 1024
+                    };
+
                     void initialize();
 
+                    /**
+                     * This method reads the available data from the socket
+                     * and passes it to the higher layers.
+                     *
+                     * @return false if the connection was closed or failed.
+                     */
+                    bool receiveData();
+
                     unique_ptr<Thread> m_thread;
+                    std::atomic<bool> m_registeredAtReactor;
 
                     unique_ptr<Mutex> m_socketMutex;
                     int32_t m_fileDescriptor;
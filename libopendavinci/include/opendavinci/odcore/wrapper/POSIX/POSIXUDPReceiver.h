@@ -23,6 +23,7 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -31,6 +32,7 @@
 #include "opendavinci/odcore/io/udp/UDPReceiver.h"
 #include "opendavinci/odcore/wrapper/NetworkLibraryProducts.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
 
 namespace odcore { namespace wrapper { class Thread; } }
 namespace odcore { namespace wrapper { template <odcore::wrapper::NetworkLibraryProducts product> class UDPFactoryWorker; } }
@@ -44,9 +46,15 @@ namespace odcore {
             /**
              * This class implements a UDP receiver for receiving data using POSIX.
              *
+             * On Linux, all datagrams that are pending after select(...)
+             * returned are received in one batch using recvmmsg(...) into
+             * preallocated slots; their receive time stamps are delivered
+             * as SO_TIMESTAMPNS control messages instead of being queried
+             * by a separate ioctl(...) per datagram.
+             *
              * @See UDPReceiver
              */
-            class POSIXUDPReceiver : public Runnable, public odcore::io::udp::UDPReceiver {
+            class POSIXUDPReceiver : public Runnable, public odcore::io::udp::UDPReceiver, public POSIXReactorHandler {
                 private:
                     friend class UDPFactoryWorker<NetworkLibraryPosix>;
 
@@ -61,7 +69,12 @@ namespace odcore {
 
                 private:
                     enum {
-                        BUFFER_SIZE = 65535
+                        BUFFER_SIZE = 65535,
+#ifdef __linux__
+                        NUMBER_OF_SLOTS = 16
+#else
+                        NUMBER_OF_SLOTS = 1
+#endif
                     };
 
                 private:
@@ -90,6 +103,7 @@ namespace odcore {
 
                 private:
                     map<unsigned long, bool> m_mapOfIPAddresses;
+                    map<unsigned long, string> m_mapOfSenderAddresses;
                     uint16_t m_portToIgnore;
                     bool m_isMulticast;
                     struct sockaddr_in m_address;
@@ -97,12 +111,42 @@ namespace odcore {
                     int32_t m_fd;
                     char *m_buffer;
                     unique_ptr<Thread> m_thread;
+                    std::atomic<bool> m_registeredAtReactor;
 
                     virtual void run();
 
                     virtual bool isRunning();
 
+                    virtual bool handleReadable();
+
+                    virtual void handleDisabled();
+
                     void getIPAddresses();
+
+                    /**
+                     * This method checks whether a received datagram shall be
+                     * passed on to avoid circular data sending.
+                     *
+                     * @param ipAddress Numerical IP address of the sender.
+                     * @param port Port of the sender.
+                     * @return true if the datagram shall be accepted.
+                     */
+                    bool acceptPacket(const unsigned long &ipAddress, const uint16_t &port) const;
+
+                    /**
+                     * This method returns the textual representation of
+                     * a sender's IP address. The representation is only
+                     * formatted once per sender.
+                     *
+                     * @param ipAddress Numerical IP address of the sender.
+                     * @return Textual representation.
+                     */
+                    const string& getSenderAddress(const unsigned long &ipAddress);
+
+                    /**
+                     * This method receives all pending datagrams.
+                     */
+                    void receivePackets();
             };
 
         }
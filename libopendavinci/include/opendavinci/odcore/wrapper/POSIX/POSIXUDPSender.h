@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/io/udp/UDPSender.h"
@@ -47,7 +48,8 @@ namespace odcore {
             class POSIXUDPSender : public odcore::io::udp::UDPSender {
                 private:
                     enum {
-                        MAX_UDP_PACKET_SIZE = 65507
+                        MAX_UDP_PACKET_SIZE = 65507,
+                        MAX_BURST_SIZE = 64
                     };
 
                 private:
@@ -81,6 +83,8 @@ namespace odcore {
 
                     virtual void send(const string &data) const;
 
+                    virtual void sendBurst(const vector<string> &listOfData) const;
+
                     virtual uint16_t getPort() const;
 
                 private:
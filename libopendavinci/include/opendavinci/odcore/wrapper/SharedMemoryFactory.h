@@ -23,12 +23,14 @@
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryOptions.h"
 #include <memory>
 
 namespace odcore {
     namespace wrapper {
 
 class SharedMemory;
+class SharedMemoryRing;
 
         using namespace std;
 
@@ -38,7 +40,8 @@ class SharedMemory;
          */
         struct OPENDAVINCI_API SharedMemoryFactory {
             /**
-             * This method returns the shared memory.
+             * This method returns the shared memory. It is created
+             * with the options from SharedMemoryOptions::fromEnvironment().
              *
              * @param name Name of the shared memory to create.
              * @param size Required size for the new shared memory.
@@ -49,10 +52,41 @@ class SharedMemory;
             /**
              * This method returns the shared memory.
              *
+             * @param name Name of the shared memory to create.
+             * @param size Required size for the new shared memory.
+             * @param options Options for creating the new shared memory.
+             * @return Shared memory based on the type of instance this factory is.
+             */
+            static std::shared_ptr<SharedMemory> createSharedMemoryWithOptions(const string &name, const uint32_t &size, const SharedMemoryOptions &options);
+
+            /**
+             * This method returns the shared memory. It attaches to
+             * shared memory created with any of the available options.
+             *
              * @param name Name of the shared memory to attach.
              * @return Shared memory based on the type of instance this factory is.
              */
             static std::shared_ptr<SharedMemory> attachToSharedMemory(const string &name);
+
+            /**
+             * This method returns a shared memory that is organized as
+             * a ring of slots for frames.
+             *
+             * @param name Name of the shared memory to create.
+             * @param slotSize Size in bytes of one slot.
+             * @param numberOfSlots Number of slots (triple buffering by default).
+             * @return Ring in a new shared memory.
+             */
+            static std::shared_ptr<SharedMemoryRing> createSharedMemoryRing(const string &name, const uint32_t &slotSize, const uint32_t &numberOfSlots = 3);
+
+            /**
+             * This method returns a shared memory that is organized as
+             * a ring of slots for frames.
+             *
+             * @param name Name of the shared memory to attach.
+             * @return Ring in the existing shared memory.
+             */
+            static std::shared_ptr<SharedMemoryRing> attachToSharedMemoryRing(const string &name);
         };
     }
 } // odcore::wrapper
@@ -24,6 +24,7 @@
 
 #include <memory>
 #include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryOptions.h"
 #include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
 
 namespace odcore {
@@ -50,9 +51,10 @@ namespace odcore {
                  *
                  * @param name Name of the shared memory to create.
                  * @param size Required size for the new shared memory.
+                 * @param options Options for creating the new shared memory.
                  * @return Shared memory based on the type of instance this factory is.
                  */
-                static std::shared_ptr<SharedMemory> createSharedMemory(const string &name, const uint32_t &size);
+                static std::shared_ptr<SharedMemory> createSharedMemory(const string &name, const uint32_t &size, const SharedMemoryOptions &options);
 
                 /**
                  * This method returns the shared memory.
@@ -0,0 +1,81 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_SHAREDMEMORYOPTIONS_H_
+#define OPENDAVINCI_CORE_WRAPPER_SHAREDMEMORYOPTIONS_H_
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace wrapper {
+
+        /**
+         * This structure describes how a new shared memory shall be
+         * created. All options except m_memoryMapped only apply to
+         * memory-mapped shared memory, which is available on POSIX
+         * systems; the other options are Linux-specific and are
+         * silently ignored elsewhere.
+         *
+         * The defaults are read from the environment variables
+         * OPENDAVINCI_SHM (set to "mmap" to use memory-mapped shared
+         * memory), OPENDAVINCI_SHM_HUGEPAGES, OPENDAVINCI_SHM_POPULATE
+         * (set to 1 to enable), and OPENDAVINCI_SHM_NUMA_NODE.
+         *
+         * @See SharedMemoryFactory
+         */
+        struct OPENDAVINCI_API SharedMemoryOptions {
+            /**
+             * Constructor for options that create System V shared memory.
+             */
+            SharedMemoryOptions();
+
+            /**
+             * This method returns the options as defined by the
+             * environment variables described above.
+             *
+             * @return Options from the environment.
+             */
+            static SharedMemoryOptions fromEnvironment();
+
+            /**
+             * Use shm_open/mmap instead of System V shared memory.
+             */
+            bool m_memoryMapped;
+
+            /**
+             * Back the shared memory by transparent huge pages.
+             */
+            bool m_hugePages;
+
+            /**
+             * Fault in all pages when creating the shared memory.
+             */
+            bool m_populate;
+
+            /**
+             * Preferred NUMA node for the pages or -1 for the default policy.
+             */
+            int32_t m_numaNode;
+        };
+
+    }
+} // odcore::wrapper
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_SHAREDMEMORYOPTIONS_H_*/
@@ -0,0 +1,214 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_SHAREDMEMORYRING_H_
+#define OPENDAVINCI_CORE_WRAPPER_SHAREDMEMORYRING_H_
+
+#include <memory>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace wrapper {
+
+        class SharedMemory;
+        struct SharedMemoryFactory;
+
+        using namespace std;
+
+        /**
+         * This class organizes a shared memory segment as a ring of
+         * equally sized slots for frames like camera images. It is
+         * created and attached by SharedMemoryFactory.
+         *
+         * A header at the beginning of the segment holds the id of the
+         * latest complete frame and every slot carries a sequence number
+         * that works like a seqlock. Thus, the producer never waits for
+         * consumers: it writes frame n into slot (n-1) % numberOfSlots
+         * and publishes it afterwards. Consumers never lock either; they
+         * read the latest frame in place and check afterwards whether the
+         * producer has overwritten the slot meanwhile. With the default
+         * of three slots, a consumer has at least one full frame period
+         * to read a frame before it is reused.
+         *
+         * A ring has exactly one producer.
+         *
+         * @code
+         * // Producer.
+         * std::shared_ptr<SharedMemoryRing> ring = SharedMemoryFactory::createSharedMemoryRing("camera", 640*480*3);
+         * char *dest = ring->beginWrite();
+         * ... // Fill dest.
+         * const uint64_t frameID = ring->endWrite();
+         *
+         * // Consumer.
+         * std::shared_ptr<SharedMemoryRing> ring = SharedMemoryFactory::attachToSharedMemoryRing("camera");
+         * const uint64_t frameID = ring->getLatestFrameID();
+         * const char *src = ring->getFrame(frameID);
+         * if (src != NULL) {
+         *     ... // Process src.
+         *     if (!ring->isFrameUnchanged(frameID)) {
+         *         // The frame was overwritten while processing it.
+         *     }
+         * }
+         * @endcode
+         */
+        class OPENDAVINCI_API SharedMemoryRing {
+            private:
+                friend struct SharedMemoryFactory;
+
+            public:
+                enum {
+                    /**
+                     * Default number of slots (triple buffering).
+                     */
+                    DEFAULT_NUMBER_OF_SLOTS = 3
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                SharedMemoryRing(const SharedMemoryRing &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                SharedMemoryRing& operator=(const SharedMemoryRing &);
+
+            protected:
+                /**
+                 * Constructor for creating a new ring in the given
+                 * shared memory.
+                 *
+                 * @param sharedMemory Newly created shared memory of at least getRequiredSize(slotSize, numberOfSlots) bytes.
+                 * @param slotSize Size in bytes of one slot.
+                 * @param numberOfSlots Number of slots.
+                 */
+                SharedMemoryRing(std::shared_ptr<SharedMemory> sharedMemory, const uint32_t &slotSize, const uint32_t &numberOfSlots);
+
+                /**
+                 * Constructor for attaching to an existing ring.
+                 *
+                 * @param sharedMemory Shared memory containing the ring.
+                 */
+                SharedMemoryRing(std::shared_ptr<SharedMemory> sharedMemory);
+
+            public:
+                virtual ~SharedMemoryRing();
+
+                /**
+                 * This method returns true if the ring is valid.
+                 *
+                 * @return true if the ring is valid.
+                 */
+                bool isValid() const;
+
+                /**
+                 * This method returns the name of the underlying shared memory.
+                 *
+                 * @return name of the shared memory.
+                 */
+                const string getName() const;
+
+                /**
+                 * @return Number of slots.
+                 */
+                uint32_t getNumberOfSlots() const;
+
+                /**
+                 * @return Size in bytes of one slot.
+                 */
+                uint32_t getSlotSize() const;
+
+                /**
+                 * This method returns the slot used for the given frame.
+                 *
+                 * @param frameID Frame id.
+                 * @return Slot.
+                 */
+                uint32_t getSlot(const uint64_t &frameID) const;
+
+                /**
+                 * This method returns the slot for the next frame and marks
+                 * it as being written. The producer must call endWrite()
+                 * once the frame is complete.
+                 *
+                 * @return Pointer to the slot for the next frame or NULL if the ring is invalid.
+                 */
+                char* beginWrite();
+
+                /**
+                 * This method publishes the frame started by beginWrite().
+                 *
+                 * @return Id of the published frame or 0 if no frame was started.
+                 */
+                uint64_t endWrite();
+
+                /**
+                 * This method returns the id of the latest complete frame.
+                 *
+                 * @return Id of the latest complete frame or 0 if no frame has been published yet.
+                 */
+                uint64_t getLatestFrameID() const;
+
+                /**
+                 * This method returns a pointer to the given frame if its
+                 * slot still holds it.
+                 *
+                 * @param frameID Frame id.
+                 * @return Pointer to the frame or NULL if the frame is not available (anymore).
+                 */
+                const char* getFrame(const uint64_t &frameID) const;
+
+                /**
+                 * This method checks whether the given frame is still
+                 * unchanged in its slot, i.e. whether all data read from
+                 * the pointer returned by getFrame() is consistent.
+                 *
+                 * @param frameID Frame id.
+                 * @return true if the frame was not overwritten.
+                 */
+                bool isFrameUnchanged(const uint64_t &frameID) const;
+
+                /**
+                 * This method returns the size of a shared memory
+                 * segment that is required for a ring.
+                 *
+                 * @param slotSize Size in bytes of one slot.
+                 * @param numberOfSlots Number of slots.
+                 * @return Required size in bytes.
+                 */
+                static uint32_t getRequiredSize(const uint32_t &slotSize, const uint32_t &numberOfSlots);
+
+            private:
+                std::shared_ptr<SharedMemory> m_sharedMemory;
+                char *m_ring;
+                uint64_t m_writeFrameID;
+        };
+
+    }
+} // odcore::wrapper
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_SHAREDMEMORYRING_H_*/
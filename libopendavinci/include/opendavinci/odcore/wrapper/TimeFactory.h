@@ -62,6 +62,14 @@ namespace odcore {
                 virtual std::shared_ptr<odcore::wrapper::Time> now();
                 static TimeFactory& getInstance();
 
+                /**
+                 * This method returns true if a controlled time factory
+                 * (e.g. for simulation) replaces the system's time.
+                 *
+                 * @return true if the time is controlled.
+                 */
+                static bool isControlled();
+
             protected:
                 TimeFactory();
                 static void setSingleton(TimeFactory *tf);
@@ -34,7 +34,7 @@ namespace odcore {
 
         template <> class OPENDAVINCI_API SharedMemoryFactoryWorker<SystemLibraryWin32> {
             public:
-                static std::shared_ptr<SharedMemory> createSharedMemory(const string &name, const uint32_t &size) {
+                static std::shared_ptr<SharedMemory> createSharedMemory(const string &name, const uint32_t &size, const SharedMemoryOptions &/*options*/) {
                     return std::shared_ptr<SharedMemory>(new WIN32Impl::WIN32SharedMemory(name, size));
                 };
 
@@ -0,0 +1,155 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_PLAYER_MAPPEDRECORDING_H_
+#define OPENDAVINCI_TOOLS_PLAYER_MAPPEDRECORDING_H_
+
+#include <string>
+
+#include <opendavinci/odcore/opendavinci.h>
+#include <opendavinci/odcore/data/Container.h>
+
+namespace odtools {
+    namespace player {
+
+        using namespace std;
+
+        /**
+         * This class maps a .rec or .rec.mem file read-only into memory.
+         * Containers are decoded directly from the mapping and shared
+         * memory dumps can be copied from it without any intermediate
+         * buffer. The pages around the current playback position are
+         * prefetched by a read-ahead window while pages that have been
+         * replayed already are released so that the resident set stays
+         * small even for large recordings.
+         *
+         * Memory-mapped recordings are not available on Windows; in
+         * that case, isValid() returns false and the recording needs to
+         * be read as stream.
+         *
+         * @code
+         * MappedRecording mr("recording.rec");
+         * if (mr.isValid()) {
+         *     mr.setReadAheadWindow(16*1024*1024);
+         *     mr.followPosition(filePosition);
+         *
+         *     Container c;
+         *     mr.readContainer(filePosition, c);
+         * }
+         * @endcode
+         */
+        class OPENDAVINCI_API MappedRecording {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                MappedRecording(const MappedRecording &/*obj*/) = delete;
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                MappedRecording& operator=(const MappedRecording &/*obj*/) = delete;
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param fileName Name of the recording to be mapped.
+                 */
+                MappedRecording(const string &fileName);
+
+                virtual ~MappedRecording();
+
+                /**
+                 * @return true if the recording is mapped.
+                 */
+                bool isValid() const;
+
+                /**
+                 * @return Size of the mapped recording.
+                 */
+                uint64_t getSize() const;
+
+                /**
+                 * This method returns a pointer into the mapping.
+                 *
+                 * @param position Position in the recording.
+                 * @param length Number of bytes to be accessed; it is reduced if the recording ends earlier.
+                 * @return Pointer to the position or NULL if the position is outside the recording.
+                 */
+                const char* getPointer(const uint64_t &position, uint64_t &length) const;
+
+                /**
+                 * This method decodes the Container at the given position.
+                 *
+                 * @param position Position in the recording.
+                 * @param c Container to decode into.
+                 * @return Number of bytes used by the Container or 0 if no Container could be decoded.
+                 */
+                uint32_t readContainer(const uint64_t &position, odcore::data::Container &c) const;
+
+                /**
+                 * This method sets the size of the read-ahead window.
+                 *
+                 * @param size Number of bytes to be prefetched.
+                 */
+                void setReadAheadWindow(const uint64_t &size);
+
+                /**
+                 * This method moves the read-ahead window along with the
+                 * current playback position: When half of the window is
+                 * consumed, the next window is prefetched and all pages
+                 * before the playback position are released.
+                 *
+                 * @param position Current playback position.
+                 */
+                void followPosition(const uint64_t &position);
+
+            private:
+                /**
+                 * This method passes an advice for the given range to the kernel.
+                 *
+                 * @param position Begin of the range.
+                 * @param length Length of the range.
+                 * @param willNeed true to prefetch the range, false to release it.
+                 */
+                void advise(const uint64_t &position, const uint64_t &length, const bool &willNeed);
+
+            private:
+                char *m_data;
+                uint64_t m_size;
+                uint64_t m_pageSize;
+                uint64_t m_readAheadWindow;
+                uint64_t m_windowBegin;
+                uint64_t m_windowEnd;
+        };
+
+    } // player
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_PLAYER_MAPPEDRECORDING_H_*/
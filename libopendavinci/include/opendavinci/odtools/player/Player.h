@@ -25,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include <opendavinci/odcore/opendavinci.h>
 #include <opendavinci/odcore/base/Mutex.h>
@@ -38,6 +39,7 @@
 namespace odtools {
     namespace player {
 
+        class MappedRecording;
         class PlayerDelegate;
         class RecMemIndex;
 
@@ -69,6 +71,8 @@ namespace odtools {
                     MAX_DELAY_IN_MICROSECONDS = 5 * ONE_SECOND_IN_MICROSECONDS,
                     LOOK_AHEAD_IN_S = 30,
                     MIN_ENTRIES_FOR_LOOK_AHEAD = 5000,
+                    MIN_READ_AHEAD_WINDOW_IN_BYTES = 16 * 1024 * 1024,
+                    MAX_READ_AHEAD_WINDOW_IN_BYTES = 256 * 1024 * 1024,
                 };
 
             private:
@@ -100,8 +104,9 @@ namespace odtools {
                  * @param memorySegmentSize Size of the memory segment to be used for buffering.
                  * @param numberOfMemorySegments Number of memory segments to be used for buffering.
                  * @param threading If set to true, player will load new containers from the files in background.
+                 * @param mapRecording If set to false, the files are read as streams even if they could be memory-mapped.
                  */
-                Player(const odcore::io::URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading);
+                Player(const odcore::io::URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const bool &mapRecording = true);
 
                 virtual ~Player();
 
@@ -140,6 +145,29 @@ namespace odtools {
                  */
                 void rewind();
 
+                /**
+                 * This method moves the playback position to the first
+                 * container that was sampled at or after the given time
+                 * point. The .rec and .rec.mem files are repositioned using
+                 * their indices and the caches are refilled from the new
+                 * position; the shared memory segments are updated with the
+                 * next replayed Shared*-containers.
+                 *
+                 * @param sampleTimeStamp Sample time point to continue the playback from.
+                 * @return false if there is no container at or after the given time point; the playback position is unchanged in this case.
+                 */
+                bool seekTo(const odcore::data::TimeStamp &sampleTimeStamp);
+
+                /**
+                 * This method moves the playback position relatively to the
+                 * time span of the .rec file; for instance, 0.5 continues the
+                 * playback from the middle of the recording.
+                 *
+                 * @param fraction Value between 0 (beginning) and 1 (end) of the recording.
+                 * @return false if the playback position could not be changed.
+                 */
+                bool seekToFraction(const double &fraction);
+
                 /**
                  * This method returns the total amount of containers in the .rec file.
                  *
@@ -147,6 +175,16 @@ namespace odtools {
                  */
                 uint32_t getTotalNumberOfContainersInRecFile() const;
 
+                /**
+                 * This method returns true if the .rec file is memory-mapped;
+                 * in this case, Containers are decoded directly from the
+                 * mapping and neither the container cache nor its thread
+                 * are used.
+                 *
+                 * @return true if the .rec file is memory-mapped.
+                 */
+                bool isRecFileMapped() const;
+
             private:
                 // Internal methods without Lock.
                 bool hasMoreDataFromRecFile() const;
@@ -173,8 +211,16 @@ namespace odtools {
 
                 /**
                  * This method resets the iterators.
+                 *
+                 * @param position Entry in the index to continue the playback from.
+                 */
+                inline void resetIterators(const multimap<int64_t, IndexEntry>::iterator &position);
+
+                /**
+                 * This method fills the cache (or prefetches the memory-mapped
+                 * .rec file) starting at the current playback position.
                  */
-                inline void resetIterators();
+                void fillCacheFromCurrentPosition();
 
                 /**
                  * This method actually fills the cache by trying to read up
@@ -185,6 +231,14 @@ namespace odtools {
                  */
                 uint32_t fillContainerCache(const uint32_t &maxNumberOfEntriesToReadFromFile);
 
+                /**
+                 * This method reads the next Container from the .rec file.
+                 *
+                 * @param c Container to read into.
+                 * @return true if a Container was successfully read.
+                 */
+                bool readNextContainerFromRecFile(odcore::data::Container &c);
+
                 /**
                  * This method checks the availability of the next container
                  * to be replayed from the cache.
@@ -209,6 +263,11 @@ namespace odtools {
                 // Handle to .rec file.
                 fstream m_recFile;
                 bool m_recFileValid;
+                // Reused buffer for the wire representation of Containers.
+                vector<char> m_recFileBuffer;
+                // Memory-mapped .rec file, if available.
+                bool m_mapRecording;
+                unique_ptr<MappedRecording> m_recFileMapping;
 
             private: // Player states.
                 bool m_autoRewind;
@@ -245,11 +304,26 @@ namespace odtools {
                 void setContainerCacheFillingRunning(const bool &running);
                 bool isContainerCacheFillingRunning() const;
 
+                /**
+                 * These methods start and stop the thread to fill the
+                 * container cache if it is used.
+                 */
+                void startContainerCacheFilling();
+                void stopContainerCacheFilling();
+
                 /**
                  * This method manages the cache.
                  */
                 void manageCache();
 
+                /**
+                 * This method reports the playback progress to the PlayerListener.
+                 *
+                 * @param numberOfReturnedContainersInTotal Number of Containers replayed so far.
+                 * @param numberOfEntriesInIndex Number of Containers in the .rec file.
+                 */
+                void publishStatistics(const uint32_t &numberOfReturnedContainersInTotal, const uint32_t &numberOfEntriesInIndex);
+
                 /**
                  * This method checks whether the cache needs to be refilled.
                  *
@@ -267,6 +341,9 @@ namespace odtools {
                 // Mapping of pos_type (within .rec file) --> Container (read from .rec file).
                 map<uint64_t, odcore::data::Container> m_containerCache;
 
+                // Time point of the last progress report for memory-mapped .rec files.
+                odcore::data::TimeStamp m_lastTimePointPublishingStatistics;
+
             private:
                 unique_ptr<RecMemIndex> m_recMemIndex;
 
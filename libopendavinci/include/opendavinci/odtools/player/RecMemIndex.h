@@ -37,6 +37,8 @@
 namespace odtools {
     namespace player {
 
+        class MappedRecording;
+
         using namespace std;
 
         class RawMemoryBufferEntry {
@@ -90,8 +92,9 @@ namespace odtools {
                  * @param memorySegmentSize Size of the memory segment to be used for buffering.
                  * @param numberOfMemorySegments Number of memory segments to be used for buffering.
                  * @param threading If set to true, RecMemIndex will load new containers from the .rec.mem file in background.
+                 * @param mapRecording If set to false, the .rec.mem file is read as stream even if it could be memory-mapped.
                  */
-                RecMemIndex(const odcore::io::URL &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading);
+                RecMemIndex(const odcore::io::URL &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const bool &mapRecording = true);
 
                 virtual ~RecMemIndex();
 
@@ -107,6 +110,16 @@ namespace odtools {
                  */
                 void rewind();
 
+                /**
+                 * This method moves the iterators to the first entry that
+                 * was sampled at or after the given time point. Raw memory
+                 * buffers read ahead from the previous position are
+                 * discarded.
+                 *
+                 * @param sampleTimeStamp Sample time point in microseconds.
+                 */
+                void seekTo(const int64_t &sampleTimeStamp);
+
                 /**
                  * This method returns the sample time stamp of the
                  * next Shared*-container to be replayed without
@@ -124,6 +137,11 @@ namespace odtools {
                  */
                 odcore::data::Container makeNextRawMemoryEntryAvailable();
 
+                /**
+                 * @return true if the .rec.mem file is memory-mapped and no raw memory buffers are used.
+                 */
+                bool isRecMemFileMapped() const;
+
             private:
                 /**
                  * This method initializes the global index where the sample
@@ -133,6 +151,35 @@ namespace odtools {
                  */
                 void initializeIndex();
 
+                /**
+                 * This method returns the name and the size of the shared
+                 * memory segment described by a Shared*-container.
+                 *
+                 * @param c Container describing the shared memory segment.
+                 * @param nameOfSharedMemorySegment Name of the shared memory segment.
+                 * @param sizeOfSharedMemorySegment Size of the dump following the container.
+                 */
+                static void getSharedMemorySegment(const odcore::data::Container &c, string &nameOfSharedMemorySegment, uint64_t &sizeOfSharedMemorySegment);
+
+                /**
+                 * This method copies a shared memory dump into the shared
+                 * memory segment described by the given entry; the segment
+                 * is created on first use.
+                 *
+                 * @param entry Entry describing the shared memory segment.
+                 * @param data Shared memory dump.
+                 * @param length Length of the shared memory dump.
+                 */
+                void copyToSharedMemory(const IndexEntry &entry, const char *data, const uint64_t &length);
+
+                /**
+                 * This method moves the iterators to the given entry and
+                 * refills the raw memory buffers from there.
+                 *
+                 * @param position Entry to continue the playback from.
+                 */
+                void resetToEntry(const multimap<int64_t, IndexEntry>::iterator &position);
+
             private: // File handle for the RecMemIndex.
                 bool m_threading;
 
@@ -141,6 +188,9 @@ namespace odtools {
                 // Handle to .rec.mem file.
                 fstream m_recMemFile;
                 bool m_recMemFileValid;
+                // Memory-mapped .rec.mem file, if available.
+                bool m_mapRecording;
+                unique_ptr<MappedRecording> m_recMemFileMapping;
 
             private: // Index and cache management.
                 mutable odcore::base::Mutex m_indexMutex;
@@ -0,0 +1,180 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_PLAYER_RECORDINGINDEX_H_
+#define OPENDAVINCI_TOOLS_PLAYER_RECORDINGINDEX_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <opendavinci/odcore/opendavinci.h>
+
+namespace odtools {
+    namespace player {
+
+        using namespace std;
+
+        /**
+         * This class describes one Container in a recording file.
+         */
+        class RecordingIndexEntry {
+            public:
+                RecordingIndexEntry();
+                RecordingIndexEntry(const int64_t &sampleTimeStamp, const uint64_t &filePosition, const int32_t &dataType, const uint32_t &senderStamp, const uint32_t &size, const uint32_t &sizeOfSharedMemorySegment);
+
+            public:
+                int64_t m_sampleTimeStamp;
+                uint64_t m_filePosition;
+                int32_t m_dataType;
+                uint32_t m_senderStamp;
+                // Size of the Container's wire representation.
+                uint32_t m_size;
+                // Size of the shared memory dump following the Container in .rec.mem files.
+                uint32_t m_sizeOfSharedMemorySegment;
+        };
+
+        /**
+         * This class reads and writes the index sidecar file (recording +
+         * ".idx") for .rec and .rec.mem files. It stores one fixed-size
+         * entry per Container so that a Player does not need to decode the
+         * entire recording before replaying the first Container.
+         *
+         * The header holds the size of the recording and a fingerprint of
+         * its first and last bytes; an index that does not match its
+         * recording is ignored.
+         *
+         * @code
+         * // While recording:
+         * RecordingIndex index("recording.rec");
+         * index.add(RecordingIndexEntry(...));
+         * ...
+         * index.finalize();
+         *
+         * // While replaying:
+         * vector<RecordingIndexEntry> entries;
+         * if (!RecordingIndex::load("recording.rec", entries)) {
+         *     // Scan recording.rec and call RecordingIndex::save(...).
+         * }
+         * @endcode
+         */
+        class OPENDAVINCI_API RecordingIndex {
+            public:
+                enum {
+                    HEADER_SIZE = 24,
+                    ENTRY_SIZE = 32,
+                    VERSION = 1,
+                    FINGERPRINT_RANGE = 4096,
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                RecordingIndex(const RecordingIndex &/*obj*/) = delete;
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                RecordingIndex& operator=(const RecordingIndex &/*obj*/) = delete;
+
+            public:
+                /**
+                 * Constructor to write the index for a recording that is
+                 * about to be written.
+                 *
+                 * @param fileNameOfRecording Name of the recording file.
+                 */
+                RecordingIndex(const string &fileNameOfRecording);
+
+                virtual ~RecordingIndex();
+
+                /**
+                 * This method appends an entry to the index.
+                 *
+                 * @param entry Entry to be added.
+                 */
+                void add(const RecordingIndexEntry &entry);
+
+                /**
+                 * This method completes the index after the recording has
+                 * been flushed. Entries added afterwards are ignored.
+                 */
+                void finalize();
+
+                /**
+                 * This method returns the name of the index file for a recording.
+                 *
+                 * @param fileNameOfRecording Name of the recording file.
+                 * @return Name of the index file.
+                 */
+                static string getFileName(const string &fileNameOfRecording);
+
+                /**
+                 * This method loads the index for a recording.
+                 *
+                 * @param fileNameOfRecording Name of the recording file.
+                 * @param entries Entries of the index in file order.
+                 * @return true if a valid index matching the recording was found.
+                 */
+                static bool load(const string &fileNameOfRecording, vector<RecordingIndexEntry> &entries);
+
+                /**
+                 * This method writes the index for an existing recording.
+                 *
+                 * @param fileNameOfRecording Name of the recording file.
+                 * @param entries Entries of the index in file order.
+                 * @return true if the index was written.
+                 */
+                static bool save(const string &fileNameOfRecording, const vector<RecordingIndexEntry> &entries);
+
+            private:
+                /**
+                 * This method computes the size and the fingerprint of a recording.
+                 *
+                 * @param fileNameOfRecording Name of the recording file.
+                 * @param size Size of the recording.
+                 * @param fingerprint Fingerprint of the recording.
+                 * @return true if the recording could be read.
+                 */
+                static bool computeFingerprint(const string &fileNameOfRecording, uint64_t &size, uint64_t &fingerprint);
+
+                static void encodeHeader(char *buffer, const uint64_t &size, const uint64_t &fingerprint);
+                static void encodeEntry(char *buffer, const RecordingIndexEntry &entry);
+                static RecordingIndexEntry decodeEntry(const char *buffer);
+
+            private:
+                string m_fileNameOfRecording;
+                fstream m_out;
+                bool m_finalized;
+        };
+
+    } // player
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_PLAYER_RECORDINGINDEX_H_*/
@@ -23,12 +23,15 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/FIFOQueue.h"
 #include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odtools/recorder/RecordingWriter.h"
 
 namespace odcore { namespace data { class Container; } }
+namespace odtools { namespace player { class RecordingIndex; } }
 
 namespace odtools {
     namespace recorder {
@@ -75,13 +78,22 @@ namespace odtools {
                  *                  queue size (numberOfSegments) is chosen too small or the low-level disk I/O
                  *                  containers of type SharedImage or SharedMemory are dropped.
                  * @param dumpSharedData If true, shared images and shared data will be stored as well.
+                 * @param groupCommitSize If threading is true, containers are written by a separate thread in chunks of this size (in bytes).
+                 * @param groupCommitInterval If threading is true, collected containers are written at least after this time (in milliseconds).
+                 * @param syncToDisk If threading is true, every chunk is synchronized with the disk using fdatasync.
                  */
-                Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData);
+                Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData,
+                         const uint32_t &groupCommitSize = RecordingWriter::DEFAULT_GROUP_COMMIT_SIZE,
+                         const uint32_t &groupCommitInterval = RecordingWriter::DEFAULT_GROUP_COMMIT_INTERVAL_IN_MILLISECONDS,
+                         const bool &syncToDisk = false);
 
                 virtual ~Recorder();
 
                 /**
-                 * This method records data from the given FIFOQueue.
+                 * This method records data from the given FIFOQueue. If
+                 * the recorder is threading, the containers are handed
+                 * over to the writing thread; in this case, this method
+                 * and store(...) must be called from the same thread.
                  *
                  * @param fifo FIFOQueue to be used for recording data.
                  */
@@ -121,14 +133,29 @@ namespace odtools {
                  */
                 void store(odcore::data::Container c);
 
+            private:
+                /**
+                 * This method writes the given container to the recording
+                 * reusing an internal buffer for its wire representation.
+                 *
+                 * @param c Container to be written.
+                 */
+                void writeContainer(const odcore::data::Container &c);
+
             private:
                 odcore::base::FIFOQueue m_fifo;
                 unique_ptr<SharedDataListener> m_sharedDataListener;
                 std::shared_ptr<ostream> m_out;
+                // Index sidecar file describing m_out.
+                unique_ptr<odtools::player::RecordingIndex> m_recordingIndex;
+                uint64_t m_bytesWritten;
+                // Writing thread for m_out if threading.
+                unique_ptr<RecordingWriter> m_recordingWriter;
                 std::shared_ptr<ostream> m_outSharedMemoryFile;
                 bool m_dumpSharedData;
                 odcore::base::Mutex m_mapOfRecorderDelegatesMutex;
                 map<int32_t, RecorderDelegate*> m_mapOfRecorderDelegates;
+                vector<char> m_buffer;
         };
 
     } // recorder
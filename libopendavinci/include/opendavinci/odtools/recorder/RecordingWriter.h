@@ -0,0 +1,194 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_RECORDER_RECORDINGWRITER_H_
+#define OPENDAVINCI_TOOLS_RECORDER_RECORDINGWRITER_H_
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/SPSCRingBuffer.h"
+#include "opendavinci/odcore/base/Service.h"
+#include "opendavinci/odcore/data/Container.h"
+
+namespace odtools { namespace player { class RecordingIndex; } }
+
+namespace odtools {
+    namespace recorder {
+
+        using namespace std;
+
+        /**
+         * This class writes Containers to a recording from its own thread.
+         * Containers are handed over through a bounded lock-free ring
+         * buffer; hence, enqueue(...) must be called from one thread only.
+         * The writing thread serializes the Containers back to back into
+         * a large buffer that is written and flushed at once (group
+         * commit) when it is full or when the commit interval has passed.
+         * Optionally, every commit is followed by fdatasync(...) to make
+         * sure that the data has reached the disk.
+         *
+         * @code
+         * RecordingWriter rw(out, "recording.rec", &index);
+         * rw.start();
+         * ...
+         * rw.enqueue(c);
+         * ...
+         * // Writes all pending Containers.
+         * rw.stop();
+         * @endcode
+         */
+        class RecordingWriter : public odcore::base::Service {
+            public:
+                enum OVERFLOW_POLICY {
+                    DROP_NEWEST,    // Drop the Container to be added.
+                    BLOCK           // Sleep until the writing thread has processed older Containers.
+                };
+
+                enum {
+                    DEFAULT_CAPACITY = 16384,
+                    DEFAULT_GROUP_COMMIT_SIZE = 4 * 1024 * 1024,
+                    DEFAULT_GROUP_COMMIT_INTERVAL_IN_MILLISECONDS = 500
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                RecordingWriter(const RecordingWriter &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                RecordingWriter& operator=(const RecordingWriter &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param out Stream to write the recording to.
+                 * @param fileName Name of the recording file; it is used to synchronize the file with the disk.
+                 * @param recordingIndex Index to add an entry per written Container to or NULL.
+                 * @param capacity Maximum number of Containers waiting to be written.
+                 * @param policy Behavior when capacity Containers are waiting already.
+                 * @param groupCommitSize Number of bytes to be collected before writing them at once.
+                 * @param groupCommitInterval Maximum time in milliseconds before collected bytes are written.
+                 * @param syncToDisk If true, every commit is followed by fdatasync(...).
+                 */
+                RecordingWriter(std::shared_ptr<ostream> out,
+                                const string &fileName,
+                                odtools::player::RecordingIndex *recordingIndex,
+                                const uint32_t &capacity = DEFAULT_CAPACITY,
+                                const OVERFLOW_POLICY &policy = BLOCK,
+                                const uint32_t &groupCommitSize = DEFAULT_GROUP_COMMIT_SIZE,
+                                const uint32_t &groupCommitInterval = DEFAULT_GROUP_COMMIT_INTERVAL_IN_MILLISECONDS,
+                                const bool &syncToDisk = false);
+
+                virtual ~RecordingWriter();
+
+                /**
+                 * This method hands a Container over to the writing thread.
+                 *
+                 * @param c Container to be written.
+                 * @return false if the Container was dropped.
+                 */
+                bool enqueue(const odcore::data::Container &c);
+
+                /**
+                 * @return Number of Containers that were dropped because the queue was full.
+                 */
+                uint64_t getNumberOfDroppedContainers() const;
+
+                /**
+                 * @return Number of Containers for which enqueue(...) had to wait for the writing thread.
+                 */
+                uint64_t getNumberOfBlockedContainers() const;
+
+                /**
+                 * @return Maximum number of Containers that were waiting to be written at the same time.
+                 */
+                uint32_t getMaximumQueueDepth() const;
+
+                /**
+                 * @return Number of group commits.
+                 */
+                uint64_t getNumberOfCommits() const;
+
+                /**
+                 * @return Number of bytes written to the recording.
+                 */
+                uint64_t getNumberOfBytesWritten() const;
+
+            private:
+                virtual void beforeStop();
+
+                virtual void run();
+
+                /**
+                 * This method serializes all Containers that are available
+                 * at this moment into the group commit buffer.
+                 */
+                void processQueue();
+
+                /**
+                 * This method writes the group commit buffer to the recording.
+                 */
+                void commit();
+
+            private:
+                std::shared_ptr<ostream> m_out;
+                odtools::player::RecordingIndex *m_recordingIndex;
+                int32_t m_fileDescriptor;
+
+                odcore::base::SPSCRingBuffer<odcore::data::Container> m_queue;
+                const OVERFLOW_POLICY m_policy;
+
+                odcore::base::Condition m_queueCondition;
+                std::atomic<bool> m_consumerWaiting;
+
+                odcore::base::Condition m_spaceCondition;
+                std::atomic<bool> m_producerWaiting;
+
+                const uint32_t m_groupCommitSize;
+                const uint32_t m_groupCommitInterval;
+                vector<char> m_buffer;
+                uint32_t m_bufferUsed;
+
+                uint64_t m_bytesWritten;
+
+                std::atomic<uint64_t> m_droppedContainers;
+                std::atomic<uint64_t> m_blockedContainers;
+                std::atomic<uint32_t> m_maximumQueueDepth;
+                std::atomic<uint64_t> m_commits;
+                std::atomic<uint64_t> m_bytesCommitted;
+        };
+
+    } // recorder
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_RECORDER_RECORDINGWRITER_H_*/
@@ -34,6 +34,7 @@
 
 namespace odcore { namespace data { class Container; } }
 namespace odcore { namespace wrapper { class SharedMemory; } }
+namespace odtools { namespace player { class RecordingIndex; } }
 
 namespace odtools {
     namespace recorder {
@@ -71,11 +72,12 @@ class SharedDataWriter;
                  * Constructor.
                  *
                  * @param out Stream to write data to.
+                 * @param recordingIndex Index to be written for the stream (might be NULL).
                  * @param memorySegmentSize Size of one memory segment.
                  * @param numberOfMemorySegments Number of available memory segments.
                  * @param threading Cf. constructor of Recorder.
                  */
-                SharedDataListener(std::shared_ptr<ostream> out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading);
+                SharedDataListener(std::shared_ptr<ostream> out, std::shared_ptr<odtools::player::RecordingIndex> recordingIndex, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading);
 
                 virtual ~SharedDataListener();
 
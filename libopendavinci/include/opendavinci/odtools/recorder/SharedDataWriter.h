@@ -28,6 +28,7 @@
 #include "opendavinci/odcore/base/Service.h"
 
 namespace odcore { namespace base { class FIFOQueue; } }
+namespace odtools { namespace player { class RecordingIndex; } }
 
 namespace odtools {
 
@@ -64,8 +65,9 @@ namespace odtools {
                  * Constructor.
                  *
                  * @param out Output stream to write to.
+                 * @param recordingIndex Index to be written for the output stream (might be NULL).
                  */
-                SharedDataWriter(std::shared_ptr<ostream> out, map<uint32_t, char*> &mapOfMemories, odcore::base::FIFOQueue &bufferIn, odcore::base::FIFOQueue &bufferOut);
+                SharedDataWriter(std::shared_ptr<ostream> out, std::shared_ptr<odtools::player::RecordingIndex> recordingIndex, map<uint32_t, char*> &mapOfMemories, odcore::base::FIFOQueue &bufferIn, odcore::base::FIFOQueue &bufferOut);
 
                 virtual ~SharedDataWriter();
 
@@ -78,6 +80,8 @@ namespace odtools {
 
             private:
                 std::shared_ptr<ostream> m_out;
+                std::shared_ptr<odtools::player::RecordingIndex> m_recordingIndex;
+                uint64_t m_bytesWritten;
 
                 map<uint32_t, char*> &m_mapOfMemories;
 
@@ -30,8 +30,13 @@ namespace odcore {
         using namespace data;
         using namespace exceptions;
 
+        KeyValueDataStore::KeyValueDataStore() :
+                m_keyValueDatabase(),
+                m_latestValues(new LatestValueStore()) {}
+
         KeyValueDataStore::KeyValueDataStore(std::shared_ptr<wrapper::KeyValueDatabase> keyValueDatabase) throw (NoDatabaseAvailableException) :
-                m_keyValueDatabase(keyValueDatabase) {
+                m_keyValueDatabase(keyValueDatabase),
+                m_latestValues() {
             if (!m_keyValueDatabase.get()) {
                 OPENDAVINCI_CORE_THROW_EXCEPTION(NoDatabaseAvailableException, "Given database is NULL.");
             }
@@ -40,24 +45,30 @@ namespace odcore {
         KeyValueDataStore::~KeyValueDataStore() {}
 
         void KeyValueDataStore::put(const int32_t &key, const Container &value) {
+            if (m_latestValues.get()) {
+                m_latestValues->put(key, value);
+                return;
+            }
+
             // Transform the given Container to a plain string...
-            stringstream stringStreamValue;
-            stringStreamValue << value;
-            string stringValue = stringStreamValue.str();
+            string stringValue(value.getSerializedSize(), '\0');
+            value.serializeTo(&stringValue[0], stringValue.size());
 
             // ...and use the datastore backend for storing the content.
             m_keyValueDatabase->put(key, stringValue);
         }
 
         Container KeyValueDataStore::get(const int32_t &key) const {
+            if (m_latestValues.get()) {
+                return m_latestValues->get(key);
+            }
+
             Container value;
 
             // Try to get the value from the database backend and try to parse a Container.
-            string stringValue(m_keyValueDatabase->get(key));
+            const string stringValue(m_keyValueDatabase->get(key));
             if (stringValue != "") {
-                stringstream stringStreamValue;
-                stringStreamValue.str(stringValue);
-                stringStreamValue >> value;
+                value.deserializeFrom(stringValue.data(), stringValue.size());
             }
 
             return value;
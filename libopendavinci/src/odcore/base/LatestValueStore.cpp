@@ -0,0 +1,89 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <atomic>
+
+#include "opendavinci/odcore/base/LatestValueStore.h"
+#include "opendavinci/odcore/base/Lock.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+        using namespace data;
+
+        LatestValueStore::Entry::Entry(const Container &container) :
+            m_container(container),
+            m_decodeOnce(),
+            m_decoded() {}
+
+        LatestValueStore::Slot::Slot() :
+            m_entry() {}
+
+        LatestValueStore::LatestValueStore() :
+            m_insertMutex(),
+            m_slots(std::make_shared<const MapOfSlots>()) {}
+
+        LatestValueStore::~LatestValueStore() {}
+
+        void LatestValueStore::put(const int32_t &key, const Container &value) {
+            std::shared_ptr<Entry> entry = std::make_shared<Entry>(value);
+
+            std::shared_ptr<const MapOfSlots> slots = std::atomic_load(&m_slots);
+            MapOfSlots::const_iterator it = slots->find(key);
+            if (it != slots->end()) {
+                std::atomic_store(&(it->second->m_entry), entry);
+                return;
+            }
+
+            // New keys are rare; copy the map and publish it.
+            Lock l(m_insertMutex);
+            slots = std::atomic_load(&m_slots);
+            it = slots->find(key);
+            if (it != slots->end()) {
+                std::atomic_store(&(it->second->m_entry), entry);
+                return;
+            }
+
+            std::shared_ptr<MapOfSlots> newSlots = std::make_shared<MapOfSlots>(*slots);
+            std::shared_ptr<Slot> slot = std::make_shared<Slot>();
+            slot->m_entry = entry;
+            (*newSlots)[key] = slot;
+            std::atomic_store(&m_slots, std::shared_ptr<const MapOfSlots>(newSlots));
+        }
+
+        Container LatestValueStore::get(const int32_t &key) const {
+            std::shared_ptr<Entry> entry = getEntry(key);
+            if (entry.get()) {
+                return entry->m_container;
+            }
+            return Container();
+        }
+
+        std::shared_ptr<LatestValueStore::Entry> LatestValueStore::getEntry(const int32_t &key) const {
+            std::shared_ptr<const MapOfSlots> slots = std::atomic_load(&m_slots);
+            MapOfSlots::const_iterator it = slots->find(key);
+            if (it != slots->end()) {
+                return std::atomic_load(&(it->second->m_entry));
+            }
+            return std::shared_ptr<Entry>();
+        }
+
+    }
+} // odcore::base
@@ -45,7 +45,8 @@ namespace odcore {
                     m_CID(0),
                     m_profiling(false),
                     m_realtime(false),
-                    m_realtimePriority(0) {
+                    m_realtimePriority(0),
+                    m_sharedMemoryConference(false) {
                 m_verbose = false;
                 parseCommandLine(argc, argv);
             }
@@ -66,6 +67,7 @@ namespace odcore {
                 cmdParser.addCommandLineArgument("verbose");
                 cmdParser.addCommandLineArgument("profiling");
                 cmdParser.addCommandLineArgument("realtime");
+                cmdParser.addCommandLineArgument("conference");
 
                 cmdParser.parse(argc, argv);
 
@@ -75,6 +77,7 @@ namespace odcore {
                 CommandLineArgument cmdArgumentVERBOSE = cmdParser.getCommandLineArgument("verbose");
                 CommandLineArgument cmdArgumentPROFILING = cmdParser.getCommandLineArgument("profiling");
                 CommandLineArgument cmdArgumentREALTIME = cmdParser.getCommandLineArgument("realtime");
+                CommandLineArgument cmdArgumentCONFERENCE = cmdParser.getCommandLineArgument("conference");
 
                 if (cmdArgumentVERBOSE.isSet()) {
                     AbstractCIDModule::m_verbose = cmdArgumentVERBOSE.getValue<int32_t>();;
@@ -117,6 +120,18 @@ namespace odcore {
                     m_profiling = true;
                 }
 
+                if (cmdArgumentCONFERENCE.isSet()) {
+                    const string conference = cmdArgumentCONFERENCE.getValue<string>();
+                    if (conference == "shm") {
+                        m_sharedMemoryConference = true;
+                    }
+                    else if (conference != "udp") {
+                        errno = 0;
+                        OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException,
+                                                      "The conference has to be either udp or shm.");
+                    }
+                }
+
                 if (cmdArgumentREALTIME.isSet()) {
                     errno = 0;
 #ifdef HAVE_LINUX_RT
@@ -50,6 +50,9 @@ namespace odcore {
                     m_loggerInitializedMutex(),
                     m_loggerInitialized(false) {
                 // Create a container conference.
+                if (isSharedMemoryConference()) {
+                    ContainerConferenceFactory::getInstance().setTransport(ContainerConferenceFactory::SHARED_MEMORY);
+                }
                 std::shared_ptr<ContainerConference> containerConference = ContainerConferenceFactory::getInstance().getContainerConference(getMultiCastGroup());
                 if (!containerConference.get()) {
                     OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "ContainerConference invalid!");
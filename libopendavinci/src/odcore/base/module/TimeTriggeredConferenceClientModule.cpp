@@ -20,8 +20,6 @@
 #include "opendavinci/odcore/base/AbstractDataStore.h"
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
-#include "opendavinci/odcore/wrapper/KeyValueDatabase.h"
-#include "opendavinci/odcore/wrapper/KeyValueDatabaseFactory.h"
 
 namespace odcore {
     namespace base {
@@ -41,8 +39,8 @@ namespace odcore {
                 m_listOfDataStores(),
                 m_mapOfListOfDataStores(),
                 m_keyValueDataStore() {
-                // Create an in-memory database.
-                m_keyValueDataStore = std::shared_ptr<KeyValueDataStore>(new KeyValueDataStore(wrapper::KeyValueDatabaseFactory::createKeyValueDatabase()));
+                // Keep the latest containers in memory.
+                m_keyValueDataStore = std::shared_ptr<KeyValueDataStore>(new KeyValueDataStore());
             }
 
             TimeTriggeredConferenceClientModule::~TimeTriggeredConferenceClientModule() {
@@ -74,12 +72,14 @@ namespace odcore {
                         }
                     }
 
-                    vector<AbstractDataStore*> listOfDataStores = m_mapOfListOfDataStores[c.getDataType()];
-                    vector<AbstractDataStore*>::iterator jt = listOfDataStores.begin();
-                    while (jt != listOfDataStores.end()) {
-                        AbstractDataStore *ads = (*jt++);
-                        if (ads != NULL) {
-                            ads->add(c); // Currently waiting threads are awaken automagically.
+                    map<int32_t, vector<AbstractDataStore*> >::iterator listOfDataStores = m_mapOfListOfDataStores.find(c.getDataType());
+                    if (listOfDataStores != m_mapOfListOfDataStores.end()) {
+                        vector<AbstractDataStore*>::iterator jt = listOfDataStores->second.begin();
+                        while (jt != listOfDataStores->second.end()) {
+                            AbstractDataStore *ads = (*jt++);
+                            if (ads != NULL) {
+                                ads->add(c); // Currently waiting threads are awaken automagically.
+                            }
                         }
                     }
                 }
@@ -99,9 +99,7 @@ namespace odcore {
             void TimeTriggeredConferenceClientModule::addDataStoreFor(const int32_t &datatype, AbstractDataStore &dataStore) {
                 Lock l(m_dataStoresMutex);
 
-                vector<AbstractDataStore*> listOfDataStores = m_mapOfListOfDataStores[datatype];
-                listOfDataStores.push_back(&dataStore);
-                m_mapOfListOfDataStores[datatype] = listOfDataStores;
+                m_mapOfListOfDataStores[datatype].push_back(&dataStore);
             }
 
             KeyValueDataStore& TimeTriggeredConferenceClientModule::getKeyValueDataStore() {
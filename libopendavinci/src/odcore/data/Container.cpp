@@ -17,15 +17,15 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
-#include "opendavinci/odcore/serialization/Deserializer.h"
-#include "opendavinci/odcore/serialization/SerializationFactory.h"
-#include "opendavinci/odcore/serialization/Serializer.h"
+#include "opendavinci/odcore/serialization/ProtoSerializer.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/SerializableData.h"
 
@@ -38,7 +38,7 @@ namespace odcore {
 
         Container::Container() :
                 m_dataType(UNDEFINEDDATA),
-                m_serializedData(),
+                m_serializedData(getEmptyBuffer()),
                 m_sent(TimeStamp(0, 0)),
                 m_received(TimeStamp(0, 0)),
                 m_sampleTimeStamp(TimeStamp(0, 0)),
@@ -52,7 +52,9 @@ namespace odcore {
                 m_sampleTimeStamp(TimeStamp(0, 0)),
                 m_senderStamp(0) {
             // Get data for container.
-            m_serializedData << serializableData;
+            stringstream sstr;
+            sstr << serializableData;
+            m_serializedData = std::make_shared<const string>(sstr.str());
         }
 
         Container::Container(const SerializableData &serializableData, const int32_t &dataType) :
@@ -63,23 +65,36 @@ namespace odcore {
                 m_sampleTimeStamp(TimeStamp(0, 0)),
                 m_senderStamp(0) {
             // Get data for container.
-            m_serializedData << serializableData;
+            stringstream sstr;
+            sstr << serializableData;
+            m_serializedData = std::make_shared<const string>(sstr.str());
         }
 
         Container::Container(const Container &obj) :
                 Serializable(),
                 m_dataType(obj.getDataType()),
-                m_serializedData(),
+                m_serializedData(obj.m_serializedData),
+                m_sent(obj.m_sent),
+                m_received(obj.m_received),
+                m_sampleTimeStamp(obj.m_sampleTimeStamp),
+                m_senderStamp(obj.m_senderStamp) {}
+
+        Container::Container(Container &&obj) :
+                Serializable(),
+                m_dataType(obj.m_dataType),
+                m_serializedData(std::move(obj.m_serializedData)),
                 m_sent(obj.m_sent),
                 m_received(obj.m_received),
                 m_sampleTimeStamp(obj.m_sampleTimeStamp),
                 m_senderStamp(obj.m_senderStamp) {
-            m_serializedData.str(obj.m_serializedData.str());
+            // Leave obj in a valid but empty state.
+            obj.m_dataType = UNDEFINEDDATA;
+            obj.m_serializedData = getEmptyBuffer();
         }
 
         Container& Container::operator=(const Container &obj) {
             m_dataType = obj.getDataType();
-            m_serializedData.str(obj.m_serializedData.str());
+            m_serializedData = obj.m_serializedData;
             setSentTimeStamp(obj.getSentTimeStamp());
             setReceivedTimeStamp(obj.getReceivedTimeStamp());
             setSampleTimeStamp(obj.getSampleTimeStamp());
@@ -88,12 +103,38 @@ namespace odcore {
             return (*this);
         }
 
+        Container& Container::operator=(Container &&obj) {
+            if (this != &obj) {
+                m_dataType = obj.m_dataType;
+                m_serializedData = std::move(obj.m_serializedData);
+                setSentTimeStamp(obj.getSentTimeStamp());
+                setReceivedTimeStamp(obj.getReceivedTimeStamp());
+                setSampleTimeStamp(obj.getSampleTimeStamp());
+                setSenderStamp(obj.getSenderStamp());
+
+                // Leave obj in a valid but empty state.
+                obj.m_dataType = UNDEFINEDDATA;
+                obj.m_serializedData = getEmptyBuffer();
+            }
+
+            return (*this);
+        }
+
         Container::~Container() {}
 
+        const std::shared_ptr<const string>& Container::getEmptyBuffer() {
+            static const std::shared_ptr<const string> EMPTY_BUFFER = std::make_shared<const string>();
+            return EMPTY_BUFFER;
+        }
+
         int32_t Container::getDataType() const {
             return m_dataType;
         }
 
+        const string& Container::getSerializedData() const {
+            return *m_serializedData;
+        }
+
         const TimeStamp Container::getSentTimeStamp() const {
             return m_sent;
         }
@@ -128,160 +169,327 @@ namespace odcore {
 
 
         ostream& Container::operator<<(ostream &out) const {
-            stringstream bufferOut;
+            vector<char> buffer(getSerializedSize());
+            const uint32_t bytesWritten = serializeTo(&buffer[0], buffer.size());
+            out.write(&buffer[0], bytesWritten);
 
-            // We need a dedicated scope as the writing will take place
-            // in the Serializer's destructor.
-            {
-                SerializationFactory& sf=SerializationFactory::getInstance();
-                std::shared_ptr<Serializer> s = sf.getSerializer(bufferOut);
+            return out;
+        }
 
-                // Write container data type.
-                int32_t dataType = getDataType();
-                s->write(1, dataType);
+        istream& Container::operator>>(istream &in) {
+            vector<char> buffer;
+            const uint32_t bytesRead = readWireRepresentation(in, buffer);
+            if (bytesRead > 0) {
+                deserializeFrom(&buffer[0], bytesRead);
+            }
 
-                // Write container data.
-                s->write(2, m_serializedData.str());
+            return in;
+        }
+
+        uint32_t Container::readWireRepresentation(istream &in, vector<char> &buffer) {
+            if (buffer.size() < HEADER_SIZE) {
+                buffer.resize(HEADER_SIZE);
+            }
+
+            // Read five bytes OpenDaVINCI Container header.
+            in.read(&buffer[0], HEADER_SIZE);
+            if (static_cast<uint32_t>(in.gcount()) != HEADER_SIZE) {
+                return 0;
+            }
 
-                // Write sent time stamp data.
-                s->write(3, m_sent);
+            uint32_t expectedBytes = 0;
+            memcpy(&expectedBytes, &buffer[1], sizeof(uint32_t));
 
-                // Write received time stamp data.
-                s->write(4, m_received);
+            // Transform value from little endian to host.
+            expectedBytes = le32toh(expectedBytes);
 
-                // Write sample time stamp.
-                s->write(5, m_sampleTimeStamp);
+            // Check validity of the received bytes.
+            const unsigned char byte1 = (expectedBytes & 0xFF);
+            if (!( (0x0D == buffer[0]) && (0xA4 == byte1) )) {
+                std::cerr << "[core::base::Container] Failed to decode OpenDaVINCI container header." << std::endl;
+                return 0;
+            }
+            expectedBytes = expectedBytes >> 8;
 
-                // Write sender stamp.
-                s->write(6, m_senderStamp);
+            // Read payload behind the header.
+            if (buffer.size() < (HEADER_SIZE + expectedBytes)) {
+                buffer.resize(HEADER_SIZE + expectedBytes);
+            }
+            in.read(&buffer[HEADER_SIZE], expectedBytes);
+            const uint32_t extractedBytes = static_cast<uint32_t>(in.gcount());
+            if (extractedBytes != expectedBytes) {
+                cerr << "[core::base::Container] Failed to read " << (expectedBytes - extractedBytes) << "." << endl;
+                return 0;
             }
 
-            // Write Container header.
-            {
-                // Write Proto header: 0x0D 0xA4 A B C <payload>.
-                // 0xA4 A B C can be read as uint32_t, 0xA4 can be cut and
-                // A B C can be read as little endian shifted by 8 bits to
-                // the right.
-                const char byte0 = 0x0D;
-                const uint8_t byte1 = 0xA4;
+            return HEADER_SIZE + expectedBytes;
+        }
+
+        uint32_t Container::getVarIntSize(uint64_t value) {
+            return VarIntCodec::getSize(value);
+        }
+
+        char* Container::encodeVarInt(char *buffer, uint64_t value) {
+            return buffer + VarIntCodec::encode(buffer, value);
+        }
 
-                const string str_bufferOut = bufferOut.str();
-                uint32_t length = (str_bufferOut.size());
+        const char* Container::decodeVarInt(const char *begin, const char *end, uint64_t &value) {
+            const uint8_t size = VarIntCodec::decode(begin, end, value);
+            return (0 == size) ? NULL : begin + size;
+        }
 
-                // Shift length by 8 bits to the left to make space
-                // for 0xA4 header part.
-                length = length << 8;
+        uint32_t Container::getTimeStampSize(const TimeStamp &timeStamp) {
+            // Field 1: seconds, field 2: microseconds; both using zigzag32.
+            const int32_t seconds = timeStamp.getSeconds();
+            const int32_t microseconds = timeStamp.getMicroseconds();
+            return 1 + getVarIntSize(VarIntCodec::encodeZigZag32(seconds))
+                 + 1 + getVarIntSize(VarIntCodec::encodeZigZag32(microseconds));
+        }
 
-                // Add 0xA4 as part of OpenDaVINCI container header.
-                length |= byte1;
+        char* Container::encodeTimeStamp(char *buffer, const uint32_t &id, const TimeStamp &timeStamp) {
+            const int32_t seconds = timeStamp.getSeconds();
+            const int32_t microseconds = timeStamp.getMicroseconds();
+
+            buffer = encodeVarInt(buffer, (id << 3) | ProtoSerializer::LENGTH_DELIMITED);
+            buffer = encodeVarInt(buffer, getTimeStampSize(timeStamp));
+            buffer = encodeVarInt(buffer, (1 << 3) | ProtoSerializer::VARINT);
+            buffer = encodeVarInt(buffer, VarIntCodec::encodeZigZag32(seconds));
+            buffer = encodeVarInt(buffer, (2 << 3) | ProtoSerializer::VARINT);
+            buffer = encodeVarInt(buffer, VarIntCodec::encodeZigZag32(microseconds));
+            return buffer;
+        }
 
-                // Transform value to little endian.
-                length = htole32(length);
+        bool Container::decodeTimeStamp(const char *begin, const char *end, TimeStamp &timeStamp) {
+            while (begin < end) {
+                uint64_t key = 0;
+                uint64_t value = 0;
+                if ( (NULL == (begin = decodeVarInt(begin, end, key)))
+                  || ((key & 0x7) != ProtoSerializer::VARINT)
+                  || (NULL == (begin = decodeVarInt(begin, end, value))) ) {
+                    return false;
+                }
 
-                // Write header and payload.
-                out.write(&byte0, sizeof(byte0));
-                out.write((char*)(&length), sizeof(uint32_t));
-                out << str_bufferOut;
+                const int32_t decoded = VarIntCodec::decodeZigZag32(static_cast<uint32_t>(value));
+                if (1 == (key >> 3)) {
+                    timeStamp.setSeconds(decoded);
+                }
+                else if (2 == (key >> 3)) {
+                    timeStamp.setMicroseconds(decoded);
+                }
             }
+            return true;
+        }
 
-            return out;
+        uint32_t Container::getSerializedSize() const {
+            const uint32_t zigZagDataType = VarIntCodec::encodeZigZag32(m_dataType);
+            const uint32_t sentSize = getTimeStampSize(m_sent);
+            const uint32_t receivedSize = getTimeStampSize(m_received);
+            const uint32_t sampleTimeStampSize = getTimeStampSize(m_sampleTimeStamp);
+
+            // All keys fit into one byte.
+            return HEADER_SIZE
+                 + 1 + getVarIntSize(zigZagDataType)
+                 + 1 + getVarIntSize(m_serializedData->size()) + m_serializedData->size()
+                 + 1 + getVarIntSize(sentSize) + sentSize
+                 + 1 + getVarIntSize(receivedSize) + receivedSize
+                 + 1 + getVarIntSize(sampleTimeStampSize) + sampleTimeStampSize
+                 + 1 + getVarIntSize(m_senderStamp);
         }
 
-        istream& Container::operator>>(istream &in) {
-            string rawData = "";
-
-            // Read Container header.
-            vector<char> temporaryBuffer;
-            stringstream bufferIn;
-            {
-                const uint32_t OPENDAVINCI_CONTAINER_HEADER_SIZE = 5;
-                bool consumedOpenDaVINCIContainerHeader = false;
-                uint32_t bytesRead = 0;
-                uint32_t expectedBytes = 0;
-                uint32_t bufferPosition = 0;
-
-                temporaryBuffer.resize(OPENDAVINCI_CONTAINER_HEADER_SIZE);
-                while (in.good()) {
-                    if (0 == expectedBytes) {
-                        in.read(&temporaryBuffer[bufferPosition], (OPENDAVINCI_CONTAINER_HEADER_SIZE - bufferPosition));
-                        bytesRead = in.gcount();
-                        bufferPosition += bytesRead;
-
-                        if (bufferPosition == OPENDAVINCI_CONTAINER_HEADER_SIZE) {
-                            // Stop processing and redirect bufferIn's underlying pointer to avoid copying data.
-                            bufferIn.rdbuf()->pubsetbuf(&temporaryBuffer[0], bufferPosition);
-                        }
-                    }
-                    else {
-                        in.read(&temporaryBuffer[bufferPosition], (expectedBytes > 1024) ? 1024 : expectedBytes);
-                        const streamsize extractedBytes = in.gcount();
-                        bufferPosition += extractedBytes;
-                        if (extractedBytes > 0) {
-                            expectedBytes -= extractedBytes;
-                        }
-                        else {
-                            cerr << "[core::base::Container] Failed to read " << expectedBytes << "." << endl;
-                        }
-                        if (0 == expectedBytes) {
-                            // Stop processing and redirect bufferIn's underlying pointer to avoid copying data.
-                            bufferIn.rdbuf()->pubsetbuf(&temporaryBuffer[0], bufferPosition);
-                            break;
-                        }
-                    }
+        uint32_t Container::serializeTo(char *buffer, const uint32_t &size) const {
+            const uint32_t serializedSize = getSerializedSize();
+
+            // The payload's length must fit into the 24 bits of the header.
+            if ( (NULL == buffer) || (size < serializedSize) || ((serializedSize - HEADER_SIZE) > 0xFFFFFF) ) {
+                return 0;
+            }
 
-                    if ( (bytesRead == OPENDAVINCI_CONTAINER_HEADER_SIZE) && !consumedOpenDaVINCIContainerHeader) {
-                        consumedOpenDaVINCIContainerHeader = true;
+            // Write Proto header: 0x0D 0xA4 A B C <payload>.
+            // 0xA4 A B C can be read as uint32_t, 0xA4 can be cut and
+            // A B C can be read as little endian shifted by 8 bits to
+            // the right.
+            uint32_t length = ((serializedSize - HEADER_SIZE) << 8) | 0xA4;
+            length = htole32(length);
+            buffer[0] = 0x0D;
+            memcpy(&buffer[1], &length, sizeof(uint32_t));
+
+            char *p = buffer + HEADER_SIZE;
+
+            // Write container data type.
+            p = encodeVarInt(p, (1 << 3) | ProtoSerializer::VARINT);
+            p = encodeVarInt(p, VarIntCodec::encodeZigZag32(m_dataType));
+
+            // Write container data.
+            p = encodeVarInt(p, (2 << 3) | ProtoSerializer::LENGTH_DELIMITED);
+            p = encodeVarInt(p, m_serializedData->size());
+            if (!m_serializedData->empty()) {
+                memcpy(p, m_serializedData->data(), m_serializedData->size());
+                p += m_serializedData->size();
+            }
 
-                        char byte0 = 0;
-                        expectedBytes = 0;
+            // Write time stamps.
+            p = encodeTimeStamp(p, 3, m_sent);
+            p = encodeTimeStamp(p, 4, m_received);
+            p = encodeTimeStamp(p, 5, m_sampleTimeStamp);
 
-                        // Read five bytes OpenDaVINCI Container header.
-                        bufferIn.read(&byte0, sizeof(char));
-                        bufferIn.read((char*)&expectedBytes, sizeof(uint32_t));
+            // Write sender stamp.
+            p = encodeVarInt(p, (6 << 3) | ProtoSerializer::VARINT);
+            p = encodeVarInt(p, m_senderStamp);
 
-                        // Transform value from little endian to host.
-                        expectedBytes = le32toh(expectedBytes);
+            return static_cast<uint32_t>(p - buffer);
+        }
 
-                        // Extract first byte as part of OpenDaVINCI Container header.
-                        unsigned char byte1 = (expectedBytes & 0xFF);
-                        expectedBytes = expectedBytes >> 8;
+        uint32_t Container::deserializeFrom(const char *buffer, const uint32_t &size) {
+            if ( (NULL == buffer) || (size < HEADER_SIZE) ) {
+                return 0;
+            }
+
+            uint32_t length = 0;
+            memcpy(&length, &buffer[1], sizeof(uint32_t));
+            length = le32toh(length);
+            if (!( (0x0D == buffer[0]) && (0xA4 == (length & 0xFF)) )) {
+                std::cerr << "[core::base::Container] Failed to decode OpenDaVINCI container header." << std::endl;
+                return 0;
+            }
+            length = length >> 8;
+            if (size < (HEADER_SIZE + length)) {
+                return 0;
+            }
 
-                        // Allocate contiguous space to store bytes.
-                        bufferPosition = 0;
-                        temporaryBuffer.resize(expectedBytes);
+            const char *p = buffer + HEADER_SIZE;
+            const char *end = p + length;
+            while (p < end) {
+                uint64_t key = 0;
+                if (NULL == (p = decodeVarInt(p, end, key))) {
+                    return 0;
+                }
+                const uint32_t fieldId = static_cast<uint32_t>(key >> 3);
+                const ProtoSerializer::PROTOBUF_TYPE protoType = static_cast<ProtoSerializer::PROTOBUF_TYPE>(key & 0x7);
 
-                        // Check validity of the received bytes.
-                        if (!( (0x0D == byte0) && (0xA4 == byte1) )) {
-                            std::cerr << "[core::base::Container] Failed to decode OpenDaVINCI container header." << std::endl;
-                            return in;
-                        }
+                if (protoType == ProtoSerializer::VARINT) {
+                    uint64_t value = 0;
+                    if (NULL == (p = decodeVarInt(p, end, value))) {
+                        return 0;
+                    }
+                    if (1 == fieldId) {
+                        m_dataType = VarIntCodec::decodeZigZag32(static_cast<uint32_t>(value));
+                    }
+                    else if (6 == fieldId) {
+                        m_senderStamp = static_cast<uint32_t>(value);
+                    }
+                }
+                else if (protoType == ProtoSerializer::LENGTH_DELIMITED) {
+                    uint64_t fieldLength = 0;
+                    if ( (NULL == (p = decodeVarInt(p, end, fieldLength))) || (fieldLength > static_cast<uint64_t>(end - p)) ) {
+                        return 0;
+                    }
+                    const char *fieldEnd = p + fieldLength;
+
+                    bool valid = true;
+                    switch (fieldId) {
+                        case 2:
+                            m_serializedData = std::make_shared<const string>(p, fieldLength);
+                        break;
+                        case 3:
+                            valid = decodeTimeStamp(p, fieldEnd, m_sent);
+                        break;
+                        case 4:
+                            valid = decodeTimeStamp(p, fieldEnd, m_received);
+                        break;
+                        case 5:
+                            valid = decodeTimeStamp(p, fieldEnd, m_sampleTimeStamp);
+                        break;
+                    }
+                    if (!valid) {
+                        return 0;
                     }
+                    p = fieldEnd;
+                }
+                else if ( (protoType == ProtoSerializer::EIGHT_BYTES) && (8 <= (end - p)) ) {
+                    p += 8;
+                }
+                else if ( (protoType == ProtoSerializer::FOUR_BYTES) && (4 <= (end - p)) ) {
+                    p += 4;
+                }
+                else {
+                    return 0;
                 }
             }
 
-            SerializationFactory& sf=SerializationFactory::getInstance();
-            std::shared_ptr<Deserializer> d = sf.getDeserializer(bufferIn);
+            return HEADER_SIZE + length;
+        }
 
-            // Read container data type.
-            d->read(1, m_dataType);
+        bool Container::peekHeader(const char *buffer, const uint32_t &size, int32_t &dataType, uint32_t &senderStamp) {
+            dataType = UNDEFINEDDATA;
+            senderStamp = 0;
 
-            // Read container data.
-            d->read(2, rawData);
-            m_serializedData.str(rawData);
+            if ( (NULL == buffer) || (size < HEADER_SIZE) ) {
+                return false;
+            }
+
+            uint32_t length = 0;
+            memcpy(&length, &buffer[1], sizeof(uint32_t));
+            length = le32toh(length);
+            if ( !( (0x0D == buffer[0]) && (0xA4 == (length & 0xFF)) ) || (size < (HEADER_SIZE + (length >> 8))) ) {
+                return false;
+            }
 
-            // Read sent time stamp data.
-            d->read(3, m_sent); m_sent.computeHumanReadableRepresentation();
+            const char *p = buffer + HEADER_SIZE;
+            const char *end = p + (length >> 8);
+            while (p < end) {
+                uint64_t key = 0;
+                if (NULL == (p = decodeVarInt(p, end, key))) {
+                    return false;
+                }
+                const uint32_t fieldId = static_cast<uint32_t>(key >> 3);
+                const ProtoSerializer::PROTOBUF_TYPE protoType = static_cast<ProtoSerializer::PROTOBUF_TYPE>(key & 0x7);
 
-            // Read received time stamp data.
-            d->read(4, m_received); m_received.computeHumanReadableRepresentation();
+                if (protoType == ProtoSerializer::VARINT) {
+                    uint64_t value = 0;
+                    if (NULL == (p = decodeVarInt(p, end, value))) {
+                        return false;
+                    }
+                    if (1 == fieldId) {
+                        dataType = VarIntCodec::decodeZigZag32(static_cast<uint32_t>(value));
+                    }
+                    else if (6 == fieldId) {
+                        senderStamp = static_cast<uint32_t>(value);
+                    }
+                }
+                else if (protoType == ProtoSerializer::LENGTH_DELIMITED) {
+                    // Skip payload and time stamps.
+                    uint64_t fieldLength = 0;
+                    if ( (NULL == (p = decodeVarInt(p, end, fieldLength))) || (fieldLength > static_cast<uint64_t>(end - p)) ) {
+                        return false;
+                    }
+                    p += fieldLength;
+                }
+                else if ( (protoType == ProtoSerializer::EIGHT_BYTES) && (8 <= (end - p)) ) {
+                    p += 8;
+                }
+                else if ( (protoType == ProtoSerializer::FOUR_BYTES) && (4 <= (end - p)) ) {
+                    p += 4;
+                }
+                else {
+                    return false;
+                }
+            }
 
-            // Read sample time stamp.
-            d->read(5, m_sampleTimeStamp); m_sampleTimeStamp.computeHumanReadableRepresentation();
+            return true;
+        }
 
-            // Read sender stamp.
-            d->read(6, m_senderStamp);
+        uint32_t Container::peekSize(const char *buffer, const uint32_t &size) {
+            if ( (NULL == buffer) || (size < HEADER_SIZE) ) {
+                return 0;
+            }
 
-            return in;
+            uint32_t length = 0;
+            memcpy(&length, &buffer[1], sizeof(uint32_t));
+            length = le32toh(length);
+            if ( !( (0x0D == buffer[0]) && (0xA4 == (length & 0xFF)) ) || (size < (HEADER_SIZE + (length >> 8))) ) {
+                return 0;
+            }
+            return HEADER_SIZE + (length >> 8);
         }
 
         const string Container::toString() const {
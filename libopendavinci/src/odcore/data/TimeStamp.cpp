@@ -36,40 +36,29 @@ namespace odcore {
         using namespace odcore::serialization;
 
         TimeStamp::TimeStamp() :
-            TimePoint(),
-            m_readableYear(0),
-            m_readableMonth(0),
-            m_readableDayOfMonth(0),
-            m_readableHours(0),
-            m_readableMinutes(0),
-            m_readableSeconds(0) {
+            TimePoint() {
+#if !defined(WIN32) && !defined(__APPLE__)
+            // Avoid the factory and any allocation unless the time is controlled.
+            if (!odcore::wrapper::TimeFactory::isControlled()) {
+                timespec ts;
+                clock_gettime(CLOCK_REALTIME, &ts);
+                setSeconds(ts.tv_sec);
+                setMicroseconds(ts.tv_nsec / 1000);
+                return;
+            }
+#endif
             std::shared_ptr<odcore::wrapper::Time> time(odcore::wrapper::TimeFactory::getInstance().now());
             if (time.get()) {
                 setSeconds(time->getSeconds());
                 setMicroseconds(time->getPartialMicroseconds());
-                computeHumanReadableRepresentation();
             }
         }
 
         TimeStamp::TimeStamp(const int32_t &seconds, const int32_t &microSeconds) :
-            TimePoint(seconds, microSeconds),
-            m_readableYear(0),
-            m_readableMonth(0),
-            m_readableDayOfMonth(0),
-            m_readableHours(0),
-            m_readableMinutes(0),
-            m_readableSeconds(0) {
-            computeHumanReadableRepresentation();
-        }
+            TimePoint(seconds, microSeconds) {}
 
         TimeStamp::TimeStamp(const string &ddmmyyyyhhmmss) :
-            TimePoint(),
-            m_readableYear(0),
-            m_readableMonth(0),
-            m_readableDayOfMonth(0),
-            m_readableHours(0),
-            m_readableMinutes(0),
-            m_readableSeconds(0) {
+            TimePoint() {
             if (ddmmyyyyhhmmss.size() == 14) {
                 stringstream dataDD;
                 dataDD.str(ddmmyyyyhhmmss.substr(0, 2));
@@ -152,44 +141,37 @@ namespace odcore {
                 }
 
                 setSeconds((yearsSince01011970 * 365 + additionalLeapDays + cumulativeDays + dd - 1) * 24 * 60 * 60 + hour*60*60 + min*60 + sec);
-                computeHumanReadableRepresentation();
             }
         }
 
         TimeStamp::TimeStamp(const TimeStamp &obj) :
-            TimePoint(obj),
-            m_readableYear(obj.m_readableYear),
-            m_readableMonth(obj.m_readableMonth),
-            m_readableDayOfMonth(obj.m_readableDayOfMonth),
-            m_readableHours(obj.m_readableHours),
-            m_readableMinutes(obj.m_readableMinutes),
-            m_readableSeconds(obj.m_readableSeconds) {}
+            TimePoint(obj) {}
 
         TimeStamp::TimeStamp(const TimePoint &obj) :
-            TimePoint(obj),
-            m_readableYear(0),
-            m_readableMonth(0),
-            m_readableDayOfMonth(0),
-            m_readableHours(0),
-            m_readableMinutes(0),
-            m_readableSeconds(0) {
-            computeHumanReadableRepresentation();
-        }
+            TimePoint(obj) {}
 
         TimeStamp::~TimeStamp() {}
 
         TimeStamp& TimeStamp::operator=(const TimeStamp &obj) {
             TimePoint::operator=(obj);
-            m_readableYear = obj.m_readableYear;
-            m_readableMonth = obj.m_readableMonth;
-            m_readableDayOfMonth = obj.m_readableDayOfMonth;
-            m_readableHours = obj.m_readableHours;
-            m_readableMinutes = obj.m_readableMinutes;
-            m_readableSeconds = obj.m_readableSeconds;
-            computeHumanReadableRepresentation();
             return (*this);
         }
 
+        TimeStamp TimeStamp::now() {
+            return TimeStamp();
+        }
+
+        TimeStamp TimeStamp::nowMonotonic() {
+#if !defined(WIN32) && !defined(__APPLE__)
+            timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return TimeStamp(ts.tv_sec, ts.tv_nsec / 1000);
+#else
+            std::shared_ptr<odcore::wrapper::Time> time(odcore::wrapper::SystemTimeFactory::getInstance().now());
+            return TimeStamp(time->getSeconds(), time->getPartialMicroseconds());
+#endif
+        }
+
         TimeStamp TimeStamp::operator+(const TimeStamp & t) const {
             int32_t sumSeconds = getSeconds() + t.getSeconds();
             int32_t sumMicroseconds = getFractionalMicroseconds() + t.getFractionalMicroseconds();
@@ -250,41 +232,49 @@ namespace odcore {
             return getMicroseconds();
         }
 
-        void TimeStamp::computeHumanReadableRepresentation() {
-            const long int seconds = getSeconds();
-            struct tm *tm = localtime(&seconds);
-
-            m_readableYear = (1900 + tm->tm_year);
-            m_readableMonth = (1 + tm->tm_mon);
-            m_readableDayOfMonth = tm->tm_mday;
-            m_readableHours = tm->tm_hour;
-            m_readableMinutes = tm->tm_min;
-            m_readableSeconds = tm->tm_sec;
+        void TimeStamp::getHumanReadableRepresentation(struct tm &tm) const {
+            const time_t seconds = getSeconds();
+#ifdef WIN32
+            localtime_s(&tm, &seconds);
+#else
+            localtime_r(&seconds, &tm);
+#endif
         }
 
         uint32_t TimeStamp::getHour() const {
-            return m_readableHours;
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            return tm.tm_hour;
         }
 
         uint32_t TimeStamp::getMinute() const {
-            return m_readableMinutes;
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            return tm.tm_min;
         }
 
         uint32_t TimeStamp::getSecond() const {
-            return m_readableSeconds;
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            return tm.tm_sec;
         }
 
         uint32_t TimeStamp::getDay() const {
-            return m_readableDayOfMonth;
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            return tm.tm_mday;
         }
 
         uint32_t TimeStamp::getMonth() const {
-            return m_readableMonth;
-
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            return (1 + tm.tm_mon);
         }
 
         uint32_t TimeStamp::getYear() const {
-            return m_readableYear;
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            return (1900 + tm.tm_year);
         }
 
         bool TimeStamp::isLeapYear(const uint32_t &year) const {
@@ -306,14 +296,16 @@ namespace odcore {
         }
 
         const string TimeStamp::getYYYYMMDD_HHMMSS() const {
-            const uint32_t MONTH = getMonth();
-            const uint32_t DAY = getDay();
-            const uint32_t HOUR = getHour();
-            const uint32_t MINUTE = getMinute();
-            const uint32_t SECOND = getSecond();
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            const uint32_t MONTH = (1 + tm.tm_mon);
+            const uint32_t DAY = tm.tm_mday;
+            const uint32_t HOUR = tm.tm_hour;
+            const uint32_t MINUTE = tm.tm_min;
+            const uint32_t SECOND = tm.tm_sec;
 
             stringstream s;
-            s << getYear() << "-" << ( (MONTH < 10) ? "0" : "" ) << MONTH << "-" << ( (DAY < 10) ? "0" : "" ) << DAY
+            s << (1900 + tm.tm_year) << "-" << ( (MONTH < 10) ? "0" : "" ) << MONTH << "-" << ( (DAY < 10) ? "0" : "" ) << DAY
                            << " " << ( (HOUR < 10) ? "0" : "" ) << HOUR
                            << ":" << ( (MINUTE < 10) ? "0" : "" ) << MINUTE
                            << ":" << ( (SECOND < 10) ? "0" : "" ) << SECOND;
@@ -321,14 +313,16 @@ namespace odcore {
         }
 
         const string TimeStamp::getYYYYMMDD_HHMMSS_noBlank() const {
-            const uint32_t MONTH = getMonth();
-            const uint32_t DAY = getDay();
-            const uint32_t HOUR = getHour();
-            const uint32_t MINUTE = getMinute();
-            const uint32_t SECOND = getSecond();
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            const uint32_t MONTH = (1 + tm.tm_mon);
+            const uint32_t DAY = tm.tm_mday;
+            const uint32_t HOUR = tm.tm_hour;
+            const uint32_t MINUTE = tm.tm_min;
+            const uint32_t SECOND = tm.tm_sec;
 
             stringstream s;
-            s << getYear() << "-" << ( (MONTH < 10) ? "0" : "" ) << MONTH << "-" << ( (DAY < 10) ? "0" : "" ) << DAY
+            s << (1900 + tm.tm_year) << "-" << ( (MONTH < 10) ? "0" : "" ) << MONTH << "-" << ( (DAY < 10) ? "0" : "" ) << DAY
                            << "_" << ( (HOUR < 10) ? "0" : "" ) << HOUR
                            << ":" << ( (MINUTE < 10) ? "0" : "" ) << MINUTE
                            << ":" << ( (SECOND < 10) ? "0" : "" ) << SECOND;
@@ -336,14 +330,16 @@ namespace odcore {
         }
 
         const string TimeStamp::getYYYYMMDD_HHMMSS_noBlankNoColons() const {
-            const uint32_t MONTH = getMonth();
-            const uint32_t DAY = getDay();
-            const uint32_t HOUR = getHour();
-            const uint32_t MINUTE = getMinute();
-            const uint32_t SECOND = getSecond();
+            struct tm tm;
+            getHumanReadableRepresentation(tm);
+            const uint32_t MONTH = (1 + tm.tm_mon);
+            const uint32_t DAY = tm.tm_mday;
+            const uint32_t HOUR = tm.tm_hour;
+            const uint32_t MINUTE = tm.tm_min;
+            const uint32_t SECOND = tm.tm_sec;
 
             stringstream s;
-            s << getYear() << "-" << ( (MONTH < 10) ? "0" : "" ) << MONTH << "-" << ( (DAY < 10) ? "0" : "" ) << DAY
+            s << (1900 + tm.tm_year) << "-" << ( (MONTH < 10) ? "0" : "" ) << MONTH << "-" << ( (DAY < 10) ? "0" : "" ) << DAY
                            << "_" << ( (HOUR < 10) ? "0" : "" ) << HOUR
                            << "" << ( (MINUTE < 10) ? "0" : "" ) << MINUTE
                            << "" << ( (SECOND < 10) ? "0" : "" ) << SECOND;
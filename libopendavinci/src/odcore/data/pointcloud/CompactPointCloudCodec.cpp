@@ -0,0 +1,337 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <string>
+
+#include "opendavinci/odcore/data/pointcloud/CompactPointCloudCodec.h"
+
+namespace odcore {
+    namespace data {
+        namespace pointcloud {
+
+            using namespace std;
+
+            namespace {
+                const float DEG2RAD = 0.017453292519943295f;
+                const float RAD2DEG = 57.29577951308232f;
+
+                /**
+                 * Layout of the 16 bit values of a CompactPointCloud.
+                 */
+                struct ValueLayout {
+                    uint16_t m_distanceMask;
+                    uint16_t m_intensityShift;
+                    uint16_t m_intensityMask;
+                };
+
+                ValueLayout getValueLayout(const uint8_t &numberOfBitsForIntensity, const CompactPointCloud::INTENSITY_PLACEMENT &intensityPlacement) {
+                    ValueLayout layout;
+                    layout.m_distanceMask = 0xFFFF;
+                    layout.m_intensityShift = 0;
+                    layout.m_intensityMask = 0;
+
+                    const uint8_t bits = (numberOfBitsForIntensity > 16) ? 16 : numberOfBitsForIntensity;
+                    if (bits > 0) {
+                        layout.m_intensityMask = static_cast<uint16_t>((1u << bits) - 1);
+                        if (CompactPointCloud::HIGHER_BITS == intensityPlacement) {
+                            layout.m_distanceMask = static_cast<uint16_t>(0xFFFFu >> bits);
+                            layout.m_intensityShift = 16 - bits;
+                        }
+                        else {
+                            layout.m_distanceMask = static_cast<uint16_t>(0xFFFFu << bits);
+                        }
+                    }
+                    return layout;
+                }
+
+                inline float getScale(const CompactPointCloud::DISTANCE_ENCODING &distanceEncoding) {
+                    // Resolution is 1cm or 2mm, respectively.
+                    return (CompactPointCloud::MM == distanceEncoding) ? 500.0f : 100.0f;
+                }
+            }
+
+            CompactPointCloudCodec::CompactPointCloudCodec(const vector<float> &verticalAngles) :
+                m_numberOfLayers(static_cast<uint32_t>(verticalAngles.size())),
+                m_networkByteOrder(true),
+                m_sinVertical(verticalAngles.size()),
+                m_cosVertical(verticalAngles.size()),
+                m_sinAzimuth(),
+                m_cosAzimuth(),
+                m_distances() {
+                for (uint32_t i = 0; i < m_numberOfLayers; i++) {
+                    m_sinVertical[i] = sin(verticalAngles[i] * DEG2RAD);
+                    m_cosVertical[i] = cos(verticalAngles[i] * DEG2RAD);
+                }
+            }
+
+            CompactPointCloudCodec::~CompactPointCloudCodec() {}
+
+            uint32_t CompactPointCloudCodec::getNumberOfLayers() const {
+                return m_numberOfLayers;
+            }
+
+            void CompactPointCloudCodec::setNetworkByteOrder(const bool &networkByteOrder) {
+                m_networkByteOrder = networkByteOrder;
+            }
+
+            const vector<float>& CompactPointCloudCodec::getDistances() const {
+                return m_distances;
+            }
+
+            uint32_t CompactPointCloudCodec::decodeDistances(const CompactPointCloud &cpc, vector<float> &distance, vector<float> &intensity) const {
+                const string distances = cpc.getDistances();
+                const uint32_t numberOfPoints = static_cast<uint32_t>(distances.size() / 2);
+                distance.resize(numberOfPoints);
+                intensity.resize(numberOfPoints);
+                if (0 == numberOfPoints) {
+                    return 0;
+                }
+
+                const ValueLayout layout = getValueLayout(cpc.getNumberOfBitsForIntensity(), cpc.getIntensityPlacement());
+                const float scale = 1.0f / getScale(cpc.getDistanceEncoding());
+                const uint8_t *src = reinterpret_cast<const uint8_t*>(distances.data());
+                float *d = &distance[0];
+                float *in = &intensity[0];
+                uint32_t i = 0;
+
+#if defined(__AVX2__)
+                {
+                    const __m256i distanceMask = _mm256_set1_epi16(static_cast<int16_t>(layout.m_distanceMask));
+                    const __m256i intensityMask = _mm256_set1_epi16(static_cast<int16_t>(layout.m_intensityMask));
+                    const __m128i intensityShift = _mm_cvtsi32_si128(layout.m_intensityShift);
+                    const __m256 scaleFactor = _mm256_set1_ps(scale);
+                    for (; numberOfPoints - i >= 16; i += 16) {
+                        __m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * i));
+                        if (m_networkByteOrder) {
+                            raw = _mm256_or_si256(_mm256_slli_epi16(raw, 8), _mm256_srli_epi16(raw, 8));
+                        }
+                        const __m256i distances16 = _mm256_and_si256(raw, distanceMask);
+                        const __m256i intensities16 = _mm256_and_si256(_mm256_srl_epi16(raw, intensityShift), intensityMask);
+
+                        _mm256_storeu_ps(d + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(distances16))), scaleFactor));
+                        _mm256_storeu_ps(d + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(distances16, 1))), scaleFactor));
+                        _mm256_storeu_ps(in + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(intensities16))));
+                        _mm256_storeu_ps(in + i + 8, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(intensities16, 1))));
+                    }
+                }
+#elif defined(__SSE2__)
+                {
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i distanceMask = _mm_set1_epi16(static_cast<int16_t>(layout.m_distanceMask));
+                    const __m128i intensityMask = _mm_set1_epi16(static_cast<int16_t>(layout.m_intensityMask));
+                    const __m128i intensityShift = _mm_cvtsi32_si128(layout.m_intensityShift);
+                    const __m128 scaleFactor = _mm_set1_ps(scale);
+                    for (; numberOfPoints - i >= 8; i += 8) {
+                        __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i));
+                        if (m_networkByteOrder) {
+                            raw = _mm_or_si128(_mm_slli_epi16(raw, 8), _mm_srli_epi16(raw, 8));
+                        }
+                        const __m128i distances16 = _mm_and_si128(raw, distanceMask);
+                        const __m128i intensities16 = _mm_and_si128(_mm_srl_epi16(raw, intensityShift), intensityMask);
+
+                        _mm_storeu_ps(d + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(distances16, zero)), scaleFactor));
+                        _mm_storeu_ps(d + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(distances16, zero)), scaleFactor));
+                        _mm_storeu_ps(in + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(intensities16, zero)));
+                        _mm_storeu_ps(in + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(intensities16, zero)));
+                    }
+                }
+#endif
+
+                for (; i < numberOfPoints; i++) {
+                    uint16_t raw = 0;
+                    if (m_networkByteOrder) {
+                        raw = static_cast<uint16_t>((src[2 * i] << 8) | src[2 * i + 1]);
+                    }
+                    else {
+                        memcpy(&raw, src + 2 * i, sizeof(uint16_t));
+                    }
+                    d[i] = static_cast<float>(raw & layout.m_distanceMask) * scale;
+                    in[i] = static_cast<float>((raw >> layout.m_intensityShift) & layout.m_intensityMask);
+                }
+
+                return numberOfPoints;
+            }
+
+            uint32_t CompactPointCloudCodec::decode(const CompactPointCloud &cpc, vector<float> &x, vector<float> &y, vector<float> &z, vector<float> &intensity) {
+                decodeDistances(cpc, m_distances, intensity);
+
+                // Only complete azimuths can be converted.
+                const uint32_t numberOfAzimuths = ( (m_numberOfLayers > 0) && (cpc.getEntriesPerAzimuth() == m_numberOfLayers) ) ? static_cast<uint32_t>(m_distances.size()) / m_numberOfLayers : 0;
+                const uint32_t numberOfPoints = numberOfAzimuths * m_numberOfLayers;
+                m_distances.resize(numberOfPoints);
+                intensity.resize(numberOfPoints);
+                x.resize(numberOfPoints);
+                y.resize(numberOfPoints);
+                z.resize(numberOfPoints);
+
+                if (numberOfPoints > 0) {
+                    const float azimuthIncrement = (cpc.getEndAzimuth() - cpc.getStartAzimuth()) / numberOfAzimuths;
+                    toCartesian(cpc.getStartAzimuth(), azimuthIncrement, numberOfAzimuths, &x[0], &y[0], &z[0]);
+                }
+
+                return numberOfPoints;
+            }
+
+            void CompactPointCloudCodec::toCartesian(const float &startAzimuth, const float &azimuthIncrement, const uint32_t &numberOfAzimuths, float *x, float *y, float *z) {
+                m_sinAzimuth.resize(numberOfAzimuths);
+                m_cosAzimuth.resize(numberOfAzimuths);
+                for (uint32_t a = 0; a < numberOfAzimuths; a++) {
+                    const float azimuth = (startAzimuth + a * azimuthIncrement) * DEG2RAD;
+                    m_sinAzimuth[a] = sin(azimuth);
+                    m_cosAzimuth[a] = cos(azimuth);
+                }
+
+                const float *d = &m_distances[0];
+                const float *sinVertical = &m_sinVertical[0];
+                const float *cosVertical = &m_cosVertical[0];
+                for (uint32_t a = 0; a < numberOfAzimuths; a++) {
+                    const uint32_t offset = a * m_numberOfLayers;
+                    uint32_t l = 0;
+
+#if defined(__AVX2__)
+                    const __m256 sinAzimuth = _mm256_set1_ps(m_sinAzimuth[a]);
+                    const __m256 cosAzimuth = _mm256_set1_ps(m_cosAzimuth[a]);
+                    for (; m_numberOfLayers - l >= 8; l += 8) {
+                        const __m256 distance = _mm256_loadu_ps(d + offset + l);
+                        const __m256 xyDistance = _mm256_mul_ps(distance, _mm256_loadu_ps(cosVertical + l));
+                        _mm256_storeu_ps(x + offset + l, _mm256_mul_ps(xyDistance, sinAzimuth));
+                        _mm256_storeu_ps(y + offset + l, _mm256_mul_ps(xyDistance, cosAzimuth));
+                        _mm256_storeu_ps(z + offset + l, _mm256_mul_ps(distance, _mm256_loadu_ps(sinVertical + l)));
+                    }
+#elif defined(__SSE2__)
+                    const __m128 sinAzimuth = _mm_set1_ps(m_sinAzimuth[a]);
+                    const __m128 cosAzimuth = _mm_set1_ps(m_cosAzimuth[a]);
+                    for (; m_numberOfLayers - l >= 4; l += 4) {
+                        const __m128 distance = _mm_loadu_ps(d + offset + l);
+                        const __m128 xyDistance = _mm_mul_ps(distance, _mm_loadu_ps(cosVertical + l));
+                        _mm_storeu_ps(x + offset + l, _mm_mul_ps(xyDistance, sinAzimuth));
+                        _mm_storeu_ps(y + offset + l, _mm_mul_ps(xyDistance, cosAzimuth));
+                        _mm_storeu_ps(z + offset + l, _mm_mul_ps(distance, _mm_loadu_ps(sinVertical + l)));
+                    }
+#endif
+
+                    for (; l < m_numberOfLayers; l++) {
+                        const float xyDistance = d[offset + l] * cosVertical[l];
+                        x[offset + l] = xyDistance * m_sinAzimuth[a];
+                        y[offset + l] = xyDistance * m_cosAzimuth[a];
+                        z[offset + l] = d[offset + l] * sinVertical[l];
+                    }
+                }
+            }
+
+            CompactPointCloud CompactPointCloudCodec::encode(const SharedPointCloud &spc, const float *points, const CompactPointCloud::DISTANCE_ENCODING &distanceEncoding, const uint8_t &numberOfBitsForIntensity, const CompactPointCloud::INTENSITY_PLACEMENT &intensityPlacement) const {
+                CompactPointCloud cpc;
+
+                const uint32_t numberOfPoints = spc.getWidth() * ((spc.getHeight() > 0) ? spc.getHeight() : 1);
+                const bool polar = (SharedPointCloud::POLAR_INTENSITY == spc.getUserInfo());
+                if ( (NULL == points) ||
+                     (0 == m_numberOfLayers) || (m_numberOfLayers > 255) ||
+                     (0 != (numberOfPoints % m_numberOfLayers)) ||
+                     (4 != spc.getNumberOfComponentsPerPoint()) ||
+                     (SharedPointCloud::FLOAT_T != spc.getComponentDataType()) ||
+                     ( (!polar) && (SharedPointCloud::XYZ_INTENSITY != spc.getUserInfo()) ) ||
+                     (numberOfBitsForIntensity > 8) ) {
+                    return cpc;
+                }
+
+                const ValueLayout layout = getValueLayout(numberOfBitsForIntensity, intensityPlacement);
+                const float scale = getScale(distanceEncoding);
+                const uint32_t maxDistance = layout.m_distanceMask;
+
+                string distances(2 * numberOfPoints, '\0');
+                int64_t firstAzimuthIndex = -1;
+                int64_t lastAzimuthIndex = -1;
+                float firstAzimuth = 0;
+                float lastAzimuth = 0;
+                for (uint32_t i = 0; i < numberOfPoints; i++) {
+                    const float *point = points + 4 * i;
+
+                    float distance = 0;
+                    float azimuth = 0;
+                    if (polar) {
+                        distance = point[0];
+                        azimuth = point[1];
+                    }
+                    else {
+                        distance = sqrt(point[0] * point[0] + point[1] * point[1] + point[2] * point[2]);
+                        azimuth = atan2(point[0], point[1]) * RAD2DEG;
+                        if (azimuth < 0) {
+                            azimuth += 360.0f;
+                        }
+                    }
+
+                    // Points without reflection do not tell their azimuth.
+                    if (distance > 0) {
+                        const int64_t azimuthIndex = i / m_numberOfLayers;
+                        if (firstAzimuthIndex < 0) {
+                            firstAzimuthIndex = azimuthIndex;
+                            firstAzimuth = azimuth;
+                        }
+                        if (azimuthIndex > firstAzimuthIndex) {
+                            lastAzimuthIndex = azimuthIndex;
+                            lastAzimuth = azimuth;
+                        }
+                    }
+
+                    uint32_t value = (distance > 0) ? static_cast<uint32_t>(distance * scale + 0.5f) : 0;
+                    value = ((value > maxDistance) ? maxDistance : value) & layout.m_distanceMask;
+
+                    if (numberOfBitsForIntensity > 0) {
+                        const float intensity = (point[3] < 0) ? 0 : ((point[3] > 255.0f) ? 255.0f : point[3]);
+                        const uint32_t level = static_cast<uint32_t>(intensity) >> (8 - numberOfBitsForIntensity);
+                        value |= (level << layout.m_intensityShift);
+                    }
+
+                    distances[2 * i] = static_cast<char>((value >> 8) & 0xFF);
+                    distances[2 * i + 1] = static_cast<char>(value & 0xFF);
+                }
+
+                // Derive the azimuths from the first and last azimuth with reflections.
+                const uint32_t numberOfAzimuths = numberOfPoints / m_numberOfLayers;
+                float azimuthIncrement = 0;
+                if (lastAzimuthIndex > firstAzimuthIndex) {
+                    if (lastAzimuth < firstAzimuth) {
+                        lastAzimuth += 360.0f;
+                    }
+                    azimuthIncrement = (lastAzimuth - firstAzimuth) / (lastAzimuthIndex - firstAzimuthIndex);
+                }
+                const float startAzimuth = (firstAzimuthIndex > 0) ? firstAzimuth - firstAzimuthIndex * azimuthIncrement : firstAzimuth;
+
+                cpc.setStartAzimuth(startAzimuth);
+                cpc.setEndAzimuth(startAzimuth + numberOfAzimuths * azimuthIncrement);
+                cpc.setEntriesPerAzimuth(static_cast<uint8_t>(m_numberOfLayers));
+                cpc.setDistances(distances);
+                cpc.setNumberOfBitsForIntensity(numberOfBitsForIntensity);
+                cpc.setIntensityPlacement(intensityPlacement);
+                cpc.setDistanceEncoding(distanceEncoding);
+                return cpc;
+            }
+
+        }
+    }
+} // odcore::data::pointcloud
@@ -57,6 +57,7 @@ namespace odcore {
                 m_listenerMutex(),
                 m_listener(NULL),
                 m_pulseCondition(),
+                m_hasReceivedPulse(false),
                 m_pulseMessageMutex(),
                 m_pulseMessage() {
                 m_connection.setContainerListener(this);
@@ -136,6 +137,7 @@ namespace odcore {
 
                     {
                         Lock l(m_pulseCondition);
+                        m_hasReceivedPulse = true;
                         m_pulseCondition.wakeAll();
                     }
                 }
@@ -145,8 +147,12 @@ namespace odcore {
                 PulseMessage pm;
 
                 {
+                    // A pulse that arrived before we started waiting must not get lost.
                     Lock l(m_pulseCondition);
-                    m_pulseCondition.waitOnSignal();
+                    if (!m_hasReceivedPulse) {
+                        m_pulseCondition.waitOnSignal();
+                    }
+                    m_hasReceivedPulse = false;
                 }
 
                 {
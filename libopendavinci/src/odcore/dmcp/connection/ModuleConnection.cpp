@@ -87,68 +87,70 @@ namespace odcore {
                 m_connection->send(c);
             }
 
+            bool ModuleConnection::isConnectionLost() {
+                Lock l(m_connectionLostMutex);
+                return m_connectionLost;
+            }
+
             void ModuleConnection::pulse_ack(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
-                // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack_containers)
+                send_pulse_ack(pm);
+                wait_for_pulse_ack(timeout);
+            }
+
+            vector<odcore::data::Container> ModuleConnection::pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
+                send_pulse_ack_containers(pm);
+                return wait_for_pulse_ack_containers(timeout);
+            }
+
+            void ModuleConnection::send_pulse_ack(const odcore::data::dmcp::PulseMessage &pm) {
+                // Unfortunately, we cannot prevent code duplication here (cf. send_pulse_ack_containers)
                 // as in this case, the dependent client module will NOT send its containers to using
                 // this TCP link but via the regular UDP multicast conference.
-                bool connectionLost = true;
-
                 {
-                    Lock l(m_connectionLostMutex);
-                    connectionLost = m_connectionLost;
+                    Lock l(m_pulseAckCondition);
+                    m_hasReceivedPulseAck = false;
                 }
 
-                // Only wait for a confirmation from dependent modules when they are still connected.
-                if (!connectionLost) {
-                    {
-                        Lock l(m_pulseAckCondition);
-                        m_hasReceivedPulseAck = false;
-                    }
-
+                // Only send pulses to dependent modules when they are still connected.
+                if (!isConnectionLost()) {
                     Container c(pm);
                     m_connection->send(c);
+                }
+            }
 
-                    // Wait for the ACK message from client.
-                    {
-                        Lock l(m_pulseAckCondition);
-                        if (!m_hasReceivedPulseAck) {
-                            m_pulseAckCondition.waitOnSignalWithTimeout(timeout);
-                        }
-                    }
+            void ModuleConnection::wait_for_pulse_ack(const uint32_t &timeout) {
+                Lock l(m_pulseAckCondition);
+
+                // Only wait for a confirmation from dependent modules when they are still connected.
+                if (!m_hasReceivedPulseAck && !isConnectionLost()) {
+                    m_pulseAckCondition.waitOnSignalWithTimeout(timeout);
                 }
             }
 
-            vector<odcore::data::Container> ModuleConnection::pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
-                // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack)
+            void ModuleConnection::send_pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm) {
+                // Unfortunately, we cannot prevent code duplication here (cf. send_pulse_ack)
                 // as in this case, the dependent client module will send all its containers
                 // via this TCP link and NOT via the regular UDP multicast conference.
-
-                // Assume that we don't receive any further containers.
-                m_containersToBeTransferredToSupercomponent.clear();
-
-                bool connectionLost = true;
                 {
-                    Lock l(m_connectionLostMutex);
-                    connectionLost = m_connectionLost;
+                    // Assume that we don't receive any further containers.
+                    Lock l(m_pulseAckContainersCondition);
+                    m_hasReceivedPulseAckContainers = false;
+                    m_containersToBeTransferredToSupercomponent.clear();
                 }
 
-                // Only wait for a confirmation from dependent modules when they are still connected.
-                if (!connectionLost) {
-                    {
-                        Lock l(m_pulseAckContainersCondition);
-                        m_hasReceivedPulseAckContainers = false;
-                    }
-
+                // Only send pulses to dependent modules when they are still connected.
+                if (!isConnectionLost()) {
                     Container c(pm);
                     m_connection->send(c);
+                }
+            }
 
-                    // Wait for the ACK message from client.
-                    {
-                        Lock l(m_pulseAckContainersCondition);
-                        if (!m_hasReceivedPulseAckContainers) {
-                            m_pulseAckContainersCondition.waitOnSignalWithTimeout(timeout);
-                        }
-                    }
+            vector<odcore::data::Container> ModuleConnection::wait_for_pulse_ack_containers(const uint32_t &timeout) {
+                Lock l(m_pulseAckContainersCondition);
+
+                // Only wait for a confirmation from dependent modules when they are still connected.
+                if (!m_hasReceivedPulseAckContainers && !isConnectionLost()) {
+                    m_pulseAckContainersCondition.waitOnSignalWithTimeout(timeout);
                 }
 
                 return m_containersToBeTransferredToSupercomponent;
@@ -17,9 +17,10 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include <iosfwd>
+#include <iostream>
 
 #include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odcore/serialization/Serializable.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
@@ -98,10 +99,14 @@ namespace odcore {
                 container.setSampleTimeStamp(container.getSentTimeStamp());
             }
 
-            stringstream stringstreamValue;
-            stringstreamValue << container;
+            // Serialize the container directly into the buffer to be sent.
+            string data(container.getSerializedSize(), '\0');
+            if (0 == container.serializeTo(&data[0], data.length())) {
+                CLOG1 << "[Connection] Container of type " << container.getDataType() << " could not be serialized; skipped." << endl;
+                return;
+            }
 
-            m_connection->send(stringstreamValue.str());
+            m_connection->send(data);
         }
 
         void Connection::nextString(const string &s) {
@@ -109,9 +114,7 @@ namespace odcore {
 
             if (m_listener != NULL) {
                 Container container;
-
-                stringstream stringstreamData(s);
-                stringstreamData >> container;
+                container.deserializeFrom(s.data(), s.length());
 
                 container.setReceivedTimeStamp(TimeStamp());
 
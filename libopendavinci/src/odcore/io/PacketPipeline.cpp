@@ -27,13 +27,18 @@ namespace odcore {
         using namespace odcore::base;
         using namespace odcore::data;
 
-        PacketPipeline::PacketPipeline() :
+        PacketPipeline::PacketPipeline(const uint32_t &capacity, const OVERFLOW_POLICY &policy) :
             Service(),
             PacketObserver(),
             PacketListener(),
+            m_queue(capacity),
+            m_policy(policy),
             m_queueCondition(),
-            m_queueMutex(),
-            m_queue(),
+            m_consumerWaiting(false),
+            m_spaceCondition(),
+            m_producerWaiting(false),
+            m_droppedPackets(0),
+            m_maximumQueueDepth(0),
             m_packetListenerMutex(),
             m_packetListener(NULL) {}
 
@@ -51,64 +56,96 @@ namespace odcore {
             }
         }
 
-        void PacketPipeline::nextPacket(const Packet &s) {
-            Lock l(m_queueCondition);
+        uint64_t PacketPipeline::getNumberOfDroppedPackets() const {
+            return m_droppedPackets.load();
+        }
+
+        uint32_t PacketPipeline::getMaximumQueueDepth() const {
+            return m_maximumQueueDepth.load();
+        }
 
+        void PacketPipeline::nextPacket(const Packet &s) {
             // Enter new data.
-            {
-                Lock l2(m_queueMutex);
-                m_queue.push(s);
+            bool added = m_queue.push(s);
+            if ( (!added) && (BLOCK == m_policy) ) {
+                // Apply backpressure until the consumer has made room.
+                Lock l(m_spaceCondition);
+                m_producerWaiting.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                while ( (!(added = m_queue.push(s))) && isRunning() ) {
+                    m_spaceCondition.waitOnSignal();
+                }
+                m_producerWaiting.store(false);
+            }
+            if (!added) {
+                m_droppedPackets++;
+                return;
             }
 
-            // Wake awaiting threads.
-            m_queueCondition.wakeAll();
+            // Only this thread is adding entries.
+            const uint32_t depth = m_queue.getSize();
+            if (depth > m_maximumQueueDepth.load(std::memory_order_relaxed)) {
+                m_maximumQueueDepth.store(depth, std::memory_order_relaxed);
+            }
+
+            // Wake awaiting thread; no locking is required while it is busy.
+            if (m_consumerWaiting.load()) {
+                Lock l(m_queueCondition);
+                m_queueCondition.wakeAll();
+            }
         }
 
         void PacketPipeline::processQueue() {
-            uint32_t numberOfEntries = 0;
+            // Process all entries that are available at this moment in one batch.
+            uint32_t numberOfEntries = m_queue.getSize();
 
-            // Determine the amount of current entries.
-            {
-                Lock l(m_queueMutex);
-                numberOfEntries = static_cast<uint32_t>(m_queue.size());
-            }
+            Lock l(m_packetListenerMutex);
+            while (numberOfEntries-- > 0) {
+                const Packet *entry = m_queue.front();
+                if (NULL == entry) {
+                    break;
+                }
 
-            Packet entry;
-            for (uint32_t i = 0; i < numberOfEntries; i++) {
-                // Acquire and remove next entry.
-                {
-                    Lock l2(m_queueMutex);
-                    entry = m_queue.front();
-                    m_queue.pop();
+                if (m_packetListener != NULL) {
+                    // Distribute entry in place; its slot is reused only after pop().
+                    m_packetListener->nextPacket(*entry);
                 }
+                m_queue.pop();
 
-                // Read all entries and distribute using the packetListener.
-                {
-                    Lock l(m_packetListenerMutex);
-                    if (m_packetListener != NULL) {
-                        // Distribute entry to connected listeners while NOT locking the queue.
-                        m_packetListener->nextPacket(entry);
-                    }
+                // Wake a producer waiting for room; no locking is required otherwise.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_producerWaiting.load()) {
+                    Lock l2(m_spaceCondition);
+                    m_spaceCondition.wakeAll();
                 }
             }
         }
 
         void PacketPipeline::beforeStop() {
             // Wake awaiting threads.
-            Lock l(m_queueCondition);
-            m_queueCondition.wakeAll();
+            {
+                Lock l(m_queueCondition);
+                m_queueCondition.wakeAll();
+            }
+            {
+                Lock l(m_spaceCondition);
+                m_spaceCondition.wakeAll();
+            }
         }
 
         void PacketPipeline::run() {
             serviceReady();
 
             while (isRunning()) {
-                Lock l(m_queueCondition);
-                m_queueCondition.waitOnSignal();
+                processQueue();
 
-                if (isRunning()) {
-                    processQueue();
+                Lock l(m_queueCondition);
+                m_consumerWaiting.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_queue.isEmpty() && isRunning()) {
+                    m_queueCondition.waitOnSignal();
                 }
+                m_consumerWaiting.store(false);
             }
 
             // Procee the queue to release any further waiting entries before shutting down.
@@ -0,0 +1,68 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "opendavinci/odcore/io/ReadOnlyStreamBuffer.h"
+
+namespace odcore {
+    namespace io {
+
+        using namespace std;
+
+        ReadOnlyStreamBuffer::ReadOnlyStreamBuffer(const char *data, const size_t &size) :
+            streambuf() {
+            // The get area is never written to; streambuf's interface
+            // requires a non-const pointer nevertheless.
+            char *begin = const_cast<char*>(data);
+            setg(begin, begin, begin + size);
+        }
+
+        ReadOnlyStreamBuffer::~ReadOnlyStreamBuffer() {}
+
+        const char* ReadOnlyStreamBuffer::getCurrentPosition() const {
+            return gptr();
+        }
+
+        ReadOnlyStreamBuffer::pos_type ReadOnlyStreamBuffer::seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which) {
+            if ((which & ios_base::in) == 0) {
+                return pos_type(off_type(-1));
+            }
+
+            off_type base = 0;
+            if (dir == ios_base::cur) {
+                base = gptr() - eback();
+            }
+            else if (dir == ios_base::end) {
+                base = egptr() - eback();
+            }
+
+            const off_type newPosition = base + off;
+            if ( (newPosition < 0) || (newPosition > (egptr() - eback())) ) {
+                return pos_type(off_type(-1));
+            }
+
+            setg(eback(), eback() + newPosition, egptr());
+            return pos_type(newPosition);
+        }
+
+        ReadOnlyStreamBuffer::pos_type ReadOnlyStreamBuffer::seekpos(pos_type pos, ios_base::openmode which) {
+            return seekoff(off_type(pos), ios_base::beg, which);
+        }
+
+    }
+} // odcore::io
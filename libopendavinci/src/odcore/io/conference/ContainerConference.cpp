@@ -18,11 +18,10 @@
  */
 
 #include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
 
-namespace odcore { namespace data { class Container; } }
-
 namespace odcore {
     namespace io {
         namespace conference {
@@ -35,7 +34,9 @@ namespace odcore {
                 m_containerListenerMutex(),
                 m_containerListener(NULL),
                 m_senderStampMutex(),
-                m_senderStamp(0) {}
+                m_senderStamp(0),
+                m_subscriptionsMutex(),
+                m_subscriptions() {}
 
             ContainerConference::~ContainerConference() {}
 
@@ -49,6 +50,12 @@ namespace odcore {
                 return m_containerListener;
             }
 
+            void ContainerConference::sendBatch(vector<Container> &containers) const {
+                for (vector<Container>::iterator it = containers.begin(); it != containers.end(); ++it) {
+                    send(*it);
+                }
+            }
+
             void ContainerConference::setSenderStamp(const uint32_t &senderStamp) {
                 Lock l(m_senderStampMutex);
                 m_senderStamp = senderStamp;
@@ -59,6 +66,51 @@ namespace odcore {
                 return m_senderStamp;
             }
 
+            void ContainerConference::addSubscription(const int32_t &dataType) {
+                Lock l(m_subscriptionsMutex);
+                m_subscriptions[dataType].clear();
+            }
+
+            void ContainerConference::addSubscription(const int32_t &dataType, const uint32_t &senderStamp) {
+                Lock l(m_subscriptionsMutex);
+                map<int32_t, set<uint32_t> >::iterator it = m_subscriptions.find(dataType);
+                if (it == m_subscriptions.end()) {
+                    m_subscriptions[dataType].insert(senderStamp);
+                }
+                else if (!it->second.empty()) {
+                    // An empty set accepts all sender stamps already.
+                    it->second.insert(senderStamp);
+                }
+            }
+
+            void ContainerConference::clearSubscriptions() {
+                Lock l(m_subscriptionsMutex);
+                m_subscriptions.clear();
+            }
+
+            bool ContainerConference::isSubscribedTo(const int32_t &dataType, const uint32_t &senderStamp) const {
+                Lock l(m_subscriptionsMutex);
+                if (m_subscriptions.empty()) {
+                    return true;
+                }
+
+                map<int32_t, set<uint32_t> >::const_iterator it = m_subscriptions.find(dataType);
+                return (it != m_subscriptions.end()) && (it->second.empty() || (it->second.count(senderStamp) > 0));
+            }
+
+            bool ContainerConference::isSubscribedTo(const char *buffer, const uint32_t &size) const {
+                {
+                    Lock l(m_subscriptionsMutex);
+                    if (m_subscriptions.empty()) {
+                        return true;
+                    }
+                }
+
+                int32_t dataType = 0;
+                uint32_t senderStamp = 0;
+                return Container::peekHeader(buffer, size, dataType, senderStamp) && isSubscribedTo(dataType, senderStamp);
+            }
+
             bool ContainerConference::hasContainerListener() const {
                 bool hasListener = false;
                 {
@@ -69,6 +121,10 @@ namespace odcore {
             }
 
             void ContainerConference::receive(Container &c) {
+                if (!isSubscribedTo(c.getDataType(), c.getSenderStamp())) {
+                    return;
+                }
+
                 Lock l(m_containerListenerMutex);
                 if (m_containerListener != NULL) {
                     m_containerListener->nextContainer(c);
@@ -20,6 +20,7 @@
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
 #include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
+#include "opendavinci/odcore/io/conference/SharedMemoryContainerConference.h"
 #include "opendavinci/odcore/io/conference/UDPMultiCastContainerConference.h"
 
 namespace odcore {
@@ -33,7 +34,8 @@ namespace odcore {
             Mutex ContainerConferenceFactory::m_singletonMutex;
             ContainerConferenceFactory* ContainerConferenceFactory::m_singleton = NULL;
 
-            ContainerConferenceFactory::ContainerConferenceFactory() {}
+            ContainerConferenceFactory::ContainerConferenceFactory() :
+                m_transport(UDP_MULTICAST) {}
 
             ContainerConferenceFactory::~ContainerConferenceFactory() {
                 setSingleton(NULL);
@@ -55,9 +57,20 @@ namespace odcore {
             }
 
             std::shared_ptr<ContainerConference> ContainerConferenceFactory::getContainerConference(const string &address, const uint32_t &port) {
+                if (SHARED_MEMORY == m_transport) {
+                    return std::shared_ptr<ContainerConference>(new SharedMemoryContainerConference(address, port));
+                }
                 return std::shared_ptr<ContainerConference>(new UDPMultiCastContainerConference(address, port));
             }
 
+            void ContainerConferenceFactory::setTransport(const TRANSPORT &transport) {
+                m_transport = transport;
+            }
+
+            ContainerConferenceFactory::TRANSPORT ContainerConferenceFactory::getTransport() const {
+                return m_transport;
+            }
+
         }
     }
 } // odcore::io::conference
@@ -0,0 +1,419 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/io/conference/SharedMemoryContainerConference.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+            using namespace base;
+            using namespace data;
+            using namespace exceptions;
+
+            namespace {
+                // Identifies an initialized ring ("ODCC").
+                const uint32_t RING_MAGIC = 0x4F444343;
+
+                // Slots and header are aligned to cache lines.
+                const uint32_t CACHE_LINE_SIZE = 64;
+
+                /**
+                 * Header at the beginning of the shared memory segment.
+                 */
+                struct RingHeader {
+                    uint32_t m_magic;
+                    uint32_t m_numberOfSlots;
+                    uint32_t m_slotSize;
+                    std::atomic<uint32_t> m_initialized;
+                    std::atomic<uint32_t> m_nextParticipantID;
+                    std::atomic<uint64_t> m_writeSequence;
+                    std::atomic<uint32_t> m_notification;
+                    std::atomic<uint32_t> m_sleepingReceivers;
+                };
+
+                /**
+                 * Header of each slot. The slot's sequence works like a
+                 * seqlock: 2*n+1 while the n-th container is written
+                 * and 2*n+2 once it is complete. A sender that has to
+                 * drop the n-th container stores 2*n+2 in m_dropped to
+                 * let the receivers skip it.
+                 */
+                struct SlotHeader {
+                    std::atomic<uint64_t> m_sequence;
+                    std::atomic<uint64_t> m_dropped;
+                    uint32_t m_size;
+                    uint32_t m_participantID;
+                };
+
+                inline uint32_t alignToCacheLine(const uint32_t &size) {
+                    return ((size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+                }
+
+                inline uint32_t getHeaderSize() {
+                    return alignToCacheLine(sizeof(RingHeader));
+                }
+
+                inline uint32_t getSlotSize() {
+                    return alignToCacheLine(sizeof(SlotHeader) + SharedMemoryContainerConference::MAX_CONTAINER_SIZE);
+                }
+
+                inline RingHeader* getHeader(char *ring) {
+                    return reinterpret_cast<RingHeader*>(ring);
+                }
+
+                inline SlotHeader* getSlot(char *ring, const uint64_t &sequence) {
+                    return reinterpret_cast<SlotHeader*>(ring + getHeaderSize() + (sequence % SharedMemoryContainerConference::NUMBER_OF_SLOTS) * getSlotSize());
+                }
+
+                inline char* getSlotData(SlotHeader *slot) {
+                    return reinterpret_cast<char*>(slot) + sizeof(SlotHeader);
+                }
+            }
+
+            SharedMemoryContainerConference::SharedMemoryContainerConference(const string &address, const uint32_t &port) throw (ConferenceException) :
+                ContainerConference(),
+                Service(),
+                m_sharedMemory(),
+                m_ring(NULL),
+                m_participantID(0),
+                m_readCursor(0),
+                m_lostContainers(0),
+                m_droppedContainers(0),
+                m_buffer(MAX_CONTAINER_SIZE) {
+                const string name = getSharedMemoryName(address, port);
+                const uint32_t size = getHeaderSize() + NUMBER_OF_SLOTS * getSlotSize();
+
+                // Join an existing conference or create a new one.
+                bool created = false;
+                m_sharedMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(name);
+                if ( (!m_sharedMemory.get()) || (!m_sharedMemory->isValid()) ) {
+                    m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(name, size);
+                    created = true;
+                }
+                if ( (!m_sharedMemory.get()) || (!m_sharedMemory->isValid()) || (m_sharedMemory->getSize() < size) ) {
+                    OPENDAVINCI_CORE_THROW_EXCEPTION(ConferenceException, "Could not create shared memory for conference " + name);
+                }
+
+                m_ring = static_cast<char*>(m_sharedMemory->getSharedMemory());
+                RingHeader *header = getHeader(m_ring);
+
+                if (created) {
+                    m_sharedMemory->lock();
+                    {
+                        new (&header->m_initialized) std::atomic<uint32_t>(0);
+                        new (&header->m_nextParticipantID) std::atomic<uint32_t>(0);
+                        new (&header->m_writeSequence) std::atomic<uint64_t>(0);
+                        new (&header->m_notification) std::atomic<uint32_t>(0);
+                        new (&header->m_sleepingReceivers) std::atomic<uint32_t>(0);
+                        header->m_magic = RING_MAGIC;
+                        header->m_numberOfSlots = NUMBER_OF_SLOTS;
+                        header->m_slotSize = getSlotSize();
+                        for (uint32_t i = 0; i < NUMBER_OF_SLOTS; i++) {
+                            SlotHeader *slot = getSlot(m_ring, i);
+                            new (&slot->m_sequence) std::atomic<uint64_t>(0);
+                            new (&slot->m_dropped) std::atomic<uint64_t>(0);
+                            slot->m_size = 0;
+                            slot->m_participantID = 0;
+                        }
+                        header->m_initialized.store(1, std::memory_order_release);
+                    }
+                    m_sharedMemory->unlock();
+                }
+                else {
+                    // Wait briefly for a concurrently joining creator.
+                    for (uint32_t i = 0; (i < 1000) && (1 != header->m_initialized.load(std::memory_order_acquire)); i++) {
+                        Thread::usleepFor(1000);
+                    }
+                    if ( (1 != header->m_initialized.load(std::memory_order_acquire)) ||
+                         (RING_MAGIC != header->m_magic) ||
+                         (NUMBER_OF_SLOTS != header->m_numberOfSlots) ||
+                         (getSlotSize() != header->m_slotSize) ) {
+                        OPENDAVINCI_CORE_THROW_EXCEPTION(ConferenceException, "Incompatible shared memory for conference " + name);
+                    }
+                }
+
+                m_participantID = header->m_nextParticipantID.fetch_add(1) + 1;
+
+                // Only containers sent after joining are received.
+                m_readCursor = header->m_writeSequence.load();
+
+                // Start receiving.
+                start();
+            }
+
+            SharedMemoryContainerConference::~SharedMemoryContainerConference() {
+                // Stop receiving.
+                stop();
+            }
+
+            const string SharedMemoryContainerConference::getSharedMemoryName(const string &address, const uint32_t &port) {
+                // Shared memory names are limited to _POSIX_NAME_MAX characters;
+                // hence, address and port are condensed using FNV-1a.
+                stringstream sstr;
+                sstr << address << ":" << port;
+                const string conference = sstr.str();
+
+                uint32_t hash = 2166136261u;
+                for (uint32_t i = 0; i < conference.size(); i++) {
+                    hash = (hash ^ static_cast<uint8_t>(conference.at(i))) * 16777619u;
+                }
+
+                stringstream name;
+                name << "odcc" << hex << setw(8) << setfill('0') << hash;
+                return name.str();
+            }
+
+            uint64_t SharedMemoryContainerConference::getNumberOfLostContainers() const {
+                return m_lostContainers;
+            }
+
+            uint64_t SharedMemoryContainerConference::getNumberOfDroppedContainers() const {
+                return m_droppedContainers.load();
+            }
+
+            void SharedMemoryContainerConference::send(Container &container) const {
+                // Set sending time stamp.
+                container.setSentTimeStamp(TimeStamp());
+
+                // If sample time stamp is unset, use sent time stamp.
+                if (container.getSampleTimeStamp().toMicroseconds() == 0) {
+                    container.setSampleTimeStamp(container.getSentTimeStamp());
+                }
+
+                // If the container's senderStamp field is unset, set it
+                // to this conference's senderStamp.
+                if (container.getSenderStamp() == 0) {
+                    container.setSenderStamp(getSenderStamp());
+                }
+
+                const uint32_t size = container.getSerializedSize();
+                if (size > MAX_CONTAINER_SIZE) {
+                    CLOG1 << "[SharedMemoryContainerConference] Container with " << size << " bytes exceeds slot size; dropped." << endl;
+                    return;
+                }
+
+                uint64_t sequence = 0;
+                if (!claimSlot(sequence)) {
+                    return;
+                }
+
+                // Encode directly into the shared memory.
+                SlotHeader *slot = getSlot(m_ring, sequence);
+                slot->m_participantID = m_participantID;
+                slot->m_size = container.serializeTo(getSlotData(slot), MAX_CONTAINER_SIZE);
+
+                if (publishSlot(sequence)) {
+                    notifyReceivers();
+                }
+            }
+
+            bool SharedMemoryContainerConference::claimSlot(uint64_t &sequence) const {
+                RingHeader *header = getHeader(m_ring);
+                sequence = header->m_writeSequence.fetch_add(1);
+                SlotHeader *slot = getSlot(m_ring, sequence);
+
+                // Take the slot over from the container sent NUMBER_OF_SLOTS before
+                // once that one is complete. A slot that is still being written is
+                // never taken over as its sender would publish our data afterwards;
+                // instead, our container is dropped if that sender stalls.
+                uint32_t spins = 0;
+                uint64_t current = slot->m_sequence.load(std::memory_order_acquire);
+                while (true) {
+                    if (current >= (2 * sequence + 1)) {
+                        // A sender that is a full ring ahead owns this slot already.
+                        break;
+                    }
+                    if (1 == (current & 1)) {
+                        if (spins++ == 1000) {
+                            break;
+                        }
+                        Thread::usleepFor(1);
+                        current = slot->m_sequence.load(std::memory_order_acquire);
+                    }
+                    else if (slot->m_sequence.compare_exchange_weak(current, 2 * sequence + 1, std::memory_order_acq_rel)) {
+                        return true;
+                    }
+                }
+
+                dropSlot(sequence);
+                return false;
+            }
+
+            bool SharedMemoryContainerConference::publishSlot(const uint64_t &sequence) const {
+                SlotHeader *slot = getSlot(m_ring, sequence);
+
+                // Publish only if the slot is still ours.
+                uint64_t claimed = 2 * sequence + 1;
+                if (!slot->m_sequence.compare_exchange_strong(claimed, 2 * sequence + 2, std::memory_order_acq_rel)) {
+                    dropSlot(sequence);
+                    return false;
+                }
+                return true;
+            }
+
+            void SharedMemoryContainerConference::dropSlot(const uint64_t &sequence) const {
+                m_droppedContainers++;
+                CLOG1 << "[SharedMemoryContainerConference] Slot for container " << sequence << " still in use; dropped." << endl;
+
+                // Let the receivers skip the dropped container.
+                SlotHeader *slot = getSlot(m_ring, sequence);
+                uint64_t dropped = slot->m_dropped.load();
+                while ( (dropped < (2 * sequence + 2)) && (!slot->m_dropped.compare_exchange_weak(dropped, 2 * sequence + 2)) ) {}
+
+                notifyReceivers();
+            }
+
+            void SharedMemoryContainerConference::notifyReceivers() const {
+                RingHeader *header = getHeader(m_ring);
+                header->m_notification.fetch_add(1);
+#ifdef __linux__
+                if (header->m_sleepingReceivers.load() > 0) {
+                    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header->m_notification), FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+                }
+#endif
+            }
+
+            void SharedMemoryContainerConference::waitForContainers(const uint32_t &lastNotification) {
+#ifdef __linux__
+                RingHeader *header = getHeader(m_ring);
+                // Wake up periodically to check whether we shall stop.
+                struct timespec timeout;
+                timeout.tv_sec = 0;
+                timeout.tv_nsec = 100 * 1000 * 1000;
+
+                header->m_sleepingReceivers.fetch_add(1);
+                ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header->m_notification), FUTEX_WAIT, lastNotification, &timeout, NULL, 0);
+                header->m_sleepingReceivers.fetch_sub(1);
+#else
+                (void)lastNotification;
+                Thread::usleepFor(500);
+#endif
+            }
+
+            bool SharedMemoryContainerConference::readAvailableContainers() {
+                RingHeader *header = getHeader(m_ring);
+                bool consumed = false;
+
+                while (isRunning()) {
+                    // Skip containers that have been overwritten already.
+                    const uint64_t writeSequence = header->m_writeSequence.load();
+                    if (writeSequence - m_readCursor > NUMBER_OF_SLOTS) {
+                        m_lostContainers += writeSequence - NUMBER_OF_SLOTS - m_readCursor;
+                        m_readCursor = writeSequence - NUMBER_OF_SLOTS;
+                    }
+
+                    SlotHeader *slot = getSlot(m_ring, m_readCursor);
+                    const uint64_t expected = 2 * m_readCursor + 2;
+                    const uint64_t before = slot->m_sequence.load(std::memory_order_acquire);
+                    if (before < expected) {
+                        if (slot->m_dropped.load(std::memory_order_acquire) < expected) {
+                            // Not yet (completely) written.
+                            break;
+                        }
+
+                        // Dropped by its sender.
+                        m_lostContainers++;
+                        m_readCursor++;
+                        consumed = true;
+                        continue;
+                    }
+
+                    bool valid = false;
+                    uint32_t size = 0;
+                    if (before == expected) {
+                        const uint32_t participantID = slot->m_participantID;
+                        size = slot->m_size;
+                        // Unsubscribed containers are neither copied nor decoded; a torn
+                        // header is detected by the validation below.
+                        if ( (participantID != m_participantID) && (size <= MAX_CONTAINER_SIZE) && isSubscribedTo(getSlotData(slot), size) ) {
+                            memcpy(&m_buffer[0], getSlotData(slot), size);
+                            valid = true;
+                        }
+
+                        // Validate that the slot was not overwritten while copying.
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        if (slot->m_sequence.load(std::memory_order_relaxed) != before) {
+                            valid = false;
+                            m_lostContainers++;
+                        }
+                    }
+                    else {
+                        m_lostContainers++;
+                    }
+
+                    m_readCursor++;
+                    consumed = true;
+
+                    if (valid && hasContainerListener()) {
+                        Container container;
+                        if (0 != container.deserializeFrom(&m_buffer[0], size)) {
+                            container.setReceivedTimeStamp(TimeStamp());
+
+                            // Use superclass to distribute any received containers.
+                            receive(container);
+                        }
+                    }
+                }
+
+                return consumed;
+            }
+
+            void SharedMemoryContainerConference::beforeStop() {
+                // Wake up our receiving thread (and spuriously all others).
+                notifyReceivers();
+            }
+
+            void SharedMemoryContainerConference::run() {
+                serviceReady();
+
+                RingHeader *header = getHeader(m_ring);
+                while (isRunning()) {
+                    const uint32_t lastNotification = header->m_notification.load();
+                    if (!readAvailableContainers() && isRunning()) {
+                        waitForContainers(lastNotification);
+                    }
+                }
+            }
+
+        }
+    }
+} // odcore::io::conference
@@ -17,9 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include <iosfwd>
-#include <sstream>
+#include <iostream>
+#include <string>
+#include <vector>
 
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odcore/serialization/Serializable.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
@@ -38,7 +41,9 @@ namespace odcore {
 
             UDPMultiCastContainerConference::UDPMultiCastContainerConference(const string &address, const uint32_t &port) throw (ConferenceException) :
                 m_sender(NULL),
-                m_receiver(NULL) {
+                m_receiver(NULL),
+                m_datagramsPerBurst(DATAGRAMS_PER_BURST),
+                m_pauseBetweenBursts(PAUSE_BETWEEN_BURSTS) {
                 try {
                     m_sender = odcore::io::udp::UDPFactory::createUDPSender(address, port);
                 }
@@ -71,21 +76,42 @@ namespace odcore {
             }
 
             void UDPMultiCastContainerConference::nextPacket(const Packet &p) {
-                if (hasContainerListener()) {
-                    Container container;
-
-                    stringstream stringstreamData(p.getData());
-                    stringstreamData >> container;
-
-                    // Set received time stamp based on information from packet.
-                    container.setReceivedTimeStamp(TimeStamp(p.getReceived()));
+                if (!hasContainerListener()) {
+                    return;
+                }
 
-                    // Use superclass to distribute any received containers.
-                    receive(container);
+                const string &data = p.getData();
+                const TimeStamp received(p.getReceived());
+
+                // A packet carries one or more containers back to back (cf. sendBatch).
+                uint32_t offset = 0;
+                while (offset < data.size()) {
+                    const char *buffer = data.data() + offset;
+                    const uint32_t length = Container::peekSize(buffer, data.size() - offset);
+                    if (0 == length) {
+                        return;
+                    }
+                    offset += length;
+
+                    // Discard unsubscribed containers before decoding them.
+                    if (isSubscribedTo(buffer, length)) {
+                        Container container;
+
+                        // Decode directly from the received packet.
+                        if (0 == container.deserializeFrom(buffer, length)) {
+                            return;
+                        }
+
+                        // Set received time stamp based on information from packet.
+                        container.setReceivedTimeStamp(received);
+
+                        // Use superclass to distribute any received containers.
+                        receive(container);
+                    }
                 }
             }
 
-            void UDPMultiCastContainerConference::send(Container &container) const {
+            void UDPMultiCastContainerConference::stamp(Container &container) const {
                 // Set sending time stamp.
                 container.setSentTimeStamp(TimeStamp());
 
@@ -99,16 +125,75 @@ namespace odcore {
                 if (container.getSenderStamp() == 0) {
                     container.setSenderStamp(getSenderStamp());
                 }
+            }
 
-                stringstream stringstreamValue;
-                stringstreamValue << container;
+            void UDPMultiCastContainerConference::send(Container &container) const {
+                stamp(container);
 
-                string stringValue = stringstreamValue.str();
+                // Encode directly into the buffer to be sent.
+                string stringValue(container.getSerializedSize(), '\0');
+                if (0 == container.serializeTo(&stringValue[0], stringValue.size())) {
+                    CLOG1 << "[UDPMultiCastContainerConference] Container of type " << container.getDataType() << " could not be serialized; skipped." << endl;
+                    return;
+                }
 
                 // Send data.
                 m_sender->send(stringValue);
             }
 
+            void UDPMultiCastContainerConference::setBatchPacing(const uint32_t &datagramsPerBurst, const uint32_t &pauseBetweenBursts) {
+                m_datagramsPerBurst = datagramsPerBurst;
+                m_pauseBetweenBursts = pauseBetweenBursts;
+            }
+
+            void UDPMultiCastContainerConference::sendBurst(vector<string> &listOfDatagrams, bool &isFirstBurst) const {
+                if (!isFirstBurst && (m_pauseBetweenBursts > 0)) {
+                    Thread::usleepFor(m_pauseBetweenBursts);
+                }
+                isFirstBurst = false;
+
+                m_sender->sendBurst(listOfDatagrams);
+                listOfDatagrams.clear();
+            }
+
+            void UDPMultiCastContainerConference::sendBatch(vector<Container> &containers) const {
+                vector<string> listOfDatagrams;
+                string datagram;
+                bool isFirstBurst = true;
+
+                for (vector<Container>::iterator it = containers.begin(); it != containers.end(); ++it) {
+                    stamp(*it);
+
+                    // Start a new datagram if the next container does not fit anymore; larger containers are sent alone.
+                    const uint32_t size = it->getSerializedSize();
+                    if (!datagram.empty() && ((datagram.size() + size) > MAX_DATAGRAM_SIZE)) {
+                        listOfDatagrams.push_back(datagram);
+                        datagram.clear();
+
+                        // Hand over a full burst to not overrun the receivers' socket buffers.
+                        if ( (m_datagramsPerBurst > 0) && (listOfDatagrams.size() >= m_datagramsPerBurst) ) {
+                            sendBurst(listOfDatagrams, isFirstBurst);
+                        }
+                    }
+
+                    // Encode directly into the datagram to be sent.
+                    const uint32_t offset = datagram.size();
+                    datagram.resize(offset + size);
+                    if (0 == it->serializeTo(&datagram[offset], size)) {
+                        CLOG1 << "[UDPMultiCastContainerConference] Container of type " << it->getDataType() << " could not be serialized; skipped." << endl;
+                        datagram.resize(offset);
+                    }
+                }
+                if (!datagram.empty()) {
+                    listOfDatagrams.push_back(datagram);
+                }
+
+                // Send the remaining datagrams.
+                if (!listOfDatagrams.empty()) {
+                    sendBurst(listOfDatagrams, isFirstBurst);
+                }
+            }
+
         }
     }
 } // odcore::io::conference
@@ -17,7 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include <cstdlib>
+#include <string>
 
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/io/StringListener.h"
@@ -34,7 +34,11 @@ namespace odcore {
                 m_stringListenerMutex(),
                 m_stringListener(NULL),
                 m_partialDataMutex(),
-                m_partialData() {}
+                m_partialData(),
+                m_begin(0),
+                m_lengthOfPayload(-1),
+                m_lengthOfPrefix(0),
+                m_payload() {}
 
             NetstringsProtocol::~NetstringsProtocol() {
                 setStringListener(NULL);
@@ -47,84 +51,99 @@ namespace odcore {
 
             void NetstringsProtocol::send(const string& data) {
                 if (data.length() > 0) {
-                    stringstream netstring;
+                    // Build the Netstring with a single allocation.
+                    const string length = std::to_string(static_cast<uint32_t>(data.length()));
 
-                    netstring << static_cast<uint32_t>(data.length()) << ":" << data << ",";
+                    string netstring;
+                    netstring.reserve(length.length() + 1 + data.length() + 1);
+                    netstring.append(length).append(1, ':').append(data).append(1, ',');
 
-                    sendByStringSender(netstring.str());
+                    sendByStringSender(netstring);
                 }
             }
 
             void NetstringsProtocol::nextString(const string &s) {
                 Lock l(m_partialDataMutex);
-                m_partialData.write(s.c_str(), s.length());
+                m_partialData.insert(m_partialData.end(), s.begin(), s.end());
                 decodeNetstring();
 
-                // After using str() to set the remaining string, the write pointer
-                // points to the beginning of the stream and further receivedString() calls
-                // would override existing data. So the write pointer has to point to the
-                // end of the stream.
-                m_partialData.seekp(0, ios_base::end);
+                // Keep only the beginning of the next incomplete Netstring;
+                // thus, every byte is moved at most once.
+                if (m_begin == m_partialData.size()) {
+                    m_partialData.clear();
+                }
+                else if (m_begin > 0) {
+                    m_partialData.erase(m_partialData.begin(), m_partialData.begin() + m_begin);
+                }
+                m_begin = 0;
+            }
+
+            void NetstringsProtocol::resetBuffer() {
+                m_partialData.clear();
+                m_begin = 0;
+                m_lengthOfPayload = -1;
+                m_lengthOfPrefix = 0;
             }
 
-            void NetstringsProtocol::decodeNetstring(void) {
+            void NetstringsProtocol::decodeNetstring() {
                 // Netstrings have the following format:
                 // ASCII Number representing the length of the payload + ':' + payload + ','
-
-                bool checkForMoreNetstrings = true;
-                while (checkForMoreNetstrings) {
-                    m_partialData.seekg(0, ios_base::end);
-                    uint32_t lengthOfBuffer = m_partialData.tellg();
-                    m_partialData.seekg(0, ios_base::beg);
-
-                    if (lengthOfBuffer >= 3) {
-                        // On WIN32, the .str() returns a temporary object that is destroyed after the expression.
-                        // The reference keeps its existence instead.
-                        const string &m_partialDataString = m_partialData.str();
-                        const char *receiveBuffer = m_partialDataString.c_str();
-                        char *colonSign = NULL;
-                        uint32_t lengthOfPayload = strtol(receiveBuffer, &colonSign, 10);
-                        if (lengthOfPayload == 0) {
-                            // Remove empty Netstring: "0:," (size is 3).
-                            m_partialData.str(m_partialData.str().substr(3));
-                            checkForMoreNetstrings = true;
-                            continue; // Try to decode next Netstring if any.
+                while (m_begin < m_partialData.size()) {
+                    const uint32_t available = m_partialData.size() - m_begin;
+                    const char *netstring = &m_partialData[m_begin];
+
+                    if (m_lengthOfPayload < 0) {
+                        // Parse the length prefix.
+                        uint32_t i = 0;
+                        int64_t lengthOfPayload = 0;
+                        while ( (i < available) && (netstring[i] >= '0') && (netstring[i] <= '9') ) {
+                            lengthOfPayload = lengthOfPayload * 10 + (netstring[i] - '0');
+                            if (lengthOfPayload > MAX_PAYLOAD_SIZE) {
+                                // Announced payload is too large; discard data.
+                                resetBuffer();
+                                return;
+                            }
+                            i++;
                         }
 
-                        if (lengthOfPayload > lengthOfBuffer) {
-                            // Incomplete Netstring received. Wait for more data.
-                            checkForMoreNetstrings = false;
-                            continue;
+                        if (i == available) {
+                            // Incomplete prefix received. Wait for more data.
+                            return;
                         }
 
-                        // Check for colon.
-                        if (*colonSign == ':') {
-                            // Found colon sign. Now, check if (receiveBuffer + 1 + lengthOfPayload) == ','.
-                            if ((colonSign[1 + lengthOfPayload]) == ',') {
-                                // Successfully found a complete Netstring.
-                                string receivedPayload = m_partialData.str().substr((colonSign + 1) - receiveBuffer, lengthOfPayload);
-
-                                invokeStringListener(receivedPayload);
-
-                                // Calculate size of decoded Netstring: "<lengthOfPayload> : <payload> ,"
-                                const uint32_t lengthOfNetstring = (colonSign + 1 + lengthOfPayload + 1) - receiveBuffer;
+                        if ( (0 == i) || (netstring[i] != ':') ) {
+                            // Corrupted data; reset buffer.
+                            resetBuffer();
+                            return;
+                        }
 
-                                // Remove the decoded Netstring from the buffer.
-                                m_partialData.str(m_partialData.str().substr(lengthOfNetstring));
+                        m_lengthOfPayload = lengthOfPayload;
+                        m_lengthOfPrefix = i + 1;
+                    }
 
-                                checkForMoreNetstrings = true;
-                                continue;
-                            }
-                        }
+                    // Size of the Netstring: "<lengthOfPayload> : <payload> ,"
+                    const uint32_t lengthOfNetstring = m_lengthOfPrefix + static_cast<uint32_t>(m_lengthOfPayload) + 1;
+                    if (available < lengthOfNetstring) {
+                        // Incomplete Netstring received. Wait for more data.
+                        return;
+                    }
 
-                        // We should never get here as the received data might be corrupted; reset buffer.
-                        m_partialData.str("");
-                        checkForMoreNetstrings = false;
+                    if (netstring[lengthOfNetstring - 1] != ',') {
+                        // Corrupted data; reset buffer.
+                        resetBuffer();
+                        return;
                     }
-                    else {
-                        // We need to wait for more data.
-                        checkForMoreNetstrings = false;
+
+                    // Empty Netstrings ("0:,") are skipped.
+                    if (m_lengthOfPayload > 0) {
+                        // Reuse the payload's capacity for all Netstrings.
+                        m_payload.assign(netstring + m_lengthOfPrefix, static_cast<uint32_t>(m_lengthOfPayload));
+                        invokeStringListener(m_payload);
                     }
+
+                    m_begin += lengthOfNetstring;
+                    m_lengthOfPayload = -1;
+                    m_lengthOfPrefix = 0;
                 }
             }
 
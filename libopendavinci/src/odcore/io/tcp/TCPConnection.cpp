@@ -18,6 +18,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <cstring>
 #include <iostream>
 
 #include "opendavinci/odcore/base/Lock.h"
@@ -38,7 +39,9 @@ namespace odcore {
                 m_stringListener(NULL),
                 m_partialDataMutex(),
                 m_partialData(),
-                m_raw(false) {}
+                m_payload(),
+                m_raw(false),
+                m_numberOfSentBytes(0) {}
 
             TCPConnection::~TCPConnection() {
                 setStringListener(NULL);
@@ -70,14 +73,43 @@ namespace odcore {
             }
 
             void TCPConnection::send(const string& data) {
-                stringstream dataStream;
+                // The size information is prepended without copying the data.
+                const uint32_t dataSize = htonl(data.length());
+                vector<pair<const char*, uint32_t> > buffers;
+                buffers.reserve(2);
+
+                uint64_t numberOfBytes = 0;
                 if (!isRaw()) {
-                    const uint32_t dataSize = htonl(data.length());
-                    dataStream.write(reinterpret_cast<const char*>(&dataSize), sizeof(uint32_t));
+                    buffers.push_back(make_pair(reinterpret_cast<const char*>(&dataSize), static_cast<uint32_t>(sizeof(uint32_t))));
+                    numberOfBytes += sizeof(uint32_t);
+                }
+                buffers.push_back(make_pair(data.data(), static_cast<uint32_t>(data.length())));
+                numberOfBytes += data.length();
+
+                sendBuffersImplementation(buffers);
+                m_numberOfSentBytes += numberOfBytes;
+            }
+
+            void TCPConnection::sendBuffersImplementation(const vector<pair<const char*, uint32_t> > &buffers) {
+                uint32_t length = 0;
+                for (vector<pair<const char*, uint32_t> >::const_iterator it = buffers.begin(); it != buffers.end(); ++it) {
+                    length += it->second;
                 }
-                dataStream << data;
 
-                sendImplementation(dataStream.str());
+                string data;
+                data.reserve(length);
+                for (vector<pair<const char*, uint32_t> >::const_iterator it = buffers.begin(); it != buffers.end(); ++it) {
+                    data.append(it->first, it->second);
+                }
+                sendImplementation(data);
+            }
+
+            uint64_t TCPConnection::getNumberOfSentBytes() const {
+                return m_numberOfSentBytes;
+            }
+
+            uint32_t TCPConnection::getNumberOfQueuedBytes() {
+                return 0;
             }
 
             void TCPConnection::setRaw(const bool &raw) {
@@ -95,51 +127,35 @@ namespace odcore {
                     invokeStringListener(s);
                 }
                 else {
-                    m_partialData.write(s.c_str(), s.length());
-
-                    if (hasCompleteData()) {
-                        m_partialData.seekg(0, ios_base::beg);
+                    m_partialData.insert(m_partialData.end(), s.begin(), s.end());
 
+                    // Pass all complete data packets to the StringListener.
+                    uint32_t begin = 0;
+                    while ((m_partialData.size() - begin) >= sizeof(uint32_t)) {
                         uint32_t dataSize = 0;
-                        m_partialData.read(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t));
+                        memcpy(&dataSize, m_partialData.data() + begin, sizeof(uint32_t));
                         dataSize = ntohl(dataSize);
-                        const uint32_t bytesToIgnore = m_partialData.gcount();
-
-                        // Split the stringstreams's string into to pieces. The first
-                        // piece contains the data for the StringListener, the second
-                        // piece will remain in the stringstream.
-                        invokeStringListener(m_partialData.str().substr(bytesToIgnore, dataSize));
-                        m_partialData.str(m_partialData.str().substr(bytesToIgnore+dataSize));
-
-                        // After using str() to set the remaining string, the write pointer
-                        // points to the beginning of the stream and further receivedString() calls
-                        // would override existing data. So the write pointer as to point to the
-                        // end of the stream.
-                        m_partialData.seekp(0, ios_base::end);
+
+                        if ((m_partialData.size() - begin - sizeof(uint32_t)) < dataSize) {
+                            // Wait for more data.
+                            break;
+                        }
+
+                        // Reuse the payload's capacity for all data packets.
+                        m_payload.assign(m_partialData.data() + begin + sizeof(uint32_t), dataSize);
+                        invokeStringListener(m_payload);
+
+                        begin += sizeof(uint32_t) + dataSize;
                     }
-                }
-            }
 
-            bool TCPConnection::hasCompleteData() {
-                // Get size of stringstream
-                m_partialData.seekg(0, ios_base::end);
-                const uint32_t streamSize = m_partialData.tellg();
-                m_partialData.seekg(0, ios_base::beg);
-
-                // Did we receive enough bytes?
-                if (streamSize > sizeof(uint32_t)) {
-                    // Read size of transfered data
-                    uint32_t dataSize = 0;
-                    m_partialData.read(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t));
-                    dataSize = ntohl(dataSize);
-                    const uint32_t bytesToIgnore = m_partialData.gcount();
-
-                    if (streamSize >= (dataSize + bytesToIgnore)) {
-                        return true;
+                    // Keep only the beginning of the next incomplete data packet.
+                    if (begin == m_partialData.size()) {
+                        m_partialData.clear();
+                    }
+                    else if (begin > 0) {
+                        m_partialData.erase(m_partialData.begin(), m_partialData.begin() + begin);
                     }
                 }
-
-                return false;
             }
 
         }
@@ -57,6 +57,14 @@ namespace odcore {
                 m_synchronousPacketListener = pl;
             }
 
+            uint64_t UDPReceiver::getNumberOfDroppedPackets() const {
+                return m_packetPipeline.getNumberOfDroppedPackets();
+            }
+
+            uint32_t UDPReceiver::getMaximumQueueDepth() const {
+                return m_packetPipeline.getMaximumQueueDepth();
+            }
+
             void UDPReceiver::nextPacket(const odcore::data::Packet &p) {
                 Lock l(m_listenerMutex);
 
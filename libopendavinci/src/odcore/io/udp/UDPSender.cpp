@@ -25,6 +25,12 @@ namespace odcore {
 
             UDPSender::~UDPSender() {}
 
+            void UDPSender::sendBurst(const vector<string> &listOfData) const {
+                for (vector<string>::const_iterator it = listOfData.begin(); it != listOfData.end(); ++it) {
+                    send(*it);
+                }
+            }
+
         }
     }
 } // odcore::io::udp
@@ -0,0 +1,77 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+
+#include "opendavinci/odcore/serialization/FieldIndex.h"
+
+namespace odcore {
+    namespace serialization {
+
+        using namespace std;
+
+        FieldIndex::FieldIndex() :
+            m_entries() {}
+
+        FieldIndex::~FieldIndex() {}
+
+        bool FieldIndex::lessById(const Entry &a, const Entry &b) {
+            return a.m_id < b.m_id;
+        }
+
+        void FieldIndex::clear() {
+            m_entries.clear();
+        }
+
+        void FieldIndex::add(const uint32_t &id, const uint32_t &type, const uint32_t &offset, const uint32_t &length) {
+            const Entry e = { id, type, offset, length };
+            m_entries.push_back(e);
+        }
+
+        void FieldIndex::sort() {
+            // Fields are usually encoded in ascending order already.
+            if (!std::is_sorted(m_entries.begin(), m_entries.end(), lessById)) {
+                std::stable_sort(m_entries.begin(), m_entries.end(), lessById);
+            }
+        }
+
+        const FieldIndex::Entry* FieldIndex::findFirst(const uint32_t &id) const {
+            const Entry key = { id, 0, 0, 0 };
+            vector<Entry>::const_iterator it = std::lower_bound(m_entries.begin(), m_entries.end(), key, lessById);
+            if ( (it != m_entries.end()) && (it->m_id == id) ) {
+                return &(*it);
+            }
+            return NULL;
+        }
+
+        const FieldIndex::Entry* FieldIndex::findLast(const uint32_t &id) const {
+            const Entry key = { id, 0, 0, 0 };
+            vector<Entry>::const_iterator it = std::upper_bound(m_entries.begin(), m_entries.end(), key, lessById);
+            if ( (it != m_entries.begin()) && ((it - 1)->m_id == id) ) {
+                return &(*(it - 1));
+            }
+            return NULL;
+        }
+
+        uint32_t FieldIndex::getSize() const {
+            return m_entries.size();
+        }
+
+    }
+} // odcore::serialization
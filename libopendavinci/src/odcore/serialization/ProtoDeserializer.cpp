@@ -22,8 +22,10 @@
 #include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/io/ReadOnlyStreamBuffer.h"
 #include "opendavinci/odcore/serialization/ProtoDeserializer.h"
 #include "opendavinci/odcore/serialization/ProtoDeserializerVisitor.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
 #include "opendavinci/odcore/base/Visitable.h"
 #include "opendavinci/odcore/reflection/MessageFromVisitableVisitor.h"
 #include "opendavinci/odcore/reflection/Message.h"
@@ -123,128 +125,145 @@ class Serializable;
         ///////////////////////////////////////////////////////////////////////
 
         ProtoDeserializer::ProtoDeserializer() :
-            m_buffer(),
-            m_mapOfKeyValues() {}
+            m_ownedData(),
+            m_data(NULL),
+            m_size(0),
+            m_indexIsValid(false),
+            m_index() {}
 
         ProtoDeserializer::ProtoDeserializer(istream &i) :
-            m_buffer(),
-            m_mapOfKeyValues() {
+            m_ownedData(),
+            m_data(NULL),
+            m_size(0),
+            m_indexIsValid(false),
+            m_index() {
             deserializeDataFrom(i);
         }
 
+        ProtoDeserializer::ProtoDeserializer(const char *data, const uint32_t &size) :
+            m_ownedData(),
+            m_data(NULL),
+            m_size(0),
+            m_indexIsValid(false),
+            m_index() {
+            deserializeDataFrom(data, size);
+        }
+
         ProtoDeserializer::~ProtoDeserializer() {}
 
-        void ProtoDeserializer::deserializeDataFrom(istream &in) {
+        void ProtoDeserializer::deserializeDataFrom(const char *data, const uint32_t &size) {
             // Reset internal states as this deserializer could be reused.
-            m_buffer.str("");
-            m_mapOfKeyValues.clear();
+            m_data = data;
+            m_size = (NULL != data) ? size : 0;
+            m_indexIsValid = false;
+            m_index.clear();
+        }
+
+        void ProtoDeserializer::deserializeDataFrom(istream &in) {
+            m_ownedData.clear();
+
+            // A Proto message extends until the end of the stream.
+            odcore::io::ReadOnlyStreamBuffer *readOnlyBuffer = dynamic_cast<odcore::io::ReadOnlyStreamBuffer*>(in.rdbuf());
+            if ( (NULL != readOnlyBuffer) && in.good() ) {
+                // The data is already in memory; borrow it.
+                const char *data = readOnlyBuffer->getCurrentPosition();
+                const uint32_t size = static_cast<uint32_t>(readOnlyBuffer->in_avail());
+                in.seekg(0, ios_base::end);
+                in.setstate(ios_base::eofbit);
+                deserializeDataFrom(data, size);
+                return;
+            }
 
+            // Otherwise, read the remaining data en bloc.
+            const uint32_t BYTES_TO_READ_INTO_BUFFER = 4096;
+            uint32_t size = 0;
             while (in.good()) {
-                // First stage: Read keyFieldType (encoded as VarInt).
-                uint64_t keyFieldType = 0;
-                uint8_t bytesRead = decodeVarInt(in, keyFieldType);
+                m_ownedData.resize(size + BYTES_TO_READ_INTO_BUFFER);
+                in.read(&m_ownedData[size], BYTES_TO_READ_INTO_BUFFER);
+                size += static_cast<uint32_t>(in.gcount());
+            }
+            m_ownedData.resize(size);
+
+            deserializeDataFrom((size > 0) ? &m_ownedData[0] : NULL, size);
+        }
+
+        const FieldIndex::Entry* ProtoDeserializer::findField(const uint32_t &id) {
+            if (!m_indexIsValid) {
+                m_indexIsValid = true;
+
+                const char *begin = m_data;
+                const char *end = m_data + m_size;
+                const char *p = begin;
+                while (p < end) {
+                    // First stage: Read keyFieldType (encoded as VarInt).
+                    uint64_t keyFieldType = 0;
+                    uint8_t bytesRead = VarIntCodec::decode(p, end, keyFieldType);
+                    if (0 == bytesRead) {
+                        break;
+                    }
+                    p += bytesRead;
 
-                if (bytesRead > 0) {
                     // Succeeded to read keyFieldType entry; extract information.
                     const uint32_t fieldId = static_cast<uint32_t>(keyFieldType >> 3);
                     const ProtoSerializer::PROTOBUF_TYPE protoType = static_cast<ProtoSerializer::PROTOBUF_TYPE>(keyFieldType & 0x7);
 
+                    uint64_t length = 0;
                     if (protoType == ProtoSerializer::VARINT) {
-                        // Read VarInt value directly.
+                        // Store the location of the VarInt; it is decoded on access.
                         uint64_t value = 0;
-                        bytesRead = decodeVarInt(in, value);
-                        ProtoKeyValue pkv(fieldId, value);
-                        m_mapOfKeyValues[fieldId] = pkv;
-                    }
-
-                    if (protoType == ProtoSerializer::EIGHT_BYTES) {
-                        const uint8_t BYTES_TO_READ_INTO_BUFFER = sizeof(double);
-                        uint8_t bytesToRead = BYTES_TO_READ_INTO_BUFFER;
-                        uint32_t bufferPosition = 0;
-
-                        // Create map entry here...
-                        ProtoKeyValue pkv(fieldId, ProtoSerializer::EIGHT_BYTES, BYTES_TO_READ_INTO_BUFFER);
-                        // ...to avoid copying data later.
-                        vector<char> &buffer = pkv.getRawBuffer();
-
-                        while (in.good() && (bytesToRead > 0)) {
-                            in.read(&buffer[bufferPosition], (bytesToRead > BYTES_TO_READ_INTO_BUFFER) ? BYTES_TO_READ_INTO_BUFFER : bytesToRead);
-                            const streamsize extractedBytes = in.gcount();
-                            bufferPosition += extractedBytes;
-                            bytesToRead -= extractedBytes;
+                        length = VarIntCodec::decode(p, end, value);
+                        if (0 == length) {
+                            break;
                         }
-
-                        // Store map entry.
-                        m_mapOfKeyValues[fieldId] = pkv;
                     }
-
-                    if (protoType == ProtoSerializer::FOUR_BYTES) {
-                        const uint8_t BYTES_TO_READ_INTO_BUFFER = sizeof(float);
-                        uint8_t bytesToRead = BYTES_TO_READ_INTO_BUFFER;
-                        uint32_t bufferPosition = 0;
-
-                        // Create map entry here...
-                        ProtoKeyValue pkv(fieldId, ProtoSerializer::FOUR_BYTES, BYTES_TO_READ_INTO_BUFFER);
-                        // ...to avoid copying data later.
-                        vector<char> &buffer = pkv.getRawBuffer();
-
-                        while (in.good() && (bytesToRead > 0)) {
-                            in.read(&buffer[bufferPosition], (bytesToRead > BYTES_TO_READ_INTO_BUFFER) ? BYTES_TO_READ_INTO_BUFFER : bytesToRead);
-                            const streamsize extractedBytes = in.gcount();
-                            bufferPosition += extractedBytes;
-                            bytesToRead -= extractedBytes;
+                    else if (protoType == ProtoSerializer::EIGHT_BYTES) {
+                        length = sizeof(double);
+                    }
+                    else if (protoType == ProtoSerializer::FOUR_BYTES) {
+                        length = sizeof(float);
+                    }
+                    else if (protoType == ProtoSerializer::LENGTH_DELIMITED) {
+                        bytesRead = VarIntCodec::decode(p, end, length);
+                        if (0 == bytesRead) {
+                            break;
                         }
-
-                        // Store map entry.
-                        m_mapOfKeyValues[fieldId] = pkv;
+                        p += bytesRead;
+                    }
+                    else {
+                        // Unsupported type.
+                        break;
                     }
 
-                    if (protoType == ProtoSerializer::LENGTH_DELIMITED) {
-                        const uint16_t BYTES_TO_READ_INTO_BUFFER = 1024;
-
-                        uint64_t length = 0;
-                        bytesRead = decodeVarInt(in, length);
-                        uint64_t bytesToRead = length;
+                    // Truncated fields are limited to the available data.
+                    if (length > static_cast<uint64_t>(end - p)) {
+                        length = static_cast<uint64_t>(end - p);
+                    }
 
-                        uint32_t bufferPosition = 0;
+                    m_index.add(fieldId, protoType, static_cast<uint32_t>(p - begin), static_cast<uint32_t>(length));
+                    p += length;
+                }
 
-                        // Create map entry here...
-                        ProtoKeyValue pkv(fieldId, ProtoSerializer::LENGTH_DELIMITED, length);
-                        // ...to avoid copying data later.
-                        vector<char> &buffer = pkv.getRawBuffer();
+                m_index.sort();
+            }
 
-                        while (in.good() && (bytesToRead > 0)) {
-                            in.read(&buffer[bufferPosition], (bytesToRead > BYTES_TO_READ_INTO_BUFFER) ? BYTES_TO_READ_INTO_BUFFER : bytesToRead);
-                            const streamsize extractedBytes = in.gcount();
-                            bufferPosition += extractedBytes;
-                            bytesToRead -= extractedBytes;
-                        }
+            // Like Protobuf, the last occurrence of a field wins.
+            return m_index.findLast(id);
+        }
 
-                        // Store map entry.
-                        m_mapOfKeyValues[fieldId] = pkv;
-                    }
+        bool ProtoDeserializer::readVarInt(const uint32_t &id, uint64_t &value) {
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                value = 0;
+                if (entry->m_type == ProtoSerializer::VARINT) {
+                    const char *p = m_data + entry->m_offset;
+                    VarIntCodec::decode(p, p + entry->m_length, value);
                 }
             }
+            return (NULL != entry);
         }
 
         uint8_t ProtoDeserializer::decodeVarInt(istream &in, uint64_t &value) {
-            value = 0x0;
-            uint8_t size = 0;
-            char c = 0x0;
-            uint64_t byte = 0x0;
-            const uint64_t bit_shift=0x7;
-            const uint64_t byte_mask=0x7f;
-            const uint64_t msb=0x80;
-            
-            while (in.good()) {
-                c = in.get();
-                byte = c & byte_mask;
-                value |= byte << (bit_shift * size++) ;
-                if ( !(c & msb) ) break;
-            }
-            // Protobuf's VarInt is based on little endian.
-            value = le64toh(value);
-            return size;
+            return VarIntCodec::decode(in, value);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -274,11 +293,11 @@ class Serializable;
         }
 
         int32_t ProtoDeserializer::decodeZigZag32(uint32_t value) {
-            return static_cast<int64_t>((value >> 1) ^ -(value & 1));
+            return VarIntCodec::decodeZigZag32(value);
         }
 
         int64_t ProtoDeserializer::decodeZigZag64(uint64_t value) {
-            return static_cast<int64_t>((value >> 1) ^ -(value & 1));
+            return VarIntCodec::decodeZigZag64(value);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -436,107 +455,130 @@ class Serializable;
         ///////////////////////////////////////////////////////////////////////
 
         void ProtoDeserializer::read(const uint32_t &id, Serializable &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                vector<char> &value = const_cast<vector<char>&>(m_mapOfKeyValues[id].getValue());
-                stringstream sstr;
-                sstr.rdbuf()->pubsetbuf(&value[0], value.size());
-                sstr >> v;
+            const FieldIndex::Entry *entry = findField(id);
+            if ( (NULL != entry) && (entry->m_type == ProtoSerializer::LENGTH_DELIMITED) ) {
+                // Decode the nested message in-place.
+                odcore::io::ReadOnlyStreamBuffer buffer(m_data + entry->m_offset, entry->m_length);
+                istream in(&buffer);
+                in >> v;
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, bool &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<bool>(_v);
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, char &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<char>(_v);
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, unsigned char &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<unsigned char>(_v);
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, int8_t &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<int8_t>(decodeZigZag8(_v));
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, int16_t &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<int16_t>(decodeZigZag16(_v));
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, uint16_t &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<uint16_t>(_v);
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, int32_t &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<int32_t>(decodeZigZag32(_v));
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, uint32_t &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<uint32_t>(_v);
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, int64_t &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                uint64_t _v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
                 v = static_cast<int64_t>(decodeZigZag64(_v));
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, uint64_t &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                v = m_mapOfKeyValues[id].getValueAsVarInt();
+            uint64_t _v = 0;
+            if (readVarInt(id, _v)) {
+                v = _v;
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, float &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                v = m_mapOfKeyValues[id].getValueAsFloat();
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                // 4 bytes values need to obey little endian encoding.
+                uint32_t _v = 0;
+                if ( (entry->m_type == ProtoSerializer::FOUR_BYTES) && (entry->m_length == sizeof(uint32_t)) ) {
+                    memcpy(&_v, m_data + entry->m_offset, sizeof(uint32_t));
+                    _v = le32toh(_v);
+                }
+                memcpy(&v, &_v, sizeof(float));
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, double &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                v = m_mapOfKeyValues[id].getValueAsDouble();
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                // 8 bytes values need to obey little endian encoding.
+                uint64_t _v = 0;
+                if ( (entry->m_type == ProtoSerializer::EIGHT_BYTES) && (entry->m_length == sizeof(uint64_t)) ) {
+                    memcpy(&_v, m_data + entry->m_offset, sizeof(uint64_t));
+                    _v = le64toh(_v);
+                }
+                memcpy(&v, &_v, sizeof(double));
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, string &v) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                v = m_mapOfKeyValues[id].getValueAsString();
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                if (entry->m_type == ProtoSerializer::LENGTH_DELIMITED) {
+                    v.assign(m_data + entry->m_offset, entry->m_length);
+                }
+                else {
+                    v = "";
+                }
             }
         }
 
         void ProtoDeserializer::read(const uint32_t &id, void *data, const uint32_t &size) {
-            if (m_mapOfKeyValues.count(id) > 0) {
-                const vector<char> &value = m_mapOfKeyValues[id].getValue();
-                memcpy(data, &value[0], (size < value.size() ? size : value.size()));
-                if (size > value.size()) {
-                    memset((char*)data + value.size(), 0, (size - value.size()));
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                const uint32_t length = (entry->m_type == ProtoSerializer::LENGTH_DELIMITED) ? entry->m_length : 0;
+                memcpy(data, m_data + entry->m_offset, (size < length ? size : length));
+                if (size > length) {
+                    memset(reinterpret_cast<char*>(data) + length, 0, (size - length));
                 }
             }
         }
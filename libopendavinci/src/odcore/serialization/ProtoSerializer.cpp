@@ -20,6 +20,7 @@
 #include <sstream>
 
 #include "opendavinci/odcore/serialization/ProtoSerializer.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
 #include "opendavinci/odcore/base/Visitable.h"
 
 namespace odcore {
@@ -159,35 +160,15 @@ class Serializable;
         }
 
         uint32_t ProtoSerializer::encodeZigZag32(int32_t value) {
-            return static_cast<uint32_t>((value << 1) ^ (value >> 31));
+            return VarIntCodec::encodeZigZag32(value);
         }
 
         uint64_t ProtoSerializer::encodeZigZag64(int64_t value) {
-            return static_cast<uint64_t>((value << 1) ^ (value >> 63));
+            return VarIntCodec::encodeZigZag64(value);
         }
 
         uint8_t ProtoSerializer::encodeVarInt(ostream &out, uint64_t value) {
-            // We will write at least one byte.
-            uint8_t size = 1;
-
-            // Protobuf's VarInt is based on little endian.
-            value = htole64(value);
-
-            char byte = 0;
-            while (value > 0x7f) {
-                // If the value to be written occupies more than 7 bits, we need to encode it using the MSB flag.
-                byte = (static_cast<uint8_t>(value & 0x7f)) | 0x80;
-                out.put(byte);
-                // Remove the seven bits that we have already written.
-                value >>= 7;
-                // Start next byte.
-                size++;
-            }
-            // Write final value.
-            byte = (static_cast<uint8_t>(value)) & 0x7f;
-            out.put(byte);
-
-            return size;
+            return VarIntCodec::encode(out, value);
         }
 
         ///////////////////////////////////////////////////////////////////////
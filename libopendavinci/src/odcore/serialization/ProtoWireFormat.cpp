@@ -0,0 +1,331 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstring>
+
+#include "opendavinci/odcore/platform/PortableEndian.h"
+#include "opendavinci/odcore/serialization/ProtoSerializer.h"
+#include "opendavinci/odcore/serialization/ProtoWireFormat.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
+
+namespace odcore {
+    namespace serialization {
+
+        using namespace std;
+
+        uint32_t ProtoWireFormat::getVarIntFieldSize(const uint32_t &id, const uint64_t &value) {
+            return VarIntCodec::getSize((id << 3) | ProtoSerializer::VARINT) + VarIntCodec::getSize(value);
+        }
+
+        char* ProtoWireFormat::writeVarIntField(char *buffer, const uint32_t &id, const uint64_t &value) {
+            buffer += VarIntCodec::encode(buffer, (id << 3) | ProtoSerializer::VARINT);
+            return buffer + VarIntCodec::encode(buffer, value);
+        }
+
+        const char* ProtoWireFormat::readVarInt(const char *begin, const char *end, const uint32_t &type, uint64_t &value) {
+            value = 0;
+            if (ProtoSerializer::VARINT != type) {
+                return skip(begin, end, type);
+            }
+            const uint8_t size = VarIntCodec::decode(begin, end, value);
+            return (0 == size) ? NULL : begin + size;
+        }
+
+        const char* ProtoWireFormat::readKey(const char *begin, const char *end, uint32_t &id, uint32_t &type) {
+            uint64_t key = 0;
+            const uint8_t size = VarIntCodec::decode(begin, end, key);
+            id = static_cast<uint32_t>(key >> 3);
+            type = static_cast<uint32_t>(key & 0x7);
+            return (0 == size) ? NULL : begin + size;
+        }
+
+        const char* ProtoWireFormat::skip(const char *begin, const char *end, const uint32_t &type) {
+            uint64_t length = 0;
+            switch (type) {
+                case ProtoSerializer::VARINT:
+                {
+                    const uint8_t size = VarIntCodec::decode(begin, end, length);
+                    return (0 == size) ? NULL : begin + size;
+                }
+                case ProtoSerializer::EIGHT_BYTES:
+                    length = sizeof(uint64_t);
+                break;
+                case ProtoSerializer::FOUR_BYTES:
+                    length = sizeof(uint32_t);
+                break;
+                case ProtoSerializer::LENGTH_DELIMITED:
+                {
+                    const uint8_t size = VarIntCodec::decode(begin, end, length);
+                    if (0 == size) {
+                        return NULL;
+                    }
+                    begin += size;
+                }
+                break;
+                default:
+                    // Unsupported wire type.
+                    return NULL;
+            }
+            return (length > static_cast<uint64_t>(end - begin)) ? NULL : begin + length;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const bool &v) {
+            return getVarIntFieldSize(id, v);
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const char &v) {
+            return getVarIntFieldSize(id, static_cast<uint64_t>(v));
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const unsigned char &v) {
+            return getVarIntFieldSize(id, v);
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const int8_t &v) {
+            return getVarIntFieldSize(id, VarIntCodec::encodeZigZag32(v));
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const int16_t &v) {
+            return getVarIntFieldSize(id, VarIntCodec::encodeZigZag32(v));
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const uint16_t &v) {
+            return getVarIntFieldSize(id, v);
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const int32_t &v) {
+            return getVarIntFieldSize(id, VarIntCodec::encodeZigZag32(v));
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const uint32_t &v) {
+            return getVarIntFieldSize(id, v);
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const int64_t &v) {
+            return getVarIntFieldSize(id, VarIntCodec::encodeZigZag64(v));
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const uint64_t &v) {
+            return getVarIntFieldSize(id, v);
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const float &/*v*/) {
+            return VarIntCodec::getSize((id << 3) | ProtoSerializer::FOUR_BYTES) + sizeof(uint32_t);
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const double &/*v*/) {
+            return VarIntCodec::getSize((id << 3) | ProtoSerializer::EIGHT_BYTES) + sizeof(uint64_t);
+        }
+
+        uint32_t ProtoWireFormat::getSize(const uint32_t &id, const string &v) {
+            return VarIntCodec::getSize((id << 3) | ProtoSerializer::LENGTH_DELIMITED) + VarIntCodec::getSize(v.size()) + v.size();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const bool &v) {
+            return writeVarIntField(buffer, id, v);
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const char &v) {
+            return writeVarIntField(buffer, id, static_cast<uint64_t>(v));
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const unsigned char &v) {
+            return writeVarIntField(buffer, id, v);
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const int8_t &v) {
+            return writeVarIntField(buffer, id, VarIntCodec::encodeZigZag32(v));
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const int16_t &v) {
+            return writeVarIntField(buffer, id, VarIntCodec::encodeZigZag32(v));
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const uint16_t &v) {
+            return writeVarIntField(buffer, id, v);
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const int32_t &v) {
+            return writeVarIntField(buffer, id, VarIntCodec::encodeZigZag32(v));
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const uint32_t &v) {
+            return writeVarIntField(buffer, id, v);
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const int64_t &v) {
+            return writeVarIntField(buffer, id, VarIntCodec::encodeZigZag64(v));
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const uint64_t &v) {
+            return writeVarIntField(buffer, id, v);
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const float &v) {
+            // 4 bytes values need to obey little endian encoding.
+            uint32_t _v = 0;
+            memcpy(&_v, &v, sizeof(uint32_t));
+            _v = htole32(_v);
+            buffer += VarIntCodec::encode(buffer, (id << 3) | ProtoSerializer::FOUR_BYTES);
+            memcpy(buffer, &_v, sizeof(uint32_t));
+            return buffer + sizeof(uint32_t);
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const double &v) {
+            // 8 bytes values need to obey little endian encoding.
+            uint64_t _v = 0;
+            memcpy(&_v, &v, sizeof(uint64_t));
+            _v = htole64(_v);
+            buffer += VarIntCodec::encode(buffer, (id << 3) | ProtoSerializer::EIGHT_BYTES);
+            memcpy(buffer, &_v, sizeof(uint64_t));
+            return buffer + sizeof(uint64_t);
+        }
+
+        char* ProtoWireFormat::write(char *buffer, const uint32_t &id, const string &v) {
+            buffer += VarIntCodec::encode(buffer, (id << 3) | ProtoSerializer::LENGTH_DELIMITED);
+            buffer += VarIntCodec::encode(buffer, v.size());
+            if (!v.empty()) {
+                memcpy(buffer, v.data(), v.size());
+            }
+            return buffer + v.size();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, bool &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = (0 != value);
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, char &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = static_cast<char>(value);
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, unsigned char &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = static_cast<unsigned char>(value);
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, int8_t &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = static_cast<int8_t>(VarIntCodec::decodeZigZag32(static_cast<uint32_t>(value)));
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, int16_t &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = static_cast<int16_t>(VarIntCodec::decodeZigZag32(static_cast<uint32_t>(value)));
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, uint16_t &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = static_cast<uint16_t>(value);
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, int32_t &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = VarIntCodec::decodeZigZag32(static_cast<uint32_t>(value));
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, uint32_t &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = static_cast<uint32_t>(value);
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, int64_t &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = VarIntCodec::decodeZigZag64(value);
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, uint64_t &v) {
+            uint64_t value = 0;
+            begin = readVarInt(begin, end, type, value);
+            v = value;
+            return begin;
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, float &v) {
+            v = 0;
+            if (ProtoSerializer::FOUR_BYTES != type) {
+                return skip(begin, end, type);
+            }
+            if (static_cast<uint64_t>(end - begin) < sizeof(uint32_t)) {
+                return NULL;
+            }
+            uint32_t _v = 0;
+            memcpy(&_v, begin, sizeof(uint32_t));
+            _v = le32toh(_v);
+            memcpy(&v, &_v, sizeof(float));
+            return begin + sizeof(uint32_t);
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, double &v) {
+            v = 0;
+            if (ProtoSerializer::EIGHT_BYTES != type) {
+                return skip(begin, end, type);
+            }
+            if (static_cast<uint64_t>(end - begin) < sizeof(uint64_t)) {
+                return NULL;
+            }
+            uint64_t _v = 0;
+            memcpy(&_v, begin, sizeof(uint64_t));
+            _v = le64toh(_v);
+            memcpy(&v, &_v, sizeof(double));
+            return begin + sizeof(uint64_t);
+        }
+
+        const char* ProtoWireFormat::read(const char *begin, const char *end, const uint32_t &type, string &v) {
+            v.clear();
+            if (ProtoSerializer::LENGTH_DELIMITED != type) {
+                return skip(begin, end, type);
+            }
+            uint64_t length = 0;
+            const uint8_t size = VarIntCodec::decode(begin, end, length);
+            if ( (0 == size) || (length > static_cast<uint64_t>(end - begin - size)) ) {
+                return NULL;
+            }
+            begin += size;
+            v.assign(begin, length);
+            return begin + length;
+        }
+
+    }
+} // odcore::serialization
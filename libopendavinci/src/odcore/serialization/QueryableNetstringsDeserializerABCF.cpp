@@ -17,9 +17,13 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
+#include "opendavinci/odcore/io/ReadOnlyStreamBuffer.h"
 #include "opendavinci/odcore/serialization/QueryableNetstringsDeserializerABCF.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
 #include "opendavinci/odcore/serialization/Serializable.h"
 #include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odcore/opendavinci.h"
@@ -30,46 +34,39 @@ namespace odcore {
         using namespace std;
 
         QueryableNetstringsDeserializerABCF::QueryableNetstringsDeserializerABCF() :
-            m_buffer(),
-            m_values() {}
+            m_ownedData(),
+            m_data(NULL),
+            m_size(0),
+            m_indexIsValid(false),
+            m_index() {}
 
         QueryableNetstringsDeserializerABCF::QueryableNetstringsDeserializerABCF(istream &in) :
-            m_buffer(),
-            m_values() {
+            m_ownedData(),
+            m_data(NULL),
+            m_size(0),
+            m_indexIsValid(false),
+            m_index() {
             deserializeDataFrom(in);
         }
 
         uint8_t QueryableNetstringsDeserializerABCF::decodeVarInt(istream &in, int64_t &value) {
             uint64_t uvalue = 0;
-            uint8_t size = decodeVarUInt(in, uvalue);
-            value = static_cast<int64_t>( uvalue & 1 ? ~(uvalue >> 1) : (uvalue >> 1) );
+            const uint8_t size = VarIntCodec::decode(in, uvalue);
+            value = VarIntCodec::decodeZigZag64(uvalue);
             return size;
         }
 
         uint8_t QueryableNetstringsDeserializerABCF::decodeVarUInt(istream &in, uint64_t &value) {
-            value = 0;
-            uint8_t size = 0;
-            while (in.good()) {
-                char c = 0;
-                in.read(&c, sizeof(char));
-                value |= static_cast<unsigned int>( (c & 0x7f) << (0x7 * size++) );
-                if ( !(c & 0x80) ) break;
-            }
-            // Decode as little endian like in Protobuf's case.
-            value = le64toh(value);
-
-            return size;
+            return VarIntCodec::decode(in, value);
         }
 
         void QueryableNetstringsDeserializerABCF::deserializeDataFrom(istream &in) {
-            // Reset any existing data in our hashmap.
-            m_values.clear();
-            m_buffer.clear();
-            m_buffer.str("");
-
-            // Initialize the stringstream for getting valid positions when calling tellp().
-            // This MUST be a blank (Win32 has a *special* implementation...)!
-            m_buffer << " ";
+            // Reset any existing data.
+            m_ownedData.clear();
+            m_data = NULL;
+            m_size = 0;
+            m_indexIsValid = false;
+            m_index.clear();
 
             // Stream contents:
             // Header:
@@ -101,43 +98,86 @@ namespace odcore {
                 uint64_t length = 0;
                 decodeVarUInt(in, length);
 
-                // Decode payload consisting of: *(ID SIZE PAYLOAD).
-                char c = 0;
-                uint64_t tokenIdentifier = 0;
-                uint64_t lengthOfPayload = 0;
-
-                // Buffer to store payload "en bloc"; length is identical to UDP payload.
-                const uint32_t MAX_SIZE_PAYLOAD = 65535;
-                char buffer[MAX_SIZE_PAYLOAD];
+                odcore::io::ReadOnlyStreamBuffer *readOnlyBuffer = dynamic_cast<odcore::io::ReadOnlyStreamBuffer*>(in.rdbuf());
+                if (NULL != readOnlyBuffer) {
+                    // The payload is already in memory; borrow it.
+                    const uint64_t available = static_cast<uint64_t>(std::max<streamsize>(readOnlyBuffer->in_avail(), 0));
+                    m_data = readOnlyBuffer->getCurrentPosition();
+                    m_size = static_cast<uint32_t>((length < available) ? length : available);
+                    in.seekg(m_size, ios_base::cur);
+                }
+                else if (length > 0) {
+                    // Read the payload en bloc.
+                    m_ownedData.resize(length);
+                    in.read(&m_ownedData[0], length);
+                    m_data = &m_ownedData[0];
+                    m_size = static_cast<uint32_t>(in.gcount());
+                }
 
-                while (in.good() && (length > 0)) {
-                    // Start of next token by reading ID.
-                    length -= decodeVarUInt(in, tokenIdentifier);
+                // Check for trailing ','
+                char c = 0;
+                in.read(&c, sizeof(char));
+                if (c != ',') {
+                    CLOG2 << "Stream corrupt: trailing ',' missing,  found: '" << c << "'" << endl;
+                }
+            }
+        }
 
-                    // Read length of payload and adjust loop.
-                    lengthOfPayload = 0;
-                    length -= decodeVarUInt(in, lengthOfPayload);
+        const FieldIndex::Entry* QueryableNetstringsDeserializerABCF::findField(const uint32_t &id) {
+            if (!m_indexIsValid) {
+                m_indexIsValid = true;
 
-                    // Create new (tokenIdentifier, m_buffer) hashmap entry.
-                    m_values.insert(make_pair(tokenIdentifier, m_buffer.tellp()));
+                // Decode payload consisting of: *(ID SIZE PAYLOAD).
+                const char *begin = m_data;
+                const char *end = m_data + m_size;
+                const char *p = begin;
+                while (p < end) {
+                    uint64_t tokenIdentifier = 0;
+                    uint8_t bytesRead = VarIntCodec::decode(p, end, tokenIdentifier);
+                    if (0 == bytesRead) {
+                        break;
+                    }
+                    p += bytesRead;
 
-                    // Decode payload.
-                    if (lengthOfPayload > 0) {
-                        // Read data "en bloc".
-                        in.read(buffer, lengthOfPayload);
-                        m_buffer.write(buffer, lengthOfPayload);
+                    uint64_t lengthOfPayload = 0;
+                    bytesRead = VarIntCodec::decode(p, end, lengthOfPayload);
+                    if (0 == bytesRead) {
+                        break;
+                    }
+                    p += bytesRead;
 
-                        // Update amount of processed data.
-                        length -= lengthOfPayload;
+                    // Truncated fields are limited to the available data.
+                    if (lengthOfPayload > static_cast<uint64_t>(end - p)) {
+                        lengthOfPayload = static_cast<uint64_t>(end - p);
                     }
-                }
 
-                // Check for trailing ','
-                in.read(&c, sizeof(char));
-                if (c != ',') {
-                    CLOG2 << "Stream corrupt: trailing ',' missing,  found: '" << c << "'" << endl;
+                    m_index.add(static_cast<uint32_t>(tokenIdentifier), 0, static_cast<uint32_t>(p - begin), static_cast<uint32_t>(lengthOfPayload));
+                    p += lengthOfPayload;
                 }
+
+                m_index.sort();
+            }
+
+            // The first occurrence of a field wins.
+            return m_index.findFirst(id);
+        }
+
+        bool QueryableNetstringsDeserializerABCF::readVarUInt(const uint32_t &id, uint64_t &value) {
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                const char *p = m_data + entry->m_offset;
+                VarIntCodec::decode(p, p + entry->m_length, value);
             }
+            return (NULL != entry);
+        }
+
+        bool QueryableNetstringsDeserializerABCF::readVarInt(const uint32_t &id, int64_t &value) {
+            uint64_t uvalue = 0;
+            const bool available = readVarUInt(id, uvalue);
+            if (available) {
+                value = VarIntCodec::decodeZigZag64(uvalue);
+            }
+            return available;
         }
 
         QueryableNetstringsDeserializerABCF::~QueryableNetstringsDeserializerABCF() {}
@@ -408,144 +448,132 @@ namespace odcore {
         ///////////////////////////////////////////////////////////////////////
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, Serializable &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-
-                // Read string for serialized Serializable.
-                string str_buffer;
-                readValue(m_buffer, str_buffer);
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                // Serializables are encoded as string.
+                const char *p = m_data + entry->m_offset;
+                const char *end = p + entry->m_length;
+                uint64_t length = 0;
+                p += VarIntCodec::decode(p, end, length);
+                if (length > static_cast<uint64_t>(end - p)) {
+                    length = static_cast<uint64_t>(end - p);
+                }
 
-                // Read Serializable from string.
-                stringstream sstr_buffer(str_buffer);
-                sstr_buffer >> v;
+                // Read Serializable in-place.
+                odcore::io::ReadOnlyStreamBuffer buffer(p, length);
+                istream in(&buffer);
+                in >> v;
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, bool &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            uint64_t tmp = 0;
+            if (readVarUInt(id, tmp)) {
+                v = static_cast<bool>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, char &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            int64_t tmp = 0;
+            if (readVarInt(id, tmp)) {
+                v = static_cast<char>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, unsigned char &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            uint64_t tmp = 0;
+            if (readVarUInt(id, tmp)) {
+                v = static_cast<unsigned char>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, int8_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            int64_t tmp = 0;
+            if (readVarInt(id, tmp)) {
+                v = static_cast<int8_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, int16_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            int64_t tmp = 0;
+            if (readVarInt(id, tmp)) {
+                v = static_cast<int16_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, uint16_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            uint64_t tmp = 0;
+            if (readVarUInt(id, tmp)) {
+                v = static_cast<uint16_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, int32_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            int64_t tmp = 0;
+            if (readVarInt(id, tmp)) {
+                v = static_cast<int32_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, uint32_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            uint64_t tmp = 0;
+            if (readVarUInt(id, tmp)) {
+                v = static_cast<uint32_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, int64_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            int64_t tmp = 0;
+            if (readVarInt(id, tmp)) {
+                v = static_cast<int64_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, uint64_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            uint64_t tmp = 0;
+            if (readVarUInt(id, tmp)) {
+                v = static_cast<uint64_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, float &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            const FieldIndex::Entry *entry = findField(id);
+            if ( (NULL != entry) && (entry->m_length >= sizeof(float)) ) {
+                float _f = 0;
+                memcpy(&_f, m_data + entry->m_offset, sizeof(float));
+                v = Deserializer::ntohf(_f);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, double &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+            const FieldIndex::Entry *entry = findField(id);
+            if ( (NULL != entry) && (entry->m_length >= sizeof(double)) ) {
+                double _d = 0;
+                memcpy(&_d, m_data + entry->m_offset, sizeof(double));
+                v = Deserializer::ntohd(_d);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, string &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                const char *p = m_data + entry->m_offset;
+                const char *end = p + entry->m_length;
+                uint64_t stringLength = 0;
+                p += VarIntCodec::decode(p, end, stringLength);
+                if (stringLength > static_cast<uint64_t>(end - p)) {
+                    stringLength = static_cast<uint64_t>(end - p);
+                }
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, v);
+                // It is absolutely necessary to specify the size of the serialized string, otherwise, s contains only data until the first '\0' is read.
+                v.assign(p, stringLength);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &id, const string &/*longName*/, const string &/*shortName*/, void *data, const uint32_t &size) {
-            map<uint32_t, streampos>::iterator it = m_values.find(id);
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                readValue(m_buffer, data, size);
+            const FieldIndex::Entry *entry = findField(id);
+            if (NULL != entry) {
+                memcpy(data, m_data + entry->m_offset, (size < entry->m_length ? size : entry->m_length));
             }
         }
     }
@@ -19,6 +19,7 @@
 
 #include "opendavinci/odcore/serialization/QueryableNetstringsSerializerABCF.h"
 #include "opendavinci/odcore/serialization/Serializable.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
 
 namespace odcore {
     namespace serialization {
@@ -31,30 +32,11 @@ namespace odcore {
         QueryableNetstringsSerializerABCF::~QueryableNetstringsSerializerABCF() {}
 
         uint8_t QueryableNetstringsSerializerABCF::encodeVarInt(ostream &out, int64_t value) {
-            uint64_t uvalue = static_cast<uint64_t>( value < 0 ? ~(value << 1) : (value << 1) );
-            return encodeVarUInt(out, uvalue);
+            return VarIntCodec::encode(out, VarIntCodec::encodeZigZag64(value));
         }
 
         uint8_t QueryableNetstringsSerializerABCF::encodeVarUInt(ostream &out, uint64_t value) {
-            // We will write at least one byte.
-            uint8_t size = 1;
-
-            value = htole64(value);
-
-            char byte = 0;
-            while (value > 0x7f) {
-                // If the value to be written occupies more than 7 bits, we need to encode it using the MSB flag.
-                byte = (static_cast<uint8_t>(value & 0x7f)) | 0x80;
-                out.put(byte);
-                // Remove the seven bits that we have already written.
-                value >>= 7;
-                // Start next byte.
-                size++;
-            }
-            // Write final value.
-            byte = (static_cast<uint8_t>(value)) & 0x7f;
-            out.put(byte);
-            return size;
+            return VarIntCodec::encode(out, value);
         }
 
         void QueryableNetstringsSerializerABCF::getSerializedData(ostream &o) {
@@ -0,0 +1,284 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+#include "opendavinci/odcore/platform/PortableEndian.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
+
+namespace odcore {
+    namespace serialization {
+
+        using namespace std;
+
+        /**
+         * @return Index of the most significant bit set in value (value != 0).
+         */
+        static inline uint32_t getIndexOfHighestBit(uint64_t value) {
+#if defined(__GNUC__)
+            return 63 - static_cast<uint32_t>(__builtin_clzll(value));
+#else
+            uint32_t index = 0;
+            while (value >>= 1) {
+                index++;
+            }
+            return index;
+#endif
+        }
+
+        /**
+         * @return Index of the least significant bit set in value (value != 0).
+         */
+        static inline uint32_t getIndexOfLowestBit(uint64_t value) {
+#if defined(__GNUC__)
+            return static_cast<uint32_t>(__builtin_ctzll(value));
+#else
+            uint32_t index = 0;
+            while (!(value & 1)) {
+                value >>= 1;
+                index++;
+            }
+            return index;
+#endif
+        }
+
+        uint8_t VarIntCodec::getSize(const uint64_t &value) {
+            // Each byte carries 7 bits: size = ceil(bits / 7), computed without a loop.
+            return static_cast<uint8_t>((getIndexOfHighestBit(value | 1) * 9 + 73) / 64);
+        }
+
+        uint8_t VarIntCodec::encode(char *buffer, uint64_t value) {
+            if (value < 0x80) {
+                buffer[0] = static_cast<char>(value);
+                return 1;
+            }
+
+            const uint8_t size = getSize(value);
+            for (uint8_t i = 0; i < size - 1; i++) {
+                // All but the last byte carry the MSB flag.
+                buffer[i] = static_cast<char>((value & 0x7f) | 0x80);
+                value >>= 7;
+            }
+            buffer[size - 1] = static_cast<char>(value);
+            return size;
+        }
+
+        uint8_t VarIntCodec::decode(const char *begin, const char *end, uint64_t &value) {
+            value = 0;
+            if (begin >= end) {
+                return 0;
+            }
+
+            // Most values occupy a single byte.
+            if (!(static_cast<uint8_t>(*begin) & 0x80)) {
+                value = static_cast<uint8_t>(*begin);
+                return 1;
+            }
+
+            if (end - begin >= 8) {
+                // Values with up to eight bytes are decoded from one 64 bit word:
+                // Locate the terminating byte and compact the 7 bit groups.
+                uint64_t word = 0;
+                memcpy(&word, begin, sizeof(uint64_t));
+                word = le64toh(word);
+
+                const uint64_t stopBits = ~word & UINT64_C(0x8080808080808080);
+                if (0 != stopBits) {
+                    const uint32_t bits = getIndexOfLowestBit(stopBits) + 1;
+                    if (bits < 64) {
+                        word &= (UINT64_C(1) << bits) - 1;
+                    }
+                    word = (word & UINT64_C(0x007f007f007f007f)) | ((word & UINT64_C(0x7f007f007f007f00)) >> 1);
+                    word = (word & UINT64_C(0x00003fff00003fff)) | ((word & UINT64_C(0x3fff00003fff0000)) >> 2);
+                    word = (word & UINT64_C(0x000000000fffffff)) | ((word & UINT64_C(0x0fffffff00000000)) >> 4);
+                    value = word;
+                    return static_cast<uint8_t>(bits / 8);
+                }
+            }
+
+            for (uint8_t size = 0; (size < MAX_VARINT_SIZE) && (begin + size < end); size++) {
+                const uint8_t byte = static_cast<uint8_t>(begin[size]);
+                value |= static_cast<uint64_t>(byte & 0x7f) << (7 * size);
+                if (!(byte & 0x80)) {
+                    return size + 1;
+                }
+            }
+            return 0;
+        }
+
+        uint8_t VarIntCodec::encode(ostream &out, const uint64_t &value) {
+            char buffer[MAX_VARINT_SIZE];
+            const uint8_t size = encode(buffer, value);
+            out.write(buffer, size);
+            return size;
+        }
+
+        uint8_t VarIntCodec::decode(istream &in, uint64_t &value) {
+            value = 0;
+
+            streambuf *sb = in.rdbuf();
+            uint8_t size = 0;
+            while ( (size < MAX_VARINT_SIZE) && in.good() && (NULL != sb) ) {
+                const int c = sb->sbumpc();
+                if (char_traits<char>::eof() == c) {
+                    in.setstate(ios_base::eofbit | ios_base::failbit);
+                    break;
+                }
+                value |= static_cast<uint64_t>(c & 0x7f) << (7 * size++);
+                if (!(c & 0x80)) {
+                    break;
+                }
+            }
+            return size;
+        }
+
+        uint32_t VarIntCodec::encode(char *buffer, const uint32_t *values, const uint32_t &count) {
+            char *p = buffer;
+            uint32_t i = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+            while (count - i >= 16) {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i + 4));
+                const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i + 8));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i + 12));
+
+                // Are all 16 values smaller than 128?
+                const __m128i highBits = _mm_srli_epi32(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), 7);
+                if (0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi32(highBits, zero))) {
+                    // Narrow 32 bit lanes to bytes; saturation cannot occur.
+                    const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), bytes);
+                    p += 16;
+                    i += 16;
+                }
+                else {
+                    for (const uint32_t last = i + 16; i < last; i++) {
+                        p += encode(p, values[i]);
+                    }
+                }
+            }
+#endif
+
+            for (; i < count; i++) {
+                p += encode(p, values[i]);
+            }
+            return static_cast<uint32_t>(p - buffer);
+        }
+
+        uint32_t VarIntCodec::decode(const char *begin, const char *end, uint32_t *values, const uint32_t &count) {
+            const char *p = begin;
+            uint32_t i = 0;
+
+#if defined(__AVX2__)
+            while ( (count - i >= 32) && (end - p >= 32) ) {
+                const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                const uint32_t continuationBits = static_cast<uint32_t>(_mm256_movemask_epi8(bytes));
+                if (0 == continuationBits) {
+                    // 32 single byte values: widen eight bytes at a time.
+                    for (uint32_t j = 0; j < 32; j += 8) {
+                        const __m128i eightBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + j));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i + j), _mm256_cvtepu8_epi32(eightBytes));
+                    }
+                    p += 32;
+                    i += 32;
+                }
+                else {
+                    // Decode scalar until all multi byte values of this block are consumed.
+                    const char *stop = p + getIndexOfHighestBit(continuationBits) + 1;
+                    while ( (p < stop) && (i < count) ) {
+                        uint64_t value = 0;
+                        const uint8_t size = decode(p, end, value);
+                        if (0 == size) {
+                            return 0;
+                        }
+                        values[i++] = static_cast<uint32_t>(value);
+                        p += size;
+                    }
+                }
+            }
+#elif defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+            while ( (count - i >= 16) && (end - p >= 16) ) {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                const uint32_t continuationBits = static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+                if (0 == continuationBits) {
+                    // 16 single byte values: widen to 32 bit lanes.
+                    const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+                    const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i + 4), _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i + 8), _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i + 12), _mm_unpackhi_epi16(high, zero));
+                    p += 16;
+                    i += 16;
+                }
+                else {
+                    // Decode scalar until all multi byte values of this block are consumed.
+                    const char *stop = p + getIndexOfHighestBit(continuationBits) + 1;
+                    while ( (p < stop) && (i < count) ) {
+                        uint64_t value = 0;
+                        const uint8_t size = decode(p, end, value);
+                        if (0 == size) {
+                            return 0;
+                        }
+                        values[i++] = static_cast<uint32_t>(value);
+                        p += size;
+                    }
+                }
+            }
+#endif
+
+            for (; i < count; i++) {
+                uint64_t value = 0;
+                const uint8_t size = decode(p, end, value);
+                if (0 == size) {
+                    return 0;
+                }
+                values[i] = static_cast<uint32_t>(value);
+                p += size;
+            }
+            return static_cast<uint32_t>(p - begin);
+        }
+
+        uint32_t VarIntCodec::encodeZigZag32(const int32_t &value) {
+            return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        }
+
+        int32_t VarIntCodec::decodeZigZag32(const uint32_t &value) {
+            return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+        uint64_t VarIntCodec::encodeZigZag64(const int64_t &value) {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        int64_t VarIntCodec::decodeZigZag64(const uint64_t &value) {
+            return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+    }
+} // odcore::serialization
@@ -0,0 +1,306 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+    #include <linux/mempolicy.h>
+    #include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXMappedSharedMemory.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            namespace {
+                // Identifies an initialized shared memory ("ODMS").
+                const uint32_t MAPPING_MAGIC = 0x4F444D53;
+
+                // The user's data starts at a cache line.
+                const uint32_t CACHE_LINE_SIZE = 64;
+
+                // Mappings with huge pages are rounded up to this size.
+                const uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+                /**
+                 * Header at the beginning of the mapping.
+                 */
+                struct MappingHeader {
+                    uint32_t m_magic;
+                    uint32_t m_headerSize;
+                    uint32_t m_size;
+                    std::atomic<uint32_t> m_initialized;
+                    pthread_mutex_t m_mutex;
+                };
+
+                inline uint32_t getHeaderSize() {
+                    return ((sizeof(MappingHeader) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+                }
+
+                inline MappingHeader* getHeader(char *mapping) {
+                    return reinterpret_cast<MappingHeader*>(mapping);
+                }
+            }
+
+            POSIXMappedSharedMemory::POSIXMappedSharedMemory(const string &name, const uint32_t &size, const SharedMemoryOptions &options) :
+                m_name(name),
+                m_internalName(getInternalName(name)),
+                m_releaseSharedMemory(true),
+                m_mapping(NULL),
+                m_mappingSize(0),
+                m_size(size) {
+
+                if (m_name.size() > 0) {
+                    // 1. Try to cleanup a potentially uncleanly existing shared memory.
+                    if (0 == shm_unlink(m_internalName.c_str())) {
+                        clog << "[POSIXMappedSharedMemory] Removed existing shared memory " << m_internalName << "." << endl;
+                    }
+
+                    // 2. Create the requested shared memory with this name.
+                    const int fd = shm_open(m_internalName.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+                    if (fd < 0) {
+                        CLOG3 << "[POSIXMappedSharedMemory] Shared memory could not be created, errno: " << errno << "; " << ::strerror(errno) << endl;
+                    }
+                    else {
+                        m_mappingSize = getHeaderSize() + static_cast<uint64_t>(size);
+                        if (options.m_hugePages) {
+                            m_mappingSize = ((m_mappingSize + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+                        }
+
+                        if (0 != ftruncate(fd, static_cast<off_t>(m_mappingSize))) {
+                            CLOG3 << "[POSIXMappedSharedMemory] Shared memory could not be resized, errno: " << errno << "; " << ::strerror(errno) << endl;
+                        }
+                        else {
+                            int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+                            // With a NUMA node, pages are faulted in after setting the memory policy.
+                            if ( (options.m_populate) && (options.m_numaNode < 0) ) {
+                                flags |= MAP_POPULATE;
+                            }
+#endif
+                            void *mapping = mmap(NULL, m_mappingSize, PROT_READ | PROT_WRITE, flags, fd, 0);
+                            if (MAP_FAILED == mapping) {
+                                CLOG3 << "[POSIXMappedSharedMemory] Shared memory could not be mapped, errno: " << errno << "; " << ::strerror(errno) << endl;
+                            }
+                            else {
+                                m_mapping = static_cast<char*>(mapping);
+                                applyOptions(options);
+
+                                // 3. Initialize the header; the mutex lives in the shared memory itself.
+                                MappingHeader *header = getHeader(m_mapping);
+                                new (&header->m_initialized) std::atomic<uint32_t>(0);
+                                header->m_magic = MAPPING_MAGIC;
+                                header->m_headerSize = getHeaderSize();
+                                header->m_size = m_size;
+
+                                pthread_mutexattr_t attributes;
+                                pthread_mutexattr_init(&attributes);
+                                pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+#ifdef __linux__
+                                pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+#endif
+                                pthread_mutex_init(&header->m_mutex, &attributes);
+                                pthread_mutexattr_destroy(&attributes);
+
+                                header->m_initialized.store(1, std::memory_order_release);
+                            }
+                        }
+                        close(fd);
+
+                        if (NULL == m_mapping) {
+                            shm_unlink(m_internalName.c_str());
+                        }
+                    }
+                }
+            }
+
+            POSIXMappedSharedMemory::POSIXMappedSharedMemory(const string &name) :
+                m_name(name),
+                m_internalName(getInternalName(name)),
+                m_releaseSharedMemory(false),
+                m_mapping(NULL),
+                m_mappingSize(0),
+                m_size(0) {
+
+                if (m_name.size() > 0) {
+                    // A missing shared memory is not an error as the caller might fall back to System V shared memory.
+                    const int fd = shm_open(m_internalName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+                    if (!(fd < 0)) {
+                        struct stat fileStatus;
+                        if ( (0 == fstat(fd, &fileStatus)) && (static_cast<uint64_t>(fileStatus.st_size) >= getHeaderSize()) ) {
+                            m_mappingSize = static_cast<uint64_t>(fileStatus.st_size);
+
+                            void *mapping = mmap(NULL, m_mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                            if (MAP_FAILED == mapping) {
+                                CLOG3 << "[POSIXMappedSharedMemory] Shared memory could not be mapped, errno: " << errno << "; " << ::strerror(errno) << endl;
+                            }
+                            else {
+                                MappingHeader *header = getHeader(static_cast<char*>(mapping));
+                                if ( (1 == header->m_initialized.load(std::memory_order_acquire)) &&
+                                     (MAPPING_MAGIC == header->m_magic) &&
+                                     (getHeaderSize() == header->m_headerSize) &&
+                                     (header->m_headerSize + static_cast<uint64_t>(header->m_size) <= m_mappingSize) ) {
+                                    m_mapping = static_cast<char*>(mapping);
+                                    m_size = header->m_size;
+                                }
+                                else {
+                                    munmap(mapping, m_mappingSize);
+                                }
+                            }
+                        }
+                        close(fd);
+                    }
+                }
+            }
+
+            POSIXMappedSharedMemory::~POSIXMappedSharedMemory() {
+                if (NULL != m_mapping) {
+                    munmap(m_mapping, m_mappingSize);
+                }
+
+                // Attached processes keep their mappings.
+                if ( (m_releaseSharedMemory) && (NULL != m_mapping) ) {
+                    shm_unlink(m_internalName.c_str());
+                }
+            }
+
+            void POSIXMappedSharedMemory::applyOptions(const SharedMemoryOptions &options) {
+#ifdef __linux__
+                if (options.m_hugePages) {
+                    // Shared memory on tmpfs uses transparent huge pages if
+                    // /sys/kernel/mm/transparent_hugepage/shmem_enabled permits.
+                    if (0 != madvise(m_mapping, m_mappingSize, MADV_HUGEPAGE)) {
+                        CLOG3 << "[POSIXMappedSharedMemory] Huge pages could not be requested, errno: " << errno << "; " << ::strerror(errno) << endl;
+                    }
+                }
+
+                if (options.m_numaNode >= 0) {
+                    const uint32_t BITS_PER_WORD = 8 * sizeof(unsigned long);
+                    vector<unsigned long> nodeMask(options.m_numaNode / BITS_PER_WORD + 1, 0);
+                    nodeMask[options.m_numaNode / BITS_PER_WORD] |= (1UL << (options.m_numaNode % BITS_PER_WORD));
+
+                    // The kernel expects one bit more than the mask holds.
+                    if (0 != syscall(SYS_mbind, m_mapping, m_mappingSize, MPOL_PREFERRED, &nodeMask[0], nodeMask.size() * BITS_PER_WORD + 1, 0)) {
+                        CLOG3 << "[POSIXMappedSharedMemory] Shared memory could not be bound to NUMA node " << options.m_numaNode << ", errno: " << errno << "; " << ::strerror(errno) << endl;
+                    }
+
+                    if (options.m_populate) {
+                        const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+                        for (uint64_t i = 0; i < m_mappingSize; i += pageSize) {
+                            m_mapping[i] = 0;
+                        }
+                    }
+                }
+#else
+                (void)options;
+#endif
+            }
+
+            bool POSIXMappedSharedMemory::isValid() const {
+                return (NULL != m_mapping);
+            }
+
+            const string POSIXMappedSharedMemory::getName() const {
+                return m_name;
+            }
+
+            void POSIXMappedSharedMemory::lock() {
+                if (NULL != m_mapping) {
+                    MappingHeader *header = getHeader(m_mapping);
+                    const int retVal = pthread_mutex_lock(&header->m_mutex);
+#ifdef __linux__
+                    if (EOWNERDEAD == retVal) {
+                        // The previous owner died while holding the lock.
+                        pthread_mutex_consistent(&header->m_mutex);
+                    }
+#else
+                    (void)retVal;
+#endif
+                }
+            }
+
+            void POSIXMappedSharedMemory::unlock() {
+                if (NULL != m_mapping) {
+                    pthread_mutex_unlock(&getHeader(m_mapping)->m_mutex);
+                }
+            }
+
+            void* POSIXMappedSharedMemory::getSharedMemory() const {
+                return (NULL != m_mapping) ? static_cast<void*>(m_mapping + getHeaderSize()) : NULL;
+            }
+
+            uint32_t POSIXMappedSharedMemory::getSize() const {
+                return m_size;
+            }
+
+            const string POSIXMappedSharedMemory::getInternalName(const string &name) {
+                // The name must start with / and must not contain any further /'s.
+                string internalName(name);
+                replace(internalName.begin(), internalName.end(), '/', '_');
+                internalName.insert(0, "/");
+
+                #ifdef NAME_MAX
+                    const uint32_t MAX_NAME_LENGTH = NAME_MAX;
+                #else
+                    const uint32_t MAX_NAME_LENGTH = 255;
+                #endif
+                if (internalName.length() > MAX_NAME_LENGTH) {
+                    // Keep long names distinct by replacing their tail with a FNV-1a hash.
+                    uint32_t hash = 2166136261u;
+                    for (uint32_t i = 0; i < name.size(); i++) {
+                        hash = (hash ^ static_cast<uint8_t>(name.at(i))) * 16777619u;
+                    }
+
+                    stringstream sstr;
+                    sstr << internalName.substr(0, MAX_NAME_LENGTH - 9) << "_" << hex << setw(8) << setfill('0') << hash;
+                    internalName = sstr.str();
+                }
+
+                return internalName;
+            }
+
+            void POSIXMappedSharedMemory::remove(const string &name) {
+                shm_unlink(getInternalName(name).c_str());
+            }
+
+        }
+    }
+} // odcore::wrapper::POSIX
@@ -0,0 +1,314 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+#endif
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
+#include "opendavinci/odcore/wrapper/Thread.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            POSIXReactorHandler::~POSIXReactorHandler() {}
+
+            POSIXReactor::Registration::Registration() :
+                m_handler(NULL),
+                m_id(0),
+                m_busy(false),
+                m_removed(false),
+                m_thread() {}
+
+            POSIXReactor::POSIXReactor() :
+                m_registrationsMutex(),
+                m_handlerFinished(),
+                m_registrations(),
+                m_nextId(0),
+                m_stateMutex(),
+                m_epollFD(-1),
+                m_wakeupFD(-1),
+                m_running(false),
+                m_threads() {
+#ifdef __linux__
+                m_epollFD = epoll_create1(EPOLL_CLOEXEC);
+                if (m_epollFD < 0) {
+                    stringstream s;
+                    s << "[core::wrapper::POSIXReactor] Error while creating epoll instance: " << strerror(errno);
+                    throw s.str();
+                }
+
+                // The wake-up file descriptor is level-triggered to interrupt all threads at once.
+                m_wakeupFD = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+                if (m_wakeupFD < 0) {
+                    stringstream s;
+                    s << "[core::wrapper::POSIXReactor] Error while creating eventfd: " << strerror(errno);
+                    throw s.str();
+                }
+
+                struct epoll_event event;
+                memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN;
+                event.data.fd = m_wakeupFD;
+                epoll_ctl(m_epollFD, EPOLL_CTL_ADD, m_wakeupFD, &event);
+#endif
+            }
+
+            POSIXReactor::~POSIXReactor() {
+                disable();
+
+                if (m_wakeupFD >= 0) {
+                    close(m_wakeupFD);
+                }
+                if (m_epollFD >= 0) {
+                    close(m_epollFD);
+                }
+            }
+
+            POSIXReactor& POSIXReactor::getInstance() {
+                static POSIXReactor reactor;
+
+                static bool configured = false;
+                static std::mutex configuredMutex;
+                {
+                    std::lock_guard<std::mutex> l(configuredMutex);
+                    if (!configured) {
+                        configured = true;
+
+                        const char *numberOfThreads = getenv("OPENDAVINCI_REACTOR_THREADS");
+                        if ( (numberOfThreads != NULL) && (atoi(numberOfThreads) > 0) ) {
+                            reactor.enable(atoi(numberOfThreads));
+                        }
+                    }
+                }
+
+                return reactor;
+            }
+
+            bool POSIXReactor::enable(const uint32_t &numberOfThreads) {
+#ifdef __linux__
+                std::lock_guard<std::mutex> l(m_stateMutex);
+                if (!m_running) {
+                    m_running = true;
+                    for (uint32_t i = 0; i < numberOfThreads; i++) {
+                        std::shared_ptr<Thread> thread(ConcurrencyFactory::createThread(*this));
+                        if (thread.get() == NULL) {
+                            stringstream s;
+                            s << "[core::wrapper::POSIXReactor] Error creating thread: " << strerror(errno);
+                            throw s.str();
+                        }
+                        thread->start();
+                        m_threads.push_back(thread);
+                    }
+                }
+                return m_running;
+#else
+                (void)numberOfThreads;
+                return false;
+#endif
+            }
+
+            void POSIXReactor::disable() {
+                std::lock_guard<std::mutex> l(m_stateMutex);
+                if (m_running) {
+                    m_running = false;
+
+#ifdef __linux__
+                    // Interrupt all waiting threads.
+                    const uint64_t one = 1;
+                    if (write(m_wakeupFD, &one, sizeof(one)) < 0) {
+                        // Threads are waiting already.
+                    }
+#endif
+
+                    for (vector<std::shared_ptr<Thread> >::iterator it = m_threads.begin(); it != m_threads.end(); ++it) {
+                        (*it)->stop();
+                    }
+                    m_threads.clear();
+
+#ifdef __linux__
+                    uint64_t value = 0;
+                    if (read(m_wakeupFD, &value, sizeof(value)) < 0) {
+                        // Nothing to reset.
+                    }
+
+                    std::lock_guard<std::mutex> registrationsLock(m_registrationsMutex);
+                    for (map<int32_t, Registration>::iterator it = m_registrations.begin(); it != m_registrations.end(); ++it) {
+                        epoll_ctl(m_epollFD, EPOLL_CTL_DEL, it->first, NULL);
+
+                        // Hand the file descriptor back to its handler.
+                        if (!it->second.m_removed) {
+                            it->second.m_handler->handleDisabled();
+                        }
+                    }
+                    m_registrations.clear();
+#endif
+                }
+            }
+
+            bool POSIXReactor::isEnabled() {
+                return m_running;
+            }
+
+            bool POSIXReactor::isRunning() {
+                return m_running;
+            }
+
+            bool POSIXReactor::add(const int32_t &fd, POSIXReactorHandler &handler) {
+#ifdef __linux__
+                if (!isEnabled()) {
+                    return false;
+                }
+
+                std::lock_guard<std::mutex> l(m_registrationsMutex);
+                if (m_registrations.count(fd) > 0) {
+                    return false;
+                }
+
+                Registration &registration = m_registrations[fd];
+                registration.m_handler = &handler;
+                registration.m_id = m_nextId++;
+
+                // One-shot events guarantee that a file descriptor is handled by only one thread at a time.
+                struct epoll_event event;
+                memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN | EPOLLONESHOT;
+                event.data.fd = fd;
+                if (epoll_ctl(m_epollFD, EPOLL_CTL_ADD, fd, &event) < 0) {
+                    m_registrations.erase(fd);
+                    return false;
+                }
+                return true;
+#else
+                (void)fd;
+                (void)handler;
+                return false;
+#endif
+            }
+
+            void POSIXReactor::remove(const int32_t &fd) {
+#ifdef __linux__
+                std::unique_lock<std::mutex> l(m_registrationsMutex);
+                map<int32_t, Registration>::iterator it = m_registrations.find(fd);
+                if (it == m_registrations.end()) {
+                    return;
+                }
+
+                epoll_ctl(m_epollFD, EPOLL_CTL_DEL, fd, NULL);
+
+                if (it->second.m_busy) {
+                    // The handling thread removes the registration.
+                    it->second.m_removed = true;
+
+                    if (!pthread_equal(it->second.m_thread, pthread_self())) {
+                        const uint64_t id = it->second.m_id;
+                        while (true) {
+                            it = m_registrations.find(fd);
+                            if ( (it == m_registrations.end()) || (it->second.m_id != id) ) {
+                                break;
+                            }
+                            m_handlerFinished.wait(l);
+                        }
+                    }
+                }
+                else {
+                    m_registrations.erase(it);
+                }
+#else
+                (void)fd;
+#endif
+            }
+
+            void POSIXReactor::dispatch(const int32_t &fd) {
+#ifdef __linux__
+                POSIXReactorHandler *handler = NULL;
+                uint64_t id = 0;
+                {
+                    std::lock_guard<std::mutex> l(m_registrationsMutex);
+                    map<int32_t, Registration>::iterator it = m_registrations.find(fd);
+                    if ( (it == m_registrations.end()) || it->second.m_removed ) {
+                        return;
+                    }
+                    handler = it->second.m_handler;
+                    id = it->second.m_id;
+                    it->second.m_busy = true;
+                    it->second.m_thread = pthread_self();
+                }
+
+                const bool keepWatching = handler->handleReadable();
+
+                {
+                    // The handler might have been removed or even destroyed meanwhile; hence, the registration is looked up again.
+                    std::lock_guard<std::mutex> l(m_registrationsMutex);
+                    map<int32_t, Registration>::iterator it = m_registrations.find(fd);
+                    if ( (it != m_registrations.end()) && (it->second.m_id == id) ) {
+                        it->second.m_busy = false;
+
+                        if (it->second.m_removed) {
+                            m_registrations.erase(it);
+                        }
+                        else if (!keepWatching) {
+                            epoll_ctl(m_epollFD, EPOLL_CTL_DEL, fd, NULL);
+                            m_registrations.erase(it);
+                        }
+                        else {
+                            struct epoll_event event;
+                            memset(&event, 0, sizeof(event));
+                            event.events = EPOLLIN | EPOLLONESHOT;
+                            event.data.fd = fd;
+                            epoll_ctl(m_epollFD, EPOLL_CTL_MOD, fd, &event);
+                        }
+                    }
+                }
+                m_handlerFinished.notify_all();
+#else
+                (void)fd;
+#endif
+            }
+
+            void POSIXReactor::run() {
+#ifdef __linux__
+                struct epoll_event events[MAX_EVENTS];
+
+                while (isRunning()) {
+                    const int32_t numberOfEvents = epoll_wait(m_epollFD, events, MAX_EVENTS, -1);
+
+                    for (int32_t i = 0; (i < numberOfEvents) && isRunning(); i++) {
+                        if (events[i].data.fd != m_wakeupFD) {
+                            dispatch(events[i].data.fd);
+                        }
+                    }
+                }
+#endif
+            }
+
+        }
+    }
+} // odcore::wrapper::POSIX
@@ -43,6 +43,7 @@ namespace odcore {
 
             POSIXTCPAcceptor::POSIXTCPAcceptor(const uint32_t &port) :
                 m_thread(),
+                m_registeredAtReactor(false),
                 m_listenerMutex(),
                 m_listener(NULL),
                 m_fileDescriptor(0),
@@ -104,8 +105,14 @@ namespace odcore {
             }
 
             POSIXTCPAcceptor::~POSIXTCPAcceptor() {
+                if (m_registeredAtReactor) {
+                    POSIXReactor::getInstance().remove(m_fileDescriptor);
+                    m_registeredAtReactor = false;
+                }
                 setAcceptorListener(NULL);
-                close(m_fileDescriptor);
+                if (m_fileDescriptor >= 0) {
+                    close(m_fileDescriptor);
+                }
             }
 
             void POSIXTCPAcceptor::setAcceptorListener(odcore::io::tcp::TCPAcceptorListener* listener) {
@@ -126,10 +133,23 @@ namespace odcore {
             }
 
             void POSIXTCPAcceptor::start() {
-                m_thread->start();
+                if (!m_registeredAtReactor) {
+                    m_registeredAtReactor = POSIXReactor::getInstance().add(m_fileDescriptor, *this);
+                }
+                if (!m_registeredAtReactor) {
+                    m_thread->start();
+                }
             }
 
             void POSIXTCPAcceptor::stop() {
+                if (m_registeredAtReactor) {
+                    POSIXReactor::getInstance().remove(m_fileDescriptor);
+                    m_registeredAtReactor = false;
+
+                    // Refuse further connections like the receiving thread does when it terminates.
+                    close(m_fileDescriptor);
+                    m_fileDescriptor = -1;
+                }
                 m_thread->stop();
             }
 
@@ -151,18 +171,33 @@ namespace odcore {
                     select(m_fileDescriptor + 1, &rfds, NULL, NULL, &timeout);
 
                     if (FD_ISSET(m_fileDescriptor, &rfds)) {
-                        sockaddr clientsock;
-                        socklen_t csize = sizeof(clientsock);
-
-                        int32_t client = accept(m_fileDescriptor, &clientsock, &csize);
-                        if (client >= 0) {
-                            invokeAcceptorListener(std::shared_ptr<odcore::io::tcp::TCPConnection>(new POSIXTCPConnection(client)));
-                        }
+                        acceptConnection();
                     }
                 }
                 close(m_fileDescriptor);
             }
 
+            bool POSIXTCPAcceptor::handleReadable() {
+                acceptConnection();
+                return true;
+            }
+
+            void POSIXTCPAcceptor::handleDisabled() {
+                // Start our own thread before stop() can skip it.
+                m_thread->start();
+                m_registeredAtReactor = false;
+            }
+
+            void POSIXTCPAcceptor::acceptConnection() {
+                sockaddr clientsock;
+                socklen_t csize = sizeof(clientsock);
+
+                int32_t client = accept(m_fileDescriptor, &clientsock, &csize);
+                if (client >= 0) {
+                    invokeAcceptorListener(std::shared_ptr<odcore::io::tcp::TCPConnection>(new POSIXTCPConnection(client)));
+                }
+            }
+
         }
     }
 }
@@ -18,8 +18,11 @@
  */
 
 #include <netdb.h>
+#include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <sstream>
@@ -38,6 +41,7 @@ namespace odcore {
 
             POSIXTCPConnection::POSIXTCPConnection(const int32_t &fileDescriptor) :
                 m_thread(),
+                m_registeredAtReactor(false),
                 m_socketMutex(),
                 m_fileDescriptor(fileDescriptor),
                 m_buffer(),
@@ -48,6 +52,7 @@ namespace odcore {
 
             POSIXTCPConnection::POSIXTCPConnection(const std::string &ip, const uint32_t &port) :
                 m_thread(),
+                m_registeredAtReactor(false),
                 m_socketMutex(),
                 m_fileDescriptor(-1),
                 m_buffer(),
@@ -99,10 +104,19 @@ namespace odcore {
             }
 
             void POSIXTCPConnection::start() {
-                m_thread->start();
+                if (!m_registeredAtReactor) {
+                    m_registeredAtReactor = POSIXReactor::getInstance().add(m_fileDescriptor, *this);
+                }
+                if (!m_registeredAtReactor) {
+                    m_thread->start();
+                }
             }
 
             void POSIXTCPConnection::stop() {
+                if (m_registeredAtReactor) {
+                    POSIXReactor::getInstance().remove(m_fileDescriptor);
+                    m_registeredAtReactor = false;
+                }
                 m_thread->stop();
             }
 
@@ -125,35 +139,113 @@ namespace odcore {
                     select(m_fileDescriptor + 1, &rfds, NULL, NULL, &timeout);
 
                     if (FD_ISSET(m_fileDescriptor, &rfds)) {
-                        int32_t numBytes = recv(m_fileDescriptor, m_buffer, BUFFER_SIZE, 0);
+                        ready = receiveData();
+                    }
+                }
+            }
 
-                        if (numBytes > 0 ) {
-                            // Get data.
-                            string stringData(m_buffer, numBytes);
+            bool POSIXTCPConnection::handleReadable() {
+                return receiveData();
+            }
 
-                            // Process data in higher layers.
-                            receivedString(stringData);
-                        }
-                        else if (numBytes <= 0) {
-                            // Handle error: numBytes == 0 if peer shut down, numBytes < 0 in any case of error.
-                            invokeConnectionListener();
-                            ready = false;
-                        }
-                    }
+            void POSIXTCPConnection::handleDisabled() {
+                // Start our own thread before stop() can skip it.
+                m_thread->start();
+                m_registeredAtReactor = false;
+            }
+
+            bool POSIXTCPConnection::receiveData() {
+                int32_t numBytes = recv(m_fileDescriptor, m_buffer, BUFFER_SIZE, 0);
+
+                if (numBytes > 0 ) {
+                    // Get data.
+                    string stringData(m_buffer, numBytes);
+
+                    // Process data in higher layers.
+                    receivedString(stringData);
+                }
+                else if ( (numBytes < 0) && ( (errno == EINTR) || (errno == EAGAIN) || (errno == EWOULDBLOCK) ) ) {
+                    // Try again later.
+                }
+                else {
+                    // Handle error: numBytes == 0 if peer shut down, numBytes < 0 in any case of error.
+                    invokeConnectionListener();
+                    return false;
                 }
+                return true;
             }
 
             void POSIXTCPConnection::sendImplementation(const std::string& data) {
+                vector<pair<const char*, uint32_t> > buffers;
+                buffers.push_back(make_pair(data.data(), static_cast<uint32_t>(data.length())));
+                sendBuffersImplementation(buffers);
+            }
+
+            void POSIXTCPConnection::sendBuffersImplementation(const vector<pair<const char*, uint32_t> > &buffers) {
+                vector<struct iovec> iovecs(buffers.size());
+                for (uint32_t i = 0; i < buffers.size(); i++) {
+                    iovecs[i].iov_base = const_cast<char*>(buffers[i].first);
+                    iovecs[i].iov_len = buffers[i].second;
+                }
+
+                bool failed = false;
                 m_socketMutex->lock();
-                int32_t numBytes = ::send(m_fileDescriptor, data.c_str(), data.length(), 0);
+                {
+                    uint32_t index = 0;
+                    while (index < iovecs.size()) {
+                        const uint32_t numberOfBuffers = std::min(static_cast<uint32_t>(iovecs.size() - index), static_cast<uint32_t>(MAX_BUFFERS_PER_CALL));
+
+                        struct msghdr message;
+                        memset(&message, 0, sizeof(message));
+                        message.msg_iov = &iovecs[index];
+                        message.msg_iovlen = numberOfBuffers;
+
+                        int32_t flags = 0;
+#ifdef __linux__
+                        // Do not raise SIGPIPE for closed connections and let the
+                        // kernel coalesce the segments of large bursts.
+                        flags = MSG_NOSIGNAL;
+                        if ((index + numberOfBuffers) < iovecs.size()) {
+                            flags |= MSG_MORE;
+                        }
+#endif
+                        ssize_t numBytes = ::sendmsg(m_fileDescriptor, &message, flags);
+                        if (numBytes < 0) {
+                            if (errno == EINTR) {
+                                continue;
+                            }
+                            failed = true;
+                            break;
+                        }
 
-                if (numBytes == -1) {
+                        // Skip all completely sent buffers and continue after partial writes.
+                        while ( (index < iovecs.size()) && (static_cast<size_t>(numBytes) >= iovecs[index].iov_len) ) {
+                            numBytes -= iovecs[index].iov_len;
+                            index++;
+                        }
+                        if (numBytes > 0) {
+                            iovecs[index].iov_base = static_cast<char*>(iovecs[index].iov_base) + numBytes;
+                            iovecs[index].iov_len -= numBytes;
+                        }
+                    }
+                }
+                m_socketMutex->unlock();
+
+                if (failed) {
                     // Handle error.
                     invokeConnectionListener();
                 }
-                m_socketMutex->unlock();
             }
 
+            uint32_t POSIXTCPConnection::getNumberOfQueuedBytes() {
+                int32_t numberOfQueuedBytes = 0;
+#ifdef TIOCOUTQ
+                if (ioctl(m_fileDescriptor, TIOCOUTQ, &numberOfQueuedBytes) < 0) {
+                    numberOfQueuedBytes = 0;
+                }
+#endif
+                return static_cast<uint32_t>(numberOfQueuedBytes);
+            }
 
             void POSIXTCPConnection::initialize() {
                 m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
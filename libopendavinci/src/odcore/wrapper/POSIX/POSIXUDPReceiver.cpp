@@ -21,11 +21,7 @@
 #include <netinet/in.h>
 #include <sys/select.h>
 #include <sys/socket.h>
-
-// Include headers for more exact time stamping.
-#ifdef __linux__
-    #include <sys/ioctl.h>
-#endif
+#include <sys/uio.h>
 
 // Include headers to query IP addresses from local devices.
 #ifdef __linux__
@@ -51,14 +47,16 @@ namespace odcore {
 
             POSIXUDPReceiver::POSIXUDPReceiver(const string &address, const uint32_t &port, const bool &isMulticast) :
                 m_mapOfIPAddresses(),
+                m_mapOfSenderAddresses(),
                 m_portToIgnore(0),
                 m_isMulticast(isMulticast),
                 m_address(),
                 m_mreq(),
                 m_fd(),
                 m_buffer(NULL),
-                m_thread() {
-                m_buffer = new char[BUFFER_SIZE];
+                m_thread(),
+                m_registeredAtReactor(false) {
+                m_buffer = new char[NUMBER_OF_SLOTS * BUFFER_SIZE];
                 if (m_buffer == NULL) {
                     stringstream s;
                     s << "[POSIXUDPReceiver] Error while allocating memory for buffer: " << strerror(errno);
@@ -81,6 +79,15 @@ namespace odcore {
                     throw s.str();
                 }
 
+#ifdef __linux__
+                // Let the kernel attach receive time stamps to every datagram.
+                if (setsockopt(m_fd, SOL_SOCKET, SO_TIMESTAMPNS, &yes, sizeof(yes)) < 0) {
+                    stringstream s;
+                    s << "[POSIXUDPReceiver] Error while enabling time stamps: " << strerror(errno);
+                    throw s.str();
+                }
+#endif
+
                 // Setup address and port.
                 memset(&m_address, 0, sizeof(m_address));
                 m_address.sin_family = AF_INET;
@@ -158,15 +165,92 @@ namespace odcore {
                 m_portToIgnore = portToIgnore;
             }
 
-            void POSIXUDPReceiver::run() {
-                fd_set rfds;
-                struct timeval timeout;
+            bool POSIXUDPReceiver::acceptPacket(const unsigned long &ipAddress, const uint16_t &port) const {
+                // Forward packet if (a) it is NOT sent from the same machine that is receiving (i.e. over network),
+                // or, if sent from the same machine as the one used for receiving, if the data was not sent from a
+                // port that shall be ignored.
+                return (0 == m_mapOfIPAddresses.count(ipAddress)) || (m_portToIgnore != port);
+            }
+
+            const string& POSIXUDPReceiver::getSenderAddress(const unsigned long &ipAddress) {
+                map<unsigned long, string>::iterator it = m_mapOfSenderAddresses.find(ipAddress);
+                if (it == m_mapOfSenderAddresses.end()) {
+                    struct in_addr addr;
+                    addr.s_addr = static_cast<in_addr_t>(ipAddress);
+                    char remoteAddr[INET_ADDRSTRLEN];
+                    inet_ntop(AF_INET, &addr, remoteAddr, sizeof(remoteAddr));
+                    it = m_mapOfSenderAddresses.insert(make_pair(ipAddress, string(remoteAddr))).first;
+                }
+                return it->second;
+            }
+
+            void POSIXUDPReceiver::receivePackets() {
 #ifdef __linux__
-                struct timeval socketTimeStamp;
-#endif
-                int32_t nbytes = 0;
+                struct mmsghdr messages[NUMBER_OF_SLOTS];
+                struct iovec iovecs[NUMBER_OF_SLOTS];
+                struct sockaddr_in remotes[NUMBER_OF_SLOTS];
+                // Control messages need to be aligned like struct cmsghdr.
+                uint64_t controls[NUMBER_OF_SLOTS][(CMSG_SPACE(sizeof(struct timespec)) + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+
+                memset(messages, 0, sizeof(messages));
+                for (uint32_t i = 0; i < NUMBER_OF_SLOTS; i++) {
+                    iovecs[i].iov_base = m_buffer + i * BUFFER_SIZE;
+                    iovecs[i].iov_len = BUFFER_SIZE;
+                    messages[i].msg_hdr.msg_iov = &iovecs[i];
+                    messages[i].msg_hdr.msg_iovlen = 1;
+                    messages[i].msg_hdr.msg_name = &remotes[i];
+                    messages[i].msg_hdr.msg_namelen = sizeof(remotes[i]);
+                    messages[i].msg_hdr.msg_control = controls[i];
+                    messages[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+                }
 
+                // Receive all pending datagrams (up to the number of slots) at once.
+                const int32_t numberOfMessages = recvmmsg(m_fd, messages, NUMBER_OF_SLOTS, MSG_DONTWAIT, NULL);
+
+                for (int32_t i = 0; i < numberOfMessages; i++) {
+                    const int32_t nbytes = messages[i].msg_len;
+                    if ( (nbytes > 0) && acceptPacket(remotes[i].sin_addr.s_addr, ntohs(remotes[i].sin_port)) ) {
+                        // Use the kernel's receive time stamp if available.
+                        struct timespec socketTimeStamp;
+                        socketTimeStamp.tv_sec = 0;
+                        socketTimeStamp.tv_nsec = 0;
+                        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&messages[i].msg_hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(&messages[i].msg_hdr, cmsg)) {
+                            if ( (SOL_SOCKET == cmsg->cmsg_level) && (SCM_TIMESTAMPNS == cmsg->cmsg_type) ) {
+                                memcpy(&socketTimeStamp, CMSG_DATA(cmsg), sizeof(socketTimeStamp));
+                            }
+                        }
+
+                        odcore::data::TimeStamp now;
+                        if (0 != socketTimeStamp.tv_sec) {
+                            now = odcore::data::TimeStamp(socketTimeStamp.tv_sec, socketTimeStamp.tv_nsec / 1000);
+                        }
+
+                        // -----     -----------------  v (remote address)-----------------v (data)------------------------------------------------v (time stamp)
+                        nextPacket(odcore::data::Packet(getSenderAddress(remotes[i].sin_addr.s_addr), string(static_cast<char*>(iovecs[i].iov_base), nbytes), now));
+                    }
+                }
+#else
+                // Get data and sender address.
                 struct sockaddr_storage remote;
+                socklen_t addrLength = sizeof(remote);
+                const int32_t nbytes = recvfrom(m_fd, m_buffer, BUFFER_SIZE, 0, reinterpret_cast<struct sockaddr *>(&remote), &addrLength);
+
+                if (nbytes > 0) {
+                    // Fix -Wcast-align compile warning.
+                    struct sockaddr_in remoteAddress;
+                    memcpy(&remoteAddress, &remote, sizeof(remoteAddress));
+
+                    if (acceptPacket(remoteAddress.sin_addr.s_addr, ntohs(remoteAddress.sin_port))) {
+                        const odcore::data::TimeStamp now;
+                        nextPacket(odcore::data::Packet(getSenderAddress(remoteAddress.sin_addr.s_addr), string(m_buffer, nbytes), now));
+                    }
+                }
+#endif
+            }
+
+            void POSIXUDPReceiver::run() {
+                fd_set rfds;
+                struct timeval timeout;
 
                 while (isRunning()) {
                     timeout.tv_sec = 1;
@@ -178,47 +262,29 @@ namespace odcore {
                     select(m_fd + 1, &rfds, NULL, NULL, &timeout);
 
                     if (FD_ISSET(m_fd, &rfds)) {
-                        // Get data and sender address.
-                        size_t addrLength = sizeof(remote);
-                        nbytes = recvfrom(m_fd, m_buffer, BUFFER_SIZE, 0, reinterpret_cast<struct sockaddr *>(&remote), reinterpret_cast<socklen_t*>(&addrLength));
-
-                        if (nbytes > 0) {
-                            // Get IP address and port from sender.
-                            const unsigned long RECVFROM_IP_ADDRESS = (reinterpret_cast<struct sockaddr_in*>(&remote))->sin_addr.s_addr;
-                            const uint16_t RECVFROM_PORT = ntohs(reinterpret_cast<struct sockaddr_in*>(&remote)->sin_port);
-
-                            // Forward packet if (a) it is NOT sent from the same machine that is receiving (i.e. over network),
-                            // or, if sent from the same machine as the one used for receiving, if the data was not sent from a
-                            // port that shall be ignored.
-                            const bool ACCEPT_PACKET = (0 == m_mapOfIPAddresses.count(RECVFROM_IP_ADDRESS))
-                                                    || ((m_mapOfIPAddresses.count(RECVFROM_IP_ADDRESS) > 0) && (m_portToIgnore != RECVFROM_PORT));
-                            if (ACCEPT_PACKET) {
-                                // Get sender address.
-                                const uint32_t MAX_ADDR_SIZE = 1024;
-                                char remoteAddr[MAX_ADDR_SIZE];
-                                inet_ntop(remote.ss_family, &((reinterpret_cast<struct sockaddr_in*>(&remote))->sin_addr), remoteAddr, sizeof(remoteAddr));
-
-                                // -----     -----------------  v (remote address)--v (data)------------------v (time stamp)
-#ifdef __linux__
-                                if (0 != ioctl(m_fd, SIOCGSTAMP, &socketTimeStamp)) {
-                                    // In case the ioctl failed, use traditional vsariant.
-                                    const odcore::data::TimeStamp now;
-                                    socketTimeStamp.tv_sec = now.getSeconds();
-                                    socketTimeStamp.tv_usec = now.getMicroseconds();
-                                }
-                                odcore::data::TimeStamp now(socketTimeStamp.tv_sec, socketTimeStamp.tv_usec);
-#else
-                                const odcore::data::TimeStamp now;
-#endif
-                                nextPacket(odcore::data::Packet(string(remoteAddr), string(m_buffer, nbytes), now));
-                            }
-                        }
+                        receivePackets();
                     }
                 }
             }
 
-            void POSIXUDPReceiver::start() {
+            bool POSIXUDPReceiver::handleReadable() {
+                receivePackets();
+                return true;
+            }
+
+            void POSIXUDPReceiver::handleDisabled() {
+                // Start our own thread before stop() can skip it.
                 m_thread->start();
+                m_registeredAtReactor = false;
+            }
+
+            void POSIXUDPReceiver::start() {
+                if (!m_registeredAtReactor) {
+                    m_registeredAtReactor = POSIXReactor::getInstance().add(m_fd, *this);
+                }
+                if (!m_registeredAtReactor) {
+                    m_thread->start();
+                }
             }
 
             void POSIXUDPReceiver::stop() {
@@ -227,6 +293,11 @@ namespace odcore {
                     setsockopt(m_fd, IPPROTO_IP, IP_DROP_MEMBERSHIP, &m_mreq, sizeof(m_mreq));
                 }
 
+                if (m_registeredAtReactor) {
+                    POSIXReactor::getInstance().remove(m_fd);
+                    m_registeredAtReactor = false;
+                }
+
                 // Interrupt socket.
                 shutdown(m_fd, SHUT_RDWR);
 
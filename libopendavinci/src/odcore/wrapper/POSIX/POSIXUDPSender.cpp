@@ -18,7 +18,9 @@
  */
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <sstream>
@@ -109,6 +111,57 @@ namespace odcore {
                 m_socketMutex->unlock();
             }
 
+            void POSIXUDPSender::sendBurst(const vector<string> &listOfData) const {
+                for (vector<string>::const_iterator it = listOfData.begin(); it != listOfData.end(); ++it) {
+                    if (it->length() > POSIXUDPSender::MAX_UDP_PACKET_SIZE) {
+                        stringstream s;
+                        s << "[core::wrapper::POSIXUDPSender] Data to be sent is too large (" << it->length() << " > " << POSIXUDPSender::MAX_UDP_PACKET_SIZE << ").";
+                        throw s.str();
+                    }
+                }
+
+                m_socketMutex->lock();
+                {
+#ifdef __linux__
+                    struct mmsghdr messages[MAX_BURST_SIZE];
+                    struct iovec iovecs[MAX_BURST_SIZE];
+                    struct sockaddr_in address = m_address;
+
+                    uint32_t offset = 0;
+                    while (offset < listOfData.size()) {
+                        // Send up to MAX_BURST_SIZE datagrams with one system call.
+                        const uint32_t numberOfMessages = min(static_cast<uint32_t>(listOfData.size()) - offset, static_cast<uint32_t>(MAX_BURST_SIZE));
+                        memset(messages, 0, sizeof(messages));
+                        for (uint32_t i = 0; i < numberOfMessages; i++) {
+                            iovecs[i].iov_base = const_cast<char*>(listOfData[offset + i].c_str());
+                            iovecs[i].iov_len = listOfData[offset + i].length();
+                            messages[i].msg_hdr.msg_iov = &iovecs[i];
+                            messages[i].msg_hdr.msg_iovlen = 1;
+                            messages[i].msg_hdr.msg_name = &address;
+                            messages[i].msg_hdr.msg_namelen = sizeof(address);
+                        }
+
+                        const int32_t sent = sendmmsg(m_fd, messages, numberOfMessages, 0);
+                        if (sent > 0) {
+                            offset += sent;
+                        }
+                        else if ( (sent < 0) && (EINTR == errno) ) {
+                            continue;
+                        }
+                        else {
+                            // Like sendto(...), drop the remaining datagrams on errors.
+                            break;
+                        }
+                    }
+#else
+                    for (vector<string>::const_iterator it = listOfData.begin(); it != listOfData.end(); ++it) {
+                        sendto(m_fd, it->c_str(), it->length(), 0, reinterpret_cast<const struct sockaddr *>(&m_address), sizeof(m_address));
+                    }
+#endif
+                }
+                m_socketMutex->unlock();
+            }
+
         }
     }
 } // odcore::wrapper::POSIX
@@ -21,6 +21,7 @@
 #include "opendavinci/odcore/wrapper/Libraries.h"
 #include "opendavinci/odcore/wrapper/SharedMemory.h"
 #include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryRing.h"
 #include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
 
 #ifdef WIN32
@@ -35,12 +36,27 @@ namespace odcore {
 
         std::shared_ptr<SharedMemory> SharedMemoryFactory::createSharedMemory(const string &name, const uint32_t &size) {
             typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
-            return SharedMemoryFactoryWorker<configuration::value>::createSharedMemory(name, size);
+            return SharedMemoryFactoryWorker<configuration::value>::createSharedMemory(name, size, SharedMemoryOptions::fromEnvironment());
+        }
+
+        std::shared_ptr<SharedMemory> SharedMemoryFactory::createSharedMemoryWithOptions(const string &name, const uint32_t &size, const SharedMemoryOptions &options) {
+            typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
+            return SharedMemoryFactoryWorker<configuration::value>::createSharedMemory(name, size, options);
         }
 
         std::shared_ptr<SharedMemory> SharedMemoryFactory::attachToSharedMemory(const string &name) {
             typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
             return SharedMemoryFactoryWorker<configuration::value>::attachToSharedMemory(name);
         }
+
+        std::shared_ptr<SharedMemoryRing> SharedMemoryFactory::createSharedMemoryRing(const string &name, const uint32_t &slotSize, const uint32_t &numberOfSlots) {
+            std::shared_ptr<SharedMemory> sharedMemory = createSharedMemory(name, SharedMemoryRing::getRequiredSize(slotSize, numberOfSlots));
+            return std::shared_ptr<SharedMemoryRing>(new SharedMemoryRing(sharedMemory, slotSize, numberOfSlots));
+        }
+
+        std::shared_ptr<SharedMemoryRing> SharedMemoryFactory::attachToSharedMemoryRing(const string &name) {
+            std::shared_ptr<SharedMemory> sharedMemory = attachToSharedMemory(name);
+            return std::shared_ptr<SharedMemoryRing>(new SharedMemoryRing(sharedMemory));
+        }
     }
 } // odcore::wrapper
@@ -0,0 +1,56 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <cstdlib>
+#include <cstring>
+
+#include "opendavinci/odcore/wrapper/SharedMemoryOptions.h"
+
+namespace odcore {
+    namespace wrapper {
+
+        SharedMemoryOptions::SharedMemoryOptions() :
+            m_memoryMapped(false),
+            m_hugePages(false),
+            m_populate(false),
+            m_numaNode(-1) {}
+
+        SharedMemoryOptions SharedMemoryOptions::fromEnvironment() {
+            SharedMemoryOptions options;
+
+            const char *backend = getenv("OPENDAVINCI_SHM");
+            options.m_memoryMapped = ( (NULL != backend) && (0 == strcmp(backend, "mmap")) );
+
+            const char *hugePages = getenv("OPENDAVINCI_SHM_HUGEPAGES");
+            options.m_hugePages = ( (NULL != hugePages) && (1 == atoi(hugePages)) );
+
+            const char *populate = getenv("OPENDAVINCI_SHM_POPULATE");
+            options.m_populate = ( (NULL != populate) && (1 == atoi(populate)) );
+
+            const char *numaNode = getenv("OPENDAVINCI_SHM_NUMA_NODE");
+            if ( (NULL != numaNode) && (strlen(numaNode) > 0) ) {
+                options.m_numaNode = atoi(numaNode);
+            }
+
+            return options;
+        }
+
+    }
+} // odcore::wrapper
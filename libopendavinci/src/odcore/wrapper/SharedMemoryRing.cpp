@@ -0,0 +1,219 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <atomic>
+#include <new>
+
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryRing.h"
+
+namespace odcore {
+    namespace wrapper {
+
+        using namespace std;
+
+        namespace {
+            // Identifies an initialized ring ("ODSR").
+            const uint32_t RING_MAGIC = 0x4F445352;
+
+            // Header, slot headers, and slots are aligned to cache lines.
+            const uint32_t CACHE_LINE_SIZE = 64;
+
+            /**
+             * Header at the beginning of the ring.
+             */
+            struct RingHeader {
+                uint32_t m_magic;
+                uint32_t m_numberOfSlots;
+                uint32_t m_slotSize;
+                std::atomic<uint32_t> m_initialized;
+                std::atomic<uint64_t> m_latestFrameID;
+            };
+
+            /**
+             * Header of each slot. The slot's sequence works like a
+             * seqlock: 2*n-1 while frame n is written and 2*n once
+             * it is complete.
+             */
+            struct SlotHeader {
+                std::atomic<uint64_t> m_sequence;
+            };
+
+            inline uint32_t alignToCacheLine(const uint32_t &size) {
+                return ((size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+            }
+
+            inline uint32_t getHeaderSize() {
+                return alignToCacheLine(sizeof(RingHeader));
+            }
+
+            inline uint32_t getSlotHeaderSize() {
+                return alignToCacheLine(sizeof(SlotHeader));
+            }
+
+            inline RingHeader* getHeader(char *ring) {
+                return reinterpret_cast<RingHeader*>(ring);
+            }
+
+            inline SlotHeader* getSlotHeader(char *ring, const uint32_t &slot) {
+                const RingHeader *header = getHeader(ring);
+                return reinterpret_cast<SlotHeader*>(ring + getHeaderSize() + slot * (getSlotHeaderSize() + alignToCacheLine(header->m_slotSize)));
+            }
+
+            inline char* getSlotData(SlotHeader *slot) {
+                return reinterpret_cast<char*>(slot) + getSlotHeaderSize();
+            }
+
+            // The shared memory itself might not start at a cache line.
+            inline char* alignRing(void *sharedMemory) {
+                const uintptr_t address = reinterpret_cast<uintptr_t>(sharedMemory);
+                return reinterpret_cast<char*>(((address + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE);
+            }
+        }
+
+        SharedMemoryRing::SharedMemoryRing(std::shared_ptr<SharedMemory> sharedMemory, const uint32_t &slotSize, const uint32_t &numberOfSlots) :
+            m_sharedMemory(sharedMemory),
+            m_ring(NULL),
+            m_writeFrameID(0) {
+            if ( (m_sharedMemory.get() != NULL) && (m_sharedMemory->isValid()) &&
+                 (numberOfSlots > 0) && (m_sharedMemory->getSize() >= getRequiredSize(slotSize, numberOfSlots)) ) {
+                char *ring = alignRing(m_sharedMemory->getSharedMemory());
+                RingHeader *header = getHeader(ring);
+
+                m_sharedMemory->lock();
+                {
+                    new (&header->m_initialized) std::atomic<uint32_t>(0);
+                    new (&header->m_latestFrameID) std::atomic<uint64_t>(0);
+                    header->m_magic = RING_MAGIC;
+                    header->m_numberOfSlots = numberOfSlots;
+                    header->m_slotSize = slotSize;
+                    for (uint32_t i = 0; i < numberOfSlots; i++) {
+                        new (&getSlotHeader(ring, i)->m_sequence) std::atomic<uint64_t>(0);
+                    }
+                    header->m_initialized.store(1, std::memory_order_release);
+                }
+                m_sharedMemory->unlock();
+
+                m_ring = ring;
+            }
+        }
+
+        SharedMemoryRing::SharedMemoryRing(std::shared_ptr<SharedMemory> sharedMemory) :
+            m_sharedMemory(sharedMemory),
+            m_ring(NULL),
+            m_writeFrameID(0) {
+            if ( (m_sharedMemory.get() != NULL) && (m_sharedMemory->isValid()) &&
+                 (m_sharedMemory->getSize() >= CACHE_LINE_SIZE + getHeaderSize()) ) {
+                char *ring = alignRing(m_sharedMemory->getSharedMemory());
+                RingHeader *header = getHeader(ring);
+
+                if ( (1 == header->m_initialized.load(std::memory_order_acquire)) &&
+                     (RING_MAGIC == header->m_magic) &&
+                     (header->m_numberOfSlots > 0) &&
+                     (m_sharedMemory->getSize() >= getRequiredSize(header->m_slotSize, header->m_numberOfSlots)) ) {
+                    m_ring = ring;
+                }
+            }
+        }
+
+        SharedMemoryRing::~SharedMemoryRing() {}
+
+        bool SharedMemoryRing::isValid() const {
+            return (m_ring != NULL);
+        }
+
+        const string SharedMemoryRing::getName() const {
+            return (m_sharedMemory.get() != NULL) ? m_sharedMemory->getName() : "";
+        }
+
+        uint32_t SharedMemoryRing::getNumberOfSlots() const {
+            return isValid() ? getHeader(m_ring)->m_numberOfSlots : 0;
+        }
+
+        uint32_t SharedMemoryRing::getSlotSize() const {
+            return isValid() ? getHeader(m_ring)->m_slotSize : 0;
+        }
+
+        uint32_t SharedMemoryRing::getSlot(const uint64_t &frameID) const {
+            const uint32_t numberOfSlots = getNumberOfSlots();
+            return ( (frameID > 0) && (numberOfSlots > 0) ) ? static_cast<uint32_t>((frameID - 1) % numberOfSlots) : 0;
+        }
+
+        uint32_t SharedMemoryRing::getRequiredSize(const uint32_t &slotSize, const uint32_t &numberOfSlots) {
+            // Reserve one more cache line to align the ring.
+            return CACHE_LINE_SIZE + getHeaderSize() + numberOfSlots * (getSlotHeaderSize() + alignToCacheLine(slotSize));
+        }
+
+        char* SharedMemoryRing::beginWrite() {
+            if (!isValid()) {
+                return NULL;
+            }
+
+            if (0 == m_writeFrameID) {
+                m_writeFrameID = getHeader(m_ring)->m_latestFrameID.load(std::memory_order_relaxed) + 1;
+
+                // Invalidate the slot before touching its data.
+                SlotHeader *slot = getSlotHeader(m_ring, getSlot(m_writeFrameID));
+                slot->m_sequence.store(2 * m_writeFrameID - 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+
+            return getSlotData(getSlotHeader(m_ring, getSlot(m_writeFrameID)));
+        }
+
+        uint64_t SharedMemoryRing::endWrite() {
+            const uint64_t frameID = m_writeFrameID;
+            if ( (isValid()) && (frameID > 0) ) {
+                SlotHeader *slot = getSlotHeader(m_ring, getSlot(frameID));
+                slot->m_sequence.store(2 * frameID, std::memory_order_release);
+                getHeader(m_ring)->m_latestFrameID.store(frameID, std::memory_order_release);
+                m_writeFrameID = 0;
+            }
+            return frameID;
+        }
+
+        uint64_t SharedMemoryRing::getLatestFrameID() const {
+            return isValid() ? getHeader(m_ring)->m_latestFrameID.load(std::memory_order_acquire) : 0;
+        }
+
+        const char* SharedMemoryRing::getFrame(const uint64_t &frameID) const {
+            if ( (!isValid()) || (0 == frameID) ) {
+                return NULL;
+            }
+
+            SlotHeader *slot = getSlotHeader(m_ring, getSlot(frameID));
+            if (slot->m_sequence.load(std::memory_order_acquire) != 2 * frameID) {
+                return NULL;
+            }
+            return getSlotData(slot);
+        }
+
+        bool SharedMemoryRing::isFrameUnchanged(const uint64_t &frameID) const {
+            if ( (!isValid()) || (0 == frameID) ) {
+                return false;
+            }
+
+            // Order all preceding reads from the slot before re-checking its sequence.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return (getSlotHeader(m_ring, getSlot(frameID))->m_sequence.load(std::memory_order_relaxed) == 2 * frameID);
+        }
+
+    }
+} // odcore::wrapper
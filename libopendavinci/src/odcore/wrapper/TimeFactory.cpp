@@ -17,6 +17,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <atomic>
+
 #include "opendavinci/odcore/wrapper/Mutex.h"
 #include "opendavinci/odcore/wrapper/MutexFactory.h"
 #include "opendavinci/odcore/wrapper/Time.h"
@@ -30,6 +32,9 @@ namespace odcore {
         TimeFactory* TimeFactory::controlledInstance = NULL;
         unique_ptr<Mutex> TimeFactory::m_singletonMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
 
+        // Allow checking for a controlled time factory without locking.
+        static std::atomic<bool> isControlledTimeFactory(false);
+
         SystemTimeFactory::worker_type SystemTimeFactory::instance = SystemTimeFactory::worker_type();
         
         TimeFactory::TimeFactory() {
@@ -70,9 +75,14 @@ namespace odcore {
             return t;
         }
 
+        bool TimeFactory::isControlled() {
+            return isControlledTimeFactory.load();
+        }
+
         void TimeFactory::setSingleton(TimeFactory *tf) {
         	TimeFactory::m_singletonMutex->lock();
             	TimeFactory::controlledInstance = tf;
+            	isControlledTimeFactory.store(tf != NULL);
             TimeFactory::m_singletonMutex->unlock();
         }  
 
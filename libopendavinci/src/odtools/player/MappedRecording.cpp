@@ -0,0 +1,160 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include <opendavinci/odtools/player/MappedRecording.h>
+
+namespace odtools {
+    namespace player {
+
+        using namespace std;
+        using namespace odcore::data;
+
+        MappedRecording::MappedRecording(const string &fileName) :
+            m_data(NULL),
+            m_size(0),
+            m_pageSize(4096),
+            m_readAheadWindow(0),
+            m_windowBegin(0),
+            m_windowEnd(0) {
+#ifndef WIN32
+            const long pageSize = ::sysconf(_SC_PAGESIZE);
+            if (pageSize > 0) {
+                m_pageSize = static_cast<uint64_t>(pageSize);
+            }
+
+            const int fd = ::open(fileName.c_str(), O_RDONLY);
+            if (fd >= 0) {
+                struct stat s;
+                if ( (0 == ::fstat(fd, &s)) && (s.st_size > 0) ) {
+                    void *data = ::mmap(NULL, static_cast<size_t>(s.st_size), PROT_READ, MAP_SHARED, fd, 0);
+                    if (MAP_FAILED != data) {
+                        m_data = static_cast<char*>(data);
+                        m_size = static_cast<uint64_t>(s.st_size);
+
+                        // Recordings are mostly replayed from the beginning to the end.
+                        ::madvise(m_data, m_size, MADV_SEQUENTIAL);
+                    }
+                }
+                // The mapping stays valid after closing the file descriptor.
+                ::close(fd);
+            }
+#else
+            (void)fileName;
+#endif
+        }
+
+        MappedRecording::~MappedRecording() {
+#ifndef WIN32
+            if (NULL != m_data) {
+                ::munmap(m_data, m_size);
+            }
+#endif
+            m_data = NULL;
+            m_size = 0;
+        }
+
+        bool MappedRecording::isValid() const {
+            return (NULL != m_data);
+        }
+
+        uint64_t MappedRecording::getSize() const {
+            return m_size;
+        }
+
+        const char* MappedRecording::getPointer(const uint64_t &position, uint64_t &length) const {
+            if ( (NULL == m_data) || (position >= m_size) ) {
+                length = 0;
+                return NULL;
+            }
+            length = std::min(length, m_size - position);
+            return m_data + position;
+        }
+
+        uint32_t MappedRecording::readContainer(const uint64_t &position, Container &c) const {
+            uint64_t length = numeric_limits<uint32_t>::max();
+            const char *data = getPointer(position, length);
+            if (NULL == data) {
+                return 0;
+            }
+            return c.deserializeFrom(data, static_cast<uint32_t>(length));
+        }
+
+        void MappedRecording::setReadAheadWindow(const uint64_t &size) {
+            m_readAheadWindow = size;
+            m_windowBegin = m_windowEnd = 0;
+        }
+
+        void MappedRecording::followPosition(const uint64_t &position) {
+            if ( (NULL == m_data) || (0 == m_readAheadWindow) ) {
+                return;
+            }
+
+            // Move the window if the position left it (for instance after rewinding) or if half of it is consumed.
+            const bool outsideOfWindow = (position < m_windowBegin) || (position >= m_windowEnd);
+            if (outsideOfWindow || ((position - m_windowBegin) > (m_readAheadWindow / 2))) {
+                if (position > m_windowBegin) {
+                    // Pages that have been replayed already are read again from the file when needed.
+                    advise(m_windowBegin, position - m_windowBegin, false);
+                }
+                advise(position, m_readAheadWindow, true);
+
+                m_windowBegin = position;
+                m_windowEnd = std::min(position + m_readAheadWindow, m_size);
+            }
+        }
+
+        void MappedRecording::advise(const uint64_t &position, const uint64_t &length, const bool &willNeed) {
+#ifndef WIN32
+            if ( (NULL == m_data) || (position >= m_size) || (0 == length) ) {
+                return;
+            }
+            const uint64_t end = std::min(position + length, m_size);
+            if (willNeed) {
+                // Extend the range to complete pages.
+                const uint64_t begin = position - (position % m_pageSize);
+                ::madvise(m_data + begin, end - begin, MADV_WILLNEED);
+            }
+            else {
+                // Release only complete pages inside the range.
+                const uint64_t begin = ((position + m_pageSize - 1) / m_pageSize) * m_pageSize;
+                const uint64_t last = end - (end % m_pageSize);
+                if (begin < last) {
+                    ::madvise(m_data + begin, last - begin, MADV_DONTNEED);
+                }
+            }
+#else
+            (void)position;
+            (void)length;
+            (void)willNeed;
+#endif
+        }
+
+    } // player
+} // tools
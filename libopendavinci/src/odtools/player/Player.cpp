@@ -32,9 +32,11 @@
 #include <opendavinci/odcore/base/Thread.h>
 #include <opendavinci/odcore/io/URL.h>
 
+#include <opendavinci/odtools/player/MappedRecording.h>
 #include <opendavinci/odtools/player/Player.h>
 #include <opendavinci/odtools/player/PlayerDelegate.h>
 #include <opendavinci/odtools/player/RecMemIndex.h>
+#include <opendavinci/odtools/player/RecordingIndex.h>
 
 namespace odtools {
     namespace player {
@@ -60,11 +62,14 @@ namespace odtools {
 
         ////////////////////////////////////////////////////////////////////////
 
-        Player::Player(const URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading) :
+        Player::Player(const URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const bool &mapRecording) :
             m_threading(threading),
             m_url(url),
             m_recFile(),
             m_recFileValid(false),
+            m_recFileBuffer(),
+            m_mapRecording(mapRecording),
+            m_recFileMapping(),
             m_autoRewind(autoRewind),
             m_indexMutex(),
             m_index(),
@@ -81,6 +86,7 @@ namespace odtools {
             m_containerCacheFillingThreadIsRunning(false),
             m_containerCacheFillingThread(),
             m_containerCache(),
+            m_lastTimePointPublishingStatistics(),
             m_recMemIndex(),
             m_mapOfPlayerDelegatesMutex(),
             m_mapOfPlayerDelegates(),
@@ -89,11 +95,7 @@ namespace odtools {
             initializeIndex();
             computeInitialCacheLevelAndFillCache();
 
-            if (m_threading) {
-                // Start concurrent thread to manage cache.
-                setContainerCacheFillingRunning(true);
-                m_containerCacheFillingThread = std::thread(&Player::manageCache, this);
-            }
+            startContainerCacheFilling();
 
             // Try reading accompanying .rec.mem file.
             if (m_recFileValid && ((memorySegmentSize * numberOfMemorySegments) > 0)) {
@@ -110,21 +112,18 @@ namespace odtools {
                     checkForRecMemFile.close();
                 }
                 if (recMemFileAvailable) {
-                    m_recMemIndex = unique_ptr<RecMemIndex>(new RecMemIndex(recMemFile, memorySegmentSize, numberOfMemorySegments, m_threading));
+                    m_recMemIndex = unique_ptr<RecMemIndex>(new RecMemIndex(recMemFile, memorySegmentSize, numberOfMemorySegments, m_threading, m_mapRecording));
                 }
             }
         }
 
         Player::~Player() {
-            if (m_threading) {
-                // Stop concurrent thread to manage cache.
-                setContainerCacheFillingRunning(false);
-                m_containerCacheFillingThread.join();
-            }
+            stopContainerCacheFilling();
 
             // Free the map of cached container entries.
             m_recMemIndex.reset();
 
+            m_recFileMapping.reset();
             m_recFile.close();
         }
 
@@ -155,21 +154,39 @@ namespace odtools {
             m_recFile.open(m_url.getResource().c_str(), ios_base::in|ios_base::binary);
             m_recFileValid = m_recFile.good();
 
+            // Prefer reading Containers directly from the memory-mapped .rec file.
+            if (m_recFileValid && m_mapRecording) {
+                m_recFileMapping = unique_ptr<MappedRecording>(new MappedRecording(m_url.getResource()));
+                if (!m_recFileMapping->isValid()) {
+                    m_recFileMapping.reset();
+                }
+            }
+
             // Determine file size to display progress.
             m_recFile.seekg(0, m_recFile.end);
                 int64_t fileLength = m_recFile.tellg();
             m_recFile.seekg(0, m_recFile.beg);
 
-            // Read complete file and store file positions to containers to create
-            // index of available data. The actual reading of Containers is deferred.
             uint64_t totalBytesRead = 0;
             const TimeStamp BEFORE;
-            {
+
+            // Use the accompanying index file if it matches the .rec file.
+            vector<RecordingIndexEntry> entries;
+            const bool INDEX_FILE_AVAILABLE = m_recFileValid && RecordingIndex::load(m_url.getResource(), entries);
+            if (INDEX_FILE_AVAILABLE) {
+                for (auto it = entries.begin(); it != entries.end(); it++) {
+                    m_index.emplace(std::make_pair(it->m_sampleTimeStamp, IndexEntry(it->m_sampleTimeStamp, it->m_filePosition)));
+                }
+                clog << "[odtools::player::Player]: Using " << RecordingIndex::getFileName(m_url.getResource()) << "." << endl;
+            }
+            else {
+                // Read complete file and store file positions to containers to create
+                // index of available data. The actual reading of Containers is deferred.
                 int32_t oldPercentage = -1;
                 while (m_recFile.good()) {
                     const uint64_t POS_BEFORE = m_recFile.tellg();
                         Container c;
-                        m_recFile >> c;
+                        readNextContainerFromRecFile(c);
                     const uint64_t POS_AFTER = m_recFile.tellg();
 
                     if (!m_recFile.eof()) {
@@ -179,6 +196,8 @@ namespace odtools {
                         m_index.emplace(std::make_pair(c.getSampleTimeStamp().toMicroseconds(),
                                                        IndexEntry(c.getSampleTimeStamp().toMicroseconds(), POS_BEFORE)));
 
+                        entries.push_back(RecordingIndexEntry(c.getSampleTimeStamp().toMicroseconds(), POS_BEFORE, c.getDataType(), c.getSenderStamp(), (POS_AFTER - POS_BEFORE), 0));
+
                         const int32_t percentage = static_cast<int32_t>(static_cast<float>(m_recFile.tellg()*100.0)/static_cast<float>(fileLength));
                         if ( (percentage % 5 == 0) && (percentage != oldPercentage) ) {
                             clog << "[odtools::player::Player]: Indexed " << percentage << "% from " << m_url.toString() << "." << endl;
@@ -186,6 +205,11 @@ namespace odtools {
                         }
                     }
                 }
+
+                // Cache the index for the next time; recordings on read-only media are simply indexed again.
+                if (m_recFileValid && !entries.empty()) {
+                    RecordingIndex::save(m_url.getResource(), entries);
+                }
             }
             const TimeStamp AFTER;
 
@@ -204,13 +228,13 @@ namespace odtools {
             m_containerCache.clear();
         }
 
-        void Player::resetIterators() {
+        void Player::resetIterators(const multimap<int64_t, IndexEntry>::iterator &position) {
             Lock l(m_indexMutex);
-            // Point to first entry in index.
+            // Point to the given entry in index.
             m_nextEntryToReadFromRecFile
                 = m_previousContainerAlreadyReplayed
                 = m_currentContainerToReplay
-                = m_index.begin();
+                = position;
             // Invalidate iterator for erasing entries point.
             m_previousPreviousContainerAlreadyReplayed = m_index.end();
         }
@@ -231,7 +255,20 @@ namespace odtools {
                 clog << "[odtools::player::Player]: Initializing cache with " << m_desiredInitialLevel << " entries." << endl;
 
                 resetCaches();
-                resetIterators();
+                resetIterators(m_index.begin());
+                fillCacheFromCurrentPosition();
+            }
+        }
+
+        void Player::fillCacheFromCurrentPosition() {
+            if (isRecFileMapped()) {
+                // Prefetch as many bytes as the cache would hold Containers.
+                const uint64_t AVERAGE_SIZE_OF_CONTAINER = std::max<uint64_t>(m_recFileMapping->getSize() / m_index.size(), 1);
+                m_recFileMapping->setReadAheadWindow(std::min<uint64_t>(std::max<uint64_t>(AVERAGE_SIZE_OF_CONTAINER * m_desiredInitialLevel, Player::MIN_READ_AHEAD_WINDOW_IN_BYTES),
+                                                                        Player::MAX_READ_AHEAD_WINDOW_IN_BYTES));
+                m_recFileMapping->followPosition(m_currentContainerToReplay->second.m_filePosition);
+            }
+            else {
                 fillContainerCache(m_desiredInitialLevel);
             }
         }
@@ -249,7 +286,7 @@ namespace odtools {
 
                     // Read the corresponding container.
                     Container c;
-                    m_recFile >> c;
+                    readNextContainerFromRecFile(c);
 
                     // Store the container in the container cache.
                     {
@@ -265,6 +302,15 @@ namespace odtools {
             return entriesReadFromFile;
         }
 
+        bool Player::isRecFileMapped() const {
+            return (NULL != m_recFileMapping.get());
+        }
+
+        bool Player::readNextContainerFromRecFile(Container &c) {
+            const uint32_t bytesRead = Container::readWireRepresentation(m_recFile, m_recFileBuffer);
+            return ( (bytesRead > 0) && (c.deserializeFrom(&m_recFileBuffer[0], bytesRead) > 0) );
+        }
+
         void Player::checkForEndOfIndexAndThrowExceptionOrAutoRewind() throw (odcore::exceptions::ArrayIndexOutOfBoundsException) {
             // If at "EOF", either throw exception or autorewind.
             if (m_currentContainerToReplay == m_index.end()) {
@@ -299,11 +345,19 @@ namespace odtools {
 
             checkForEndOfIndexAndThrowExceptionOrAutoRewind();
 
-            checkAvailabilityOfNextContainerToBeReplayed();
+            if (!isRecFileMapped()) {
+                checkAvailabilityOfNextContainerToBeReplayed();
+            }
 
             Lock l(m_indexMutex);
             Container retVal;
-            Container &nextContainer = m_containerCache[m_currentContainerToReplay->second.m_filePosition];
+            Container mappedContainer;
+            if (isRecFileMapped()) {
+                // Decode the next Container directly from the mapping and prefetch the following ones.
+                m_recFileMapping->followPosition(m_currentContainerToReplay->second.m_filePosition);
+                m_recFileMapping->readContainer(m_currentContainerToReplay->second.m_filePosition, mappedContainer);
+            }
+            Container &nextContainer = (isRecFileMapped() ? mappedContainer : m_containerCache[m_currentContainerToReplay->second.m_filePosition]);
 
             // Check if the next Container + shared memory comes from the .rec.mem file.
             const int64_t recContainerSampleTime = nextContainer.getSampleTimeStamp().toMicroseconds();
@@ -355,11 +409,18 @@ namespace odtools {
             }
 
             // If Player is non-threaded, manage cache regularly.
-            if (!m_threading) {
+            if (!m_threading && !isRecFileMapped()) {
                 float refillMultiplicator = 1.1;
                 checkRefillingCache(m_index.size(), refillMultiplicator);
             }
 
+            // Without the thread managing the cache, progress is reported while replaying.
+            if (m_threading && isRecFileMapped()
+                && ((thisTimePointCallingThisMethod - m_lastTimePointPublishingStatistics).toMicroseconds() > Player::ONE_SECOND_IN_MICROSECONDS)) {
+                m_lastTimePointPublishingStatistics = thisTimePointCallingThisMethod;
+                publishStatistics(m_numberOfReturnedContainersInTotal, m_index.size());
+            }
+
             // Store sample time stamp as int64 to avoid unnecessary copying of Containers.
             lastContainersSampleTimeStamp = retVal.getSampleTimeStamp().toMicroseconds();
             return retVal;
@@ -399,24 +460,53 @@ namespace odtools {
         }
 
         void Player::rewind() {
-            if (m_threading) {
-                // Stop concurrent thread.
-                setContainerCacheFillingRunning(false);
-                m_containerCacheFillingThread.join();
+            stopContainerCacheFilling();
+            computeInitialCacheLevelAndFillCache();
+            startContainerCacheFilling();
+
+            // Propagate rewind to .rec.mem file.
+            if (NULL != m_recMemIndex.get()) {
+                m_recMemIndex->rewind();
             }
+        }
 
-            computeInitialCacheLevelAndFillCache();
+        bool Player::seekTo(const TimeStamp &sampleTimeStamp) {
+            if (!m_recFileValid || m_index.empty()) {
+                return false;
+            }
 
-            if (m_threading) {
-                // Re-start concurrent thread.
-                setContainerCacheFillingRunning(true);
-                m_containerCacheFillingThread = std::thread(&Player::manageCache, this);
+            // Find the first entry that was sampled at or after the desired time point.
+            auto position = m_index.lower_bound(sampleTimeStamp.toMicroseconds());
+            if (position == m_index.end()) {
+                return false;
             }
 
-            // Propagate rewind to .rec.mem file.
+            stopContainerCacheFilling();
+            resetCaches();
+            resetIterators(position);
+            fillCacheFromCurrentPosition();
+            startContainerCacheFilling();
+
+            // Propagate seeking to .rec.mem file.
             if (NULL != m_recMemIndex.get()) {
-                m_recMemIndex->rewind();
+                m_recMemIndex->seekTo(sampleTimeStamp.toMicroseconds());
             }
+
+            return true;
+        }
+
+        bool Player::seekToFraction(const double &fraction) {
+            if (!m_recFileValid || m_index.empty()) {
+                return false;
+            }
+
+            const int64_t FIRST_SAMPLE_TIME_POINT = m_index.begin()->first;
+            const int64_t LAST_SAMPLE_TIME_POINT = m_index.rbegin()->first;
+            const double FRACTION = std::min(std::max(fraction, 0.0), 1.0);
+            const int64_t SAMPLE_TIME_POINT = FIRST_SAMPLE_TIME_POINT + static_cast<int64_t>(std::floor(FRACTION * (LAST_SAMPLE_TIME_POINT - FIRST_SAMPLE_TIME_POINT)));
+
+            return seekTo(TimeStamp(static_cast<int32_t>(SAMPLE_TIME_POINT / Player::ONE_SECOND_IN_MICROSECONDS),
+                                    static_cast<int32_t>(SAMPLE_TIME_POINT % Player::ONE_SECOND_IN_MICROSECONDS)));
         }
 
         bool Player::hasMoreData() const {
@@ -438,6 +528,22 @@ namespace odtools {
 
         ////////////////////////////////////////////////////////////////////////
 
+        void Player::startContainerCacheFilling() {
+            if (m_threading && !isRecFileMapped()) {
+                // Start concurrent thread to manage cache.
+                setContainerCacheFillingRunning(true);
+                m_containerCacheFillingThread = std::thread(&Player::manageCache, this);
+            }
+        }
+
+        void Player::stopContainerCacheFilling() {
+            if (m_threading && !isRecFileMapped()) {
+                // Stop concurrent thread to manage cache.
+                setContainerCacheFillingRunning(false);
+                m_containerCacheFillingThread.join();
+            }
+        }
+
         void Player::setContainerCacheFillingRunning(const bool &running) {
             Lock l(m_containerCacheFillingThreadIsRunningMutex);
             m_containerCacheFillingThreadIsRunning = running;
@@ -478,17 +584,19 @@ namespace odtools {
                         Lock l(m_indexMutex);
                         numberOfReturnedContainersInTotal = m_numberOfReturnedContainersInTotal;
                     }
-                    {
-                        Lock l(m_playerListenerMutex);
-                        if (NULL != m_playerListener) {
-                            m_playerListener->percentagePlayedBack(numberOfReturnedContainersInTotal/static_cast<float>(numberOfEntriesInIndex));
-                        }
-                    }
+                    publishStatistics(numberOfReturnedContainersInTotal, numberOfEntriesInIndex);
                     statisticsCounter = 0;
                 }
             }
         }
 
+        void Player::publishStatistics(const uint32_t &numberOfReturnedContainersInTotal, const uint32_t &numberOfEntriesInIndex) {
+            Lock l(m_playerListenerMutex);
+            if (NULL != m_playerListener) {
+                m_playerListener->percentagePlayedBack(numberOfReturnedContainersInTotal/static_cast<float>(numberOfEntriesInIndex));
+            }
+        }
+
         float Player::checkRefillingCache(const uint32_t &numberOfEntries, float refillMultiplicator) {
             // If filling level is around 35%, pour in more from the recording.
             if (numberOfEntries < 0.35*m_desiredInitialLevel) {
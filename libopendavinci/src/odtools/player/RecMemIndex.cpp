@@ -27,6 +27,7 @@
 #include <iostream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <opendavinci/odcore/base/Lock.h>
 #include <opendavinci/odcore/base/Thread.h>
@@ -34,7 +35,9 @@
 
 #include <opendavinci/GeneratedHeaders_OpenDaVINCI.h>
 
+#include <opendavinci/odtools/player/MappedRecording.h>
 #include <opendavinci/odtools/player/RecMemIndex.h>
+#include <opendavinci/odtools/player/RecordingIndex.h>
 
 namespace odtools {
     namespace player {
@@ -73,11 +76,13 @@ namespace odtools {
 
         ////////////////////////////////////////////////////////////////////////
 
-        RecMemIndex::RecMemIndex(const URL &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading) :
+        RecMemIndex::RecMemIndex(const URL &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const bool &mapRecording) :
             m_threading(threading),
             m_url(url),
             m_recMemFile(),
             m_recMemFileValid(false),
+            m_mapRecording(mapRecording),
+            m_recMemFileMapping(),
             m_indexMutex(),
             m_index(),
             m_nextEntryToPlayBack(),
@@ -90,26 +95,32 @@ namespace odtools {
             m_rawMemoryBufferFillingThreadIsRunningMutex(),
             m_rawMemoryBufferFillingThreadIsRunning(false),
             m_rawMemoryBufferFillingThread() {
-            clog << "[odtools::player::RecMemIndex]: Acquiring " << numberOfMemorySegments << " memory segments of " << memorySegmentSize << " bytes...";
-            for(uint16_t id = 0; id < numberOfMemorySegments; id++) {
-                shared_ptr<RawMemoryBufferEntry> e = shared_ptr<RawMemoryBufferEntry>(new RawMemoryBufferEntry());
-                e->m_rawMemoryBuffer = static_cast<char*>(::malloc(memorySegmentSize));
-                e->m_lengthOfRawMemoryBuffer = memorySegmentSize;
-                m_unusedEntriesFromRawMemoryBuffer.push_back(e);
-
-                // This vector holds all entries for reuse.
-                m_allEntriesFromRawMemoryBuffer.push_back(e);
-            }
-            clog << "done." << endl;
-
             initializeIndex();
 
+            if (isRecMemFileMapped()) {
+                // Shared memory dumps are copied directly from the mapping; prefetch as many bytes as the raw buffers would hold.
+                m_recMemFileMapping->setReadAheadWindow(static_cast<uint64_t>(memorySegmentSize) * numberOfMemorySegments);
+            }
+            else {
+                clog << "[odtools::player::RecMemIndex]: Acquiring " << numberOfMemorySegments << " memory segments of " << memorySegmentSize << " bytes...";
+                for(uint16_t id = 0; id < numberOfMemorySegments; id++) {
+                    shared_ptr<RawMemoryBufferEntry> e = shared_ptr<RawMemoryBufferEntry>(new RawMemoryBufferEntry());
+                    e->m_rawMemoryBuffer = static_cast<char*>(::malloc(memorySegmentSize));
+                    e->m_lengthOfRawMemoryBuffer = memorySegmentSize;
+                    m_unusedEntriesFromRawMemoryBuffer.push_back(e);
+
+                    // This vector holds all entries for reuse.
+                    m_allEntriesFromRawMemoryBuffer.push_back(e);
+                }
+                clog << "done." << endl;
+            }
+
             // Fill raw buffer.
             manageRawMemoryBuffer();
             // Some data has been initially added to the cache.
             m_hasMoreData = true;
 
-            if (m_threading) {
+            if (m_threading && !isRecMemFileMapped()) {
                 // Start concurrent thread to manage the cache for shared memory dumps.
                 setRawMemoryBufferFillingRunning(true);
                 m_rawMemoryBufferFillingThread = std::thread(&RecMemIndex::manageRawMemoryBuffer, this);
@@ -117,12 +128,13 @@ namespace odtools {
         }
 
         RecMemIndex::~RecMemIndex() {
-            if (m_threading) {
+            if (m_threading && !isRecMemFileMapped()) {
                 // Stop concurrent thread to manage cache.
                 setRawMemoryBufferFillingRunning(false);
                 m_rawMemoryBufferFillingThread.join();
             }
 
+            m_recMemFileMapping.reset();
             m_recMemFile.close();
 
             clog << "[odtools::player::RecMemIndex]: Clearing " << m_allEntriesFromRawMemoryBuffer.size() << " entries from buffer...";
@@ -141,18 +153,38 @@ namespace odtools {
                 m_recMemFile.open(m_url.getResource().c_str(), ios_base::in|ios_base::binary);
                 m_recMemFileValid = m_recMemFile.good();
 
+                // Prefer reading Containers and shared memory dumps directly from the memory-mapped .rec.mem file.
+                if (m_recMemFileValid && m_mapRecording) {
+                    m_recMemFileMapping = unique_ptr<MappedRecording>(new MappedRecording(m_url.getResource()));
+                    if (!m_recMemFileMapping->isValid()) {
+                        m_recMemFileMapping.reset();
+                    }
+                }
+
                 // Determine file size to display progress.
                 m_recMemFile.seekg(0, m_recMemFile.end);
                     int64_t fileLength = m_recMemFile.tellg();
                 m_recMemFile.seekg(0, m_recMemFile.beg);
 
-                // Read complete file and store file positions to containers
-                // preceding the shared memory dumps to create an index of
-                // available data. The actual reading of shared memory
-                // dumps is deferred.
                 uint64_t totalBytesRead = 0;
                 const TimeStamp BEFORE;
-                {
+
+                // Use the accompanying index file if it matches the .rec.mem file.
+                vector<RecordingIndexEntry> entries;
+                const bool INDEX_FILE_AVAILABLE = m_recMemFileValid && RecordingIndex::load(m_url.getResource(), entries);
+                if (INDEX_FILE_AVAILABLE) {
+                    // The names of the shared memory segments are resolved when the containers are read.
+                    for (auto it = entries.begin(); it != entries.end(); it++) {
+                        m_index.emplace(std::make_pair(it->m_sampleTimeStamp,
+                                                       IndexEntry(it->m_sampleTimeStamp, it->m_filePosition, "", it->m_sizeOfSharedMemorySegment)));
+                    }
+                    clog << "[odtools::player::RecMemIndex]: Using " << RecordingIndex::getFileName(m_url.getResource()) << "." << endl;
+                }
+                else {
+                    // Read complete file and store file positions to containers
+                    // preceding the shared memory dumps to create an index of
+                    // available data. The actual reading of shared memory
+                    // dumps is deferred.
                     int32_t oldPercentage = -1;
                     while (m_recMemFile.good()) {
                         const uint64_t POS_BEFORE = m_recMemFile.tellg();
@@ -167,21 +199,7 @@ namespace odtools {
                             // directly following the Container.
                             uint64_t bytesToSkip = 0;
                             string nameOfSharedMemorySegment = "";
-                            if (c.getDataType() == odcore::data::SharedData::ID()) {
-                                odcore::data::SharedData sd = c.getData<odcore::data::SharedData>();
-                                bytesToSkip = sd.getSize();
-                                nameOfSharedMemorySegment = sd.getName();
-                            }
-                            if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
-                                odcore::data::image::SharedImage si = c.getData<odcore::data::image::SharedImage>();
-                                bytesToSkip = (si.getSize() > 0) ? si.getSize() : (si.getWidth() * si.getHeight() * si.getBytesPerPixel());
-                                nameOfSharedMemorySegment = si.getName();
-                            }
-                            if (c.getDataType() == odcore::data::SharedPointCloud::ID()) {
-                                odcore::data::SharedPointCloud spc = c.getData<odcore::data::SharedPointCloud>();
-                                bytesToSkip = spc.getSize();
-                                nameOfSharedMemorySegment = spc.getName();
-                            }
+                            getSharedMemorySegment(c, nameOfSharedMemorySegment, bytesToSkip);
                             const uint64_t CURRENT_POSITION_IN_RECMEM_FILE = m_recMemFile.tellg();
                             m_recMemFile.seekg(CURRENT_POSITION_IN_RECMEM_FILE + bytesToSkip);
                             totalBytesRead += bytesToSkip;
@@ -190,6 +208,8 @@ namespace odtools {
                             m_index.emplace(std::make_pair(c.getSampleTimeStamp().toMicroseconds(),
                                                            IndexEntry(c.getSampleTimeStamp().toMicroseconds(), POS_BEFORE, nameOfSharedMemorySegment, bytesToSkip)));
 
+                            entries.push_back(RecordingIndexEntry(c.getSampleTimeStamp().toMicroseconds(), POS_BEFORE, c.getDataType(), c.getSenderStamp(), (POS_AFTER - POS_BEFORE), bytesToSkip));
+
                             const int32_t percentage = static_cast<int32_t>(static_cast<float>(m_recMemFile.tellg()*100.0)/static_cast<float>(fileLength));
                             if ( (percentage % 5 == 0) && (percentage != oldPercentage) ) {
                                 clog << "[odtools::player::RecMemIndex]: Indexed " << percentage << "% from " << m_url.toString() << "." << endl;
@@ -197,6 +217,11 @@ namespace odtools {
                             }
                         }
                     }
+
+                    // Cache the index for the next time.
+                    if (m_recMemFileValid && !entries.empty()) {
+                        RecordingIndex::save(m_url.getResource(), entries);
+                    }
                 }
                 const TimeStamp AFTER;
 
@@ -214,22 +239,54 @@ namespace odtools {
             }
         }
 
+        void RecMemIndex::getSharedMemorySegment(const Container &c, string &nameOfSharedMemorySegment, uint64_t &sizeOfSharedMemorySegment) {
+            if (c.getDataType() == odcore::data::SharedData::ID()) {
+                odcore::data::SharedData sd = c.getData<odcore::data::SharedData>();
+                sizeOfSharedMemorySegment = sd.getSize();
+                nameOfSharedMemorySegment = sd.getName();
+            }
+            if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
+                odcore::data::image::SharedImage si = c.getData<odcore::data::image::SharedImage>();
+                sizeOfSharedMemorySegment = (si.getSize() > 0) ? si.getSize() : (si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+                nameOfSharedMemorySegment = si.getName();
+            }
+            if (c.getDataType() == odcore::data::SharedPointCloud::ID()) {
+                odcore::data::SharedPointCloud spc = c.getData<odcore::data::SharedPointCloud>();
+                sizeOfSharedMemorySegment = spc.getSize();
+                nameOfSharedMemorySegment = spc.getName();
+            }
+        }
+
+        bool RecMemIndex::isRecMemFileMapped() const {
+            return (NULL != m_recMemFileMapping.get());
+        }
+
         bool RecMemIndex::hasMoreData() const {
             Lock l(m_indexMutex);
             return m_hasMoreData;
         }
 
         void RecMemIndex::rewind() {
-            if (m_threading) {
+            resetToEntry(m_index.begin());
+        }
+
+        void RecMemIndex::seekTo(const int64_t &sampleTimeStamp) {
+            // Continue with the first entry that was sampled at or after the desired time point.
+            resetToEntry(m_index.lower_bound(sampleTimeStamp));
+        }
+
+        void RecMemIndex::resetToEntry(const multimap<int64_t, IndexEntry>::iterator &position) {
+            if (m_threading && !isRecMemFileMapped()) {
                 // Stop concurrent thread to manage cache.
                 setRawMemoryBufferFillingRunning(false);
                 m_rawMemoryBufferFillingThread.join();
             }
 
-            // Reset pointer to beginning of the .rec.mem file.
+            // Reset pointer to the given entry of the .rec.mem file; at the end, we continue from the beginning.
+            const bool AT_END = (position == m_index.end());
             m_nextEntryToPlayBack
                 = m_nextEntryToReadFromRecMemFile
-                = m_index.begin();
+                = (AT_END ? m_index.begin() : position);
 
             // Clear caches to rebuild it.
             m_rawMemoryBuffer.clear();
@@ -244,10 +301,10 @@ namespace odtools {
 
             // Fill raw buffer.
             manageRawMemoryBuffer();
-            // Some data has been initially added to the cache.
-            m_hasMoreData = true;
+            // Some data has been added to the cache unless the position is beyond the last entry.
+            m_hasMoreData = !AT_END;
 
-            if (m_threading) {
+            if (m_threading && !isRecMemFileMapped()) {
                 // Start concurrent thread to manage the cache for shared memory dumps.
                 setRawMemoryBufferFillingRunning(true);
                 m_rawMemoryBufferFillingThread = std::thread(&RecMemIndex::manageRawMemoryBuffer, this);
@@ -263,29 +320,33 @@ namespace odtools {
             odcore::data::Container retVal;
             {
                 Lock l(m_indexMutex);
-                if ( (m_nextEntryToPlayBack->second.m_available) &&
+                if (isRecMemFileMapped()) {
+                    // Decode the Container directly from the mapping and prefetch the following entries.
+                    m_recMemFileMapping->followPosition(m_nextEntryToPlayBack->second.m_filePosition);
+                    const uint32_t SIZE_OF_CONTAINER = m_recMemFileMapping->readContainer(m_nextEntryToPlayBack->second.m_filePosition, retVal);
+                    if (SIZE_OF_CONTAINER > 0) {
+                        // Entries from an index file do not know the shared memory segment's name yet.
+                        if (m_nextEntryToPlayBack->second.m_nameOfSharedMemorySegment.empty()) {
+                            uint64_t sizeOfSharedMemorySegment = 0;
+                            getSharedMemorySegment(retVal, m_nextEntryToPlayBack->second.m_nameOfSharedMemorySegment, sizeOfSharedMemorySegment);
+                        }
+
+                        // The shared memory dump directly follows the Container.
+                        uint64_t lengthOfSharedMemoryDump = m_nextEntryToPlayBack->second.m_sizeOfSharedMemorySegment;
+                        const char *sharedMemoryDump = m_recMemFileMapping->getPointer(m_nextEntryToPlayBack->second.m_filePosition + SIZE_OF_CONTAINER, lengthOfSharedMemoryDump);
+                        copyToSharedMemory(m_nextEntryToPlayBack->second, sharedMemoryDump, lengthOfSharedMemoryDump);
+                    }
+                }
+                else if ( (m_nextEntryToPlayBack->second.m_available) &&
                      (1 == m_rawMemoryBuffer.count(m_nextEntryToPlayBack->second.m_filePosition)) ) {
                     // Load Container from cache to be distributed into container conference.
                     retVal = m_rawMemoryBuffer[m_nextEntryToPlayBack->second.m_filePosition]->m_container;
 
                     // Transfer raw memory available to shared memory.
-                    const string NAME_OF_SHARED_MEMORY_SEGMENT = m_nextEntryToPlayBack->second.m_nameOfSharedMemorySegment;
-                    if (0 == m_mapOfPointersToSharedMemorySegments.count(NAME_OF_SHARED_MEMORY_SEGMENT)) {
-                        // A shared memory segment has not been acquired for this container.
-                        std::shared_ptr<odcore::wrapper::SharedMemory> sp = odcore::wrapper::SharedMemoryFactory::createSharedMemory(NAME_OF_SHARED_MEMORY_SEGMENT, m_nextEntryToPlayBack->second.m_sizeOfSharedMemorySegment);
-                        m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT] = sp;
-                    }
+                    copyToSharedMemory(m_nextEntryToPlayBack->second,
+                                       m_rawMemoryBuffer[m_nextEntryToPlayBack->second.m_filePosition]->m_rawMemoryBuffer,
+                                       m_rawMemoryBuffer[m_nextEntryToPlayBack->second.m_filePosition]->m_lengthOfRawMemoryBuffer);
 
-                    if ( (0 < m_mapOfPointersToSharedMemorySegments.count(NAME_OF_SHARED_MEMORY_SEGMENT)) &&
-                         (m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT]->isValid()) ) {
-                        Lock l2(m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT]);
-                        // Copy data from raw memory buffer into shared memory.
-                        ::memcpy(m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT]->getSharedMemory(),
-                                 m_rawMemoryBuffer[m_nextEntryToPlayBack->second.m_filePosition]->m_rawMemoryBuffer,
-                                 /* Limit the amount of data to be copied to the maximum length of the shared memory. */
-                                 std::min(m_rawMemoryBuffer[m_nextEntryToPlayBack->second.m_filePosition]->m_lengthOfRawMemoryBuffer, 
-                                          m_nextEntryToPlayBack->second.m_sizeOfSharedMemorySegment));
-                    }
                     // Mark entry as available.
                     m_nextEntryToReadFromRecMemFile->second.m_available = false;
                     // Remove entry from map of used rawMemoryBuffers.
@@ -303,7 +364,7 @@ namespace odtools {
             }
 
             // If not threading, handle cache regularly.
-            if (!m_threading) {
+            if (!m_threading && !isRecMemFileMapped()) {
                 // Fill raw buffer.
                 manageRawMemoryBuffer();
             }
@@ -311,6 +372,29 @@ namespace odtools {
             return retVal;
         }
 
+        void RecMemIndex::copyToSharedMemory(const IndexEntry &entry, const char *data, const uint64_t &length) {
+            if (NULL == data) {
+                return;
+            }
+
+            const string NAME_OF_SHARED_MEMORY_SEGMENT = entry.m_nameOfSharedMemorySegment;
+            if (0 == m_mapOfPointersToSharedMemorySegments.count(NAME_OF_SHARED_MEMORY_SEGMENT)) {
+                // A shared memory segment has not been acquired for this container.
+                std::shared_ptr<odcore::wrapper::SharedMemory> sp = odcore::wrapper::SharedMemoryFactory::createSharedMemory(NAME_OF_SHARED_MEMORY_SEGMENT, entry.m_sizeOfSharedMemorySegment);
+                m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT] = sp;
+            }
+
+            if ( (0 < m_mapOfPointersToSharedMemorySegments.count(NAME_OF_SHARED_MEMORY_SEGMENT)) &&
+                 (m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT]->isValid()) ) {
+                Lock l(m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT]);
+                // Copy data into shared memory.
+                ::memcpy(m_mapOfPointersToSharedMemorySegments[NAME_OF_SHARED_MEMORY_SEGMENT]->getSharedMemory(),
+                         data,
+                         /* Limit the amount of data to be copied to the maximum length of the shared memory. */
+                         std::min<uint64_t>(length, entry.m_sizeOfSharedMemorySegment));
+            }
+        }
+
         ////////////////////////////////////////////////////////////////////////
 
         void RecMemIndex::setRawMemoryBufferFillingRunning(const bool &running) {
@@ -350,6 +434,12 @@ namespace odtools {
                         // Read data from .rec.mem file.
                         m_recMemFile >> entry->m_container;
 
+                        // Entries from an index file do not know the shared memory segment's name yet.
+                        if (m_nextEntryToReadFromRecMemFile->second.m_nameOfSharedMemorySegment.empty()) {
+                            uint64_t sizeOfSharedMemorySegment = 0;
+                            getSharedMemorySegment(entry->m_container, m_nextEntryToReadFromRecMemFile->second.m_nameOfSharedMemorySegment, sizeOfSharedMemorySegment);
+                        }
+
                         // Read raw memory dump.
                         m_recMemFile.read(entry->m_rawMemoryBuffer,
                                           std::min(m_nextEntryToReadFromRecMemFile->second.m_sizeOfSharedMemorySegment, entry->m_lengthOfRawMemoryBuffer));
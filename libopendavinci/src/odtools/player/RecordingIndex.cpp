@@ -0,0 +1,241 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstring>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <opendavinci/odtools/player/RecordingIndex.h>
+
+namespace odtools {
+    namespace player {
+
+        using namespace std;
+
+        static const char MAGIC[4] = { 'O', 'D', 'I', 'X' };
+
+        RecordingIndexEntry::RecordingIndexEntry() :
+            RecordingIndexEntry(0, 0, 0, 0, 0, 0) {}
+
+        RecordingIndexEntry::RecordingIndexEntry(const int64_t &sampleTimeStamp, const uint64_t &filePosition, const int32_t &dataType, const uint32_t &senderStamp, const uint32_t &size, const uint32_t &sizeOfSharedMemorySegment) :
+            m_sampleTimeStamp(sampleTimeStamp),
+            m_filePosition(filePosition),
+            m_dataType(dataType),
+            m_senderStamp(senderStamp),
+            m_size(size),
+            m_sizeOfSharedMemorySegment(sizeOfSharedMemorySegment) {}
+
+        ////////////////////////////////////////////////////////////////////////
+
+        RecordingIndex::RecordingIndex(const string &fileNameOfRecording) :
+            m_fileNameOfRecording(fileNameOfRecording),
+            m_out(),
+            m_finalized(false) {
+            m_out.open(getFileName(m_fileNameOfRecording).c_str(), ios::out | ios::binary | ios::trunc);
+
+            // The header is completed in finalize(); until then, the index does not match any recording.
+            char header[HEADER_SIZE];
+            encodeHeader(header, 0, 0);
+            m_out.write(header, HEADER_SIZE);
+        }
+
+        RecordingIndex::~RecordingIndex() {
+            m_out.close();
+        }
+
+        void RecordingIndex::add(const RecordingIndexEntry &entry) {
+            if (!m_finalized && m_out.good()) {
+                char buffer[ENTRY_SIZE];
+                encodeEntry(buffer, entry);
+                m_out.write(buffer, ENTRY_SIZE);
+            }
+        }
+
+        void RecordingIndex::finalize() {
+            if (!m_finalized && m_out.good()) {
+                m_finalized = true;
+
+                uint64_t size = 0;
+                uint64_t fingerprint = 0;
+                if (computeFingerprint(m_fileNameOfRecording, size, fingerprint)) {
+                    char header[HEADER_SIZE];
+                    encodeHeader(header, size, fingerprint);
+                    m_out.seekp(0);
+                    m_out.write(header, HEADER_SIZE);
+                }
+                m_out.flush();
+            }
+        }
+
+        string RecordingIndex::getFileName(const string &fileNameOfRecording) {
+            return fileNameOfRecording + ".idx";
+        }
+
+        bool RecordingIndex::load(const string &fileNameOfRecording, vector<RecordingIndexEntry> &entries) {
+            entries.clear();
+
+            uint64_t size = 0;
+            uint64_t fingerprint = 0;
+            if (!computeFingerprint(fileNameOfRecording, size, fingerprint)) {
+                return false;
+            }
+
+            ifstream in(getFileName(fileNameOfRecording).c_str(), ios::in | ios::binary);
+            if (!in.good()) {
+                return false;
+            }
+
+            in.seekg(0, in.end);
+            const int64_t lengthOfIndex = in.tellg();
+            in.seekg(0, in.beg);
+            if ( (lengthOfIndex < HEADER_SIZE) || (0 != ((lengthOfIndex - HEADER_SIZE) % ENTRY_SIZE)) ) {
+                return false;
+            }
+
+            // Read the complete index at once.
+            vector<char> buffer(lengthOfIndex);
+            in.read(&buffer[0], lengthOfIndex);
+            if (in.gcount() != lengthOfIndex) {
+                return false;
+            }
+
+            char expectedHeader[HEADER_SIZE];
+            encodeHeader(expectedHeader, size, fingerprint);
+            if (0 != ::memcmp(expectedHeader, &buffer[0], HEADER_SIZE)) {
+                return false;
+            }
+
+            const uint64_t numberOfEntries = (lengthOfIndex - HEADER_SIZE) / ENTRY_SIZE;
+            entries.reserve(numberOfEntries);
+            for (uint64_t i = 0; i < numberOfEntries; i++) {
+                const RecordingIndexEntry entry = decodeEntry(&buffer[HEADER_SIZE + i * ENTRY_SIZE]);
+
+                // Reject entries pointing beyond the recording.
+                if ((entry.m_filePosition + entry.m_size + entry.m_sizeOfSharedMemorySegment) > size) {
+                    entries.clear();
+                    return false;
+                }
+                entries.push_back(entry);
+            }
+
+            return true;
+        }
+
+        bool RecordingIndex::save(const string &fileNameOfRecording, const vector<RecordingIndexEntry> &entries) {
+            uint64_t size = 0;
+            uint64_t fingerprint = 0;
+            if (!computeFingerprint(fileNameOfRecording, size, fingerprint)) {
+                return false;
+            }
+
+            vector<char> buffer(HEADER_SIZE + entries.size() * ENTRY_SIZE);
+            encodeHeader(&buffer[0], size, fingerprint);
+            for (uint64_t i = 0; i < entries.size(); i++) {
+                encodeEntry(&buffer[HEADER_SIZE + i * ENTRY_SIZE], entries[i]);
+            }
+
+            ofstream out(getFileName(fileNameOfRecording).c_str(), ios::out | ios::binary | ios::trunc);
+            out.write(&buffer[0], buffer.size());
+            out.flush();
+            return out.good();
+        }
+
+        bool RecordingIndex::computeFingerprint(const string &fileNameOfRecording, uint64_t &size, uint64_t &fingerprint) {
+            ifstream in(fileNameOfRecording.c_str(), ios::in | ios::binary);
+            if (!in.good()) {
+                return false;
+            }
+
+            in.seekg(0, in.end);
+            const int64_t length = in.tellg();
+            if (length < 0) {
+                return false;
+            }
+            size = static_cast<uint64_t>(length);
+
+            // FNV-1a over the first and the last bytes of the recording.
+            const uint64_t FNV_PRIME = UINT64_C(0x00000100000001B3);
+            fingerprint = UINT64_C(0xCBF29CE484222325);
+
+            vector<char> buffer(FINGERPRINT_RANGE);
+            const int64_t ranges[2] = { 0, std::max<int64_t>(0, length - FINGERPRINT_RANGE) };
+            for (uint32_t r = 0; r < 2; r++) {
+                in.clear();
+                in.seekg(ranges[r]);
+                in.read(&buffer[0], std::min<int64_t>(length, FINGERPRINT_RANGE));
+                const int64_t bytesRead = in.gcount();
+                for (int64_t i = 0; i < bytesRead; i++) {
+                    fingerprint = (fingerprint ^ static_cast<uint8_t>(buffer[i])) * FNV_PRIME;
+                }
+            }
+
+            return true;
+        }
+
+        void RecordingIndex::encodeHeader(char *buffer, const uint64_t &size, const uint64_t &fingerprint) {
+            const uint32_t version = htole32(VERSION);
+            const uint64_t s = htole64(size);
+            const uint64_t f = htole64(fingerprint);
+            ::memcpy(buffer, MAGIC, sizeof(MAGIC));
+            ::memcpy(buffer + 4, &version, sizeof(uint32_t));
+            ::memcpy(buffer + 8, &s, sizeof(uint64_t));
+            ::memcpy(buffer + 16, &f, sizeof(uint64_t));
+        }
+
+        void RecordingIndex::encodeEntry(char *buffer, const RecordingIndexEntry &entry) {
+            const uint64_t sampleTimeStamp = htole64(static_cast<uint64_t>(entry.m_sampleTimeStamp));
+            const uint64_t filePosition = htole64(entry.m_filePosition);
+            const uint32_t dataType = htole32(static_cast<uint32_t>(entry.m_dataType));
+            const uint32_t senderStamp = htole32(entry.m_senderStamp);
+            const uint32_t size = htole32(entry.m_size);
+            const uint32_t sizeOfSharedMemorySegment = htole32(entry.m_sizeOfSharedMemorySegment);
+            ::memcpy(buffer, &sampleTimeStamp, sizeof(uint64_t));
+            ::memcpy(buffer + 8, &filePosition, sizeof(uint64_t));
+            ::memcpy(buffer + 16, &dataType, sizeof(uint32_t));
+            ::memcpy(buffer + 20, &senderStamp, sizeof(uint32_t));
+            ::memcpy(buffer + 24, &size, sizeof(uint32_t));
+            ::memcpy(buffer + 28, &sizeOfSharedMemorySegment, sizeof(uint32_t));
+        }
+
+        RecordingIndexEntry RecordingIndex::decodeEntry(const char *buffer) {
+            uint64_t sampleTimeStamp = 0;
+            uint64_t filePosition = 0;
+            uint32_t dataType = 0;
+            uint32_t senderStamp = 0;
+            uint32_t size = 0;
+            uint32_t sizeOfSharedMemorySegment = 0;
+            ::memcpy(&sampleTimeStamp, buffer, sizeof(uint64_t));
+            ::memcpy(&filePosition, buffer + 8, sizeof(uint64_t));
+            ::memcpy(&dataType, buffer + 16, sizeof(uint32_t));
+            ::memcpy(&senderStamp, buffer + 20, sizeof(uint32_t));
+            ::memcpy(&size, buffer + 24, sizeof(uint32_t));
+            ::memcpy(&sizeOfSharedMemorySegment, buffer + 28, sizeof(uint32_t));
+            return RecordingIndexEntry(static_cast<int64_t>(le64toh(sampleTimeStamp)),
+                                       le64toh(filePosition),
+                                       static_cast<int32_t>(le32toh(dataType)),
+                                       le32toh(senderStamp),
+                                       le32toh(size),
+                                       le32toh(sizeOfSharedMemorySegment));
+        }
+
+    } // player
+} // tools
@@ -26,8 +26,10 @@
 #include "opendavinci/odcore/io/StreamFactory.h"
 #include "opendavinci/odcore/io/URL.h"
 #include "opendavinci/odcore/serialization/Serializable.h"
+#include "opendavinci/odtools/player/RecordingIndex.h"
 #include "opendavinci/odtools/recorder/Recorder.h"
 #include "opendavinci/odtools/recorder/RecorderDelegate.h"
+#include "opendavinci/odtools/recorder/RecordingWriter.h"
 #include "opendavinci/odtools/recorder/SharedDataListener.h"
 #include "opendavinci/generated/odcore/data/recorder/RecorderCommand.h"
 
@@ -40,25 +42,42 @@ namespace odtools {
         using namespace odcore::data;
         using namespace odcore::io;
 
-        Recorder::Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData) :
+        Recorder::Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData,
+                           const uint32_t &groupCommitSize, const uint32_t &groupCommitInterval, const bool &syncToDisk) :
             m_fifo(),
             m_sharedDataListener(),
             m_out(NULL),
+            m_recordingIndex(),
+            m_bytesWritten(0),
+            m_recordingWriter(),
             m_outSharedMemoryFile(NULL),
             m_dumpSharedData(dumpSharedData),
             m_mapOfRecorderDelegatesMutex(),
-            m_mapOfRecorderDelegates() {
+            m_mapOfRecorderDelegates(),
+            m_buffer() {
 
             // Get output file.
             URL _url(url);
             m_out = StreamFactory::getInstance().getOutputStream(_url);
 
+            // Write an index alongside the recording to allow a Player to skip scanning it.
+            m_recordingIndex = unique_ptr<odtools::player::RecordingIndex>(new odtools::player::RecordingIndex(_url.getResource()));
+
+            // Decouple serializing and writing containers from the calling thread.
+            if (threading) {
+                m_recordingWriter = unique_ptr<RecordingWriter>(new RecordingWriter(m_out, _url.getResource(), m_recordingIndex.get(),
+                                                                                    RecordingWriter::DEFAULT_CAPACITY, RecordingWriter::BLOCK,
+                                                                                    groupCommitSize, groupCommitInterval, syncToDisk));
+                m_recordingWriter->start();
+            }
+
             // Add a specific listener for SharedData type.
             URL urlSharedMemoryFile("file://" + _url.getResource() + ".mem");
             m_outSharedMemoryFile = StreamFactory::getInstance().getOutputStream(urlSharedMemoryFile);
+            std::shared_ptr<odtools::player::RecordingIndex> recordingIndexSharedMemoryFile(new odtools::player::RecordingIndex(urlSharedMemoryFile.getResource()));
 
             // Create data store for shared memory.
-            m_sharedDataListener = unique_ptr<SharedDataListener>(new SharedDataListener(m_outSharedMemoryFile, memorySegmentSize, numberOfSegments, threading));
+            m_sharedDataListener = unique_ptr<SharedDataListener>(new SharedDataListener(m_outSharedMemoryFile, recordingIndexSharedMemoryFile, memorySegmentSize, numberOfSegments, threading));
         }
 
         Recorder::~Recorder() {
@@ -73,10 +92,21 @@ namespace odtools {
                     m_mapOfRecorderDelegates.clear();
                 }
 
+                // Write all containers handed over to the writing thread.
+                if (m_recordingWriter.get()) {
+                    m_recordingWriter->stop();
+                    CLOG1 << "wrote " << m_recordingWriter->getNumberOfBytesWritten() << " bytes in " << m_recordingWriter->getNumberOfCommits() << " commits, "
+                          << m_recordingWriter->getNumberOfBlockedContainers() << " containers waited for the writer, "
+                          << m_recordingWriter->getNumberOfDroppedContainers() << " dropped, maximum queue depth " << m_recordingWriter->getMaximumQueueDepth() << "; ";
+                }
+
                 // Flush the file's content.
                 if (m_out.get()) {
                     m_out->flush();
                 }
+
+                // Complete the index after all containers are on disk.
+                m_recordingIndex->finalize();
             CLOG1 << "done." << endl;
         }
 
@@ -150,9 +180,7 @@ namespace odtools {
                         auto delegate = m_mapOfRecorderDelegates.find(c.getDataType());
                         if (delegate != m_mapOfRecorderDelegates.end()) {
                             Container replacementContainer = delegate->second->process(c);
-                            if (m_out.get()) {
-                                (*m_out) << replacementContainer;
-                            }
+                            writeContainer(replacementContainer);
 
                             // Continue processing as a delegated RecorderDelegate has
                             // handled this Container.
@@ -166,17 +194,33 @@ namespace odtools {
                          (c.getDataType() != odcore::data::SharedData::ID())  &&
                          (c.getDataType() != odcore::data::SharedPointCloud::ID())  &&
                          (c.getDataType() != odcore::data::image::SharedImage::ID()) ) {
-                        if (m_out.get()) {
-                            (*m_out) << c;
-                        }
+                        writeContainer(c);
                     }
                 }
 
-                if (m_out.get()) {
+                // The writing thread commits on its own.
+                if (m_out.get() && !m_recordingWriter.get()) {
                     m_out->flush();
                 }
             }
         }
 
+        void Recorder::writeContainer(const Container &c) {
+            if (m_recordingWriter.get()) {
+                m_recordingWriter->enqueue(c);
+            }
+            else if (m_out.get()) {
+                const uint32_t size = c.getSerializedSize();
+                if (m_buffer.size() < size) {
+                    m_buffer.resize(size);
+                }
+                const uint32_t bytesWritten = c.serializeTo(&m_buffer[0], size);
+                m_out->write(&m_buffer[0], bytesWritten);
+
+                m_recordingIndex->add(odtools::player::RecordingIndexEntry(c.getSampleTimeStamp().toMicroseconds(), m_bytesWritten, c.getDataType(), c.getSenderStamp(), bytesWritten, 0));
+                m_bytesWritten += bytesWritten;
+            }
+        }
+
     } // recorder
 } // tools
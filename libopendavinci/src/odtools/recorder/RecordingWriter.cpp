@@ -0,0 +1,254 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <iostream>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odtools/player/RecordingIndex.h"
+#include "opendavinci/odtools/recorder/RecordingWriter.h"
+
+namespace odtools {
+    namespace recorder {
+
+        using namespace std;
+        using namespace odcore::base;
+        using namespace odcore::data;
+
+        RecordingWriter::RecordingWriter(std::shared_ptr<ostream> out,
+                                         const string &fileName,
+                                         odtools::player::RecordingIndex *recordingIndex,
+                                         const uint32_t &capacity,
+                                         const OVERFLOW_POLICY &policy,
+                                         const uint32_t &groupCommitSize,
+                                         const uint32_t &groupCommitInterval,
+                                         const bool &syncToDisk) :
+            Service(),
+            m_out(out),
+            m_recordingIndex(recordingIndex),
+            m_fileDescriptor(-1),
+            m_queue(capacity),
+            m_policy(policy),
+            m_queueCondition(),
+            m_consumerWaiting(false),
+            m_spaceCondition(),
+            m_producerWaiting(false),
+            m_groupCommitSize(std::max<uint32_t>(groupCommitSize, 1)),
+            m_groupCommitInterval(std::max<uint32_t>(groupCommitInterval, 1)),
+            m_buffer(),
+            m_bufferUsed(0),
+            m_bytesWritten(0),
+            m_droppedContainers(0),
+            m_blockedContainers(0),
+            m_maximumQueueDepth(0),
+            m_commits(0),
+            m_bytesCommitted(0) {
+            // Allocate the buffer as multiple of memory pages.
+            const uint32_t PAGE_SIZE = 4096;
+            m_buffer.resize(((m_groupCommitSize + PAGE_SIZE - 1) / PAGE_SIZE) * PAGE_SIZE);
+
+#ifndef WIN32
+            if (syncToDisk) {
+                // Data written through any file descriptor is synchronized by fdatasync(...).
+                m_fileDescriptor = ::open(fileName.c_str(), O_WRONLY);
+                if (m_fileDescriptor < 0) {
+                    cerr << "[odtools::recorder::RecordingWriter] Could not open " << fileName << " to synchronize it with the disk." << endl;
+                }
+            }
+#else
+            (void)fileName;
+            (void)syncToDisk;
+#endif
+        }
+
+        RecordingWriter::~RecordingWriter() {
+            // Stop the writing thread.
+            stop();
+
+#ifndef WIN32
+            if (m_fileDescriptor >= 0) {
+                ::close(m_fileDescriptor);
+            }
+#endif
+        }
+
+        bool RecordingWriter::enqueue(const Container &c) {
+            bool added = m_queue.push(c);
+            if ( (!added) && (BLOCK == m_policy) ) {
+                // Apply backpressure until the writing thread has made room.
+                m_blockedContainers++;
+                Lock l(m_spaceCondition);
+                m_producerWaiting.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                while ( (!(added = m_queue.push(c))) && isRunning() ) {
+                    m_spaceCondition.waitOnSignal();
+                }
+                m_producerWaiting.store(false);
+            }
+            if (!added) {
+                m_droppedContainers++;
+                return false;
+            }
+
+            // Only this thread is adding entries.
+            const uint32_t depth = m_queue.getSize();
+            if (depth > m_maximumQueueDepth.load(std::memory_order_relaxed)) {
+                m_maximumQueueDepth.store(depth, std::memory_order_relaxed);
+            }
+
+            // Wake awaiting thread; no locking is required while it is busy.
+            if (m_consumerWaiting.load()) {
+                Lock l(m_queueCondition);
+                m_queueCondition.wakeAll();
+            }
+            return true;
+        }
+
+        uint64_t RecordingWriter::getNumberOfDroppedContainers() const {
+            return m_droppedContainers.load();
+        }
+
+        uint64_t RecordingWriter::getNumberOfBlockedContainers() const {
+            return m_blockedContainers.load();
+        }
+
+        uint32_t RecordingWriter::getMaximumQueueDepth() const {
+            return m_maximumQueueDepth.load();
+        }
+
+        uint64_t RecordingWriter::getNumberOfCommits() const {
+            return m_commits.load();
+        }
+
+        uint64_t RecordingWriter::getNumberOfBytesWritten() const {
+            return m_bytesCommitted.load();
+        }
+
+        void RecordingWriter::processQueue() {
+            // Process all entries that are available at this moment in one batch.
+            uint32_t numberOfEntries = m_queue.getSize();
+            while (numberOfEntries-- > 0) {
+                const Container *entry = m_queue.front();
+                if (NULL == entry) {
+                    break;
+                }
+
+                const uint32_t size = entry->getSerializedSize();
+                if ((m_bufferUsed + size) > m_buffer.size()) {
+                    commit();
+                    if (size > m_buffer.size()) {
+                        m_buffer.resize(size);
+                    }
+                }
+
+                const uint32_t bytesSerialized = entry->serializeTo(&m_buffer[m_bufferUsed], size);
+                if (0 == bytesSerialized) {
+                    CLOG1 << "[odtools::recorder::RecordingWriter] Container of type " << entry->getDataType() << " could not be serialized; skipped." << endl;
+                }
+                else {
+                    if (NULL != m_recordingIndex) {
+                        m_recordingIndex->add(odtools::player::RecordingIndexEntry(entry->getSampleTimeStamp().toMicroseconds(), m_bytesWritten, entry->getDataType(), entry->getSenderStamp(), bytesSerialized, 0));
+                    }
+                    m_bufferUsed += bytesSerialized;
+                    m_bytesWritten += bytesSerialized;
+                }
+
+                // The slot is reused only after pop().
+                m_queue.pop();
+
+                // Wake a producer waiting for room; no locking is required otherwise.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_producerWaiting.load()) {
+                    Lock l(m_spaceCondition);
+                    m_spaceCondition.wakeAll();
+                }
+
+                if (m_bufferUsed >= m_groupCommitSize) {
+                    commit();
+                }
+            }
+        }
+
+        void RecordingWriter::commit() {
+            if ( (m_bufferUsed > 0) && m_out.get() ) {
+                m_out->write(&m_buffer[0], m_bufferUsed);
+                m_out->flush();
+
+#ifndef WIN32
+                if (m_fileDescriptor >= 0) {
+                    ::fdatasync(m_fileDescriptor);
+                }
+#endif
+
+                m_bytesCommitted += m_bufferUsed;
+                m_commits++;
+            }
+            m_bufferUsed = 0;
+        }
+
+        void RecordingWriter::beforeStop() {
+            // Wake awaiting threads.
+            {
+                Lock l(m_queueCondition);
+                m_queueCondition.wakeAll();
+            }
+            {
+                Lock l(m_spaceCondition);
+                m_spaceCondition.wakeAll();
+            }
+        }
+
+        void RecordingWriter::run() {
+            serviceReady();
+
+            TimeStamp lastCommit;
+            while (isRunning()) {
+                processQueue();
+
+                // Write collected data at least once per commit interval.
+                TimeStamp now;
+                if ((now - lastCommit).toMicroseconds() >= static_cast<int64_t>(m_groupCommitInterval) * 1000) {
+                    commit();
+                    lastCommit = now;
+                }
+
+                Lock l(m_queueCondition);
+                m_consumerWaiting.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_queue.isEmpty() && isRunning()) {
+                    m_queueCondition.waitOnSignalWithTimeout(m_groupCommitInterval);
+                }
+                m_consumerWaiting.store(false);
+            }
+
+            // Write all remaining entries before shutting down.
+            processQueue();
+            commit();
+        }
+
+    } // recorder
+} // tools
@@ -40,7 +40,7 @@ namespace odtools {
         using namespace odcore::data;
         using namespace odtools;
 
-        SharedDataListener::SharedDataListener(std::shared_ptr<ostream> out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading) :
+        SharedDataListener::SharedDataListener(std::shared_ptr<ostream> out, std::shared_ptr<odtools::player::RecordingIndex> recordingIndex, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading) :
             m_threading(threading),
             m_sharedDataWriter(),
             m_mapOfAvailableSharedData(),
@@ -67,7 +67,7 @@ namespace odtools {
             CLOG1 << "done." << endl;
 
             // Hand over the buffer to the writer.
-            m_sharedDataWriter = unique_ptr<SharedDataWriter>(new SharedDataWriter(m_out, m_mapOfMemories, m_bufferIn, m_bufferOut));
+            m_sharedDataWriter = unique_ptr<SharedDataWriter>(new SharedDataWriter(m_out, recordingIndex, m_mapOfMemories, m_bufferIn, m_bufferOut));
             if ( (m_sharedDataWriter.get() != NULL) && (m_threading) ) {
                 m_sharedDataWriter->start();
             }
@@ -26,6 +26,7 @@
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/generated/odcore/data/buffer/MemorySegment.h"
+#include "opendavinci/odtools/player/RecordingIndex.h"
 #include "opendavinci/odtools/recorder/SharedDataWriter.h"
 
 namespace odtools {
@@ -36,8 +37,10 @@ namespace odtools {
         using namespace odcore::data;
         using namespace odtools;
 
-        SharedDataWriter::SharedDataWriter(std::shared_ptr<ostream> out, map<uint32_t, char*> &mapOfMemories, FIFOQueue &bufferIn, FIFOQueue &bufferOut) :
+        SharedDataWriter::SharedDataWriter(std::shared_ptr<ostream> out, std::shared_ptr<odtools::player::RecordingIndex> recordingIndex, map<uint32_t, char*> &mapOfMemories, FIFOQueue &bufferIn, FIFOQueue &bufferOut) :
             m_out(out),
+            m_recordingIndex(recordingIndex),
+            m_bytesWritten(0),
             m_mapOfMemories(mapOfMemories),
             m_bufferIn(bufferIn),
             m_bufferOut(bufferOut)
@@ -46,6 +49,12 @@ namespace odtools {
         SharedDataWriter::~SharedDataWriter() {
             CLOG1 << "SharedDataWriter: Cleaning queue... ";
             recordEntries();
+
+            // Complete the index after all entries are on disk.
+            if (m_recordingIndex.get()) {
+                m_out->flush();
+                m_recordingIndex->finalize();
+            }
             CLOG1 << "done." << endl;
         }
 
@@ -67,6 +76,13 @@ namespace odtools {
                     (*m_out) << header;
                     m_out->write(ptrToMemory, ms.getConsumedSize());
 
+                    // Describe the container and its dump in the index.
+                    if (m_recordingIndex.get()) {
+                        const uint32_t size = header.getSerializedSize();
+                        m_recordingIndex->add(odtools::player::RecordingIndexEntry(header.getSampleTimeStamp().toMicroseconds(), m_bytesWritten, header.getDataType(), header.getSenderStamp(), size, ms.getConsumedSize()));
+                        m_bytesWritten += size + ms.getConsumedSize();
+                    }
+
                     // Reset meta information.
                     ms.setConsumedSize(0);
 
@@ -0,0 +1,227 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_COMPACTPOINTCLOUDCODECTESTSUITE_H_
+#define CORE_COMPACTPOINTCLOUDCODECTESTSUITE_H_
+
+#include <cmath>                        // for fabs, sin, cos
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/data/pointcloud/CompactPointCloudCodec.h"
+#include "opendavinci/generated/odcore/data/CompactPointCloud.h"
+#include "opendavinci/generated/odcore/data/SharedPointCloud.h"
+
+using namespace std;
+using namespace odcore::data;
+using namespace odcore::data::pointcloud;
+
+class CompactPointCloudCodecTest : public CxxTest::TestSuite {
+    private:
+        /**
+         * This method creates a point cloud in polar coordinates
+         * (distance, azimuth, vertical angle, intensity).
+         */
+        vector<float> createPolarPointCloud(const vector<float> &verticalAngles, const uint32_t &numberOfAzimuths, const float &startAzimuth, const float &azimuthIncrement) {
+            vector<float> points;
+            for (uint32_t a = 0; a < numberOfAzimuths; a++) {
+                for (uint32_t l = 0; l < verticalAngles.size(); l++) {
+                    // Every 7th point has no reflection.
+                    const uint32_t i = a * verticalAngles.size() + l;
+                    points.push_back( (0 == (i % 7)) ? 0.0f : 1.0f + static_cast<float>(i % 97) * 0.37f );
+                    points.push_back(startAzimuth + a * azimuthIncrement);
+                    points.push_back(verticalAngles[l]);
+                    points.push_back(static_cast<float>((i * 13) % 256));
+                }
+            }
+            return points;
+        }
+
+        SharedPointCloud createSharedPointCloud(const uint32_t &numberOfPoints, const SharedPointCloud::USERINFO &userInfo) {
+            SharedPointCloud spc;
+            spc.setWidth(numberOfPoints);
+            spc.setHeight(1);
+            spc.setNumberOfComponentsPerPoint(4);
+            spc.setComponentDataType(SharedPointCloud::FLOAT_T);
+            spc.setUserInfo(userInfo);
+            return spc;
+        }
+
+        vector<float> getVerticalAngles(const uint32_t &numberOfLayers) {
+            vector<float> verticalAngles;
+            for (uint32_t l = 0; l < numberOfLayers; l++) {
+                verticalAngles.push_back(-15.0f + l * (30.0f / numberOfLayers));
+            }
+            return verticalAngles;
+        }
+
+        void checkRoundTrip(const uint32_t &numberOfLayers, const CompactPointCloud::DISTANCE_ENCODING &distanceEncoding, const uint8_t &numberOfBitsForIntensity, const CompactPointCloud::INTENSITY_PLACEMENT &intensityPlacement) {
+            const vector<float> verticalAngles = getVerticalAngles(numberOfLayers);
+            const uint32_t NUMBER_OF_AZIMUTHS = 37;
+            const vector<float> points = createPolarPointCloud(verticalAngles, NUMBER_OF_AZIMUTHS, 10.0f, 0.2f);
+            const uint32_t numberOfPoints = NUMBER_OF_AZIMUTHS * numberOfLayers;
+
+            CompactPointCloudCodec codec(verticalAngles);
+            TS_ASSERT(codec.getNumberOfLayers() == numberOfLayers);
+
+            CompactPointCloud cpc = codec.encode(createSharedPointCloud(numberOfPoints, SharedPointCloud::POLAR_INTENSITY), &points[0], distanceEncoding, numberOfBitsForIntensity, intensityPlacement);
+            TS_ASSERT(cpc.getEntriesPerAzimuth() == numberOfLayers);
+            TS_ASSERT(cpc.getDistances().size() == 2 * numberOfPoints);
+            TS_ASSERT(fabs(cpc.getStartAzimuth() - 10.0f) < 1e-3);
+            TS_ASSERT(fabs(cpc.getEndAzimuth() - (10.0f + NUMBER_OF_AZIMUTHS * 0.2f)) < 1e-3);
+
+            // The distance loses the bits used by the intensity and its resolution.
+            const float resolution = (CompactPointCloud::MM == distanceEncoding) ? 0.002f : 0.01f;
+            const float tolerance = ( (CompactPointCloud::LOWER_BITS == intensityPlacement) ? (1 << numberOfBitsForIntensity) : 1 ) * resolution;
+
+            // Distances are capped by the bits available for them.
+            const float maxDistance = ( (CompactPointCloud::HIGHER_BITS == intensityPlacement) ? (0xFFFF >> numberOfBitsForIntensity) : 0xFFFF ) * resolution;
+
+            vector<float> distance;
+            vector<float> intensity;
+            TS_ASSERT(codec.decodeDistances(cpc, distance, intensity) == numberOfPoints);
+            TS_ASSERT(distance.size() == numberOfPoints);
+            TS_ASSERT(intensity.size() == numberOfPoints);
+            for (uint32_t i = 0; i < numberOfPoints; i++) {
+                const float expectedDistance = (points[4 * i] > maxDistance) ? maxDistance : points[4 * i];
+                TS_ASSERT(fabs(distance[i] - expectedDistance) <= tolerance);
+                const float expectedIntensity = (numberOfBitsForIntensity > 0) ? static_cast<float>(static_cast<uint32_t>(points[4 * i + 3]) >> (8 - numberOfBitsForIntensity)) : 0.0f;
+                TS_ASSERT(intensity[i] == expectedIntensity);
+            }
+
+            vector<float> x, y, z;
+            TS_ASSERT(codec.decode(cpc, x, y, z, intensity) == numberOfPoints);
+            TS_ASSERT(codec.getDistances().size() == numberOfPoints);
+            const float DEG2RAD = 0.017453292519943295f;
+            for (uint32_t i = 0; i < numberOfPoints; i++) {
+                const float d = codec.getDistances()[i];
+                TS_ASSERT(d == distance[i]);
+
+                const float azimuth = points[4 * i + 1] * DEG2RAD;
+                const float verticalAngle = points[4 * i + 2] * DEG2RAD;
+                TS_ASSERT(fabs(x[i] - d * cos(verticalAngle) * sin(azimuth)) < 1e-3);
+                TS_ASSERT(fabs(y[i] - d * cos(verticalAngle) * cos(azimuth)) < 1e-3);
+                TS_ASSERT(fabs(z[i] - d * sin(verticalAngle)) < 1e-3);
+            }
+        }
+
+    public:
+        void testRoundTripNoIntensity() {
+            checkRoundTrip(16, CompactPointCloud::CM, 0, CompactPointCloud::HIGHER_BITS);
+            checkRoundTrip(32, CompactPointCloud::MM, 0, CompactPointCloud::HIGHER_BITS);
+        }
+
+        void testRoundTripIntensityInHigherBits() {
+            checkRoundTrip(16, CompactPointCloud::CM, 4, CompactPointCloud::HIGHER_BITS);
+            checkRoundTrip(64, CompactPointCloud::MM, 3, CompactPointCloud::HIGHER_BITS);
+        }
+
+        void testRoundTripIntensityInLowerBits() {
+            checkRoundTrip(16, CompactPointCloud::CM, 4, CompactPointCloud::LOWER_BITS);
+            checkRoundTrip(32, CompactPointCloud::CM, 2, CompactPointCloud::LOWER_BITS);
+        }
+
+        void testRoundTripUnevenNumberOfLayers() {
+            // HDL-32E parts use 11, 12, and 9 layers.
+            checkRoundTrip(11, CompactPointCloud::CM, 0, CompactPointCloud::HIGHER_BITS);
+            checkRoundTrip(9, CompactPointCloud::MM, 4, CompactPointCloud::HIGHER_BITS);
+        }
+
+        void testEncodeCartesian() {
+            const vector<float> verticalAngles = getVerticalAngles(16);
+            const uint32_t NUMBER_OF_AZIMUTHS = 20;
+            const vector<float> polar = createPolarPointCloud(verticalAngles, NUMBER_OF_AZIMUTHS, 100.0f, 0.4f);
+
+            // Convert the point cloud to (x, y, z, intensity).
+            const float DEG2RAD = 0.017453292519943295f;
+            vector<float> cartesian;
+            for (uint32_t i = 0; i < polar.size(); i += 4) {
+                const float d = polar[i];
+                const float azimuth = polar[i + 1] * DEG2RAD;
+                const float verticalAngle = polar[i + 2] * DEG2RAD;
+                cartesian.push_back(d * cos(verticalAngle) * sin(azimuth));
+                cartesian.push_back(d * cos(verticalAngle) * cos(azimuth));
+                cartesian.push_back(d * sin(verticalAngle));
+                cartesian.push_back(polar[i + 3]);
+            }
+
+            CompactPointCloudCodec codec(verticalAngles);
+            CompactPointCloud cpc = codec.encode(createSharedPointCloud(polar.size() / 4, SharedPointCloud::XYZ_INTENSITY), &cartesian[0], CompactPointCloud::MM, 0, CompactPointCloud::HIGHER_BITS);
+            TS_ASSERT(fabs(cpc.getStartAzimuth() - 100.0f) < 1e-2);
+            TS_ASSERT(fabs(cpc.getEndAzimuth() - (100.0f + NUMBER_OF_AZIMUTHS * 0.4f)) < 1e-2);
+
+            vector<float> x, y, z, intensity;
+            TS_ASSERT(codec.decode(cpc, x, y, z, intensity) == polar.size() / 4);
+            for (uint32_t i = 0; i < x.size(); i++) {
+                TS_ASSERT(fabs(x[i] - cartesian[4 * i]) < 0.01);
+                TS_ASSERT(fabs(y[i] - cartesian[4 * i + 1]) < 0.01);
+                TS_ASSERT(fabs(z[i] - cartesian[4 * i + 2]) < 0.01);
+            }
+        }
+
+        void testDecodeHostByteOrder() {
+            vector<float> verticalAngles;
+            verticalAngles.push_back(0.0f);
+
+            // Distances of 1m, 2m, and 3m in cm and host byte order.
+            const uint16_t values[] = { 100, 200, 300 };
+            CompactPointCloud cpc;
+            cpc.setStartAzimuth(0.0f);
+            cpc.setEndAzimuth(270.0f);
+            cpc.setEntriesPerAzimuth(1);
+            cpc.setDistances(string(reinterpret_cast<const char*>(values), sizeof(values)));
+            cpc.setDistanceEncoding(CompactPointCloud::CM);
+
+            CompactPointCloudCodec codec(verticalAngles);
+            codec.setNetworkByteOrder(false);
+
+            vector<float> x, y, z, intensity;
+            TS_ASSERT(codec.decode(cpc, x, y, z, intensity) == 3);
+            TS_ASSERT(fabs(x[0] - 0.0f) < 1e-5 && fabs(y[0] - 1.0f) < 1e-5);
+            TS_ASSERT(fabs(x[1] - 2.0f) < 1e-5 && fabs(y[1] - 0.0f) < 1e-5);
+            TS_ASSERT(fabs(x[2] - 0.0f) < 1e-5 && fabs(y[2] + 3.0f) < 1e-5);
+            TS_ASSERT(fabs(z[2]) < 1e-5);
+        }
+
+        void testUnsupportedLayouts() {
+            CompactPointCloudCodec codec(getVerticalAngles(16));
+            const vector<float> points(4 * 16 * 2, 1.0f);
+
+            // Not a multiple of the number of layers.
+            CompactPointCloud cpc = codec.encode(createSharedPointCloud(17, SharedPointCloud::POLAR_INTENSITY), &points[0], CompactPointCloud::CM, 0, CompactPointCloud::HIGHER_BITS);
+            TS_ASSERT(cpc.getDistances().empty());
+
+            // Wrong component type.
+            SharedPointCloud spc = createSharedPointCloud(32, SharedPointCloud::POLAR_INTENSITY);
+            spc.setComponentDataType(SharedPointCloud::DOUBLE_T);
+            cpc = codec.encode(spc, &points[0], CompactPointCloud::CM, 0, CompactPointCloud::HIGHER_BITS);
+            TS_ASSERT(cpc.getDistances().empty());
+
+            // A CompactPointCloud with a different number of layers cannot be converted.
+            cpc = codec.encode(createSharedPointCloud(32, SharedPointCloud::POLAR_INTENSITY), &points[0], CompactPointCloud::CM, 0, CompactPointCloud::HIGHER_BITS);
+            CompactPointCloudCodec otherCodec(getVerticalAngles(8));
+            vector<float> x, y, z, intensity;
+            TS_ASSERT(otherCodec.decode(cpc, x, y, z, intensity) == 0);
+            TS_ASSERT(x.empty());
+        }
+};
+
+#endif /*CORE_COMPACTPOINTCLOUDCODECTESTSUITE_H_*/
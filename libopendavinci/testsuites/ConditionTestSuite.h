@@ -30,6 +30,7 @@
 #include "opendavinci/odcore/base/Mutex.h"            // for Mutex
 #include "opendavinci/odcore/base/Service.h"          // for Service
 #include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
 
 using namespace std;
 using namespace odcore::base;
@@ -202,6 +203,19 @@ class ConditionTest : public CxxTest::TestSuite {
             TS_ASSERT(condition.waitOnSignalWithTimeout(100) == false);
 
         }
+
+        void testTimeConditionWithFractionOfSecond() {
+            clog << endl << "ConditionTest::testTimeConditionWithFractionOfSecond" << endl;
+            Condition condition;
+            Lock l(condition);
+
+            // The nanoseconds of the deadline exceed one second in almost all cases.
+            const odcore::data::TimeStamp before;
+            TS_ASSERT(condition.waitOnSignalWithTimeout(999) == false);
+            const odcore::data::TimeStamp after;
+
+            TS_ASSERT((after - before).toMicroseconds() >= 990 * 1000);
+        }
 };
 
 #endif /*CORE_CONDITIONTESTSUITE_H_*/
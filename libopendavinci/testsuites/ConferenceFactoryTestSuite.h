@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>                       // for operator==, basic_string, etc
+#include <vector>
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
@@ -29,6 +30,7 @@
 #include "opendavinci/odcontext/base/ControlledContainerConferenceFactory.h"
 #include "opendavinci/odcontext/base/ControlledContainerConferenceForSystemUnderTest.h"
 #include "opendavinci/odcore/base/FIFOQueue.h"        // for FIFOQueue
+#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"        // for Container, etc
 #include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
@@ -165,6 +167,110 @@ class ConferenceFactoryTest : public CxxTest::TestSuite {
                 TS_ASSERT(tsCheckReceivedTimeStampFromApplication.toString() == tsSendFromApplicationToContainerConference.toString());
             }
         }
+
+        void testUDPMultiCastContainerConferenceSendBatch() {
+            // Destroy any existing ContainerConferenceFactory.
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ContainerConferenceFactory *ccf2 = &ccf;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+
+            const string group = "225.0.0.201";
+            std::shared_ptr<ContainerConference> sender = ContainerConferenceFactory::getInstance().getContainerConference(group);
+            std::shared_ptr<ContainerConference> receiver = ContainerConferenceFactory::getInstance().getContainerConference(group);
+            TS_ASSERT(sender.get());
+            TS_ASSERT(receiver.get());
+
+            ConferenceFactoryTestContainerListenerForContainerFromSystemsUnderTest listener;
+            receiver->setContainerListener(&listener);
+
+            // More containers than fit into one datagram.
+            const uint32_t NUMBER_OF_CONTAINERS = 200;
+            vector<Container> containers;
+            for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                containers.push_back(Container(TimeStamp(i, 0)));
+            }
+            sender->sendBatch(containers);
+
+            uint32_t cycles = 0;
+            while ( (listener.getFIFO().getSize() < NUMBER_OF_CONTAINERS) && (cycles < 100) ) {
+                Thread::usleepFor(10 * 1000);
+                cycles++;
+            }
+
+            // All containers are received in the order they were sent.
+            TS_ASSERT(listener.getFIFO().getSize() == NUMBER_OF_CONTAINERS);
+            bool correctOrder = true;
+            for (uint32_t i = 0; (i < NUMBER_OF_CONTAINERS) && (listener.getFIFO().getSize() > 0); i++) {
+                Container c = listener.getFIFO().leave();
+                correctOrder &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+                correctOrder &= (c.getSentTimeStamp().toMicroseconds() > 0);
+            }
+            TS_ASSERT(correctOrder);
+
+            receiver->setContainerListener(NULL);
+
+            // Destroy existing ContainerConferenceFactory.
+            ContainerConferenceFactory &ccfDestroy = ContainerConferenceFactory::getInstance();
+            ccf2 = &ccfDestroy;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+        }
+
+        void testUDPMultiCastContainerConferenceSendBatchPaced() {
+            // Destroy any existing ContainerConferenceFactory.
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ContainerConferenceFactory *ccf2 = &ccf;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+
+            const string group = "225.0.0.202";
+            std::shared_ptr<ContainerConference> sender = ContainerConferenceFactory::getInstance().getContainerConference(group);
+            std::shared_ptr<ContainerConference> receiver = ContainerConferenceFactory::getInstance().getContainerConference(group);
+            TS_ASSERT(sender.get());
+            TS_ASSERT(receiver.get());
+
+            // Pause after every single datagram.
+            const uint32_t PAUSE = 20 * 1000;
+            std::shared_ptr<UDPMultiCastContainerConference> udpSender = std::dynamic_pointer_cast<UDPMultiCastContainerConference>(sender);
+            TS_ASSERT(udpSender.get());
+            udpSender->setBatchPacing(1, PAUSE);
+
+            ConferenceFactoryTestContainerListenerForContainerFromSystemsUnderTest listener;
+            receiver->setContainerListener(&listener);
+
+            // More containers than fit into one datagram.
+            const uint32_t NUMBER_OF_CONTAINERS = 200;
+            vector<Container> containers;
+            for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                containers.push_back(Container(TimeStamp(i, 0)));
+            }
+            TimeStamp before;
+            sender->sendBatch(containers);
+            TimeStamp after;
+
+            // At least one pause between two datagrams.
+            TS_ASSERT((after - before).toMicroseconds() >= PAUSE);
+
+            uint32_t cycles = 0;
+            while ( (listener.getFIFO().getSize() < NUMBER_OF_CONTAINERS) && (cycles < 100) ) {
+                Thread::usleepFor(10 * 1000);
+                cycles++;
+            }
+
+            // All containers are received in the order they were sent.
+            TS_ASSERT(listener.getFIFO().getSize() == NUMBER_OF_CONTAINERS);
+            bool correctOrder = true;
+            for (uint32_t i = 0; (i < NUMBER_OF_CONTAINERS) && (listener.getFIFO().getSize() > 0); i++) {
+                Container c = listener.getFIFO().leave();
+                correctOrder &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+            }
+            TS_ASSERT(correctOrder);
+
+            receiver->setContainerListener(NULL);
+
+            // Destroy existing ContainerConferenceFactory.
+            ContainerConferenceFactory &ccfDestroy = ContainerConferenceFactory::getInstance();
+            ccf2 = &ccfDestroy;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+        }
 };
 
 #endif /*CONTEXT_CONFERENCEFACTORYTESTSUITE_H_*/
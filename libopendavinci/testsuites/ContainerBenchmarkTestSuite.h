@@ -0,0 +1,170 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_CONTAINERBENCHMARKTESTSUITE_H_
+#define CORE_CONTAINERBENCHMARKTESTSUITE_H_
+
+#include <cstring>                      // for memcpy
+#include <iostream>                     // for clog, endl
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/serialization/Deserializer.h"
+#include "opendavinci/odcore/serialization/SerializationFactory.h"
+#include "opendavinci/odcore/serialization/Serializer.h"
+#include "opendavinci/generated/odcore/data/Packet.h"
+
+using namespace std;
+using namespace odcore::data;
+using namespace odcore::serialization;
+
+/**
+ * Reference implementation of the former stream-based Container
+ * encoding using the generic Serializer.
+ */
+void encodeContainerUsingStreams(const Container &c, ostream &out) {
+    stringstream bufferOut;
+    {
+        std::shared_ptr<Serializer> s = SerializationFactory::getInstance().getSerializer(bufferOut);
+        s->write(1, c.getDataType());
+        s->write(2, c.getSerializedData());
+        s->write(3, c.getSentTimeStamp());
+        s->write(4, c.getReceivedTimeStamp());
+        s->write(5, c.getSampleTimeStamp());
+        s->write(6, c.getSenderStamp());
+    }
+
+    const char byte0 = 0x0D;
+    const string str_bufferOut = bufferOut.str();
+    uint32_t length = htole32((static_cast<uint32_t>(str_bufferOut.size()) << 8) | 0xA4);
+    out.write(&byte0, sizeof(byte0));
+    out.write(reinterpret_cast<char*>(&length), sizeof(uint32_t));
+    out << str_bufferOut;
+}
+
+/**
+ * Reference implementation of the former stream-based Container
+ * decoding using the generic Deserializer.
+ */
+string decodeContainerUsingStreams(istream &in, int32_t &dataType, TimeStamp &sampleTimeStamp) {
+    vector<char> header(Container::HEADER_SIZE);
+    in.read(&header[0], Container::HEADER_SIZE);
+    uint32_t length = 0;
+    memcpy(&length, &header[1], sizeof(uint32_t));
+    length = le32toh(length) >> 8;
+
+    vector<char> payload(length);
+    in.read(&payload[0], length);
+
+    stringstream bufferIn;
+    bufferIn.rdbuf()->pubsetbuf(&payload[0], length);
+    std::shared_ptr<Deserializer> d = SerializationFactory::getInstance().getDeserializer(bufferIn);
+
+    string rawData;
+    d->read(1, dataType);
+    d->read(2, rawData);
+    d->read(5, sampleTimeStamp);
+    return rawData;
+}
+
+class ContainerBenchmarkTest : public CxxTest::TestSuite {
+    public:
+        void testWireFormatIsCompatible() {
+            Packet p("sender", string(100000, 'x'), TimePoint(1, 2));
+            Container c(p);
+            c.setSentTimeStamp(TimeStamp(3, -4));
+            c.setReceivedTimeStamp(TimeStamp(5, 6));
+            c.setSampleTimeStamp(TimeStamp(7, 8));
+            c.setSenderStamp(9);
+
+            stringstream streamBased;
+            encodeContainerUsingStreams(c, streamBased);
+
+            vector<char> buffer(c.getSerializedSize());
+            TS_ASSERT(buffer.size() == c.serializeTo(&buffer[0], buffer.size()));
+            TS_ASSERT(streamBased.str() == string(buffer.begin(), buffer.end()));
+
+            int32_t dataType = 0;
+            TimeStamp sampleTimeStamp;
+            stringstream in(string(buffer.begin(), buffer.end()));
+            TS_ASSERT(decodeContainerUsingStreams(in, dataType, sampleTimeStamp) == c.getSerializedData());
+            TS_ASSERT(dataType == Packet::ID());
+            TS_ASSERT(sampleTimeStamp.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+
+            Container c2;
+            TS_ASSERT(buffer.size() == c2.deserializeFrom(&buffer[0], buffer.size()));
+            TS_ASSERT(c2.getData<Packet>().getData() == p.getData());
+        }
+
+        void testThroughput() {
+            const uint32_t ITERATIONS = 200;
+
+            Packet p("sender", string(256 * 1024, 'x'), TimePoint(1, 2));
+            Container c(p);
+            c.setSampleTimeStamp(TimeStamp(3, 4));
+            const uint64_t totalBytes = static_cast<uint64_t>(c.getSerializedSize()) * ITERATIONS;
+
+            // Former stream-based path.
+            uint64_t checksumStreams = 0;
+            const TimeStamp streamsBefore;
+            for (uint32_t i = 0; i < ITERATIONS; i++) {
+                stringstream sstr;
+                encodeContainerUsingStreams(c, sstr);
+
+                int32_t dataType = 0;
+                TimeStamp sampleTimeStamp;
+                checksumStreams += decodeContainerUsingStreams(sstr, dataType, sampleTimeStamp).size();
+            }
+            const TimeStamp streamsAfter;
+
+            // Direct encoding into and decoding from a buffer.
+            uint64_t checksumDirect = 0;
+            vector<char> buffer;
+            const TimeStamp directBefore;
+            for (uint32_t i = 0; i < ITERATIONS; i++) {
+                const uint32_t size = c.getSerializedSize();
+                if (buffer.size() < size) {
+                    buffer.resize(size);
+                }
+                const uint32_t bytesWritten = c.serializeTo(&buffer[0], size);
+
+                Container c2;
+                c2.deserializeFrom(&buffer[0], bytesWritten);
+                checksumDirect += c2.getSerializedData().size();
+            }
+            const TimeStamp directAfter;
+
+            TS_ASSERT(checksumStreams == checksumDirect);
+
+            const double durationStreams = (streamsAfter - streamsBefore).toMicroseconds() / (1000.0 * 1000.0);
+            const double durationDirect = (directAfter - directBefore).toMicroseconds() / (1000.0 * 1000.0);
+            clog << endl << "[ContainerBenchmarkTest]: stream-based encode/decode: "
+                 << (totalBytes / (1024.0 * 1024.0)) / durationStreams << " MiB/s" << endl;
+            clog << "[ContainerBenchmarkTest]: serializeTo/deserializeFrom: "
+                 << (totalBytes / (1024.0 * 1024.0)) / durationDirect << " MiB/s" << endl;
+        }
+};
+
+#endif /*CORE_CONTAINERBENCHMARKTESTSUITE_H_*/
@@ -22,6 +22,8 @@
 
 #include <sstream>                      // for stringstream, etc
 #include <string>                       // for operator==, basic_string
+#include <utility>                      // for move
+#include <vector>                       // for vector
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
@@ -235,6 +237,153 @@ class ContainerTest : public CxxTest::TestSuite {
             TS_ASSERT(listener2.m_container.getDataType() == ts3.ID());
             TS_ASSERT(listener2.m_container.getData<TimeStamp>().toMicroseconds() == ts3.toMicroseconds());
         }
+
+        void testCopiesSharePayload() {
+            TimeStamp ts(11, 12);
+            Container c1(ts);
+
+            Container c2(c1);
+            Container c3;
+            c3 = c1;
+
+            // Copies must not duplicate the serialized payload.
+            TS_ASSERT(c1.getSerializedData().data() == c2.getSerializedData().data());
+            TS_ASSERT(c1.getSerializedData().data() == c3.getSerializedData().data());
+
+            TS_ASSERT(c2.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+            TS_ASSERT(c3.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+
+            // Reading from one container must not affect the others.
+            TS_ASSERT(c1.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+            TS_ASSERT(c1.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+        }
+
+        void testMoveContainer() {
+            TimeStamp ts(13, 14);
+            Container c1(ts);
+            c1.setSenderStamp(15);
+            const char *payload = c1.getSerializedData().data();
+
+            Container c2(std::move(c1));
+            TS_ASSERT(c2.getDataType() == ts.getID());
+            TS_ASSERT(c2.getSenderStamp() == 15);
+            TS_ASSERT(c2.getSerializedData().data() == payload);
+            TS_ASSERT(c2.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+
+            TS_ASSERT(c1.getDataType() == Container::UNDEFINEDDATA);
+            TS_ASSERT(c1.getSerializedData().empty());
+
+            Container c3;
+            c3 = std::move(c2);
+            TS_ASSERT(c3.getDataType() == ts.getID());
+            TS_ASSERT(c3.getSerializedData().data() == payload);
+            TS_ASSERT(c3.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+            TS_ASSERT(c2.getSerializedData().empty());
+
+            // Moved-from containers remain usable.
+            stringstream s;
+            s << c3;
+            s.flush();
+            s >> c1;
+            TS_ASSERT(c1.getDataType() == ts.getID());
+            TS_ASSERT(c1.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+        }
+
+        void testSerializeToDeserializeFrom() {
+            TimeStamp ts(-16, 17);
+            Container c1(ts, -42);
+            c1.setSentTimeStamp(TimeStamp(1, 2));
+            c1.setReceivedTimeStamp(TimeStamp(-3, 4));
+            c1.setSampleTimeStamp(TimeStamp(5, -6));
+            c1.setSenderStamp(123456789);
+
+            // Buffers that are too small must be rejected.
+            vector<char> buffer(c1.getSerializedSize());
+            TS_ASSERT(0 == c1.serializeTo(&buffer[0], buffer.size() - 1));
+            TS_ASSERT(buffer.size() == c1.serializeTo(&buffer[0], buffer.size()));
+
+            // The fast path must produce the same bytes as operator<<.
+            stringstream s;
+            s << c1;
+            TS_ASSERT(s.str() == string(buffer.begin(), buffer.end()));
+
+            Container c2;
+            TS_ASSERT(buffer.size() == c2.deserializeFrom(&buffer[0], buffer.size()));
+            TS_ASSERT(c2.getDataType() == -42);
+            TS_ASSERT(c2.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+            TS_ASSERT(c2.getSentTimeStamp().toMicroseconds() == c1.getSentTimeStamp().toMicroseconds());
+            TS_ASSERT(c2.getReceivedTimeStamp().toMicroseconds() == c1.getReceivedTimeStamp().toMicroseconds());
+            TS_ASSERT(c2.getSampleTimeStamp().toMicroseconds() == c1.getSampleTimeStamp().toMicroseconds());
+            TS_ASSERT(c2.getSenderStamp() == 123456789);
+
+            // Truncated input must be rejected.
+            Container c3;
+            TS_ASSERT(0 == c3.deserializeFrom(&buffer[0], buffer.size() - 1));
+            TS_ASSERT(0 == c3.deserializeFrom(&buffer[0], Container::HEADER_SIZE - 1));
+        }
+
+        void testPeekHeader() {
+            TimeStamp ts(22, 23);
+            Container c1(ts, -42);
+            c1.setSenderStamp(4711);
+
+            vector<char> buffer(c1.getSerializedSize());
+            TS_ASSERT(buffer.size() == c1.serializeTo(&buffer[0], buffer.size()));
+
+            int32_t dataType = 0;
+            uint32_t senderStamp = 0;
+            TS_ASSERT(Container::peekHeader(&buffer[0], buffer.size(), dataType, senderStamp));
+            TS_ASSERT(dataType == -42);
+            TS_ASSERT(senderStamp == 4711);
+
+            // Truncated input must be rejected.
+            TS_ASSERT(!Container::peekHeader(&buffer[0], buffer.size() - 1, dataType, senderStamp));
+            TS_ASSERT(!Container::peekHeader(&buffer[0], Container::HEADER_SIZE - 1, dataType, senderStamp));
+        }
+
+        void testPeekSize() {
+            TimeStamp ts1(24, 25);
+            TimeStamp ts2(26, 27);
+            Container c1(ts1);
+            Container c2(ts2);
+
+            // Two containers back to back.
+            vector<char> buffer(c1.getSerializedSize() + c2.getSerializedSize());
+            TS_ASSERT(c1.getSerializedSize() == c1.serializeTo(&buffer[0], buffer.size()));
+            TS_ASSERT(c2.getSerializedSize() == c2.serializeTo(&buffer[c1.getSerializedSize()], c2.getSerializedSize()));
+
+            TS_ASSERT(c1.getSerializedSize() == Container::peekSize(&buffer[0], buffer.size()));
+            TS_ASSERT(c2.getSerializedSize() == Container::peekSize(&buffer[c1.getSerializedSize()], c2.getSerializedSize()));
+
+            // Truncated input must be rejected.
+            TS_ASSERT(0 == Container::peekSize(&buffer[0], c1.getSerializedSize() - 1));
+            TS_ASSERT(0 == Container::peekSize(&buffer[0], Container::HEADER_SIZE - 1));
+        }
+
+        void testReadWireRepresentation() {
+            TimeStamp ts1(18, 19);
+            TimeStamp ts2(20, 21);
+            Container c1(ts1);
+            Container c2(ts2);
+
+            stringstream s;
+            s << c1 << c2;
+
+            vector<char> buffer;
+            Container c3;
+            uint32_t bytesRead = Container::readWireRepresentation(s, buffer);
+            TS_ASSERT(bytesRead == c1.getSerializedSize());
+            TS_ASSERT(bytesRead == c3.deserializeFrom(&buffer[0], bytesRead));
+            TS_ASSERT(c3.getData<TimeStamp>().toMicroseconds() == ts1.toMicroseconds());
+
+            bytesRead = Container::readWireRepresentation(s, buffer);
+            TS_ASSERT(bytesRead == c2.getSerializedSize());
+            TS_ASSERT(bytesRead == c3.deserializeFrom(&buffer[0], bytesRead));
+            TS_ASSERT(c3.getData<TimeStamp>().toMicroseconds() == ts2.toMicroseconds());
+
+            TS_ASSERT(0 == Container::readWireRepresentation(s, buffer));
+            TS_ASSERT(s.eof());
+        }
 };
 
 #endif /*CORE_CONTAINERTESTSUITE_H_*/
@@ -0,0 +1,128 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_LATESTVALUESTORETESTSUITE_H_
+#define CORE_LATESTVALUESTORETESTSUITE_H_
+
+#include <memory>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/KeyValueDataStore.h"
+#include "opendavinci/odcore/base/LatestValueStore.h"
+#include "opendavinci/odcore/base/Service.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+
+class LatestValueStoreTestReader : public Service {
+    public:
+        LatestValueStoreTestReader(LatestValueStore &lvs) :
+            m_lvs(lvs),
+            m_monotonic(true),
+            m_reads(0) {}
+
+        virtual void beforeStop() {}
+
+        virtual void run() {
+            serviceReady();
+            int32_t last = -1;
+            while (isRunning()) {
+                std::shared_ptr<const TimeStamp> ts = m_lvs.getLatest<TimeStamp>(TimeStamp::ID());
+                if (ts.get()) {
+                    m_monotonic = m_monotonic && (ts->getSeconds() >= last);
+                    last = ts->getSeconds();
+                    m_reads++;
+                }
+            }
+        }
+
+        LatestValueStore &m_lvs;
+        bool m_monotonic;
+        uint32_t m_reads;
+
+    private:
+        LatestValueStoreTestReader(const LatestValueStoreTestReader &);
+        LatestValueStoreTestReader& operator=(const LatestValueStoreTestReader &);
+};
+
+class LatestValueStoreTest : public CxxTest::TestSuite {
+    public:
+        void testPutGet() {
+            LatestValueStore lvs;
+            TS_ASSERT(lvs.get(TimeStamp::ID()).getDataType() == Container::UNDEFINEDDATA);
+            TS_ASSERT(!lvs.getLatest<TimeStamp>(TimeStamp::ID()).get());
+
+            lvs.put(TimeStamp::ID(), Container(TimeStamp(1, 2)));
+            TS_ASSERT(lvs.get(TimeStamp::ID()).getData<TimeStamp>().getSeconds() == 1);
+
+            // The payload is decoded once and shared until it is replaced.
+            std::shared_ptr<const TimeStamp> ts1 = lvs.getLatest<TimeStamp>(TimeStamp::ID());
+            std::shared_ptr<const TimeStamp> ts2 = lvs.getLatest<TimeStamp>(TimeStamp::ID());
+            TS_ASSERT(ts1.get());
+            TS_ASSERT(ts1.get() == ts2.get());
+            TS_ASSERT(ts1->getSeconds() == 1);
+            TS_ASSERT(ts1->getMicroseconds() == 2);
+
+            lvs.put(TimeStamp::ID(), Container(TimeStamp(3, 4)));
+            std::shared_ptr<const TimeStamp> ts3 = lvs.getLatest<TimeStamp>(TimeStamp::ID());
+            TS_ASSERT(ts3->getSeconds() == 3);
+            // Previously returned objects stay valid.
+            TS_ASSERT(ts1->getSeconds() == 1);
+
+            // Other keys are independent.
+            lvs.put(42, Container(TimeStamp(5, 6), 42));
+            TS_ASSERT(lvs.get(42).getDataType() == 42);
+            TS_ASSERT(lvs.getLatest<TimeStamp>(TimeStamp::ID())->getSeconds() == 3);
+        }
+
+        void testKeyValueDataStoreInMemory() {
+            KeyValueDataStore kvds;
+            TS_ASSERT(!kvds.getLatest<TimeStamp>(TimeStamp::ID()).get());
+
+            kvds.put(TimeStamp::ID(), Container(TimeStamp(7, 8)));
+            TS_ASSERT(kvds.get(TimeStamp::ID()).getData<TimeStamp>().getSeconds() == 7);
+            TS_ASSERT(kvds.getLatest<TimeStamp>(TimeStamp::ID())->getMicroseconds() == 8);
+        }
+
+        void testConcurrentReaders() {
+            LatestValueStore lvs;
+            LatestValueStoreTestReader reader1(lvs);
+            LatestValueStoreTestReader reader2(lvs);
+            reader1.start();
+            reader2.start();
+
+            for (int32_t i = 0; i < 10000; i++) {
+                lvs.put(TimeStamp::ID(), Container(TimeStamp(i, 0)));
+            }
+
+            reader1.stop();
+            reader2.stop();
+
+            TS_ASSERT(reader1.m_monotonic);
+            TS_ASSERT(reader2.m_monotonic);
+            TS_ASSERT(lvs.getLatest<TimeStamp>(TimeStamp::ID())->getSeconds() == 9999);
+        }
+};
+
+#endif /*CORE_LATESTVALUESTORETESTSUITE_H_*/
@@ -21,7 +21,9 @@
 #define CORE_NETSTRINGSPROTOCOLTESTSUITE_H_
 
 #include <iostream>                     // for operator<<, basic_ostream, etc
+#include <sstream>                      // for stringstream
 #include <string>                       // for string, char_traits, etc
+#include <vector>                       // for vector
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
@@ -35,11 +37,13 @@ class NetstringsProtocolTest : public CxxTest::TestSuite, public odcore::io::Str
     private:
         string m_receivedData;
         string m_dataToBeSent;
+        vector<string> m_receivedStrings;
 
     public:
         NetstringsProtocolTest() :
             m_receivedData(""),
-            m_dataToBeSent("") {}
+            m_dataToBeSent(""),
+            m_receivedStrings() {}
 
         void send(const string& data) {
             m_dataToBeSent = data;
@@ -47,6 +51,7 @@ class NetstringsProtocolTest : public CxxTest::TestSuite, public odcore::io::Str
 
         void nextString(const string &s) {
             m_receivedData = s;
+            m_receivedStrings.push_back(s);
         }
 
         void testNetstringsProtocolSend() {
@@ -123,6 +128,86 @@ class NetstringsProtocolTest : public CxxTest::TestSuite, public odcore::io::Str
             TS_ASSERT(m_receivedData.compare(testDataToBeSent) == 0); 
         }
 
+        void testNetstringsProtocolMultipleNetstringsInOneChunk() {
+            odcore::io::protocol::NetstringsProtocol nsp;
+            nsp.setStringListener(this);
+            m_receivedStrings.clear();
+
+            stringstream dataStream;
+            for (uint32_t i = 0; i < 1000; i++) {
+                stringstream payload;
+                payload << "Payload" << i;
+                dataStream << payload.str().length() << ":" << payload.str() << ",";
+            }
+            nsp.nextString(dataStream.str());
+
+            TS_ASSERT(m_receivedStrings.size() == 1000);
+            TS_ASSERT(m_receivedStrings.front() == "Payload0");
+            TS_ASSERT(m_receivedStrings.back() == "Payload999");
+        }
+
+        void testNetstringsProtocolByteByByte() {
+            odcore::io::protocol::NetstringsProtocol nsp;
+            nsp.setStringListener(this);
+            m_receivedStrings.clear();
+
+            const string data("5:Hello,12:Hello World!,");
+            for (uint32_t i = 0; i < data.length(); i++) {
+                nsp.nextString(data.substr(i, 1));
+            }
+
+            TS_ASSERT(m_receivedStrings.size() == 2);
+            TS_ASSERT(m_receivedStrings.at(0) == "Hello");
+            TS_ASSERT(m_receivedStrings.at(1) == "Hello World!");
+        }
+
+        void testNetstringsProtocolEmptyNetstring() {
+            odcore::io::protocol::NetstringsProtocol nsp;
+            nsp.setStringListener(this);
+            m_receivedStrings.clear();
+
+            // Empty Netstrings are consumed but not delivered.
+            nsp.nextString("0:,5:Hello,");
+
+            TS_ASSERT(m_receivedStrings.size() == 1);
+            TS_ASSERT(m_receivedStrings.at(0) == "Hello");
+        }
+
+        void testNetstringsProtocolOversizedNetstring() {
+            odcore::io::protocol::NetstringsProtocol nsp;
+            nsp.setStringListener(this);
+            m_receivedStrings.clear();
+
+            stringstream dataStream;
+            dataStream << (odcore::io::protocol::NetstringsProtocol::MAX_PAYLOAD_SIZE + 1) << ":Hello,";
+            nsp.nextString(dataStream.str());
+            TS_ASSERT(m_receivedStrings.size() == 0);
+
+            nsp.nextString("99999999999999999999:Hello,");
+            TS_ASSERT(m_receivedStrings.size() == 0);
+
+            // The decoder has recovered.
+            nsp.nextString("5:Hello,");
+            TS_ASSERT(m_receivedStrings.size() == 1);
+        }
+
+        void testNetstringsProtocolCorruptedData() {
+            odcore::io::protocol::NetstringsProtocol nsp;
+            nsp.setStringListener(this);
+            m_receivedStrings.clear();
+
+            nsp.nextString("Garbage");
+            TS_ASSERT(m_receivedStrings.size() == 0);
+
+            // Missing ',' at the end.
+            nsp.nextString("5:Hello;");
+            TS_ASSERT(m_receivedStrings.size() == 0);
+
+            nsp.nextString("5:Hello,");
+            TS_ASSERT(m_receivedStrings.size() == 1);
+            TS_ASSERT(m_receivedStrings.at(0) == "Hello");
+        }
+
 };
 
 #endif /*CORE_NETSTRINGSPROTOCOLTESTSUITE_H_*/
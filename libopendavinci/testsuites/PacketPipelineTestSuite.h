@@ -20,6 +20,7 @@
 #ifndef CORE_PACKETPIPELINETESTSUITE_H_
 #define CORE_PACKETPIPELINETESTSUITE_H_
 
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -91,6 +92,54 @@ class PacketPipelineTest : public CxxTest::TestSuite, PacketListener {
             m_receivedData.clear();
             TS_ASSERT(m_receivedData.size() == 0);
         }
+
+        void testDropNewestWhenFull() {
+            m_receivedData.clear();
+            TS_ASSERT(m_receivedData.size() == 0);
+
+            // Not started; hence, nothing is consumed while adding packets.
+            PacketPipeline ppl(4, PacketPipeline::DROP_NEWEST);
+            ppl.setPacketListener(this);
+            for (uint32_t i = 0; i < 10; i++) {
+                ppl.nextPacket(Packet("", "Packet", TimeStamp()));
+            }
+            TS_ASSERT(ppl.getNumberOfDroppedPackets() == 6);
+            TS_ASSERT(ppl.getMaximumQueueDepth() == 4);
+
+            // Remaining packets are delivered in order once the pipeline runs.
+            ppl.start();
+            ppl.stop();
+            TS_ASSERT(m_receivedData.size() == 4);
+
+            ppl.setPacketListener(NULL);
+            m_receivedData.clear();
+            TS_ASSERT(m_receivedData.size() == 0);
+        }
+
+        void testBlockDeliversAllPackets() {
+            m_receivedData.clear();
+            TS_ASSERT(m_receivedData.size() == 0);
+
+            PacketPipeline ppl(4, PacketPipeline::BLOCK);
+            ppl.setPacketListener(this);
+            ppl.start();
+            for (uint32_t i = 0; i < 1000; i++) {
+                stringstream sstr;
+                sstr << i;
+                ppl.nextPacket(Packet("", sstr.str(), TimeStamp()));
+            }
+            ppl.stop();
+
+            TS_ASSERT(ppl.getNumberOfDroppedPackets() == 0);
+            TS_ASSERT(ppl.getMaximumQueueDepth() <= 4);
+            TS_ASSERT(m_receivedData.size() == 1000);
+            TS_ASSERT(m_receivedData.front().getData() == "0");
+            TS_ASSERT(m_receivedData.back().getData() == "999");
+
+            ppl.setPacketListener(NULL);
+            m_receivedData.clear();
+            TS_ASSERT(m_receivedData.size() == 0);
+        }
 };
 
 #endif /*CORE_PACKETPIPELINETESTSUITE_H_*/
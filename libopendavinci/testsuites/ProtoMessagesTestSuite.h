@@ -2721,6 +2721,9 @@ class ProtoMessageTest : public CxxTest::TestSuite {
             tm1.setWidth(640);
             tm1.setHeight(480);
             tm1.setBytesPerPixel(3);
+            tm1.setNumberOfSlots(3);
+            tm1.setSlot(1);
+            tm1.setFrameID(5);
 
             // Replace default serializer/deserializers.
             SerializationFactoryTestCase tmp;
@@ -2748,6 +2751,15 @@ class ProtoMessageTest : public CxxTest::TestSuite {
 
             TS_ASSERT(tm1.getBytesPerPixel() == tm2.getBytesPerPixel());
             TS_ASSERT(tm2.getBytesPerPixel() == 3);
+
+            TS_ASSERT(tm1.getNumberOfSlots() == tm2.getNumberOfSlots());
+            TS_ASSERT(tm2.getNumberOfSlots() == 3);
+
+            TS_ASSERT(tm1.getSlot() == tm2.getSlot());
+            TS_ASSERT(tm2.getSlot() == 1);
+
+            TS_ASSERT(tm1.getFrameID() == tm2.getFrameID());
+            TS_ASSERT(tm2.getFrameID() == 5);
         }
 
         void testSerializationDeserializationSharedImageContainer() {
@@ -4436,6 +4448,80 @@ class ProtoMessageTest : public CxxTest::TestSuite {
 
         ///////////////////////////////////////////////////////////////////////
 
+        void testDirectSerializationTestMessage2MatchesProtoSerializer() {
+            TestMessage2 tm1;
+            tm1.setField1(123);
+            tm1.setField2(-123);
+
+            // Replace default serializer/deserializers.
+            SerializationFactoryTestCase tmp;
+            (void)tmp;
+
+            stringstream out;
+            out << tm1;
+            const string viaSerializer = out.str();
+
+            char buffer[TestMessage2::MAX_SERIALIZED_SIZE];
+            TS_ASSERT(tm1.getSerializedSize() <= TestMessage2::MAX_SERIALIZED_SIZE);
+            const uint32_t size = tm1.serializeTo(buffer, sizeof(buffer));
+            TS_ASSERT(size == tm1.getSerializedSize());
+            TS_ASSERT(string(buffer, size) == viaSerializer);
+            TS_ASSERT(string(buffer, size) == string("\x08\x7b\x10\xf5\x01", 5));
+
+            // Buffer too small.
+            TS_ASSERT(0 == tm1.serializeTo(buffer, 2));
+
+            TestMessage2 tm2;
+            TS_ASSERT(size == tm2.deserializeFrom(viaSerializer.data(), viaSerializer.size()));
+            TS_ASSERT(tm2.getField1() == 123);
+            TS_ASSERT(tm2.getField2() == -123);
+        }
+
+        void testDirectSerializationLogMessageWithEnumAndStrings() {
+            LogMessage lm1;
+            lm1.setComponentName("ABC");
+            lm1.setLogLevel(LogMessage::DEBUG);
+            lm1.setLogMessage("Hello World!");
+
+            // Replace default serializer/deserializers.
+            SerializationFactoryTestCase tmp;
+            (void)tmp;
+
+            stringstream out;
+            out << lm1;
+            const string viaSerializer = out.str();
+
+            vector<char> buffer(lm1.getSerializedSize());
+            const uint32_t size = lm1.serializeTo(&buffer[0], buffer.size());
+            TS_ASSERT(size == buffer.size());
+            TS_ASSERT(string(&buffer[0], size) == viaSerializer);
+
+            // Deserialize what the regular Deserializer would consume.
+            LogMessage lm2;
+            TS_ASSERT(size == lm2.deserializeFrom(viaSerializer.data(), viaSerializer.size()));
+            TS_ASSERT(lm2.getComponentName() == "ABC");
+            TS_ASSERT(lm2.getLogLevel() == LogMessage::DEBUG);
+            TS_ASSERT(lm2.getLogMessage() == "Hello World!");
+
+            // Truncated data is rejected.
+            LogMessage lm3;
+            TS_ASSERT(0 == lm3.deserializeFrom(viaSerializer.data(), viaSerializer.size() - 1));
+        }
+
+        void testDirectDeserializationSkipsUnknownFields() {
+            // Field 7 (fixed64) and field 8 (length-delimited) are unknown to TestMessage2.
+            const string data("\x39\x01\x02\x03\x04\x05\x06\x07\x08"
+                              "\x42\x02\x41\x42"
+                              "\x08\x7b\x10\xf5\x01", 18);
+
+            TestMessage2 tm;
+            TS_ASSERT(data.size() == tm.deserializeFrom(data.data(), data.size()));
+            TS_ASSERT(tm.getField1() == 123);
+            TS_ASSERT(tm.getField2() == -123);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
 };
 
 #endif /*CORE_PROTOMESSAGESTESTSUITE_H_*/
@@ -29,6 +29,8 @@
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/serialization/Deserializer.h"     // for Deserializer
+#include "opendavinci/odcore/serialization/ProtoDeserializer.h"
+#include "opendavinci/odcore/serialization/ProtoSerializer.h"
 #include "opendavinci/odcore/serialization/ProtoDeserializerVisitor.h"
 #include "opendavinci/odcore/serialization/ProtoSerializerVisitor.h"
 #include "opendavinci/odcore/serialization/SerializationFactory.h"  // for SerializationFactory
@@ -417,6 +419,40 @@ class ProtoTest : public CxxTest::TestSuite {
             TS_ASSERT(vcRef.getLeftFlashingLights() == vcRef2.getLeftFlashingLights());
             TS_ASSERT(vcRef.getRightFlashingLights() == vcRef2.getRightFlashingLights());
         }
+
+        void testDeserializationFromMemory() {
+            stringstream out;
+            {
+                ProtoSerializer s;
+                s.write(1, string("first"));
+                s.write(2, static_cast<int32_t>(-42));
+                s.write(1, string("second"));
+                s.write(3, 2.5f);
+                s.getSerializedData(out);
+            }
+            const string data = out.str();
+
+            // Fields are read in arbitrary order directly from memory;
+            // duplicate fields are resolved as the last one encoded.
+            ProtoDeserializer d(data.data(), data.size());
+            float f = 0;
+            int32_t i = 0;
+            string str;
+            d.read(3, f);
+            d.read(2, i);
+            d.read(1, str);
+            TS_ASSERT_DELTA(f, 2.5, 1e-5);
+            TS_ASSERT(i == -42);
+            TS_ASSERT(str == "second");
+
+            // A missing field leaves the value untouched while a field
+            // with a different wire type is read as 0.
+            uint32_t u = 7;
+            d.read(4, u);
+            TS_ASSERT(u == 7);
+            d.read(1, i);
+            TS_ASSERT(i == 0);
+        }
 };
 
 #endif /*CORE_PROTOTESTSUITE_H_*/
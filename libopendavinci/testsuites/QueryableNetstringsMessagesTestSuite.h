@@ -28,6 +28,7 @@
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/io/ReadOnlyStreamBuffer.h"
 #include "opendavinci/odcore/serialization/SerializationFactory.h"
 #include "opendavinci/odcore/serialization/QueryableNetstringsDeserializer.h"
 #include "opendavinci/odcore/serialization/QueryableNetstringsSerializer.h"
@@ -3326,6 +3327,51 @@ class QueryableNetstringsSerializerMessageTest : public CxxTest::TestSuite {
 
         ///////////////////////////////////////////////////////////////////////
 
+        void testLargeFieldsAndBorrowedBuffer() {
+            const string largeValue(100000, 'x');
+            const uint64_t largeNumber = static_cast<uint64_t>(0xFFFFFFFF) << 8;
+
+            stringstream out;
+            {
+                std::shared_ptr<Serializer> s = SerializationFactory::getInstance().getQueryableNetstringsSerializer(out);
+                s->write(1, largeValue);
+                s->write(2, static_cast<int32_t>(-12345));
+                s->write(3, largeNumber);
+                s->write(4, -1.5);
+            }
+
+            // Read from a regular stream.
+            {
+                std::shared_ptr<Deserializer> d = SerializationFactory::getInstance().getQueryableNetstringsDeserializer(out);
+                string s;
+                int32_t i = 0;
+                uint64_t u = 0;
+                double v = 0;
+                d->read(4, v);
+                d->read(3, u);
+                d->read(2, i);
+                d->read(1, s);
+                TS_ASSERT(s == largeValue);
+                TS_ASSERT(i == -12345);
+                TS_ASSERT(u == largeNumber);
+                TS_ASSERT_DELTA(v, -1.5, 1e-5);
+            }
+
+            // Read from memory without copying the payload.
+            {
+                const string data = out.str();
+                odcore::io::ReadOnlyStreamBuffer buffer(data.data(), data.size());
+                istream in(&buffer);
+                std::shared_ptr<Deserializer> d = SerializationFactory::getInstance().getQueryableNetstringsDeserializer(in);
+                string s;
+                int32_t i = 0;
+                d->read(1, s);
+                d->read(2, i);
+                TS_ASSERT(s == largeValue);
+                TS_ASSERT(i == -12345);
+                TS_ASSERT(in.tellg() == static_cast<streampos>(data.size()));
+            }
+        }
 };
 
 #endif /*CORE_QUERYABLENETSTRINGSABCFMESSAGESTESTSUITE_H_*/
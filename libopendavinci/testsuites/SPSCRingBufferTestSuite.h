@@ -0,0 +1,84 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_SPSCRINGBUFFERTESTSUITE_H_
+#define CORE_SPSCRINGBUFFERTESTSUITE_H_
+
+#include <memory>
+#include <utility>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/base/SPSCRingBuffer.h"
+
+using namespace std;
+using namespace odcore::base;
+
+class SPSCRingBufferTest : public CxxTest::TestSuite {
+    public:
+        void testPushAndPopInOrder() {
+            SPSCRingBuffer<int> ring(3);
+            TS_ASSERT(ring.getCapacity() == 4);
+            TS_ASSERT(ring.isEmpty());
+            TS_ASSERT(ring.front() == NULL);
+
+            for (int i = 0; i < 4; i++) {
+                TS_ASSERT(ring.push(i));
+            }
+            TS_ASSERT(!ring.push(4));
+            TS_ASSERT(ring.getSize() == 4);
+
+            for (int i = 0; i < 4; i++) {
+                TS_ASSERT(ring.front() != NULL);
+                TS_ASSERT(*ring.front() == i);
+                ring.pop();
+            }
+            TS_ASSERT(ring.isEmpty());
+        }
+
+        void testPushMovesValue() {
+            SPSCRingBuffer<std::shared_ptr<int> > ring(2);
+
+            std::shared_ptr<int> value = std::make_shared<int>(42);
+            std::shared_ptr<int> moved = value;
+            TS_ASSERT(ring.push(std::move(moved)));
+            TS_ASSERT(!moved.get());
+            TS_ASSERT(value.use_count() == 2);
+
+            // A value that does not fit is not moved.
+            std::shared_ptr<int> tooMany = value;
+            TS_ASSERT(ring.push(value));
+            TS_ASSERT(!ring.push(std::move(tooMany)));
+            TS_ASSERT(tooMany.get() == value.get());
+        }
+
+        void testPopReleasesPayload() {
+            SPSCRingBuffer<std::shared_ptr<int> > ring(2);
+
+            std::shared_ptr<int> value = std::make_shared<int>(42);
+            TS_ASSERT(ring.push(value));
+            TS_ASSERT(value.use_count() == 2);
+
+            TS_ASSERT(**ring.front() == 42);
+            ring.pop();
+            TS_ASSERT(value.use_count() == 1);
+        }
+};
+
+#endif /*CORE_SPSCRINGBUFFERTESTSUITE_H_*/
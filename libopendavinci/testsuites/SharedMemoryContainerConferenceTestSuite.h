@@ -0,0 +1,311 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_SHAREDMEMORYCONTAINERCONFERENCETESTSUITE_H_
+#define CORE_SHAREDMEMORYCONTAINERCONFERENCETESTSUITE_H_
+
+#include <memory>
+#include <string>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/FIFOQueue.h"
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/io/conference/ContainerConference.h"
+#include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+#include "opendavinci/odcore/io/conference/SharedMemoryContainerConference.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::io::conference;
+
+class SharedMemoryContainerConferenceTestListener : public ContainerListener {
+    public:
+        SharedMemoryContainerConferenceTestListener() :
+            m_fifo() {}
+
+        virtual ~SharedMemoryContainerConferenceTestListener() {}
+
+        virtual void nextContainer(Container &c) {
+            m_fifo.add(c);
+        }
+
+        FIFOQueue& getFIFO() {
+            return m_fifo;
+        }
+
+        bool waitForContainers(const uint32_t &numberOfContainers) {
+            for (uint32_t i = 0; (i < 200) && (m_fifo.getSize() < numberOfContainers); i++) {
+                Thread::usleepFor(5000);
+            }
+            return (m_fifo.getSize() >= numberOfContainers);
+        }
+
+    private:
+        FIFOQueue m_fifo;
+};
+
+class SharedMemoryContainerConferenceTestBlockingListener : public ContainerListener {
+    public:
+        SharedMemoryContainerConferenceTestBlockingListener() :
+            m_mutex(),
+            m_released(false),
+            m_numberOfContainers(0),
+            m_lastSeconds(-1) {}
+
+        virtual ~SharedMemoryContainerConferenceTestBlockingListener() {}
+
+        virtual void nextContainer(Container &c) {
+            while (!isReleased()) {
+                Thread::usleepFor(1000);
+            }
+            Lock l(m_mutex);
+            m_numberOfContainers++;
+            m_lastSeconds = c.getData<TimeStamp>().getSeconds();
+        }
+
+        void release() {
+            Lock l(m_mutex);
+            m_released = true;
+        }
+
+        bool isReleased() {
+            Lock l(m_mutex);
+            return m_released;
+        }
+
+        uint64_t getNumberOfContainers() {
+            Lock l(m_mutex);
+            return m_numberOfContainers;
+        }
+
+        int32_t getLastSeconds() {
+            Lock l(m_mutex);
+            return m_lastSeconds;
+        }
+
+    private:
+        Mutex m_mutex;
+        bool m_released;
+        uint64_t m_numberOfContainers;
+        int32_t m_lastSeconds;
+};
+
+class SharedMemoryContainerConferenceTest : public CxxTest::TestSuite {
+    public:
+        void testFactoryCreatesSharedMemoryConference() {
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            TS_ASSERT(ccf.getTransport() == ContainerConferenceFactory::UDP_MULTICAST);
+
+            ccf.setTransport(ContainerConferenceFactory::SHARED_MEMORY);
+            std::shared_ptr<ContainerConference> conference = ccf.getContainerConference("225.0.0.201", 12176);
+            ccf.setTransport(ContainerConferenceFactory::UDP_MULTICAST);
+
+            TS_ASSERT(conference.get());
+            TS_ASSERT(NULL != dynamic_cast<SharedMemoryContainerConference*>(conference.get()));
+        }
+
+        void testSendReceive() {
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ccf.setTransport(ContainerConferenceFactory::SHARED_MEMORY);
+            std::shared_ptr<ContainerConference> sender = ccf.getContainerConference("225.0.0.202", 12177);
+            std::shared_ptr<ContainerConference> receiver = ccf.getContainerConference("225.0.0.202", 12177);
+            std::shared_ptr<ContainerConference> otherGroup = ccf.getContainerConference("225.0.0.203", 12177);
+            ccf.setTransport(ContainerConferenceFactory::UDP_MULTICAST);
+
+            SharedMemoryContainerConferenceTestListener senderListener;
+            SharedMemoryContainerConferenceTestListener receiverListener;
+            SharedMemoryContainerConferenceTestListener otherGroupListener;
+            sender->setContainerListener(&senderListener);
+            receiver->setContainerListener(&receiverListener);
+            otherGroup->setContainerListener(&otherGroupListener);
+            sender->setSenderStamp(7);
+
+            const uint32_t NUMBER_OF_CONTAINERS = 100;
+            for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                TimeStamp ts(i, 1);
+                Container c(ts);
+                sender->send(c);
+            }
+
+            TS_ASSERT(receiverListener.waitForContainers(NUMBER_OF_CONTAINERS));
+            TS_ASSERT(receiverListener.getFIFO().getSize() == NUMBER_OF_CONTAINERS);
+            for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                Container c = receiverListener.getFIFO().leave();
+                TS_ASSERT(c.getDataType() == TimeStamp::ID());
+                TS_ASSERT(c.getSenderStamp() == 7);
+                TS_ASSERT(c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+                TS_ASSERT(c.getReceivedTimeStamp().toMicroseconds() > 0);
+            }
+
+            // Containers are neither delivered to the sender itself nor to other conferences.
+            TS_ASSERT(senderListener.getFIFO().getSize() == 0);
+            TS_ASSERT(otherGroupListener.getFIFO().getSize() == 0);
+
+            sender->setContainerListener(NULL);
+            receiver->setContainerListener(NULL);
+            otherGroup->setContainerListener(NULL);
+        }
+
+        void testSubscriptions() {
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ccf.setTransport(ContainerConferenceFactory::SHARED_MEMORY);
+            std::shared_ptr<ContainerConference> sender = ccf.getContainerConference("225.0.0.205", 12179);
+            std::shared_ptr<ContainerConference> receiver = ccf.getContainerConference("225.0.0.205", 12179);
+            ccf.setTransport(ContainerConferenceFactory::UDP_MULTICAST);
+
+            // Without subscriptions, everything is accepted.
+            TS_ASSERT(receiver->isSubscribedTo(TimeStamp::ID(), 1));
+
+            receiver->addSubscription(TimeStamp::ID(), 7);
+            receiver->addSubscription(TimeStamp::ID(), 9);
+            TS_ASSERT(receiver->isSubscribedTo(TimeStamp::ID(), 7));
+            TS_ASSERT(receiver->isSubscribedTo(TimeStamp::ID(), 9));
+            TS_ASSERT(!receiver->isSubscribedTo(TimeStamp::ID(), 8));
+            TS_ASSERT(!receiver->isSubscribedTo(42, 7));
+
+            SharedMemoryContainerConferenceTestListener listener;
+            receiver->setContainerListener(&listener);
+
+            const TimeStamp ts(1, 2);
+            Container wrongSenderStamp(ts);
+            wrongSenderStamp.setSenderStamp(8);
+            sender->send(wrongSenderStamp);
+
+            Container wrongDataType(ts, 42);
+            wrongDataType.setSenderStamp(7);
+            sender->send(wrongDataType);
+
+            Container subscribed(ts);
+            subscribed.setSenderStamp(7);
+            sender->send(subscribed);
+
+            TS_ASSERT(listener.waitForContainers(1));
+            Thread::usleepFor(50000);
+            TS_ASSERT(listener.getFIFO().getSize() == 1);
+            Container c = listener.getFIFO().leave();
+            TS_ASSERT(c.getDataType() == TimeStamp::ID());
+            TS_ASSERT(c.getSenderStamp() == 7);
+
+            // Subscribing to all sender stamps of a data type.
+            receiver->addSubscription(42);
+            TS_ASSERT(receiver->isSubscribedTo(42, 1));
+            receiver->addSubscription(42, 7);
+            TS_ASSERT(receiver->isSubscribedTo(42, 1));
+
+            receiver->clearSubscriptions();
+            TS_ASSERT(receiver->isSubscribedTo(43, 1));
+
+            receiver->setContainerListener(NULL);
+        }
+
+        void testSlowReceiverLosesOverwrittenContainers() {
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ccf.setTransport(ContainerConferenceFactory::SHARED_MEMORY);
+            std::shared_ptr<ContainerConference> sender = ccf.getContainerConference("225.0.0.204", 12178);
+            std::shared_ptr<ContainerConference> receiver = ccf.getContainerConference("225.0.0.204", 12178);
+            ccf.setTransport(ContainerConferenceFactory::UDP_MULTICAST);
+
+            SharedMemoryContainerConference *shmReceiver = dynamic_cast<SharedMemoryContainerConference*>(receiver.get());
+            TS_ASSERT(NULL != shmReceiver);
+
+            // The listener blocks on the first container until the ring has wrapped around.
+            SharedMemoryContainerConferenceTestBlockingListener listener;
+            receiver->setContainerListener(&listener);
+
+            const uint32_t NUMBER_OF_CONTAINERS = 3 * SharedMemoryContainerConference::NUMBER_OF_SLOTS;
+            for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                sender->send(c);
+            }
+            listener.release();
+
+            // Wait until the last container has been delivered.
+            for (uint32_t i = 0; (i < 200) && (listener.getLastSeconds() != static_cast<int32_t>(NUMBER_OF_CONTAINERS - 1)); i++) {
+                Thread::usleepFor(5000);
+            }
+            receiver->setContainerListener(NULL);
+
+            TS_ASSERT(listener.getLastSeconds() == static_cast<int32_t>(NUMBER_OF_CONTAINERS - 1));
+            TS_ASSERT(shmReceiver->getNumberOfLostContainers() > 0);
+            TS_ASSERT(listener.getNumberOfContainers() + shmReceiver->getNumberOfLostContainers() == NUMBER_OF_CONTAINERS);
+        }
+
+        void testStalledSenderIsNotOvertaken() {
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ccf.setTransport(ContainerConferenceFactory::SHARED_MEMORY);
+            std::shared_ptr<ContainerConference> sender = ccf.getContainerConference("225.0.0.206", 12180);
+            std::shared_ptr<ContainerConference> receiver = ccf.getContainerConference("225.0.0.206", 12180);
+            ccf.setTransport(ContainerConferenceFactory::UDP_MULTICAST);
+
+            SharedMemoryContainerConference *shmSender = dynamic_cast<SharedMemoryContainerConference*>(sender.get());
+            SharedMemoryContainerConference *shmReceiver = dynamic_cast<SharedMemoryContainerConference*>(receiver.get());
+            TS_ASSERT(NULL != shmSender);
+            TS_ASSERT(NULL != shmReceiver);
+
+            SharedMemoryContainerConferenceTestListener listener;
+            receiver->setContainerListener(&listener);
+
+            // Stall a sender after claiming its slot.
+            uint64_t stalled = 0;
+            TS_ASSERT(shmSender->claimSlot(stalled));
+
+            // The container that would reuse the stalled slot is dropped instead of overtaking it.
+            const uint32_t NUMBER_OF_CONTAINERS = SharedMemoryContainerConference::NUMBER_OF_SLOTS;
+            for (uint32_t i = 1; i <= NUMBER_OF_CONTAINERS; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                sender->send(c);
+            }
+            TS_ASSERT(shmSender->getNumberOfDroppedContainers() == 1);
+
+            // Receivers skip the stalled and the dropped container once the ring has wrapped around.
+            TS_ASSERT(listener.waitForContainers(NUMBER_OF_CONTAINERS - 1));
+
+            // The stalled sender still owns its slot.
+            TS_ASSERT(shmSender->publishSlot(stalled));
+
+            TimeStamp ts(NUMBER_OF_CONTAINERS + 1, 0);
+            Container c(ts);
+            sender->send(c);
+
+            TS_ASSERT(listener.waitForContainers(NUMBER_OF_CONTAINERS));
+            Thread::usleepFor(50000);
+            receiver->setContainerListener(NULL);
+
+            // Neither the stalled nor the dropped container is delivered.
+            TS_ASSERT(listener.getFIFO().getSize() == NUMBER_OF_CONTAINERS);
+            for (uint32_t i = 1; i < NUMBER_OF_CONTAINERS; i++) {
+                TS_ASSERT(listener.getFIFO().leave().getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+            }
+            TS_ASSERT(listener.getFIFO().leave().getData<TimeStamp>().getSeconds() == static_cast<int32_t>(NUMBER_OF_CONTAINERS + 1));
+            TS_ASSERT(shmReceiver->getNumberOfLostContainers() == 2);
+            TS_ASSERT(shmSender->getNumberOfDroppedContainers() == 1);
+        }
+};
+
+#endif /*CORE_SHAREDMEMORYCONTAINERCONFERENCETESTSUITE_H_*/
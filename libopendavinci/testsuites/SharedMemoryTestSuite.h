@@ -31,6 +31,8 @@
 #include "opendavinci/odcore/serialization/Serializable.h"     // for operator<<, operator>>
 #include "opendavinci/odcore/wrapper/SharedMemory.h"  // for SharedMemory
 #include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"  // for SharedMemoryFactory
+#include "opendavinci/odcore/wrapper/SharedMemoryOptions.h"  // for SharedMemoryOptions
+#include "opendavinci/odcore/wrapper/SharedMemoryRing.h"  // for SharedMemoryRing
 #include "opendavinci/generated/odcore/data/SharedData.h"  // for SharedData
 
 using namespace std;
@@ -128,6 +130,122 @@ class SharedMemoryTest : public CxxTest::TestSuite {
             }
         }
 
+        void testSharedMemoryRing() {
+            std::shared_ptr<odcore::wrapper::SharedMemoryRing> ringServer = odcore::wrapper::SharedMemoryFactory::createSharedMemoryRing("SharedMemoryRingTest", 10);
+            TS_ASSERT(ringServer->isValid());
+            TS_ASSERT(ringServer->getNumberOfSlots() == 3);
+            TS_ASSERT(ringServer->getSlotSize() == 10);
+            TS_ASSERT(ringServer->getLatestFrameID() == 0);
+            TS_ASSERT(ringServer->getFrame(1) == NULL);
+
+            std::shared_ptr<odcore::wrapper::SharedMemoryRing> ringClient = odcore::wrapper::SharedMemoryFactory::attachToSharedMemoryRing("SharedMemoryRingTest");
+            TS_ASSERT(ringClient->isValid());
+            TS_ASSERT(ringClient->getNumberOfSlots() == 3);
+            TS_ASSERT(ringClient->getSlotSize() == 10);
+
+            for (uint32_t frame = 1; frame <= 4; frame++) {
+                char *dest = ringServer->beginWrite();
+                TS_ASSERT(dest != NULL);
+                for (uint32_t i = 0; i < ringServer->getSlotSize(); i++) {
+                    dest[i] = static_cast<char>('A' + frame + i);
+                }
+
+                // A frame being written is not available.
+                TS_ASSERT(ringClient->getFrame(frame) == NULL);
+                TS_ASSERT(ringClient->getLatestFrameID() == frame - 1);
+
+                TS_ASSERT(ringServer->endWrite() == frame);
+                TS_ASSERT(ringServer->getSlot(frame) == (frame - 1) % 3);
+
+                const uint64_t frameID = ringClient->getLatestFrameID();
+                TS_ASSERT(frameID == frame);
+                const char *src = ringClient->getFrame(frameID);
+                TS_ASSERT(src != NULL);
+                for (uint32_t i = 0; i < ringClient->getSlotSize(); i++) {
+                    TS_ASSERT(src[i] == static_cast<char>('A' + frame + i));
+                }
+                TS_ASSERT(ringClient->isFrameUnchanged(frameID));
+            }
+
+            // Frame 1 was overwritten by frame 4.
+            TS_ASSERT(ringClient->getFrame(1) == NULL);
+            TS_ASSERT(!ringClient->isFrameUnchanged(1));
+            TS_ASSERT(ringClient->getFrame(2) != NULL);
+
+            // Starting to write frame 5 invalidates frame 2 in place.
+            TS_ASSERT(ringClient->isFrameUnchanged(2));
+            ringServer->beginWrite();
+            TS_ASSERT(!ringClient->isFrameUnchanged(2));
+            TS_ASSERT(ringClient->getLatestFrameID() == 4);
+            TS_ASSERT(ringClient->getFrame(4) != NULL);
+            TS_ASSERT(ringServer->endWrite() == 5);
+            TS_ASSERT(ringServer->endWrite() == 0);
+        }
+
+        void testSharedMemoryRingAttachToPlainSharedMemory() {
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer = odcore::wrapper::SharedMemoryFactory::createSharedMemory("SharedMemoryRingTest2", 1024);
+            TS_ASSERT(memServer->isValid());
+
+            std::shared_ptr<odcore::wrapper::SharedMemoryRing> ringClient = odcore::wrapper::SharedMemoryFactory::attachToSharedMemoryRing("SharedMemoryRingTest2");
+            TS_ASSERT(!ringClient->isValid());
+            TS_ASSERT(ringClient->beginWrite() == NULL);
+            TS_ASSERT(ringClient->getLatestFrameID() == 0);
+        }
+
+        void testMemoryMappedSharedMemory() {
+            odcore::wrapper::SharedMemoryOptions options;
+            options.m_memoryMapped = true;
+            options.m_hugePages = true;
+            options.m_populate = true;
+            options.m_numaNode = 0;
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer = odcore::wrapper::SharedMemoryFactory::createSharedMemoryWithOptions("SharedMemoryTest3", 10, options);
+            TS_ASSERT(memServer->isValid());
+            TS_ASSERT(memServer->getSize() == 10);
+            {
+                odcore::base::Lock l(memServer);
+                for (uint32_t i = 0; i < memServer->getSize(); i++) {
+                    *(((char*)(memServer->getSharedMemory())) + i) = ('A' + i);
+                }
+            }
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memClient = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedMemoryTest3");
+            TS_ASSERT(memClient->isValid());
+            TS_ASSERT(memClient->getSize() == 10);
+            TS_ASSERT(memClient->getName() == "SharedMemoryTest3");
+            {
+                odcore::base::Lock l(memClient);
+                for (uint32_t i = 0; i < memClient->getSize(); i++) {
+                    char c = *(((char*)(memClient->getSharedMemory())) + i);
+                    TS_ASSERT(c == (char)('A' + i));
+                }
+            }
+
+            // Both processes' views share the same memory.
+            *((char*)(memClient->getSharedMemory())) = 'Z';
+            TS_ASSERT(*((char*)(memServer->getSharedMemory())) == 'Z');
+        }
+
+        void testMemoryMappedSharedMemoryWithLongNames() {
+            odcore::wrapper::SharedMemoryOptions options;
+            options.m_memoryMapped = true;
+
+            const string name1 = string(256, 'A') + "1";
+            const string name2 = string(256, 'A') + "2";
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer1 = odcore::wrapper::SharedMemoryFactory::createSharedMemoryWithOptions(name1, 10, options);
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer2 = odcore::wrapper::SharedMemoryFactory::createSharedMemoryWithOptions(name2, 20, options);
+            TS_ASSERT(memServer1->isValid());
+            TS_ASSERT(memServer2->isValid());
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memClient1 = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(name1);
+            std::shared_ptr<odcore::wrapper::SharedMemory> memClient2 = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(name2);
+            TS_ASSERT(memClient1->isValid());
+            TS_ASSERT(memClient2->isValid());
+            TS_ASSERT(memClient1->getSize() == 10);
+            TS_ASSERT(memClient2->getSize() == 20);
+        }
+
 };
 
 #endif /*CORE_SHAREDMEMORYTESTSUITE_H_*/
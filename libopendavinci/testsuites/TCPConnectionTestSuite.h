@@ -21,11 +21,17 @@
 #define CORE_WRAPPER_TCPCONNECTIONTESTSUITE_H_
 
 #include <memory>                       // for unique_ptr, etc
+#include <sstream>                      // for stringstream
 #include <string>                       // for string
+#include <vector>                       // for vector
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/io/Connection.h"
+#include "opendavinci/odcore/io/StringListener.h"
 #include "opendavinci/odcore/io/tcp/TCPAcceptor.h"
 #include "opendavinci/odcore/wrapper/NetworkLibraryProducts.h"
 #include "mocks/ConnectionListenerMock.h"
@@ -33,6 +39,7 @@
 #include "mocks/TCPAcceptorListenerMock.h"
 
 #ifndef WIN32
+    #include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
     #include "opendavinci/odcore/wrapper/POSIX/POSIXTCPFactoryWorker.h"
 #endif
 #ifdef WIN32
@@ -47,6 +54,34 @@ using namespace std;
 using namespace odcore;
 using namespace odcore::base;
 
+class TCPConnectionTestStringCollector : public odcore::io::StringListener {
+    public:
+        TCPConnectionTestStringCollector() :
+            m_mutex(),
+            m_strings() {}
+
+        virtual void nextString(const string &s) {
+            Lock l(m_mutex);
+            m_strings.push_back(s);
+        }
+
+        vector<string> getStrings() {
+            Lock l(m_mutex);
+            return m_strings;
+        }
+
+        bool waitForStrings(const uint32_t &numberOfStrings) {
+            for (uint32_t i = 0; (i < 200) && (getStrings().size() < numberOfStrings); i++) {
+                Thread::usleepFor(10000);
+            }
+            return (getStrings().size() >= numberOfStrings);
+        }
+
+    private:
+        Mutex m_mutex;
+        vector<string> m_strings;
+};
+
 template <typename worker> struct TCPConnectionTests
 {
     static void transferTest()
@@ -100,6 +135,49 @@ template <typename worker> struct TCPConnectionTests
         stmAcceptedConnection.CALLWAITER_nextString.reset();
     }
 
+    static void burstTest()
+    {
+        mocks::TCPAcceptorListenerMock am;
+
+        unique_ptr<odcore::io::tcp::TCPAcceptor> acceptor(worker::createTCPAcceptor(20006));
+        acceptor->setAcceptorListener(&am);
+        acceptor->start();
+
+        unique_ptr<odcore::io::tcp::TCPConnection> connection(worker::createTCPConnectionTo("127.0.0.1", 20006));
+        connection->start();
+
+        TS_ASSERT(am.CALLWAITER_onNewConnection.wait());
+        TCPConnectionTestStringCollector collector;
+        am.getConnection()->setStringListener(&collector);
+        am.getConnection()->start();
+
+        // Many data packets of different sizes arrive in the right order.
+        vector<string> listOfData;
+        uint64_t numberOfBytes = 0;
+        for (uint32_t i = 0; i < 2000; i++) {
+            stringstream sstr;
+            sstr << "Data packet " << i << ":" << string(i % 97, 'x');
+            listOfData.push_back(sstr.str());
+            numberOfBytes += sizeof(uint32_t) + sstr.str().length();
+        }
+        for (uint32_t i = 0; i < listOfData.size(); i++) {
+            connection->send(listOfData[i]);
+        }
+        connection->send("Last data packet");
+        numberOfBytes += sizeof(uint32_t) + string("Last data packet").length();
+
+        TS_ASSERT(collector.waitForStrings(listOfData.size() + 1));
+        const vector<string> receivedData = collector.getStrings();
+        TS_ASSERT(receivedData.size() == listOfData.size() + 1);
+        for (uint32_t i = 0; (i < listOfData.size()) && (i < receivedData.size()); i++) {
+            TS_ASSERT(receivedData[i] == listOfData[i]);
+        }
+        TS_ASSERT(receivedData.back() == "Last data packet");
+        TS_ASSERT(connection->getNumberOfSentBytes() == numberOfBytes);
+
+        am.getConnection()->setStringListener(NULL);
+    }
+
     static void errorTest() {
         bool failed = true;
         try {
@@ -198,6 +276,91 @@ class TCPConnectionTestSuite  : public CxxTest::TestSuite
                 >::errorTest();
             #endif
         }
+
+        void testBurst()
+        {
+            #ifndef WIN32
+                clog << endl << "TCPConnectionTestSuite::testBurst using NetworkLibraryPosix" << endl;
+                TCPConnectionTests
+                <
+                     odcore::wrapper::TCPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>
+                >::burstTest();
+            #endif
+        }
+
+        void testTransferAndErrorUsingReactor()
+        {
+            #ifdef __linux__
+                clog << endl << "TCPConnectionTestSuite::testTransferAndErrorUsingReactor using NetworkLibraryPosix" << endl;
+                odcore::wrapper::POSIX::POSIXReactor &reactor = odcore::wrapper::POSIX::POSIXReactor::getInstance();
+                TS_ASSERT(reactor.enable(2));
+                TS_ASSERT(reactor.isEnabled());
+
+                TCPConnectionTests
+                <
+                     odcore::wrapper::TCPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>
+                >::transferTest();
+
+                TCPConnectionTests
+                <
+                     odcore::wrapper::TCPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>
+                >::errorTest();
+
+                reactor.disable();
+                TS_ASSERT(!reactor.isEnabled());
+            #endif
+        }
+
+        void testTransferAfterDisablingReactor()
+        {
+            #ifdef __linux__
+                clog << endl << "TCPConnectionTestSuite::testTransferAfterDisablingReactor using NetworkLibraryPosix" << endl;
+                odcore::wrapper::POSIX::POSIXReactor &reactor = odcore::wrapper::POSIX::POSIXReactor::getInstance();
+                TS_ASSERT(reactor.enable(2));
+
+                mocks::TCPAcceptorListenerMock am;
+                unique_ptr<odcore::io::tcp::TCPAcceptor> acceptor(odcore::wrapper::TCPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createTCPAcceptor(20007));
+                acceptor->setAcceptorListener(&am);
+                acceptor->start();
+
+                unique_ptr<odcore::io::tcp::TCPConnection> connection(odcore::wrapper::TCPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createTCPConnectionTo("127.0.0.1", 20007));
+                connection->start();
+
+                TS_ASSERT(am.CALLWAITER_onNewConnection.wait());
+                std::shared_ptr<odcore::io::tcp::TCPConnection> accepted = am.getConnection();
+                TCPConnectionTestStringCollector collectorAccepted;
+                accepted->setStringListener(&collectorAccepted);
+                accepted->start();
+
+                TCPConnectionTestStringCollector collectorConnected;
+                connection->setStringListener(&collectorConnected);
+
+                connection->send("BEFORE DISABLING");
+                TS_ASSERT(collectorAccepted.waitForStrings(1));
+
+                // All sockets continue with their own threads.
+                reactor.disable();
+                TS_ASSERT(!reactor.isEnabled());
+
+                connection->send("AFTER DISABLING");
+                TS_ASSERT(collectorAccepted.waitForStrings(2));
+                TS_ASSERT(collectorAccepted.getStrings().size() == 2);
+                TS_ASSERT(collectorAccepted.getStrings().back() == "AFTER DISABLING");
+
+                accepted->send("AFTER DISABLING");
+                TS_ASSERT(collectorConnected.waitForStrings(1));
+                TS_ASSERT(collectorConnected.getStrings().size() == 1);
+
+                // The acceptor still accepts new connections.
+                am.CALLWAITER_onNewConnection.reset();
+                unique_ptr<odcore::io::tcp::TCPConnection> connection2(odcore::wrapper::TCPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createTCPConnectionTo("127.0.0.1", 20007));
+                connection2->start();
+                TS_ASSERT(am.CALLWAITER_onNewConnection.wait());
+
+                accepted->setStringListener(NULL);
+                connection->setStringListener(NULL);
+            #endif
+        }
 };
 
 #endif /*CORE_WRAPPER_TCPCONNECTIONTESTSUITE_H_*/
@@ -85,6 +85,28 @@ class TimeStampTest : public CxxTest::TestSuite {
             TS_ASSERT(ts2.getMinute() == 42);
             TS_ASSERT(ts2.getSecond() == 54);
         }
+
+        void testReadableFieldsFollowChanges() {
+            TimeStamp ts(0, 0);
+            ts.setSeconds(1240926174);
+
+            TS_ASSERT(ts.getDay() == 28);
+            TS_ASSERT(ts.getMonth() == 4);
+            TS_ASSERT(ts.getYear() == 2009);
+            TS_ASSERT(ts.getMinute() == 42);
+            TS_ASSERT(ts.getSecond() == 54);
+        }
+
+        void testNow() {
+            TimeStamp before;
+            TimeStamp now = TimeStamp::now();
+            TS_ASSERT(now.toMicroseconds() > 0);
+            TS_ASSERT(now >= before);
+
+            TimeStamp monotonic1 = TimeStamp::nowMonotonic();
+            TimeStamp monotonic2 = TimeStamp::nowMonotonic();
+            TS_ASSERT(monotonic2 >= monotonic1);
+        }
 };
 
 #endif /*CORE_TIMESTAMPTESTSUITE_H_*/
@@ -22,11 +22,19 @@
 
 #include <iostream>                     // for endl, operator<<, etc
 #include <memory>
+#include <sstream>
 #include <string>                       // for string
+#include <vector>
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/io/PacketListener.h"
+#include "opendavinci/generated/odcore/data/Packet.h"
 #include "mocks/StringListenerMock.h"
 
 namespace odcore { namespace io { namespace udp { class UDPReceiver; } } }
@@ -70,6 +78,57 @@ using namespace std;
         }
     };
 
+    class UDPTestPacketCollector : public odcore::io::PacketListener {
+        public:
+            UDPTestPacketCollector() :
+                m_mutex(),
+                m_packets() {}
+
+            virtual void nextPacket(const odcore::data::Packet &p) {
+                odcore::base::Lock l(m_mutex);
+                m_packets.push_back(p);
+            }
+
+            vector<odcore::data::Packet> getPackets() {
+                odcore::base::Lock l(m_mutex);
+                return m_packets;
+            }
+
+        private:
+            odcore::base::Mutex m_mutex;
+            vector<odcore::data::Packet> m_packets;
+    };
+
+    struct UDPBurstTestPOSIX
+    {
+        static vector<odcore::data::Packet> test(const vector<string> &burst)
+        {
+            const string group = "225.0.0.14";
+            const uint32_t port = 4568;
+
+            std::shared_ptr<odcore::io::udp::UDPReceiver> receiver(
+                    odcore::wrapper::UDPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createUDPReceiver(group, port));
+
+            std::shared_ptr<odcore::io::udp::UDPSender> sender(
+                                odcore::wrapper::UDPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createUDPSender(group, port));
+
+            UDPTestPacketCollector collector;
+            receiver->setSynchronousPacketListener(&collector);
+            receiver->start();
+
+            sender->sendBurst(burst);
+
+            for (uint32_t i = 0; (i < 200) && (collector.getPackets().size() < burst.size()); i++) {
+                odcore::base::Thread::usleepFor(5000);
+            }
+
+            receiver->setSynchronousPacketListener(NULL);
+            receiver->stop();
+
+            return collector.getPackets();
+        }
+    };
+
 #endif
 
 #ifdef WIN32
@@ -128,6 +187,28 @@ using namespace std;
                 TS_ASSERT( mock.CALLWAITER_nextString.wasCalled() );
                 TS_ASSERT( mock.correctCalled() );
             }
+
+            void testBurstExchange()
+            {
+                #ifndef WIN32
+                vector<string> burst;
+                for (uint32_t i = 0; i < 100; i++) {
+                    stringstream sstr;
+                    sstr << "Datagram " << i;
+                    burst.push_back(sstr.str());
+                }
+
+                const odcore::data::TimeStamp before;
+                vector<odcore::data::Packet> packets = UDPBurstTestPOSIX::test(burst);
+
+                TS_ASSERT(packets.size() == burst.size());
+                for (uint32_t i = 0; (i < packets.size()) && (i < burst.size()); i++) {
+                    TS_ASSERT(packets.at(i).getData() == burst.at(i));
+                    TS_ASSERT(odcore::data::TimeStamp(packets.at(i).getReceived()).toMicroseconds() >= before.toMicroseconds());
+                    TS_ASSERT(!packets.at(i).getSender().empty());
+                }
+                #endif
+            }
     };
 
 
@@ -0,0 +1,143 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_VARINTCODECBENCHMARKTESTSUITE_H_
+#define CORE_VARINTCODECBENCHMARKTESTSUITE_H_
+
+#include <iostream>                     // for clog, endl
+#include <sstream>                      // for stringstream
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
+
+using namespace std;
+using namespace odcore::data;
+using namespace odcore::serialization;
+
+/**
+ * Reference implementation of the former byte-wise stream encoding.
+ */
+uint8_t encodeVarIntUsingStreams(ostream &out, uint64_t value) {
+    uint8_t size = 1;
+    while (value > 0x7f) {
+        out.put(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+        size++;
+    }
+    out.put(static_cast<char>(value & 0x7f));
+    return size;
+}
+
+/**
+ * Reference implementation of the former byte-wise stream decoding.
+ */
+uint8_t decodeVarIntUsingStreams(istream &in, uint64_t &value) {
+    value = 0;
+    uint8_t size = 0;
+    while (in.good()) {
+        char c = 0;
+        in.read(&c, sizeof(char));
+        value |= static_cast<uint64_t>(c & 0x7f) << (0x7 * size++);
+        if ( !(c & 0x80) ) break;
+    }
+    return size;
+}
+
+class VarIntCodecBenchmarkTest : public CxxTest::TestSuite {
+    private:
+        void report(const string &name, const TimeStamp &before, const TimeStamp &after, const uint32_t &count) {
+            const double duration = (after - before).toMicroseconds() / (1000.0 * 1000.0);
+            clog << "[VarIntCodecBenchmarkTest]: " << name << ": " << (count / duration) / (1000.0 * 1000.0) << " million values/s" << endl;
+        }
+
+    public:
+        void testThroughput() {
+            // Distances of a point cloud: mostly small values with some larger ones.
+            const uint32_t COUNT = 1000000;
+            vector<uint32_t> values(COUNT);
+            for (uint32_t i = 0; i < COUNT; i++) {
+                values[i] = (i % 16 == 0) ? (i * 31) : (i % 100);
+            }
+            clog << endl;
+
+            // Former stream-based path.
+            stringstream sstr;
+            const TimeStamp streamsEncodeBefore;
+            for (uint32_t i = 0; i < COUNT; i++) {
+                encodeVarIntUsingStreams(sstr, values[i]);
+            }
+            const TimeStamp streamsEncodeAfter;
+            report("stream-based encode", streamsEncodeBefore, streamsEncodeAfter, COUNT);
+
+            vector<uint32_t> decodedStreams(COUNT);
+            const TimeStamp streamsDecodeBefore;
+            for (uint32_t i = 0; i < COUNT; i++) {
+                uint64_t value = 0;
+                decodeVarIntUsingStreams(sstr, value);
+                decodedStreams[i] = static_cast<uint32_t>(value);
+            }
+            const TimeStamp streamsDecodeAfter;
+            report("stream-based decode", streamsDecodeBefore, streamsDecodeAfter, COUNT);
+
+            // Single values from memory.
+            vector<char> buffer(COUNT * VarIntCodec::MAX_VARINT32_SIZE);
+            uint32_t size = 0;
+            const TimeStamp scalarEncodeBefore;
+            for (uint32_t i = 0; i < COUNT; i++) {
+                size += VarIntCodec::encode(&buffer[size], values[i]);
+            }
+            const TimeStamp scalarEncodeAfter;
+            report("VarIntCodec scalar encode", scalarEncodeBefore, scalarEncodeAfter, COUNT);
+            TS_ASSERT(sstr.str() == string(&buffer[0], size));
+
+            vector<uint32_t> decodedScalar(COUNT);
+            const char *p = &buffer[0];
+            const char *end = p + size;
+            const TimeStamp scalarDecodeBefore;
+            for (uint32_t i = 0; i < COUNT; i++) {
+                uint64_t value = 0;
+                p += VarIntCodec::decode(p, end, value);
+                decodedScalar[i] = static_cast<uint32_t>(value);
+            }
+            const TimeStamp scalarDecodeAfter;
+            report("VarIntCodec scalar decode", scalarDecodeBefore, scalarDecodeAfter, COUNT);
+
+            // Arrays from memory.
+            const TimeStamp bulkEncodeBefore;
+            const uint32_t bulkSize = VarIntCodec::encode(&buffer[0], &values[0], COUNT);
+            const TimeStamp bulkEncodeAfter;
+            report("VarIntCodec array encode", bulkEncodeBefore, bulkEncodeAfter, COUNT);
+            TS_ASSERT(bulkSize == size);
+
+            vector<uint32_t> decodedBulk(COUNT);
+            const TimeStamp bulkDecodeBefore;
+            TS_ASSERT(bulkSize == VarIntCodec::decode(&buffer[0], &buffer[0] + bulkSize, &decodedBulk[0], COUNT));
+            const TimeStamp bulkDecodeAfter;
+            report("VarIntCodec array decode", bulkDecodeBefore, bulkDecodeAfter, COUNT);
+
+            TS_ASSERT(decodedStreams == values);
+            TS_ASSERT(decodedScalar == values);
+            TS_ASSERT(decodedBulk == values);
+        }
+};
+
+#endif /*CORE_VARINTCODECBENCHMARKTESTSUITE_H_*/
@@ -0,0 +1,137 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_VARINTCODECTESTSUITE_H_
+#define CORE_VARINTCODECTESTSUITE_H_
+
+#include <cstring>                      // for memset
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/serialization/VarIntCodec.h"
+
+using namespace std;
+using namespace odcore::serialization;
+
+class VarIntCodecTest : public CxxTest::TestSuite {
+    public:
+        void testSizes() {
+            TS_ASSERT(1 == VarIntCodec::getSize(0));
+            TS_ASSERT(1 == VarIntCodec::getSize(127));
+            TS_ASSERT(2 == VarIntCodec::getSize(128));
+            TS_ASSERT(2 == VarIntCodec::getSize(16383));
+            TS_ASSERT(3 == VarIntCodec::getSize(16384));
+            TS_ASSERT(5 == VarIntCodec::getSize(0xFFFFFFFF));
+            TS_ASSERT(9 == VarIntCodec::getSize(static_cast<uint64_t>(1) << 62));
+            TS_ASSERT(10 == VarIntCodec::getSize(static_cast<uint64_t>(1) << 63));
+        }
+
+        void testEncodeDecodeAllLengths() {
+            for (uint32_t bits = 0; bits < 64; bits++) {
+                const uint64_t values[] = { static_cast<uint64_t>(1) << bits, (static_cast<uint64_t>(1) << bits) - 1, ~static_cast<uint64_t>(0) >> (63 - bits) };
+                for (uint32_t i = 0; i < 3; i++) {
+                    // Trailing garbage must not be decoded.
+                    char buffer[VarIntCodec::MAX_VARINT_SIZE + 8];
+                    memset(buffer, 0xFF, sizeof(buffer));
+                    const uint8_t size = VarIntCodec::encode(buffer, values[i]);
+                    TS_ASSERT(size == VarIntCodec::getSize(values[i]));
+
+                    uint64_t decoded = 0;
+                    TS_ASSERT(size == VarIntCodec::decode(buffer, buffer + sizeof(buffer), decoded));
+                    TS_ASSERT(decoded == values[i]);
+
+                    // Decoding from a buffer ending right behind the value.
+                    decoded = 0;
+                    TS_ASSERT(size == VarIntCodec::decode(buffer, buffer + size, decoded));
+                    TS_ASSERT(decoded == values[i]);
+
+                    // Truncated values are rejected.
+                    TS_ASSERT(0 == VarIntCodec::decode(buffer, buffer + size - 1, decoded));
+                }
+            }
+        }
+
+        void testStreams() {
+            const uint64_t value = (static_cast<uint64_t>(0x12345678) << 32) | 0x9ABCDEF0;
+            stringstream sstr;
+            TS_ASSERT(9 == VarIntCodec::encode(sstr, value));
+            TS_ASSERT(1 == VarIntCodec::encode(sstr, 5));
+
+            // Bits beyond 32 must survive decoding.
+            uint64_t decoded = 0;
+            TS_ASSERT(9 == VarIntCodec::decode(sstr, decoded));
+            TS_ASSERT(decoded == value);
+            TS_ASSERT(1 == VarIntCodec::decode(sstr, decoded));
+            TS_ASSERT(5 == decoded);
+            TS_ASSERT(sstr.good());
+
+            TS_ASSERT(0 == VarIntCodec::decode(sstr, decoded));
+            TS_ASSERT(sstr.eof());
+        }
+
+        void testZigZag() {
+            TS_ASSERT(0 == VarIntCodec::encodeZigZag32(0));
+            TS_ASSERT(1 == VarIntCodec::encodeZigZag32(-1));
+            TS_ASSERT(2 == VarIntCodec::encodeZigZag32(1));
+            TS_ASSERT(0xFFFFFFFF == VarIntCodec::encodeZigZag32(INT32_MIN));
+            TS_ASSERT(INT32_MIN == VarIntCodec::decodeZigZag32(0xFFFFFFFF));
+            TS_ASSERT(INT32_MAX == VarIntCodec::decodeZigZag32(0xFFFFFFFE));
+            TS_ASSERT(-1 == VarIntCodec::decodeZigZag32(1));
+
+            TS_ASSERT(3 == VarIntCodec::encodeZigZag64(-2));
+            TS_ASSERT(INT64_MIN == VarIntCodec::decodeZigZag64(VarIntCodec::encodeZigZag64(INT64_MIN)));
+            TS_ASSERT(INT64_MAX == VarIntCodec::decodeZigZag64(VarIntCodec::encodeZigZag64(INT64_MAX)));
+        }
+
+        void testArrays() {
+            // Mix long runs of small values with larger ones to cover both the bulk and the scalar path.
+            vector<uint32_t> values;
+            for (uint32_t i = 0; i < 1000; i++) {
+                values.push_back(i % 100);
+            }
+            for (uint32_t i = 0; i < 1000; i++) {
+                values.push_back((i % 7 == 0) ? (i * 1000003) : (i % 128));
+            }
+            values.push_back(0xFFFFFFFF);
+
+            vector<char> buffer(values.size() * VarIntCodec::MAX_VARINT32_SIZE);
+            const uint32_t size = VarIntCodec::encode(&buffer[0], &values[0], values.size());
+
+            // The result must match encoding value by value.
+            vector<char> reference(buffer.size());
+            uint32_t referenceSize = 0;
+            for (uint32_t i = 0; i < values.size(); i++) {
+                referenceSize += VarIntCodec::encode(&reference[referenceSize], values[i]);
+            }
+            TS_ASSERT(size == referenceSize);
+            TS_ASSERT(string(&buffer[0], size) == string(&reference[0], referenceSize));
+
+            vector<uint32_t> decoded(values.size());
+            TS_ASSERT(size == VarIntCodec::decode(&buffer[0], &buffer[0] + size, &decoded[0], decoded.size()));
+            TS_ASSERT(values == decoded);
+
+            // Truncated input is rejected.
+            TS_ASSERT(0 == VarIntCodec::decode(&buffer[0], &buffer[0] + size - 1, &decoded[0], decoded.size()));
+        }
+};
+
+#endif /*CORE_VARINTCODECTESTSUITE_H_*/
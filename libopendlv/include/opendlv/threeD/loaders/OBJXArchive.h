@@ -23,6 +23,7 @@
 #include <map>
 #include <string>
 #include <sstream>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendlv/core/wrapper/Image.h"
@@ -30,6 +31,7 @@
 
 #include "opendlv/threeD/Material.h"
 #include "opendlv/threeD/TransformGroup.h"
+#include "opendlv/threeD/models/TriangleSet.h"
 
 namespace opendlv {
     namespace threeD {
@@ -125,6 +127,15 @@ namespace opendlv {
                      */
                     TransformGroup* createTransformGroup(const NodeDescriptor &nd);
 
+                    /**
+                     * This method returns all triangles grouped by their
+                     * materials without requiring an OpenGL context. The
+                     * vertices are not rotated; i.e. the Y-axis points up.
+                     *
+                     * @return List of triangle sets.
+                     */
+                    vector<models::TriangleSet> getListOfTriangleSets();
+
                 private:
                     map<string, core::wrapper::Image*, odcore::strings::StringComparator> m_mapOfImages;
                     map<string, Material, odcore::strings::StringComparator> m_mapOfMaterials;
@@ -140,6 +151,14 @@ namespace opendlv {
                      * This method registers the images at TextureManager.
                      */
                     void setUpTextures();
+
+                    /**
+                     * This method parses all triangles from the obj-file
+                     * using the current materials.
+                     *
+                     * @return List of triangle sets.
+                     */
+                    vector<models::TriangleSet> parseTriangleSets();
             };
 
         }
@@ -67,6 +67,34 @@ namespace opendlv {
 
                     virtual void render(RenderingConfiguration &renderingConfiguration);
 
+                    /**
+                     * This method returns point A of this line.
+                     *
+                     * @return Point A.
+                     */
+                    const opendlv::data::environment::Point3 getPositionA() const;
+
+                    /**
+                     * This method returns point B of this line.
+                     *
+                     * @return Point B.
+                     */
+                    const opendlv::data::environment::Point3 getPositionB() const;
+
+                    /**
+                     * This method returns the line's color.
+                     *
+                     * @return Color.
+                     */
+                    const opendlv::data::environment::Point3 getColor() const;
+
+                    /**
+                     * This method returns the line's width in pixels.
+                     *
+                     * @return Width.
+                     */
+                    float getWidth() const;
+
                 private:
                     opendlv::data::environment::Point3 m_positionA;
                     opendlv::data::environment::Point3 m_positionB;
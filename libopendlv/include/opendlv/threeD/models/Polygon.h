@@ -68,6 +68,27 @@ namespace opendlv {
 
                     virtual void render(RenderingConfiguration &renderingConfiguration);
 
+                    /**
+                     * This method returns the vertices describing the shape of this polygon.
+                     *
+                     * @return List of vertices.
+                     */
+                    vector<opendlv::data::environment::Point3> getListOfGroundVertices() const;
+
+                    /**
+                     * This method returns the polygon's color.
+                     *
+                     * @return Color.
+                     */
+                    const opendlv::data::environment::Point3 getColor() const;
+
+                    /**
+                     * This method returns the polygon's height.
+                     *
+                     * @return Height.
+                     */
+                    float getHeight() const;
+
                 private:
                     vector<opendlv::data::environment::Point3> m_listOfGroundVertices;
                     opendlv::data::environment::Point3 m_color;
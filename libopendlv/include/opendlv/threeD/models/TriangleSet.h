@@ -83,6 +83,21 @@ namespace opendlv {
                      */
                     void setMaterial(const Material &material);
 
+                    /**
+                     * This method returns the material for all triangles.
+                     *
+                     * @return Material.
+                     */
+                    const Material getMaterial() const;
+
+                    /**
+                     * This method returns the vertices of all triangles;
+                     * three consecutive vertices form one triangle.
+                     *
+                     * @return List of vertices.
+                     */
+                    vector<opendlv::data::environment::Point3> getVertices() const;
+
                 private:
                     mutable bool m_compiled;
                     mutable uint32_t m_callList;
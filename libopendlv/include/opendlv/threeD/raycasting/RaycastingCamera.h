@@ -0,0 +1,112 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGCAMERA_H_
+#define HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGCAMERA_H_
+
+#include "opendavinci/odcore/opendavinci.h"
+
+#include "opendlv/data/environment/Point3.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace raycasting {
+
+            class RaycastingScene;
+
+            /**
+             * This class renders BGR images and depth maps from a
+             * RaycastingScene without any OpenGL context. Each 2x2 block
+             * of pixels is traced as one RayPacket and the rows are
+             * distributed over all cores.
+             */
+            class OPENDAVINCI_API RaycastingCamera {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    RaycastingCamera(const RaycastingCamera &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    RaycastingCamera& operator=(const RaycastingCamera &/*obj*/);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param scene Scene to be rendered; it must be built already.
+                     * @param width Width of the image in pixels.
+                     * @param height Height of the image in pixels.
+                     * @param fieldOfViewY Vertical field of view in DEG.
+                     * @param maximumDistance Maximum distance in m.
+                     */
+                    RaycastingCamera(const RaycastingScene &scene, const uint32_t &width, const uint32_t &height, const double &fieldOfViewY, const double &maximumDistance);
+
+                    virtual ~RaycastingCamera();
+
+                    uint32_t getWidth() const;
+
+                    uint32_t getHeight() const;
+
+                    /**
+                     * This method sets the number of threads for rendering.
+                     *
+                     * @param numberOfThreads Number of threads or 0 for one per core.
+                     */
+                    void setNumberOfThreads(const uint32_t &numberOfThreads);
+
+                    /**
+                     * This method renders one image.
+                     *
+                     * @param position Position of the camera.
+                     * @param heading Heading of the camera in RAD.
+                     * @param pitch Pitch of the camera in RAD; negative values look down.
+                     * @param image BGR image with width * height * 3 bytes; the first row is the top one.
+                     * @param depth Optional buffer with width * height distances in m; 0 for no hit.
+                     */
+                    void render(const opendlv::data::environment::Point3 &position, const double &heading, const double &pitch, unsigned char *image, float *depth) const;
+
+                private:
+                    const static float AMBIENT;
+                    const static float LIGHT[3];
+
+                    const RaycastingScene &m_scene;
+                    uint32_t m_width;
+                    uint32_t m_height;
+                    double m_fieldOfViewY;
+                    float m_maximumDistance;
+                    uint32_t m_numberOfThreads;
+            };
+
+        }
+    }
+} // opendlv::threeD::raycasting
+
+#endif /*HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGCAMERA_H_*/
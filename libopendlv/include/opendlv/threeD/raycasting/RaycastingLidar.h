@@ -0,0 +1,137 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGLIDAR_H_
+#define HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGLIDAR_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+#include "opendlv/data/environment/Point3.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace raycasting {
+
+            using namespace std;
+
+            class RaycastingScene;
+
+            /**
+             * This class simulates a rotating multi-layer lidar on a
+             * RaycastingScene. The layers of one azimuth are traced as
+             * RayPackets and the azimuths are distributed over all cores.
+             *
+             * Azimuths are measured clockwise from the heading; i.e. 90
+             * is to the right. The points of a scan are ordered by azimuth
+             * and by layer within each azimuth and have the components
+             * distance, azimuth, vertical angle, and intensity like
+             * SharedPointCloud::POLAR_INTENSITY; thus, scans can be encoded
+             * directly into CompactPointCloud messages.
+             */
+            class OPENDAVINCI_API RaycastingLidar {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    RaycastingLidar(const RaycastingLidar &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    RaycastingLidar& operator=(const RaycastingLidar &/*obj*/);
+
+                public:
+                    /**
+                     * Number of components per point.
+                     */
+                    static const uint32_t NUMBER_OF_COMPONENTS_PER_POINT;
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param scene Scene to be scanned; it must be built already.
+                     * @param verticalAngles Vertical angles of the layers in DEG.
+                     * @param startAzimuth First azimuth in DEG.
+                     * @param endAzimuth Azimuth in DEG where the scan ends (exclusive).
+                     * @param azimuthIncrement Increment between two azimuths in DEG.
+                     * @param maximumDistance Maximum distance in m.
+                     */
+                    RaycastingLidar(const RaycastingScene &scene, const vector<float> &verticalAngles, const float &startAzimuth, const float &endAzimuth, const float &azimuthIncrement, const double &maximumDistance);
+
+                    virtual ~RaycastingLidar();
+
+                    uint32_t getNumberOfLayers() const;
+
+                    uint32_t getNumberOfAzimuths() const;
+
+                    /**
+                     * @return Number of points per scan.
+                     */
+                    uint32_t getNumberOfPoints() const;
+
+                    /**
+                     * This method sets the number of threads for scanning.
+                     *
+                     * @param numberOfThreads Number of threads or 0 for one per core.
+                     */
+                    void setNumberOfThreads(const uint32_t &numberOfThreads);
+
+                    /**
+                     * This method computes one scan. Points without a
+                     * reflection have distance and intensity 0.
+                     *
+                     * @param position Position of the sensor.
+                     * @param heading Heading of the sensor in RAD.
+                     * @param points Buffer for getNumberOfPoints() * NUMBER_OF_COMPONENTS_PER_POINT floats.
+                     * @return Number of points with a reflection.
+                     */
+                    uint32_t scan(const opendlv::data::environment::Point3 &position, const double &heading, float *points) const;
+
+                private:
+                    enum {
+                        AZIMUTHS_PER_TASK = 16
+                    };
+
+                    const RaycastingScene &m_scene;
+                    vector<float> m_verticalAngles;
+                    vector<float> m_sinVertical;
+                    vector<float> m_cosVertical;
+                    vector<float> m_azimuths;
+                    vector<float> m_sinAzimuth;
+                    vector<float> m_cosAzimuth;
+                    float m_maximumDistance;
+                    uint32_t m_numberOfThreads;
+            };
+
+        }
+    }
+} // opendlv::threeD::raycasting
+
+#endif /*HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGLIDAR_H_*/
@@ -0,0 +1,306 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGSCENE_H_
+#define HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGSCENE_H_
+
+#include <functional>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/threeD/TransformGroupVisitor.h"
+
+namespace opendlv { namespace scenario { class SCNXArchive; } }
+namespace opendlv { namespace threeD { class Node; } }
+
+namespace opendlv {
+    namespace threeD {
+        namespace raycasting {
+
+            using namespace std;
+
+            /**
+             * This class bundles four rays that are traversed together
+             * through a RaycastingScene. The rays are stored as structure
+             * of arrays to be loaded directly into SIMD registers.
+             */
+            class OPENDAVINCI_API RayPacket {
+                public:
+                    enum {
+                        SIZE = 4
+                    };
+
+                    RayPacket();
+
+                    /**
+                     * This method sets one ray of this packet.
+                     *
+                     * @param i Index of the ray.
+                     * @param origin Origin (x, y, z) of the ray.
+                     * @param direction Normalized direction (x, y, z) of the ray.
+                     * @param maximumDistance Maximum distance to look for hits.
+                     */
+                    void setRay(const uint32_t &i, const float *origin, const float *direction, const float &maximumDistance);
+
+                public:
+                    alignas(16) float m_originX[SIZE];
+                    alignas(16) float m_originY[SIZE];
+                    alignas(16) float m_originZ[SIZE];
+                    alignas(16) float m_directionX[SIZE];
+                    alignas(16) float m_directionY[SIZE];
+                    alignas(16) float m_directionZ[SIZE];
+
+                    /**
+                     * Maximum distance before and distance to the nearest hit after intersecting.
+                     */
+                    alignas(16) float m_distance[SIZE];
+
+                    /**
+                     * Identifier of the nearest hit after intersecting.
+                     */
+                    alignas(16) uint32_t m_hit[SIZE];
+            };
+
+            /**
+             * This class holds the triangles of a scenario and its complex
+             * models in a bounding volume hierarchy (BVH) to be raycasted
+             * on the CPU without any OpenGL context. The BVH is built once
+             * using the surface area heuristic and is traversed by packets
+             * of four rays at once.
+             *
+             * The ground is modeled as the infinite plane z = 0.
+             *
+             * After calling build(), all methods are read-only and may be
+             * used from several threads concurrently.
+             */
+            class OPENDAVINCI_API RaycastingScene : public TransformGroupVisitor {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    RaycastingScene(const RaycastingScene &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    RaycastingScene& operator=(const RaycastingScene &/*obj*/);
+
+                public:
+                    /**
+                     * Hit identifier for rays that did not hit anything.
+                     */
+                    static const uint32_t NO_HIT;
+
+                    /**
+                     * Hit identifier for rays that hit the ground.
+                     */
+                    static const uint32_t GROUND;
+
+                    /**
+                     * Width in m of a line that is rendered one pixel wide by OpenGL.
+                     */
+                    static const float LINE_WIDTH_PER_PIXEL;
+
+                    RaycastingScene();
+
+                    virtual ~RaycastingScene();
+
+                    /**
+                     * This method adds a triangle. The BVH needs to be
+                     * rebuilt afterwards.
+                     *
+                     * @param a First vertex.
+                     * @param b Second vertex.
+                     * @param c Third vertex.
+                     * @param color Color (r, g, b) in [0, 1].
+                     */
+                    void addTriangle(const opendlv::data::environment::Point3 &a, const opendlv::data::environment::Point3 &b, const opendlv::data::environment::Point3 &c, const opendlv::data::environment::Point3 &color);
+
+                    /**
+                     * This method adds the surroundings, lane markings, and
+                     * ground based complex models from the given SCNX archive.
+                     *
+                     * @param scnxArchive SCNX archive to be added.
+                     */
+                    void addSCNXArchive(scenario::SCNXArchive &scnxArchive);
+
+                    /**
+                     * This method adds polygons, lines, and triangle sets
+                     * from a scene graph; transformations are ignored.
+                     *
+                     * @param nd Node to be added.
+                     */
+                    virtual void visit(Node *nd);
+
+                    /**
+                     * This method builds the BVH over all added triangles.
+                     */
+                    void build();
+
+                    /**
+                     * @return Number of triangles.
+                     */
+                    uint32_t getNumberOfTriangles() const;
+
+                    /**
+                     * @return Number of BVH nodes.
+                     */
+                    uint32_t getNumberOfNodes() const;
+
+                    /**
+                     * This method enables or disables the ground.
+                     *
+                     * @param ground True if rays shall hit the plane z = 0.
+                     */
+                    void setGround(const bool &ground);
+
+                    /**
+                     * This method sets the color of the ground.
+                     *
+                     * @param color Color (r, g, b) in [0, 1].
+                     */
+                    void setGroundColor(const opendlv::data::environment::Point3 &color);
+
+                    /**
+                     * This method sets the color for rays without hit.
+                     *
+                     * @param color Color (r, g, b) in [0, 1].
+                     */
+                    void setSkyColor(const opendlv::data::environment::Point3 &color);
+
+                    /**
+                     * This method finds the nearest hits for all rays of
+                     * the given packet that are closer than their
+                     * maximum distance.
+                     *
+                     * @param packet Rays to be intersected.
+                     */
+                    void intersect(RayPacket &packet) const;
+
+                    /**
+                     * This method returns the color for a hit.
+                     *
+                     * @param hit Hit identifier.
+                     * @return Color (r, g, b) in [0, 1].
+                     */
+                    const float* getColor(const uint32_t &hit) const;
+
+                    /**
+                     * This method returns the normal for a hit.
+                     *
+                     * @param hit Hit identifier.
+                     * @return Normalized normal (x, y, z).
+                     */
+                    const float* getNormal(const uint32_t &hit) const;
+
+                    /**
+                     * This method runs the given task for all indices in
+                     * [0, numberOfTasks) distributed over several threads.
+                     *
+                     * @param numberOfTasks Number of tasks.
+                     * @param numberOfThreads Number of threads or 0 for one per core.
+                     * @param task Task to be run per index.
+                     */
+                    static void parallelFor(const uint32_t &numberOfTasks, const uint32_t &numberOfThreads, const std::function<void(const uint32_t &)> &task);
+
+                private:
+                    enum {
+                        MAX_LEAF_SIZE = 4,
+                        MAX_DEPTH = 60,
+                        NUMBER_OF_BINS = 16
+                    };
+
+                    const static float EPSILON;
+                    const static float LIFT;
+
+                    class Triangle {
+                        public:
+                            float m_vertex[3];
+                            float m_edge1[3];
+                            float m_edge2[3];
+                    };
+
+                    class BVHNode {
+                        public:
+                            BVHNode();
+
+                            float m_minimum[3];
+                            float m_maximum[3];
+
+                            /**
+                             * Index of the first triangle for leaves or of the left child.
+                             */
+                            uint32_t m_first;
+
+                            /**
+                             * Number of triangles for leaves or 0.
+                             */
+                            uint32_t m_count;
+
+                            /**
+                             * Split axis for inner nodes.
+                             */
+                            uint32_t m_axis;
+                    };
+
+                    void addTriangle(const float *a, const float *b, const float *c, const float *color);
+
+                    void addPolygon(const vector<opendlv::data::environment::Point3> &vertices, const float &height, const opendlv::data::environment::Point3 &color);
+
+                    void addLine(const opendlv::data::environment::Point3 &a, const opendlv::data::environment::Point3 &b, const float &width, const opendlv::data::environment::Point3 &color);
+
+                    void addComplexModels(scenario::SCNXArchive &scnxArchive);
+
+                    /**
+                     * This method recursively splits the triangles [first, first + count).
+                     */
+                    void subdivide(const uint32_t &node, const uint32_t &first, const uint32_t &count, const uint32_t &depth, vector<uint32_t> &indices, const vector<float> &bounds, const vector<float> &centroids);
+
+                    void traverse(RayPacket &packet) const;
+
+                    void intersectGround(RayPacket &packet) const;
+
+                private:
+                    vector<Triangle> m_triangles;
+                    vector<float> m_normals;
+                    vector<float> m_colors;
+                    vector<BVHNode> m_nodes;
+
+                    bool m_ground;
+                    float m_groundColor[3];
+                    float m_groundNormal[3];
+                    float m_skyColor[3];
+            };
+
+        }
+    }
+} // opendlv::threeD::raycasting
+
+#endif /*HESPERIA_CORE_THREED_RAYCASTING_RAYCASTINGSCENE_H_*/
@@ -29,8 +29,10 @@
 #include "opendavinci/odcontext/base/SystemFeedbackComponent.h"
 
 #include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/OtherVehicleState.h"
 #include "opendlv/data/environment/Polygon.h"
 
+#include "opendlv/vehiclecontext/model/ObstacleGrid.h"
 #include "opendlv/vehiclecontext/model/PointSensor.h"
 
 namespace opendlv { namespace vehiclecontext {
@@ -94,12 +96,39 @@ namespace opendlv { namespace vehiclecontext {
                  */
                 vector<odcore::data::Container> calculate(const opendlv::data::environment::EgoState &es);
 
+                /**
+                 * This method adds or moves another vehicle that is
+                 * considered as a dynamic obstacle by all sensors.
+                 *
+                 * @param ovs State of the other vehicle.
+                 */
+                void updateOtherVehicle(const opendlv::data::environment::OtherVehicleState &ovs);
+
+                /**
+                 * This method removes another vehicle.
+                 *
+                 * @param id Identifier of the other vehicle.
+                 */
+                void removeOtherVehicle(const uint32_t &id);
+
+                /**
+                 * This method removes all other vehicles that have not
+                 * been updated for the configured number of cycles and
+                 * advances to the next cycle.
+                 */
+                void removeStaleOtherVehicles();
+
             private:
                 odcore::base::KeyValueConfiguration m_kvc;
                 float m_freq;
 
                 uint32_t m_numberOfPolygons;
-                map<uint32_t, opendlv::data::environment::Polygon> m_mapOfPolygons;
+                ObstacleGrid m_obstacleGrid;
+                double m_otherVehicleLength;
+                double m_otherVehicleWidth;
+                uint32_t m_otherVehicleTimeout;
+                uint32_t m_cycle;
+                map<uint32_t, uint32_t> m_otherVehicleLastUpdate;
                 vector<uint32_t> m_listOfPolygonsInsideFOV;
                 map<string, PointSensor*> m_mapOfPointSensors;
                 map<string, double> m_distances;
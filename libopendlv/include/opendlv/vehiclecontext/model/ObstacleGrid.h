@@ -0,0 +1,208 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_MODEL_OBSTACLEGRID_H_
+#define VEHICLECONTEXT_MODEL_OBSTACLEGRID_H_
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+
+namespace opendlv { namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+
+        /**
+         * This class is a uniform 2D grid over the edges of obstacle
+         * polygons ignoring the Z coordinate. Static polygons (e.g. the
+         * buildings from an SCNX file) are added once; dynamic polygons
+         * (e.g. other vehicles) are identified by an ID and can be moved
+         * or removed at any time by only touching the cells they cover.
+         *
+         * Queries return the distance to the nearest obstacle edge
+         * inside a triangular field of view by visiting the covered
+         * cells in the order of their distance to the sensor and stop
+         * as soon as no closer edge can be found.
+         */
+        class OPENDAVINCI_API ObstacleGrid {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                ObstacleGrid(const ObstacleGrid &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                ObstacleGrid& operator=(const ObstacleGrid &/*obj*/);
+
+            public:
+                /**
+                 * Default edge length of a grid cell in m.
+                 */
+                static const double DEFAULT_CELL_SIZE;
+
+                /**
+                 * Constructor.
+                 *
+                 * @param cellSize Edge length of a grid cell in m.
+                 */
+                ObstacleGrid(const double &cellSize);
+
+                virtual ~ObstacleGrid();
+
+                /**
+                 * This method returns the edge length of a grid cell.
+                 *
+                 * @return Edge length of a grid cell in m.
+                 */
+                double getCellSize() const;
+
+                /**
+                 * This method changes the edge length of a grid cell and
+                 * re-indexes all contained edges.
+                 *
+                 * @param cellSize Edge length of a grid cell in m.
+                 */
+                void setCellSize(const double &cellSize);
+
+                /**
+                 * This method adds a polygon that will never move.
+                 *
+                 * @param p Closed polygon to be added.
+                 */
+                void addStaticPolygon(const opendlv::data::environment::Polygon &p);
+
+                /**
+                 * This method adds or moves a dynamic polygon.
+                 *
+                 * @param id Identifier of the dynamic polygon.
+                 * @param p Closed polygon at its current position.
+                 */
+                void updateDynamicPolygon(const uint32_t &id, const opendlv::data::environment::Polygon &p);
+
+                /**
+                 * This method removes a dynamic polygon.
+                 *
+                 * @param id Identifier of the dynamic polygon.
+                 */
+                void removeDynamicPolygon(const uint32_t &id);
+
+                /**
+                 * @return Number of edges from all static polygons.
+                 */
+                uint32_t getNumberOfStaticEdges() const;
+
+                /**
+                 * @return Number of dynamic polygons.
+                 */
+                uint32_t getNumberOfDynamicPolygons() const;
+
+                /**
+                 * This method returns the distance from the apex of the
+                 * given triangle to the nearest obstacle edge inside
+                 * this triangle ignoring the Z coordinate.
+                 *
+                 * @param apex Position of the sensor.
+                 * @param left Left boundary of the FOV.
+                 * @param right Right boundary of the FOV.
+                 * @return Distance to the nearest edge or -1.
+                 */
+                double getNearestDistance(const opendlv::data::environment::Point3 &apex, const opendlv::data::environment::Point3 &left, const opendlv::data::environment::Point3 &right) const;
+
+            private:
+                const static double EPSILON;
+
+                class Edge {
+                    public:
+                        Edge(const double &ax, const double &ay, const double &bx, const double &by);
+
+                        double m_ax;
+                        double m_ay;
+                        double m_bx;
+                        double m_by;
+                };
+
+                /**
+                 * This method returns the key for the cell (x, y).
+                 */
+                static int64_t getKey(const int32_t &x, const int32_t &y);
+
+                int32_t getCell(const double &v) const;
+
+                /**
+                 * This method appends the closed polygon's edges to the list.
+                 */
+                static void getEdges(const opendlv::data::environment::Polygon &p, vector<Edge> &edges);
+
+                /**
+                 * This method returns the keys of all cells that the given edge touches.
+                 */
+                void getCellsForEdge(const Edge &e, vector<int64_t> &keys) const;
+
+                /**
+                 * This method returns the sorted keys of all cells that the given edges touch.
+                 */
+                void getCellsForEdges(const vector<Edge> &edges, vector<int64_t> &keys) const;
+
+                void indexStaticEdge(const uint32_t &index);
+
+                void removeFromDynamicCell(const int64_t &key, const uint32_t &id);
+
+                void indexDynamicPolygon(const uint32_t &id);
+
+                void unindexDynamicPolygon(const uint32_t &id);
+
+                /**
+                 * This method returns the distance from the apex to the part
+                 * of the edge inside the triangle given by its three half planes
+                 * or -1 if the edge does not cross the triangle.
+                 */
+                static double getDistanceToEdge(const Edge &e, const double *planes, const double &apexX, const double &apexY);
+
+            private:
+                double m_cellSize;
+
+                vector<Edge> m_staticEdges;
+                unordered_map<int64_t, vector<uint32_t> > m_staticCells;
+
+                map<uint32_t, vector<Edge> > m_dynamicEdges;
+                map<uint32_t, vector<int64_t> > m_dynamicCellsPerPolygon;
+                unordered_map<int64_t, vector<uint32_t> > m_dynamicCells;
+        };
+
+    }
+} } // opendlv::vehiclecontext::model
+
+#endif /*VEHICLECONTEXT_MODEL_OBSTACLEGRID_H_*/
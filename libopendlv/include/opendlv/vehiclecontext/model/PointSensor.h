@@ -21,10 +21,10 @@
 #define VEHICLECONTEXT_MODEL_POINTSENSOR_H_
 
 #include <string>
-#include <map>
 
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/ObstacleGrid.h"
 
 namespace opendlv { namespace vehiclecontext {
     namespace model {
@@ -83,12 +83,12 @@ namespace opendlv { namespace vehiclecontext {
                 opendlv::data::environment::Polygon updateFOV(const opendlv::data::environment::Point3 &translation, const opendlv::data::environment::Point3 &rotation);
 
                 /**
-                 * This methods calculates the distance.
+                 * This methods calculates the distance using a spatial index.
                  *
-                 * @param mapOfPolygons Map of polygons to iterate through.
+                 * @param obstacleGrid Spatial index of all obstacles.
                  * @return distance to the closest line or -1.
                  */
-                double getDistance(map<uint32_t, opendlv::data::environment::Polygon> &mapOfPolygons);
+                double getDistance(const ObstacleGrid &obstacleGrid);
 
                 bool hasShowFOV() const;
 
@@ -115,8 +115,16 @@ namespace opendlv { namespace vehiclecontext {
 
                 opendlv::data::environment::Polygon m_FOV;
                 opendlv::data::environment::Point3 m_sensorPosition;
+                opendlv::data::environment::Point3 m_leftBoundaryFOV;
+                opendlv::data::environment::Point3 m_rightBoundaryFOV;
 
-                bool isInFOV(const opendlv::data::environment::Point3 &pt) const;
+                /**
+                 * This method applies the configured fault model to the measured distance.
+                 *
+                 * @param distance Measured distance or -1.
+                 * @return Distance to be reported.
+                 */
+                double applyFaultModel(const double &distance);
         };
 
     }
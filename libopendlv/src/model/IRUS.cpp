@@ -30,6 +30,7 @@
 #include "opendavinci/odcore/wrapper/Time.h"
 #include "automotivedata/generated/automotive/miniature/SensorBoardData.h"
 #include "opendlv/data/environment/Obstacle.h"
+#include "opendlv/data/environment/OtherVehicleState.h"
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/scenario/Ground.h"
 #include "opendlv/data/scenario/Polygon.h"
@@ -38,6 +39,7 @@
 #include "opendlv/scenario/SCNXArchive.h"
 #include "opendlv/scenario/SCNXArchiveFactory.h"
 #include "opendlv/vehiclecontext/model/IRUS.h"
+#include "opendlv/vehiclecontext/model/ObstacleGrid.h"
 #include "opendlv/vehiclecontext/model/PointSensor.h"
 
 namespace core { namespace exceptions { class ValueForKeyNotFoundException; } }
@@ -59,7 +61,12 @@ namespace opendlv { namespace vehiclecontext {
             m_kvc(),
             m_freq(0),
             m_numberOfPolygons(0),
-            m_mapOfPolygons(),
+            m_obstacleGrid(ObstacleGrid::DEFAULT_CELL_SIZE),
+            m_otherVehicleLength(4.0),
+            m_otherVehicleWidth(2.0),
+            m_otherVehicleTimeout(10),
+            m_cycle(0),
+            m_otherVehicleLastUpdate(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -75,7 +82,12 @@ namespace opendlv { namespace vehiclecontext {
             m_kvc(),
             m_freq(freq),
             m_numberOfPolygons(0),
-            m_mapOfPolygons(),
+            m_obstacleGrid(ObstacleGrid::DEFAULT_CELL_SIZE),
+            m_otherVehicleLength(4.0),
+            m_otherVehicleWidth(2.0),
+            m_otherVehicleTimeout(10),
+            m_cycle(0),
+            m_otherVehicleLastUpdate(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -94,6 +106,30 @@ namespace opendlv { namespace vehiclecontext {
         }
 
         void IRUS::setup() {
+            // Edge length of the cells from the spatial index over all obstacles.
+            try {
+                m_obstacleGrid.setCellSize(m_kvc.getValue<double>("odsimirus.cellSize"));
+            }
+            catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {
+            }
+
+            // Footprint of other vehicles.
+            try {
+                m_otherVehicleLength = m_kvc.getValue<double>("odsimirus.otherVehicle.length");
+            }
+            catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {
+            }
+            try {
+                m_otherVehicleWidth = m_kvc.getValue<double>("odsimirus.otherVehicle.width");
+            }
+            catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {
+            }
+            try {
+                m_otherVehicleTimeout = m_kvc.getValue<uint32_t>("odsimirus.otherVehicle.timeout");
+            }
+            catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {
+            }
+
             // Load scenario.
             const URL urlOfSCNXFile(m_kvc.getValue<string>("global.scenario"));
             if (urlOfSCNXFile.isValid()) {
@@ -118,7 +154,7 @@ namespace opendlv { namespace vehiclecontext {
                                 while (jt != listOfVertices.end()) {
                                     p.add(*jt++);
                                 }
-                                m_mapOfPolygons[m_numberOfPolygons] = p;
+                                m_obstacleGrid.addStaticPolygon(p);
 
                                 cerr << "[IRUS] Found polygon: " << p.toString() << endl;
                             }
@@ -232,7 +268,7 @@ namespace opendlv { namespace vehiclecontext {
                 m_FOVs[sensor->getName()] = FOV;
 
                 // Calculate distance.
-                m_distances[sensor->getName()] = sensor->getDistance(m_mapOfPolygons);
+                m_distances[sensor->getName()] = sensor->getDistance(m_obstacleGrid);
                 cerr << sensor->getName() << ": " << m_distances[sensor->getName()] << endl;
 
                 // Store data for sensorboard.
@@ -268,6 +304,48 @@ namespace opendlv { namespace vehiclecontext {
             return retVal;
         }
 
+        void IRUS::updateOtherVehicle(const OtherVehicleState &ovs) {
+            const Point3 position = ovs.getPosition();
+            const double heading = ovs.getRotation().getAngleXY();
+
+            // Rectangular footprint around the other vehicle's center.
+            const double corners[4][2] = { { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 } };
+            Polygon footprint;
+            for (uint32_t i = 0; i < 4; i++) {
+                Point3 corner(corners[i][0] * m_otherVehicleLength / 2.0, corners[i][1] * m_otherVehicleWidth / 2.0, 0);
+                corner.rotateZ(heading);
+                corner += position;
+                footprint.add(corner);
+            }
+
+            m_obstacleGrid.updateDynamicPolygon(ovs.getIdentifier(), footprint);
+            m_otherVehicleLastUpdate[ovs.getIdentifier()] = m_cycle;
+        }
+
+        void IRUS::removeOtherVehicle(const uint32_t &id) {
+            m_obstacleGrid.removeDynamicPolygon(id);
+            m_otherVehicleLastUpdate.erase(id);
+        }
+
+        void IRUS::removeStaleOtherVehicles() {
+            vector<uint32_t> stale;
+            map<uint32_t, uint32_t>::const_iterator it = m_otherVehicleLastUpdate.begin();
+            while (it != m_otherVehicleLastUpdate.end()) {
+                if ((m_cycle - it->second) >= m_otherVehicleTimeout) {
+                    stale.push_back(it->first);
+                }
+                it++;
+            }
+
+            vector<uint32_t>::const_iterator jt = stale.begin();
+            while (jt != stale.end()) {
+                cerr << "[IRUS] Removing other vehicle " << *jt << " without update." << endl;
+                removeOtherVehicle(*jt++);
+            }
+
+            m_cycle++;
+        }
+
         void IRUS::step(const odcore::wrapper::Time &t, SendContainerToSystemsUnderTest &sender) {
             cerr << "[IRUS] Call for t = " << t.getSeconds() << "." << t.getPartialMicroseconds() << ", containing " << getFIFO().getSize() << " containers." << endl;
 
@@ -281,8 +359,14 @@ namespace opendlv { namespace vehiclecontext {
                 if (c.getDataType() == opendlv::data::environment::EgoState::ID()) {
                     egoState = c.getData<EgoState>();
                 }
+                if (c.getDataType() == opendlv::data::environment::OtherVehicleState::ID()) {
+                    updateOtherVehicle(c.getData<OtherVehicleState>());
+                }
             }
 
+            // Forget other vehicles that are no longer reported.
+            removeStaleOtherVehicles();
+
             // Calculate result and propagate it.
             vector<Container> toBeSent = calculate(egoState);
             if (toBeSent.size() > 0) {
@@ -0,0 +1,346 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/ObstacleGrid.h"
+
+namespace opendlv { namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+        using namespace opendlv::data::environment;
+
+        const double ObstacleGrid::DEFAULT_CELL_SIZE = 5.0;
+        const double ObstacleGrid::EPSILON = 1e-10;
+
+        ObstacleGrid::Edge::Edge(const double &ax, const double &ay, const double &bx, const double &by) :
+            m_ax(ax),
+            m_ay(ay),
+            m_bx(bx),
+            m_by(by) {}
+
+        ObstacleGrid::ObstacleGrid(const double &cellSize) :
+            m_cellSize((cellSize > 0) ? cellSize : DEFAULT_CELL_SIZE),
+            m_staticEdges(),
+            m_staticCells(),
+            m_dynamicEdges(),
+            m_dynamicCellsPerPolygon(),
+            m_dynamicCells() {}
+
+        ObstacleGrid::~ObstacleGrid() {}
+
+        double ObstacleGrid::getCellSize() const {
+            return m_cellSize;
+        }
+
+        void ObstacleGrid::setCellSize(const double &cellSize) {
+            if ( (cellSize > 0) && (fabs(cellSize - m_cellSize) > 0) ) {
+                m_cellSize = cellSize;
+
+                // Re-index all edges for the new cell size.
+                m_staticCells.clear();
+                for (uint32_t i = 0; i < m_staticEdges.size(); i++) {
+                    indexStaticEdge(i);
+                }
+
+                m_dynamicCells.clear();
+                m_dynamicCellsPerPolygon.clear();
+                map<uint32_t, vector<Edge> >::const_iterator it = m_dynamicEdges.begin();
+                while (it != m_dynamicEdges.end()) {
+                    indexDynamicPolygon(it->first);
+                    it++;
+                }
+            }
+        }
+
+        int64_t ObstacleGrid::getKey(const int32_t &x, const int32_t &y) {
+            return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y));
+        }
+
+        int32_t ObstacleGrid::getCell(const double &v) const {
+            return static_cast<int32_t>(floor(v / m_cellSize));
+        }
+
+        void ObstacleGrid::getEdges(const Polygon &p, vector<Edge> &edges) {
+            const vector<Point3> vertices = p.getVertices();
+            if (vertices.size() > 1) {
+                // Polygons are implicitly closed.
+                for (uint32_t i = 0; i < vertices.size(); i++) {
+                    const Point3 &a = vertices.at(i);
+                    const Point3 &b = vertices.at((i + 1) % vertices.size());
+                    edges.push_back(Edge(a.getX(), a.getY(), b.getX(), b.getY()));
+                }
+            }
+        }
+
+        void ObstacleGrid::getCellsForEdge(const Edge &e, vector<int64_t> &keys) const {
+            const double minX = min(e.m_ax, e.m_bx);
+            const double maxX = max(e.m_ax, e.m_bx);
+            const double minY = min(e.m_ay, e.m_by);
+            const double maxY = max(e.m_ay, e.m_by);
+            const double dx = e.m_bx - e.m_ax;
+
+            // Walk along the columns and add all cells that the edge passes in each column.
+            const int32_t lastColumn = getCell(maxX);
+            for (int32_t x = getCell(minX); x <= lastColumn; x++) {
+                double yLow = minY;
+                double yHigh = maxY;
+                if (fabs(dx) > 0) {
+                    const double xStart = max(minX, x * m_cellSize);
+                    const double xEnd = min(maxX, (x + 1) * m_cellSize);
+                    const double yStart = e.m_ay + (xStart - e.m_ax) * (e.m_by - e.m_ay) / dx;
+                    const double yEnd = e.m_ay + (xEnd - e.m_ax) * (e.m_by - e.m_ay) / dx;
+                    yLow = min(yStart, yEnd);
+                    yHigh = max(yStart, yEnd);
+                }
+
+                const int32_t lastRow = getCell(yHigh);
+                for (int32_t y = getCell(yLow); y <= lastRow; y++) {
+                    keys.push_back(getKey(x, y));
+                }
+            }
+        }
+
+        void ObstacleGrid::indexStaticEdge(const uint32_t &index) {
+            vector<int64_t> keys;
+            getCellsForEdge(m_staticEdges.at(index), keys);
+
+            vector<int64_t>::const_iterator it = keys.begin();
+            while (it != keys.end()) {
+                m_staticCells[*it++].push_back(index);
+            }
+        }
+
+        void ObstacleGrid::getCellsForEdges(const vector<Edge> &edges, vector<int64_t> &keys) const {
+            vector<Edge>::const_iterator it = edges.begin();
+            while (it != edges.end()) {
+                getCellsForEdge(*it++, keys);
+            }
+
+            // Register a polygon only once per cell.
+            sort(keys.begin(), keys.end());
+            keys.erase(unique(keys.begin(), keys.end()), keys.end());
+        }
+
+        void ObstacleGrid::removeFromDynamicCell(const int64_t &key, const uint32_t &id) {
+            unordered_map<int64_t, vector<uint32_t> >::iterator cell = m_dynamicCells.find(key);
+            if (cell != m_dynamicCells.end()) {
+                cell->second.erase(remove(cell->second.begin(), cell->second.end(), id), cell->second.end());
+                if (cell->second.empty()) {
+                    m_dynamicCells.erase(cell);
+                }
+            }
+        }
+
+        void ObstacleGrid::indexDynamicPolygon(const uint32_t &id) {
+            vector<int64_t> keys;
+            getCellsForEdges(m_dynamicEdges[id], keys);
+
+            vector<int64_t>::const_iterator it = keys.begin();
+            while (it != keys.end()) {
+                m_dynamicCells[*it++].push_back(id);
+            }
+            m_dynamicCellsPerPolygon[id] = keys;
+        }
+
+        void ObstacleGrid::unindexDynamicPolygon(const uint32_t &id) {
+            map<uint32_t, vector<int64_t> >::iterator it = m_dynamicCellsPerPolygon.find(id);
+            if (it != m_dynamicCellsPerPolygon.end()) {
+                vector<int64_t>::const_iterator jt = it->second.begin();
+                while (jt != it->second.end()) {
+                    removeFromDynamicCell(*jt++, id);
+                }
+                m_dynamicCellsPerPolygon.erase(it);
+            }
+        }
+
+        void ObstacleGrid::addStaticPolygon(const Polygon &p) {
+            const uint32_t first = m_staticEdges.size();
+            getEdges(p, m_staticEdges);
+            for (uint32_t i = first; i < m_staticEdges.size(); i++) {
+                indexStaticEdge(i);
+            }
+        }
+
+        void ObstacleGrid::updateDynamicPolygon(const uint32_t &id, const Polygon &p) {
+            vector<Edge> edges;
+            getEdges(p, edges);
+
+            vector<int64_t> keys;
+            getCellsForEdges(edges, keys);
+
+            // Both lists are sorted; only touch the cells that the polygon
+            // has left or entered since its last update.
+            vector<int64_t> &oldKeys = m_dynamicCellsPerPolygon[id];
+
+            vector<int64_t> left;
+            set_difference(oldKeys.begin(), oldKeys.end(), keys.begin(), keys.end(), back_inserter(left));
+            vector<int64_t>::const_iterator it = left.begin();
+            while (it != left.end()) {
+                removeFromDynamicCell(*it++, id);
+            }
+
+            vector<int64_t> entered;
+            set_difference(keys.begin(), keys.end(), oldKeys.begin(), oldKeys.end(), back_inserter(entered));
+            vector<int64_t>::const_iterator jt = entered.begin();
+            while (jt != entered.end()) {
+                m_dynamicCells[*jt++].push_back(id);
+            }
+
+            oldKeys.swap(keys);
+            m_dynamicEdges[id].swap(edges);
+        }
+
+        void ObstacleGrid::removeDynamicPolygon(const uint32_t &id) {
+            unindexDynamicPolygon(id);
+            m_dynamicEdges.erase(id);
+        }
+
+        uint32_t ObstacleGrid::getNumberOfStaticEdges() const {
+            return m_staticEdges.size();
+        }
+
+        uint32_t ObstacleGrid::getNumberOfDynamicPolygons() const {
+            return m_dynamicEdges.size();
+        }
+
+        double ObstacleGrid::getDistanceToEdge(const Edge &e, const double *planes, const double &apexX, const double &apexY) {
+            // Clip the edge against the three half planes of the triangle.
+            double tStart = 0;
+            double tEnd = 1;
+            for (uint32_t i = 0; i < 3; i++) {
+                const double *plane = planes + 3 * i;
+                const double fA = plane[0] * e.m_ax + plane[1] * e.m_ay + plane[2];
+                const double fB = plane[0] * e.m_bx + plane[1] * e.m_by + plane[2];
+
+                if ( (fA < 0) && (fB < 0) ) {
+                    return -1;
+                }
+                if (fA < 0) {
+                    tStart = max(tStart, fA / (fA - fB));
+                }
+                else if (fB < 0) {
+                    tEnd = min(tEnd, fA / (fA - fB));
+                }
+            }
+            if (tStart > tEnd) {
+                return -1;
+            }
+
+            // Find the point on the clipped edge that is closest to the apex.
+            const double dx = e.m_bx - e.m_ax;
+            const double dy = e.m_by - e.m_ay;
+            const double length2 = dx * dx + dy * dy;
+            double t = (length2 > 0) ? ((apexX - e.m_ax) * dx + (apexY - e.m_ay) * dy) / length2 : 0;
+            t = min(max(t, tStart), tEnd);
+
+            const double x = e.m_ax + t * dx - apexX;
+            const double y = e.m_ay + t * dy - apexY;
+            return sqrt(x * x + y * y);
+        }
+
+        double ObstacleGrid::getNearestDistance(const Point3 &apex, const Point3 &left, const Point3 &right) const {
+            const double x[3] = { apex.getX(), left.getX(), right.getX() };
+            const double y[3] = { apex.getY(), left.getY(), right.getY() };
+
+            const double area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+            if (fabs(area) < EPSILON) {
+                return -1;
+            }
+
+            // Half planes a*x + b*y + c >= 0 for the inside of the triangle.
+            const double orientation = (area > 0) ? 1.0 : -1.0;
+            double planes[9];
+            for (uint32_t i = 0; i < 3; i++) {
+                const uint32_t j = (i + 1) % 3;
+                planes[3 * i + 0] = -orientation * (y[j] - y[i]);
+                planes[3 * i + 1] = orientation * (x[j] - x[i]);
+                planes[3 * i + 2] = orientation * ((y[j] - y[i]) * x[i] - (x[j] - x[i]) * y[i]);
+            }
+
+            // Collect all populated cells overlapping the triangle's bounding box with their distance to the apex.
+            const int32_t firstColumn = getCell(min(x[0], min(x[1], x[2])));
+            const int32_t lastColumn = getCell(max(x[0], max(x[1], x[2])));
+            const int32_t firstRow = getCell(min(y[0], min(y[1], y[2])));
+            const int32_t lastRow = getCell(max(y[0], max(y[1], y[2])));
+
+            vector<pair<double, int64_t> > cells;
+            for (int32_t column = firstColumn; column <= lastColumn; column++) {
+                for (int32_t row = firstRow; row <= lastRow; row++) {
+                    const int64_t key = getKey(column, row);
+                    if ( (m_staticCells.count(key) > 0) || (m_dynamicCells.count(key) > 0) ) {
+                        const double dx = max(0.0, max(column * m_cellSize - x[0], x[0] - (column + 1) * m_cellSize));
+                        const double dy = max(0.0, max(row * m_cellSize - y[0], y[0] - (row + 1) * m_cellSize));
+                        cells.push_back(make_pair(sqrt(dx * dx + dy * dy), key));
+                    }
+                }
+            }
+            sort(cells.begin(), cells.end());
+
+            double nearest = -1;
+            vector<pair<double, int64_t> >::const_iterator it = cells.begin();
+            while (it != cells.end()) {
+                // No edge in the remaining cells can be closer.
+                if ( (nearest >= 0) && (it->first >= nearest) ) {
+                    break;
+                }
+
+                unordered_map<int64_t, vector<uint32_t> >::const_iterator staticCell = m_staticCells.find(it->second);
+                if (staticCell != m_staticCells.end()) {
+                    vector<uint32_t>::const_iterator jt = staticCell->second.begin();
+                    while (jt != staticCell->second.end()) {
+                        const double d = getDistanceToEdge(m_staticEdges[*jt++], planes, x[0], y[0]);
+                        if ( (d >= 0) && ( (nearest < 0) || (d < nearest) ) ) {
+                            nearest = d;
+                        }
+                    }
+                }
+
+                unordered_map<int64_t, vector<uint32_t> >::const_iterator dynamicCell = m_dynamicCells.find(it->second);
+                if (dynamicCell != m_dynamicCells.end()) {
+                    vector<uint32_t>::const_iterator jt = dynamicCell->second.begin();
+                    while (jt != dynamicCell->second.end()) {
+                        const vector<Edge> &edges = m_dynamicEdges.find(*jt++)->second;
+                        vector<Edge>::const_iterator kt = edges.begin();
+                        while (kt != edges.end()) {
+                            const double d = getDistanceToEdge(*kt++, planes, x[0], y[0]);
+                            if ( (d >= 0) && ( (nearest < 0) || (d < nearest) ) ) {
+                                nearest = d;
+                            }
+                        }
+                    }
+                }
+
+                it++;
+            }
+
+            return nearest;
+        }
+
+    }
+} } // opendlv::vehiclecontext::model
@@ -20,7 +20,6 @@
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -28,6 +27,7 @@
 #include "automotivedata/generated/cartesian/Constants.h"
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/ObstacleGrid.h"
 #include "opendlv/vehiclecontext/model/PointSensor.h"
 
 namespace opendlv { namespace vehiclecontext {
@@ -51,7 +51,9 @@ namespace opendlv { namespace vehiclecontext {
             m_faultModelNoise(faultModelNoise),
             m_totalRotation(0),
             m_FOV(),
-            m_sensorPosition()
+            m_sensorPosition(),
+            m_leftBoundaryFOV(),
+            m_rightBoundaryFOV()
         {}
 
         PointSensor::~PointSensor() {}
@@ -83,73 +85,21 @@ namespace opendlv { namespace vehiclecontext {
             FOV.add(m_sensorPosition);
             m_FOV = FOV;
 
+            // Polygon sorts its vertices; keep the triangle's corners for the spatial index.
+            m_leftBoundaryFOV = leftBoundaryFOV;
+            m_rightBoundaryFOV = rightBoundaryFOV;
+
             return m_FOV;
         }
 
-        bool PointSensor::isInFOV(const Point3 &pt) const {
-            bool retVal = false;
-
-            // Calculate angle deviation.
-            double angleDelta = (pt - m_sensorPosition).getAngleXY() - m_totalRotation;
-
-            // If total rotation angle is negative, normalize angleDelta.
-            if (m_totalRotation < 0) {
-                // Normalize angle to interval -PI ... PI.
-                while (angleDelta < -cartesian::Constants::PI) {
-                    angleDelta += 2.0*cartesian::Constants::PI;
-                }
-                while (angleDelta > cartesian::Constants::PI) {
-                    angleDelta -= 2.0*cartesian::Constants::PI;
-                }
-            }
+        double PointSensor::getDistance(const ObstacleGrid &obstacleGrid) {
+            const double distanceToSensor = obstacleGrid.getNearestDistance(m_sensorPosition, m_leftBoundaryFOV, m_rightBoundaryFOV);
 
-//           cerr << m_name << " angleDelta: " << angleDelta << ", totalRotation: " << m_totalRotation << ", left: " << (m_totalRotation + (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) << ", right: " << (m_totalRotation - (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) << ", " << (m_totalRotation + angleDelta) << endl;
-
-            // Check if the point is within the FOV.
-            if ( ( ((m_totalRotation + angleDelta) > (m_totalRotation - (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD)) &&
-                   ((m_totalRotation + angleDelta) < (m_totalRotation + (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD)) ) || 
-                 ( (fabs((m_totalRotation - (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) - (m_totalRotation + angleDelta)) < 1e-4) ||
-                   (fabs((m_totalRotation + (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) - (m_totalRotation + angleDelta)) < 1e-4) )
-               ) {
-                // Distance found.
-//              cerr << "Object's distance: " << (pt - m_sensorPosition).lengthXY() << ", Pos: " << pt.toString() << ", angleDelta: " << angleDelta << endl;
-                retVal = true;
-            }
-
-            return retVal;
+            return applyFaultModel(distanceToSensor);
         }
 
-        double PointSensor::getDistance(map<uint32_t, opendlv::data::environment::Polygon> &mapOfPolygons) {
-            Point3 nearest;
-            double distanceToSensor = -1;
-
-            map<uint32_t, opendlv::data::environment::Polygon>::const_iterator it = mapOfPolygons.begin();
-            while (it != mapOfPolygons.end()) {
-                Polygon p = it->second;
-
-                // Get overlapping parts of polygon...
-                Polygon contour = m_FOV.intersectIgnoreZ(p);
-
-                if (contour.getSize() > 0) {
-                    // Get nearest point from contour.
-                    const vector<Point3> listOfPoints = contour.getVertices();
-                    vector<Point3>::const_iterator jt = listOfPoints.begin();
-
-                    while (jt != listOfPoints.end()) {
-                        Point3 pt = (*jt++);
-                        double d = (pt - m_sensorPosition).lengthXY();
-
-                        if (isInFOV(pt)) {
-                            if ((distanceToSensor < 0) || (d < distanceToSensor)) {
-                                nearest = pt;
-                                distanceToSensor = d;
-                            }
-                        }
-                    }
-                }
-
-                it++;
-            }
+        double PointSensor::applyFaultModel(const double &distance) {
+            double distanceToSensor = distance;
 
             if (distanceToSensor > m_clampDistance) {
                 distanceToSensor = -1;
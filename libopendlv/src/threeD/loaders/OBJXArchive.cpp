@@ -82,6 +82,7 @@ namespace opendlv {
                 m_mapOfMaterials.clear();
 
                 if (m_mtlFile.str().length() > 0) {
+                    m_mtlFile.clear();
                     m_mtlFile.seekg(ios::beg);
                     string line = "";
                     Material m;
@@ -167,7 +168,6 @@ namespace opendlv {
             TransformGroup* OBJXArchive::createTransformGroup(const NodeDescriptor &nd) {
                 TransformGroup *returnableModel = NULL;
                 TransformGroup *rotatedModel = NULL;
-                uint32_t triangleCounter = 0;
 
                 // Read materials.
                 createMapOfMaterials();
@@ -185,11 +185,34 @@ namespace opendlv {
                     returnableModel = new TransformGroup(nd);
                     returnableModel->addChild(rotatedModel);
 
+                    const vector<TriangleSet> listOfTriangleSets = parseTriangleSets();
+                    vector<TriangleSet>::const_iterator it = listOfTriangleSets.begin();
+                    while (it != listOfTriangleSets.end()) {
+                        model->addChild(new TriangleSet(*it++));
+                    }
+                }
+
+                return returnableModel;
+            }
+
+            vector<TriangleSet> OBJXArchive::getListOfTriangleSets() {
+                // Read materials but do not set up any textures.
+                createMapOfMaterials();
+
+                return parseTriangleSets();
+            }
+
+            vector<TriangleSet> OBJXArchive::parseTriangleSets() {
+                vector<TriangleSet> listOfTriangleSets;
+                uint32_t triangleCounter = 0;
+
+                if (m_objFile.str().length() > 0) {
                     // Parse all available vertices.
                     vector<Point3> listOfVertices;
                     vector<Point3> listOfNormals;
                     vector<Point3> listOfTextureCoordinates;
 
+                    m_objFile.clear();
                     m_objFile.seekg(ios::beg);
                     string line = "";
                     while (getline(m_objFile, line)) {
@@ -233,26 +256,23 @@ namespace opendlv {
                     m_objFile.seekg(ios::beg);
                     line = "";
                     // Add root triangle set if no groups are defined.
-                    TriangleSet *triangleSet = new TriangleSet();
-                    model->addChild(triangleSet);
+                    listOfTriangleSets.push_back(TriangleSet());
                     bool has_g = false;
                     while (getline(m_objFile, line)) {
                         if (line.find("g ") != string::npos) {
                             // Add new group.
-                            triangleSet = new TriangleSet(NodeDescriptor());
-                            model->addChild(triangleSet);
+                            listOfTriangleSets.push_back(TriangleSet(NodeDescriptor()));
                             has_g = true;
                         }
 
                         if ( (line.find("usemtl ") != string::npos) && (line.length() > 8) ) {
                             // Add new group.
                             if (!has_g) {
-                                triangleSet = new TriangleSet(NodeDescriptor());
-                                model->addChild(triangleSet);
+                                listOfTriangleSets.push_back(TriangleSet(NodeDescriptor()));
                             }
 
                             Material m = m_mapOfMaterials[line.substr(7)];
-                            triangleSet->setMaterial(m);
+                            listOfTriangleSets.back().setMaterial(m);
                         }
 
                         if (line.find("f ") != string::npos) {
@@ -289,13 +309,13 @@ namespace opendlv {
                                 }
 
                                 // Add the result.
-                                if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
+                                if ( vertices.size() == 3 ) {
                                     Triangle t;
                                     t.setVertices(vertices[0], vertices[1], vertices[2]);
                                     if (!normals.empty()) {
                                         t.setNormal(normals[0]);
                                     }
-                                    triangleSet->addTriangle(t);
+                                    listOfTriangleSets.back().addTriangle(t);
                                     triangleCounter++;
                                 }
                             } else if (line.find("/") == string::npos) {
@@ -314,10 +334,10 @@ namespace opendlv {
                                 }
 
                                 // Add the result.
-                                if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
+                                if ( vertices.size() == 3 ) {
                                     Triangle t;
                                     t.setVertices(vertices[0], vertices[1], vertices[2]);
-                                    triangleSet->addTriangle(t);
+                                    listOfTriangleSets.back().addTriangle(t);
                                     triangleCounter++;
                                 }
                             } else {
@@ -359,7 +379,7 @@ namespace opendlv {
                                     }
 
                                     // Add the result.
-                                    if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
+                                    if ( vertices.size() == 3 ) {
                                         Triangle t;
                                         t.setVertices(vertices[0], vertices[1], vertices[2]);
                                         if (!normals.empty()) {
@@ -368,7 +388,7 @@ namespace opendlv {
                                         if (textureCoordinates.size() == 3) {
                                             t.setTextureCoordinates(textureCoordinates[0], textureCoordinates[1], textureCoordinates[2]);
                                         }
-                                        triangleSet->addTriangle(t);
+                                        listOfTriangleSets.back().addTriangle(t);
                                         triangleCounter++;
                                     }
                                 } else if (numberOfSlashes == 1) {
@@ -399,13 +419,13 @@ namespace opendlv {
                                     }
 
                                     // Add the result.
-                                    if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
+                                    if ( vertices.size() == 3 ) {
                                         Triangle t;
                                         t.setVertices(vertices[0], vertices[1], vertices[2]);
                                         if (textureCoordinates.size() == 3) {
                                             t.setTextureCoordinates(textureCoordinates[0], textureCoordinates[1], textureCoordinates[2]);
                                         }
-                                        triangleSet->addTriangle(t);
+                                        listOfTriangleSets.back().addTriangle(t);
                                         triangleCounter++;
                                     }
                                 } else {
@@ -419,7 +439,7 @@ namespace opendlv {
 
                 clog << "Model contains " << triangleCounter << " triangles." << endl;
 
-                return returnableModel;
+                return listOfTriangleSets;
             }
 
             void OBJXArchive::addImage(const string &name, core::wrapper::Image *image) {
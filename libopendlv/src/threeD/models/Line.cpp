@@ -59,6 +59,22 @@ namespace opendlv {
 
             Line::~Line() {}
 
+            const Point3 Line::getPositionA() const {
+                return m_positionA;
+            }
+
+            const Point3 Line::getPositionB() const {
+                return m_positionB;
+            }
+
+            const Point3 Line::getColor() const {
+                return m_color;
+            }
+
+            float Line::getWidth() const {
+                return m_width;
+            }
+
             Line& Line::operator=(const Line &obj) {
                 setNodeDescriptor(obj.getNodeDescriptor()),
                 m_positionA = obj.m_positionA;
@@ -66,6 +66,18 @@ namespace opendlv {
 
             Polygon::~Polygon() {}
 
+            vector<Point3> Polygon::getListOfGroundVertices() const {
+                return m_listOfGroundVertices;
+            }
+
+            const Point3 Polygon::getColor() const {
+                return m_color;
+            }
+
+            float Polygon::getHeight() const {
+                return m_height;
+            }
+
             Polygon& Polygon::operator=(const Polygon &obj) {
                 setNodeDescriptor(obj.getNodeDescriptor());
                 m_listOfGroundVertices = obj.m_listOfGroundVertices;
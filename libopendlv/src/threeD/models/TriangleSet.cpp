@@ -102,6 +102,14 @@ namespace opendlv {
                 m_material = material;
             }
 
+            const Material TriangleSet::getMaterial() const {
+                return m_material;
+            }
+
+            vector<Point3> TriangleSet::getVertices() const {
+                return m_vertices;
+            }
+
             void TriangleSet::compile() const {
                 m_callList = glGenLists(1);
                 glNewList(m_callList, GL_COMPILE);
@@ -0,0 +1,125 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "automotivedata/generated/cartesian/Constants.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/threeD/raycasting/RaycastingCamera.h"
+#include "opendlv/threeD/raycasting/RaycastingScene.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace raycasting {
+
+            using namespace std;
+            using namespace opendlv::data::environment;
+
+            const float RaycastingCamera::AMBIENT = 0.3f;
+            // Normalized direction towards the light source.
+            const float RaycastingCamera::LIGHT[3] = { 0.3f, 0.2f, 0.932738f };
+
+            RaycastingCamera::RaycastingCamera(const RaycastingScene &scene, const uint32_t &width, const uint32_t &height, const double &fieldOfViewY, const double &maximumDistance) :
+                m_scene(scene),
+                m_width(width),
+                m_height(height),
+                m_fieldOfViewY(fieldOfViewY),
+                m_maximumDistance(static_cast<float>(maximumDistance)),
+                m_numberOfThreads(0) {}
+
+            RaycastingCamera::~RaycastingCamera() {}
+
+            uint32_t RaycastingCamera::getWidth() const {
+                return m_width;
+            }
+
+            uint32_t RaycastingCamera::getHeight() const {
+                return m_height;
+            }
+
+            void RaycastingCamera::setNumberOfThreads(const uint32_t &numberOfThreads) {
+                m_numberOfThreads = numberOfThreads;
+            }
+
+            void RaycastingCamera::render(const Point3 &position, const double &heading, const double &pitch, unsigned char *image, float *depth) const {
+                if ( (image == NULL) || (m_width == 0) || (m_height == 0) ) {
+                    return;
+                }
+
+                const double tanY = tan(m_fieldOfViewY * cartesian::Constants::DEG2RAD / 2.0);
+                const double tanX = tanY * m_width / m_height;
+
+                // Camera frame: forward, right, and up.
+                const double f[3] = { cos(heading) * cos(pitch), sin(heading) * cos(pitch), sin(pitch) };
+                const double r[3] = { sin(heading), -cos(heading), 0 };
+                const double u[3] = { r[1] * f[2], -r[0] * f[2], r[0] * f[1] - r[1] * f[0] };
+                const float origin[3] = { static_cast<float>(position.getX()), static_cast<float>(position.getY()), static_cast<float>(position.getZ()) };
+
+                // Each task renders two rows.
+                RaycastingScene::parallelFor((m_height + 1) / 2, m_numberOfThreads, [&](const uint32_t &task) {
+                    const uint32_t y0 = 2 * task;
+                    for (uint32_t x0 = 0; x0 < m_width; x0 += 2) {
+                        RayPacket packet;
+                        for (uint32_t k = 0; k < RayPacket::SIZE; k++) {
+                            // Rays outside of odd sized images repeat the last pixel.
+                            const uint32_t x = min(x0 + (k & 1), m_width - 1);
+                            const uint32_t y = min(y0 + (k >> 1), m_height - 1);
+                            const double sx = ((x + 0.5) * 2.0 / m_width - 1.0) * tanX;
+                            const double sy = (1.0 - (y + 0.5) * 2.0 / m_height) * tanY;
+
+                            double d[3] = { f[0] + sx * r[0] + sy * u[0], f[1] + sx * r[1] + sy * u[1], f[2] + sx * r[2] + sy * u[2] };
+                            const double length = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+                            const float direction[3] = { static_cast<float>(d[0] / length), static_cast<float>(d[1] / length), static_cast<float>(d[2] / length) };
+                            packet.setRay(k, origin, direction, m_maximumDistance);
+                        }
+
+                        m_scene.intersect(packet);
+
+                        for (uint32_t k = 0; k < RayPacket::SIZE; k++) {
+                            const uint32_t x = x0 + (k & 1);
+                            const uint32_t y = y0 + (k >> 1);
+                            if ( (x < m_width) && (y < m_height) ) {
+                                const uint32_t hit = packet.m_hit[k];
+                                const float *color = m_scene.getColor(hit);
+
+                                // Two sided Lambertian shading.
+                                float shade = 1.0f;
+                                if (hit != RaycastingScene::NO_HIT) {
+                                    const float *n = m_scene.getNormal(hit);
+                                    shade = AMBIENT + (1.0f - AMBIENT) * fabs(n[0] * LIGHT[0] + n[1] * LIGHT[1] + n[2] * LIGHT[2]);
+                                }
+
+                                unsigned char *pixel = image + 3 * (y * m_width + x);
+                                pixel[0] = static_cast<unsigned char>(min(255.0f, 255.0f * color[2] * shade));
+                                pixel[1] = static_cast<unsigned char>(min(255.0f, 255.0f * color[1] * shade));
+                                pixel[2] = static_cast<unsigned char>(min(255.0f, 255.0f * color[0] * shade));
+
+                                if (depth != NULL) {
+                                    depth[y * m_width + x] = (hit != RaycastingScene::NO_HIT) ? packet.m_distance[k] : 0;
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+
+        }
+    }
+} // opendlv::threeD::raycasting
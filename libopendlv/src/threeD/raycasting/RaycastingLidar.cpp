@@ -0,0 +1,142 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <atomic>
+#include <cmath>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "automotivedata/generated/cartesian/Constants.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/threeD/raycasting/RaycastingLidar.h"
+#include "opendlv/threeD/raycasting/RaycastingScene.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace raycasting {
+
+            using namespace std;
+            using namespace opendlv::data::environment;
+
+            const uint32_t RaycastingLidar::NUMBER_OF_COMPONENTS_PER_POINT = 4;
+
+            RaycastingLidar::RaycastingLidar(const RaycastingScene &scene, const vector<float> &verticalAngles, const float &startAzimuth, const float &endAzimuth, const float &azimuthIncrement, const double &maximumDistance) :
+                m_scene(scene),
+                m_verticalAngles(verticalAngles),
+                m_sinVertical(),
+                m_cosVertical(),
+                m_azimuths(),
+                m_sinAzimuth(),
+                m_cosAzimuth(),
+                m_maximumDistance(static_cast<float>(maximumDistance)),
+                m_numberOfThreads(0) {
+                for (uint32_t l = 0; l < m_verticalAngles.size(); l++) {
+                    m_sinVertical.push_back(static_cast<float>(sin(m_verticalAngles[l] * cartesian::Constants::DEG2RAD)));
+                    m_cosVertical.push_back(static_cast<float>(cos(m_verticalAngles[l] * cartesian::Constants::DEG2RAD)));
+                }
+
+                const uint32_t numberOfAzimuths = (azimuthIncrement > 0) && (endAzimuth > startAzimuth) ? static_cast<uint32_t>(floor((endAzimuth - startAzimuth) / azimuthIncrement + 0.5f)) : 0;
+                for (uint32_t a = 0; a < numberOfAzimuths; a++) {
+                    const float azimuth = startAzimuth + a * azimuthIncrement;
+                    m_azimuths.push_back(azimuth);
+                    m_sinAzimuth.push_back(static_cast<float>(sin(azimuth * cartesian::Constants::DEG2RAD)));
+                    m_cosAzimuth.push_back(static_cast<float>(cos(azimuth * cartesian::Constants::DEG2RAD)));
+                }
+            }
+
+            RaycastingLidar::~RaycastingLidar() {}
+
+            uint32_t RaycastingLidar::getNumberOfLayers() const {
+                return static_cast<uint32_t>(m_verticalAngles.size());
+            }
+
+            uint32_t RaycastingLidar::getNumberOfAzimuths() const {
+                return static_cast<uint32_t>(m_azimuths.size());
+            }
+
+            uint32_t RaycastingLidar::getNumberOfPoints() const {
+                return getNumberOfLayers() * getNumberOfAzimuths();
+            }
+
+            void RaycastingLidar::setNumberOfThreads(const uint32_t &numberOfThreads) {
+                m_numberOfThreads = numberOfThreads;
+            }
+
+            uint32_t RaycastingLidar::scan(const Point3 &position, const double &heading, float *points) const {
+                const uint32_t numberOfLayers = getNumberOfLayers();
+                const uint32_t numberOfAzimuths = getNumberOfAzimuths();
+                if ( (points == NULL) || (numberOfLayers == 0) || (numberOfAzimuths == 0) ) {
+                    return 0;
+                }
+
+                // Sensor frame: forward and right.
+                const float f[2] = { static_cast<float>(cos(heading)), static_cast<float>(sin(heading)) };
+                const float r[2] = { static_cast<float>(sin(heading)), static_cast<float>(-cos(heading)) };
+                const float origin[3] = { static_cast<float>(position.getX()), static_cast<float>(position.getY()), static_cast<float>(position.getZ()) };
+
+                std::atomic<uint32_t> numberOfReflections(0);
+                RaycastingScene::parallelFor((numberOfAzimuths + AZIMUTHS_PER_TASK - 1) / AZIMUTHS_PER_TASK, m_numberOfThreads, [&](const uint32_t &task) {
+                    uint32_t reflections = 0;
+                    const uint32_t lastAzimuth = min(numberOfAzimuths, (task + 1) * AZIMUTHS_PER_TASK);
+                    for (uint32_t a = task * AZIMUTHS_PER_TASK; a < lastAzimuth; a++) {
+                        const float horizontal[2] = { m_sinAzimuth[a] * r[0] + m_cosAzimuth[a] * f[0], m_sinAzimuth[a] * r[1] + m_cosAzimuth[a] * f[1] };
+
+                        for (uint32_t l = 0; l < numberOfLayers; l += RayPacket::SIZE) {
+                            RayPacket packet;
+                            for (uint32_t k = 0; k < RayPacket::SIZE; k++) {
+                                // Missing layers in the last packet repeat the last layer.
+                                const uint32_t layer = min(l + k, numberOfLayers - 1);
+                                const float direction[3] = { m_cosVertical[layer] * horizontal[0], m_cosVertical[layer] * horizontal[1], m_sinVertical[layer] };
+                                packet.setRay(k, origin, direction, m_maximumDistance);
+                            }
+
+                            m_scene.intersect(packet);
+
+                            for (uint32_t k = 0; (k < RayPacket::SIZE) && ((l + k) < numberOfLayers); k++) {
+                                const uint32_t layer = l + k;
+                                const uint32_t hit = packet.m_hit[k];
+                                float *point = points + NUMBER_OF_COMPONENTS_PER_POINT * (a * numberOfLayers + layer);
+
+                                point[0] = 0;
+                                point[1] = m_azimuths[a];
+                                point[2] = m_verticalAngles[layer];
+                                point[3] = 0;
+
+                                if (hit != RaycastingScene::NO_HIT) {
+                                    // Brighter surfaces facing the sensor reflect more.
+                                    const float *color = m_scene.getColor(hit);
+                                    const float *n = m_scene.getNormal(hit);
+                                    const float luminance = 0.299f * color[0] + 0.587f * color[1] + 0.114f * color[2];
+                                    const float incidence = fabs(n[0] * packet.m_directionX[k] + n[1] * packet.m_directionY[k] + n[2] * packet.m_directionZ[k]);
+
+                                    point[0] = packet.m_distance[k];
+                                    point[3] = min(255.0f, 255.0f * luminance * incidence);
+                                    reflections++;
+                                }
+                            }
+                        }
+                    }
+                    numberOfReflections += reflections;
+                });
+
+                return numberOfReflections;
+            }
+
+        }
+    }
+} // opendlv::threeD::raycasting
@@ -0,0 +1,716 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "automotivedata/generated/cartesian/Constants.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/scenario/ComplexModel.h"
+#include "opendlv/data/scenario/Scenario.h"
+#include "opendlv/data/scenario/Vertex3.h"
+#include "opendlv/scenario/SCNXArchive.h"
+#include "opendlv/scenario/ScenarioOpenGLSceneTransformation.h"
+#include "opendlv/threeD/Material.h"
+#include "opendlv/threeD/Node.h"
+#include "opendlv/threeD/TransformGroup.h"
+#include "opendlv/threeD/loaders/OBJXArchive.h"
+#include "opendlv/threeD/loaders/OBJXArchiveFactory.h"
+#include "opendlv/threeD/models/Line.h"
+#include "opendlv/threeD/models/Polygon.h"
+#include "opendlv/threeD/models/TriangleSet.h"
+#include "opendlv/threeD/raycasting/RaycastingScene.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace raycasting {
+
+            using namespace std;
+            using namespace opendlv::data::environment;
+            using namespace threeD::loaders;
+
+            RayPacket::RayPacket() :
+                m_originX(),
+                m_originY(),
+                m_originZ(),
+                m_directionX(),
+                m_directionY(),
+                m_directionZ(),
+                m_distance(),
+                m_hit() {
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    m_hit[i] = RaycastingScene::NO_HIT;
+                }
+            }
+
+            void RayPacket::setRay(const uint32_t &i, const float *origin, const float *direction, const float &maximumDistance) {
+                m_originX[i] = origin[0];
+                m_originY[i] = origin[1];
+                m_originZ[i] = origin[2];
+                m_directionX[i] = direction[0];
+                m_directionY[i] = direction[1];
+                m_directionZ[i] = direction[2];
+                m_distance[i] = maximumDistance;
+                m_hit[i] = RaycastingScene::NO_HIT;
+            }
+
+            const uint32_t RaycastingScene::NO_HIT = 0xFFFFFFFF;
+            const uint32_t RaycastingScene::GROUND = 0xFFFFFFFE;
+            const float RaycastingScene::LINE_WIDTH_PER_PIXEL = 0.02f;
+            const float RaycastingScene::EPSILON = 1e-6f;
+            // Flat features like lane markings are lifted above the ground to be always visible.
+            const float RaycastingScene::LIFT = 1e-3f;
+
+            RaycastingScene::BVHNode::BVHNode() :
+                m_minimum(),
+                m_maximum(),
+                m_first(0),
+                m_count(0),
+                m_axis(0) {}
+
+            RaycastingScene::RaycastingScene() :
+                m_triangles(),
+                m_normals(),
+                m_colors(),
+                m_nodes(),
+                m_ground(true),
+                m_groundColor(),
+                m_groundNormal(),
+                m_skyColor() {
+                setGroundColor(Point3(0.3, 0.3, 0.3));
+                setSkyColor(Point3(0, 0.58, 0.78));
+                m_groundNormal[2] = 1;
+            }
+
+            RaycastingScene::~RaycastingScene() {}
+
+            void RaycastingScene::addTriangle(const Point3 &a, const Point3 &b, const Point3 &c, const Point3 &color) {
+                const float fa[3] = { static_cast<float>(a.getX()), static_cast<float>(a.getY()), static_cast<float>(a.getZ()) };
+                const float fb[3] = { static_cast<float>(b.getX()), static_cast<float>(b.getY()), static_cast<float>(b.getZ()) };
+                const float fc[3] = { static_cast<float>(c.getX()), static_cast<float>(c.getY()), static_cast<float>(c.getZ()) };
+                const float fcolor[3] = { static_cast<float>(color.getX()), static_cast<float>(color.getY()), static_cast<float>(color.getZ()) };
+                addTriangle(fa, fb, fc, fcolor);
+            }
+
+            void RaycastingScene::addTriangle(const float *a, const float *b, const float *c, const float *color) {
+                Triangle t;
+                for (uint32_t i = 0; i < 3; i++) {
+                    t.m_vertex[i] = a[i];
+                    t.m_edge1[i] = b[i] - a[i];
+                    t.m_edge2[i] = c[i] - a[i];
+                }
+
+                float n[3] = { t.m_edge1[1] * t.m_edge2[2] - t.m_edge1[2] * t.m_edge2[1],
+                               t.m_edge1[2] * t.m_edge2[0] - t.m_edge1[0] * t.m_edge2[2],
+                               t.m_edge1[0] * t.m_edge2[1] - t.m_edge1[1] * t.m_edge2[0] };
+                const float length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+                // Degenerated triangles cannot be hit.
+                if (length > EPSILON * EPSILON) {
+                    m_triangles.push_back(t);
+                    for (uint32_t i = 0; i < 3; i++) {
+                        m_normals.push_back(n[i] / length);
+                        m_colors.push_back(color[i]);
+                    }
+                }
+            }
+
+            void RaycastingScene::addPolygon(const vector<Point3> &vertices, const float &height, const Point3 &color) {
+                const float top = max(height, LIFT);
+                const float fcolor[3] = { static_cast<float>(color.getX()), static_cast<float>(color.getY()), static_cast<float>(color.getZ()) };
+
+                // Walls like rendered by models::Polygon.
+                if (height > LIFT) {
+                    for (uint32_t i = 0; (i + 1) < vertices.size(); i++) {
+                        const float p1[3] = { static_cast<float>(vertices[i].getX()), static_cast<float>(vertices[i].getY()), 0 };
+                        const float p2[3] = { static_cast<float>(vertices[i+1].getX()), static_cast<float>(vertices[i+1].getY()), 0 };
+                        const float p1h[3] = { p1[0], p1[1], top };
+                        const float p2h[3] = { p2[0], p2[1], top };
+
+                        addTriangle(p1, p2, p2h, fcolor);
+                        addTriangle(p1, p2h, p1h, fcolor);
+                    }
+                }
+
+                // Top of the polygon as triangle fan.
+                for (uint32_t i = 1; (i + 1) < vertices.size(); i++) {
+                    const float p0[3] = { static_cast<float>(vertices[0].getX()), static_cast<float>(vertices[0].getY()), top };
+                    const float p1[3] = { static_cast<float>(vertices[i].getX()), static_cast<float>(vertices[i].getY()), top };
+                    const float p2[3] = { static_cast<float>(vertices[i+1].getX()), static_cast<float>(vertices[i+1].getY()), top };
+
+                    addTriangle(p0, p1, p2, fcolor);
+                }
+            }
+
+            void RaycastingScene::addLine(const Point3 &a, const Point3 &b, const float &width, const Point3 &color) {
+                Point3 direction = b - a;
+                direction.setZ(0);
+                if (direction.lengthXY() > EPSILON) {
+                    direction.normalizeXY();
+
+                    // Lines are rendered as flat strip on the ground.
+                    const double halfWidth = 0.5 * width * LINE_WIDTH_PER_PIXEL;
+                    const Point3 side(-direction.getY() * halfWidth, direction.getX() * halfWidth, LIFT);
+
+                    const Point3 a1 = a + side;
+                    const Point3 b1 = b + side;
+                    const Point3 a2 = a - side + Point3(0, 0, 2 * LIFT);
+                    const Point3 b2 = b - side + Point3(0, 0, 2 * LIFT);
+
+                    addTriangle(a2, b2, b1, color);
+                    addTriangle(a2, b1, a1, color);
+                }
+            }
+
+            void RaycastingScene::visit(Node *nd) {
+                models::Polygon *polygon = dynamic_cast<models::Polygon*>(nd);
+                if (polygon != NULL) {
+                    addPolygon(polygon->getListOfGroundVertices(), polygon->getHeight(), polygon->getColor());
+                    return;
+                }
+
+                models::Line *line = dynamic_cast<models::Line*>(nd);
+                if (line != NULL) {
+                    addLine(line->getPositionA(), line->getPositionB(), line->getWidth(), line->getColor());
+                    return;
+                }
+
+                models::TriangleSet *triangleSet = dynamic_cast<models::TriangleSet*>(nd);
+                if (triangleSet != NULL) {
+                    const Point3 color = triangleSet->getMaterial().getDiffuse();
+                    const vector<Point3> vertices = triangleSet->getVertices();
+                    for (uint32_t i = 0; (i + 2) < vertices.size(); i += 3) {
+                        addTriangle(vertices[i], vertices[i+1], vertices[i+2], color);
+                    }
+                }
+            }
+
+            void RaycastingScene::addSCNXArchive(scenario::SCNXArchive &scnxArchive) {
+                // Surroundings and lanes.
+                scenario::ScenarioOpenGLSceneTransformation scnOpenGL(false);
+                scnxArchive.getScenario().accept(scnOpenGL);
+
+                TransformGroup *root = scnOpenGL.getRoot();
+                if (root != NULL) {
+                    root->accept(*this);
+                    OPENDAVINCI_CORE_DELETE_POINTER(root);
+                }
+
+                addComplexModels(scnxArchive);
+            }
+
+            void RaycastingScene::addComplexModels(scenario::SCNXArchive &scnxArchive) {
+                vector<data::scenario::ComplexModel*> listOfComplexModels = scnxArchive.getListOfGroundBasedComplexModels();
+
+                vector<data::scenario::ComplexModel*>::iterator jt = listOfComplexModels.begin();
+                while (jt != listOfComplexModels.end()) {
+                    data::scenario::ComplexModel *cm = (*jt++);
+                    std::shared_ptr<istream> in = scnxArchive.getModelData(cm->getModelFile());
+                    if (in.get()) {
+                        OBJXArchive *objxArchive = NULL;
+                        if (cm->getModelFile().find(".objx") != string::npos) {
+                            objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchive(*in);
+                        } else if (cm->getModelFile().find(".obj") != string::npos) {
+                            objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchiveFromPlainOBJFile(*in);
+                        }
+
+                        if (objxArchive != NULL) {
+                            // Same transformation as done by GroundBasedComplexModelLoader and OBJXArchive.
+                            const Point3 translation(cm->getPosition());
+                            const Point3 rotation(cm->getRotation().getX(), cm->getRotation().getZ(), cm->getRotation().getY());
+
+                            const vector<models::TriangleSet> listOfTriangleSets = objxArchive->getListOfTriangleSets();
+                            vector<models::TriangleSet>::const_iterator it = listOfTriangleSets.begin();
+                            while (it != listOfTriangleSets.end()) {
+                                const Point3 color = it->getMaterial().getDiffuse();
+                                vector<Point3> vertices = it->getVertices();
+                                for (uint32_t i = 0; i < vertices.size(); i++) {
+                                    vertices[i].rotateX(cartesian::Constants::PI/2.0);
+                                    vertices[i].rotateZ(rotation.getZ());
+                                    vertices[i].rotateY(rotation.getY());
+                                    vertices[i].rotateX(rotation.getX());
+                                    vertices[i] += translation;
+                                }
+                                for (uint32_t i = 0; (i + 2) < vertices.size(); i += 3) {
+                                    addTriangle(vertices[i], vertices[i+1], vertices[i+2], color);
+                                }
+                                it++;
+                            }
+
+                            OPENDAVINCI_CORE_DELETE_POINTER(objxArchive);
+                        }
+                        else {
+                            clog << "OBJ model could not be opened." << endl;
+                        }
+                    }
+                }
+            }
+
+            void RaycastingScene::build() {
+                m_nodes.clear();
+
+                const uint32_t numberOfTriangles = static_cast<uint32_t>(m_triangles.size());
+                if (numberOfTriangles == 0) {
+                    return;
+                }
+
+                vector<float> bounds(6 * numberOfTriangles);
+                vector<float> centroids(3 * numberOfTriangles);
+                vector<uint32_t> indices(numberOfTriangles);
+                for (uint32_t i = 0; i < numberOfTriangles; i++) {
+                    const Triangle &t = m_triangles[i];
+                    for (uint32_t a = 0; a < 3; a++) {
+                        const float v0 = t.m_vertex[a];
+                        const float v1 = v0 + t.m_edge1[a];
+                        const float v2 = v0 + t.m_edge2[a];
+                        bounds[6 * i + a] = min(v0, min(v1, v2));
+                        bounds[6 * i + 3 + a] = max(v0, max(v1, v2));
+                        centroids[3 * i + a] = 0.5f * (bounds[6 * i + a] + bounds[6 * i + 3 + a]);
+                    }
+                    indices[i] = i;
+                }
+
+                m_nodes.reserve(2 * numberOfTriangles);
+                m_nodes.push_back(BVHNode());
+                subdivide(0, 0, numberOfTriangles, 0, indices, bounds, centroids);
+
+                // Store the triangles in the order of the leaves.
+                vector<Triangle> triangles(numberOfTriangles);
+                vector<float> normals(3 * numberOfTriangles);
+                vector<float> colors(3 * numberOfTriangles);
+                for (uint32_t i = 0; i < numberOfTriangles; i++) {
+                    triangles[i] = m_triangles[indices[i]];
+                    for (uint32_t a = 0; a < 3; a++) {
+                        normals[3 * i + a] = m_normals[3 * indices[i] + a];
+                        colors[3 * i + a] = m_colors[3 * indices[i] + a];
+                    }
+                }
+                m_triangles.swap(triangles);
+                m_normals.swap(normals);
+                m_colors.swap(colors);
+            }
+
+            void RaycastingScene::subdivide(const uint32_t &node, const uint32_t &first, const uint32_t &count, const uint32_t &depth, vector<uint32_t> &indices, const vector<float> &bounds, const vector<float> &centroids) {
+                float centroidMinimum[3] = { 0, 0, 0 };
+                float centroidMaximum[3] = { 0, 0, 0 };
+                {
+                    BVHNode &n = m_nodes[node];
+                    for (uint32_t a = 0; a < 3; a++) {
+                        n.m_minimum[a] = bounds[6 * indices[first] + a];
+                        n.m_maximum[a] = bounds[6 * indices[first] + 3 + a];
+                        centroidMinimum[a] = centroidMaximum[a] = centroids[3 * indices[first] + a];
+                    }
+                    for (uint32_t i = first + 1; i < first + count; i++) {
+                        for (uint32_t a = 0; a < 3; a++) {
+                            n.m_minimum[a] = min(n.m_minimum[a], bounds[6 * indices[i] + a]);
+                            n.m_maximum[a] = max(n.m_maximum[a], bounds[6 * indices[i] + 3 + a]);
+                            centroidMinimum[a] = min(centroidMinimum[a], centroids[3 * indices[i] + a]);
+                            centroidMaximum[a] = max(centroidMaximum[a], centroids[3 * indices[i] + a]);
+                        }
+                    }
+                    n.m_first = first;
+                    n.m_count = count;
+                }
+
+                if ( (count <= MAX_LEAF_SIZE) || (depth >= MAX_DEPTH) ) {
+                    return;
+                }
+
+                // Split along the axis with the largest extent of centroids.
+                uint32_t axis = 0;
+                for (uint32_t a = 1; a < 3; a++) {
+                    if ((centroidMaximum[a] - centroidMinimum[a]) > (centroidMaximum[axis] - centroidMinimum[axis])) {
+                        axis = a;
+                    }
+                }
+                const float extent = centroidMaximum[axis] - centroidMinimum[axis];
+                if (extent < EPSILON) {
+                    return;
+                }
+
+                // Bin the triangles by their centroids.
+                const float scale = NUMBER_OF_BINS * (1.0f - EPSILON) / extent;
+                uint32_t binCount[NUMBER_OF_BINS];
+                float binMinimum[NUMBER_OF_BINS][3];
+                float binMaximum[NUMBER_OF_BINS][3];
+                for (uint32_t b = 0; b < NUMBER_OF_BINS; b++) {
+                    binCount[b] = 0;
+                    for (uint32_t a = 0; a < 3; a++) {
+                        binMinimum[b][a] = numeric_limits<float>::max();
+                        binMaximum[b][a] = -numeric_limits<float>::max();
+                    }
+                }
+                for (uint32_t i = first; i < first + count; i++) {
+                    const uint32_t b = min(static_cast<uint32_t>(NUMBER_OF_BINS - 1), static_cast<uint32_t>((centroids[3 * indices[i] + axis] - centroidMinimum[axis]) * scale));
+                    binCount[b]++;
+                    for (uint32_t a = 0; a < 3; a++) {
+                        binMinimum[b][a] = min(binMinimum[b][a], bounds[6 * indices[i] + a]);
+                        binMaximum[b][a] = max(binMaximum[b][a], bounds[6 * indices[i] + 3 + a]);
+                    }
+                }
+
+                // Surface area heuristic: Find the split with the smallest sum of count * area.
+                float leftCost[NUMBER_OF_BINS];
+                uint32_t leftCount[NUMBER_OF_BINS];
+                {
+                    float minimum[3] = { numeric_limits<float>::max(), numeric_limits<float>::max(), numeric_limits<float>::max() };
+                    float maximum[3] = { -numeric_limits<float>::max(), -numeric_limits<float>::max(), -numeric_limits<float>::max() };
+                    uint32_t sum = 0;
+                    for (uint32_t b = 0; b < NUMBER_OF_BINS; b++) {
+                        sum += binCount[b];
+                        for (uint32_t a = 0; a < 3; a++) {
+                            minimum[a] = min(minimum[a], binMinimum[b][a]);
+                            maximum[a] = max(maximum[a], binMaximum[b][a]);
+                        }
+                        const float dx = maximum[0] - minimum[0];
+                        const float dy = maximum[1] - minimum[1];
+                        const float dz = maximum[2] - minimum[2];
+                        leftCount[b] = sum;
+                        leftCost[b] = (sum > 0) ? sum * (dx * dy + dy * dz + dz * dx) : 0;
+                    }
+                }
+
+                uint32_t bestSplit = 0;
+                float bestCost = numeric_limits<float>::max();
+                {
+                    float minimum[3] = { numeric_limits<float>::max(), numeric_limits<float>::max(), numeric_limits<float>::max() };
+                    float maximum[3] = { -numeric_limits<float>::max(), -numeric_limits<float>::max(), -numeric_limits<float>::max() };
+                    uint32_t sum = 0;
+                    for (uint32_t b = NUMBER_OF_BINS - 1; b > 0; b--) {
+                        sum += binCount[b];
+                        for (uint32_t a = 0; a < 3; a++) {
+                            minimum[a] = min(minimum[a], binMinimum[b][a]);
+                            maximum[a] = max(maximum[a], binMaximum[b][a]);
+                        }
+
+                        // Split between bin b - 1 and b.
+                        if ( (sum > 0) && (leftCount[b - 1] > 0) ) {
+                            const float dx = maximum[0] - minimum[0];
+                            const float dy = maximum[1] - minimum[1];
+                            const float dz = maximum[2] - minimum[2];
+                            const float cost = leftCost[b - 1] + sum * (dx * dy + dy * dz + dz * dx);
+                            if (cost < bestCost) {
+                                bestCost = cost;
+                                bestSplit = b - 1;
+                            }
+                        }
+                    }
+                }
+
+                vector<uint32_t>::iterator middle = partition(indices.begin() + first, indices.begin() + first + count, [&](const uint32_t &i) {
+                    return min(static_cast<uint32_t>(NUMBER_OF_BINS - 1), static_cast<uint32_t>((centroids[3 * i + axis] - centroidMinimum[axis]) * scale)) <= bestSplit;
+                });
+                const uint32_t leftSize = static_cast<uint32_t>(middle - (indices.begin() + first));
+                if ( (leftSize == 0) || (leftSize == count) ) {
+                    return;
+                }
+
+                const uint32_t left = static_cast<uint32_t>(m_nodes.size());
+                m_nodes.push_back(BVHNode());
+                m_nodes.push_back(BVHNode());
+
+                m_nodes[node].m_first = left;
+                m_nodes[node].m_count = 0;
+                m_nodes[node].m_axis = axis;
+
+                subdivide(left, first, leftSize, depth + 1, indices, bounds, centroids);
+                subdivide(left + 1, first + leftSize, count - leftSize, depth + 1, indices, bounds, centroids);
+            }
+
+            uint32_t RaycastingScene::getNumberOfTriangles() const {
+                return static_cast<uint32_t>(m_triangles.size());
+            }
+
+            uint32_t RaycastingScene::getNumberOfNodes() const {
+                return static_cast<uint32_t>(m_nodes.size());
+            }
+
+            void RaycastingScene::setGround(const bool &ground) {
+                m_ground = ground;
+            }
+
+            void RaycastingScene::setGroundColor(const Point3 &color) {
+                m_groundColor[0] = static_cast<float>(color.getX());
+                m_groundColor[1] = static_cast<float>(color.getY());
+                m_groundColor[2] = static_cast<float>(color.getZ());
+            }
+
+            void RaycastingScene::setSkyColor(const Point3 &color) {
+                m_skyColor[0] = static_cast<float>(color.getX());
+                m_skyColor[1] = static_cast<float>(color.getY());
+                m_skyColor[2] = static_cast<float>(color.getZ());
+            }
+
+            const float* RaycastingScene::getColor(const uint32_t &hit) const {
+                if (hit == NO_HIT) {
+                    return m_skyColor;
+                }
+                if (hit == GROUND) {
+                    return m_groundColor;
+                }
+                return &m_colors[3 * hit];
+            }
+
+            const float* RaycastingScene::getNormal(const uint32_t &hit) const {
+                if ( (hit == NO_HIT) || (hit == GROUND) ) {
+                    return m_groundNormal;
+                }
+                return &m_normals[3 * hit];
+            }
+
+            void RaycastingScene::intersect(RayPacket &packet) const {
+                if (!m_nodes.empty()) {
+                    traverse(packet);
+                }
+                if (m_ground) {
+                    intersectGround(packet);
+                }
+            }
+
+            void RaycastingScene::intersectGround(RayPacket &packet) const {
+                for (uint32_t i = 0; i < RayPacket::SIZE; i++) {
+                    if ( (packet.m_directionZ[i] < -EPSILON) && (packet.m_originZ[i] >= 0) ) {
+                        const float t = -packet.m_originZ[i] / packet.m_directionZ[i];
+                        if (t < packet.m_distance[i]) {
+                            packet.m_distance[i] = t;
+                            packet.m_hit[i] = GROUND;
+                        }
+                    }
+                }
+            }
+
+            void RaycastingScene::traverse(RayPacket &packet) const {
+                // Reciprocal directions for the slab tests; axis parallel rays get a huge value instead of infinity.
+                alignas(16) float inverseDirection[3][RayPacket::SIZE];
+                for (uint32_t i = 0; i < RayPacket::SIZE; i++) {
+                    inverseDirection[0][i] = (fabs(packet.m_directionX[i]) > EPSILON) ? 1.0f / packet.m_directionX[i] : 1e30f;
+                    inverseDirection[1][i] = (fabs(packet.m_directionY[i]) > EPSILON) ? 1.0f / packet.m_directionY[i] : 1e30f;
+                    inverseDirection[2][i] = (fabs(packet.m_directionZ[i]) > EPSILON) ? 1.0f / packet.m_directionZ[i] : 1e30f;
+                }
+
+                // Rays of a packet are coherent; thus, the first ray decides which child to visit first.
+                const bool positive[3] = { packet.m_directionX[0] >= 0, packet.m_directionY[0] >= 0, packet.m_directionZ[0] >= 0 };
+
+                uint32_t stack[MAX_DEPTH + 4];
+                uint32_t stackSize = 0;
+                stack[stackSize++] = 0;
+
+#if defined(__SSE2__)
+                const __m128 ox = _mm_load_ps(packet.m_originX);
+                const __m128 oy = _mm_load_ps(packet.m_originY);
+                const __m128 oz = _mm_load_ps(packet.m_originZ);
+                const __m128 dx = _mm_load_ps(packet.m_directionX);
+                const __m128 dy = _mm_load_ps(packet.m_directionY);
+                const __m128 dz = _mm_load_ps(packet.m_directionZ);
+                const __m128 idx = _mm_load_ps(inverseDirection[0]);
+                const __m128 idy = _mm_load_ps(inverseDirection[1]);
+                const __m128 idz = _mm_load_ps(inverseDirection[2]);
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 one = _mm_set1_ps(1.0f);
+                const __m128 epsilon = _mm_set1_ps(EPSILON);
+                const __m128 signMask = _mm_set1_ps(-0.0f);
+                __m128 distance = _mm_load_ps(packet.m_distance);
+                __m128i hit = _mm_load_si128(reinterpret_cast<const __m128i*>(packet.m_hit));
+
+                while (stackSize > 0) {
+                    const BVHNode &node = m_nodes[stack[--stackSize]];
+
+                    // Slab test against the node's bounding box.
+                    __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_minimum[0]), ox), idx);
+                    __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_maximum[0]), ox), idx);
+                    __m128 tNear = _mm_min_ps(t1, t2);
+                    __m128 tFar = _mm_max_ps(t1, t2);
+                    t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_minimum[1]), oy), idy);
+                    t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_maximum[1]), oy), idy);
+                    tNear = _mm_max_ps(tNear, _mm_min_ps(t1, t2));
+                    tFar = _mm_min_ps(tFar, _mm_max_ps(t1, t2));
+                    t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_minimum[2]), oz), idz);
+                    t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_maximum[2]), oz), idz);
+                    tNear = _mm_max_ps(_mm_max_ps(tNear, _mm_min_ps(t1, t2)), zero);
+                    tFar = _mm_min_ps(_mm_min_ps(tFar, _mm_max_ps(t1, t2)), distance);
+                    if (0 == _mm_movemask_ps(_mm_cmple_ps(tNear, tFar))) {
+                        continue;
+                    }
+
+                    if (node.m_count > 0) {
+                        for (uint32_t i = node.m_first; i < node.m_first + node.m_count; i++) {
+                            const Triangle &t = m_triangles[i];
+                            const __m128 e1x = _mm_set1_ps(t.m_edge1[0]);
+                            const __m128 e1y = _mm_set1_ps(t.m_edge1[1]);
+                            const __m128 e1z = _mm_set1_ps(t.m_edge1[2]);
+                            const __m128 e2x = _mm_set1_ps(t.m_edge2[0]);
+                            const __m128 e2y = _mm_set1_ps(t.m_edge2[1]);
+                            const __m128 e2z = _mm_set1_ps(t.m_edge2[2]);
+
+                            // Moeller-Trumbore for four rays at once.
+                            const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+                            const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+                            const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+                            const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+                            const __m128 inverseDet = _mm_div_ps(one, det);
+
+                            const __m128 tx = _mm_sub_ps(ox, _mm_set1_ps(t.m_vertex[0]));
+                            const __m128 ty = _mm_sub_ps(oy, _mm_set1_ps(t.m_vertex[1]));
+                            const __m128 tz = _mm_sub_ps(oz, _mm_set1_ps(t.m_vertex[2]));
+                            const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), inverseDet);
+
+                            const __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+                            const __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+                            const __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+                            const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverseDet);
+                            const __m128 d = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverseDet);
+
+                            // Comparisons with NaN are false; thus, parallel rays are rejected as well.
+                            __m128 valid = _mm_cmpgt_ps(_mm_andnot_ps(signMask, det), _mm_set1_ps(EPSILON * EPSILON));
+                            valid = _mm_and_ps(valid, _mm_cmpge_ps(u, zero));
+                            valid = _mm_and_ps(valid, _mm_cmpge_ps(v, zero));
+                            valid = _mm_and_ps(valid, _mm_cmple_ps(_mm_add_ps(u, v), one));
+                            valid = _mm_and_ps(valid, _mm_cmpgt_ps(d, epsilon));
+                            valid = _mm_and_ps(valid, _mm_cmplt_ps(d, distance));
+
+                            distance = _mm_or_ps(_mm_and_ps(valid, d), _mm_andnot_ps(valid, distance));
+                            const __m128i validi = _mm_castps_si128(valid);
+                            hit = _mm_or_si128(_mm_and_si128(validi, _mm_set1_epi32(static_cast<int>(i))), _mm_andnot_si128(validi, hit));
+                        }
+                    }
+                    else {
+                        // Push the far child first to visit the near one next.
+                        if (positive[node.m_axis]) {
+                            stack[stackSize++] = node.m_first + 1;
+                            stack[stackSize++] = node.m_first;
+                        }
+                        else {
+                            stack[stackSize++] = node.m_first;
+                            stack[stackSize++] = node.m_first + 1;
+                        }
+                    }
+                }
+
+                _mm_store_ps(packet.m_distance, distance);
+                _mm_store_si128(reinterpret_cast<__m128i*>(packet.m_hit), hit);
+#else
+                while (stackSize > 0) {
+                    const BVHNode &node = m_nodes[stack[--stackSize]];
+
+                    bool visit = false;
+                    for (uint32_t r = 0; (r < RayPacket::SIZE) && !visit; r++) {
+                        const float origin[3] = { packet.m_originX[r], packet.m_originY[r], packet.m_originZ[r] };
+                        float tNear = 0;
+                        float tFar = packet.m_distance[r];
+                        for (uint32_t a = 0; a < 3; a++) {
+                            const float t1 = (node.m_minimum[a] - origin[a]) * inverseDirection[a][r];
+                            const float t2 = (node.m_maximum[a] - origin[a]) * inverseDirection[a][r];
+                            tNear = max(tNear, min(t1, t2));
+                            tFar = min(tFar, max(t1, t2));
+                        }
+                        visit = (tNear <= tFar);
+                    }
+                    if (!visit) {
+                        continue;
+                    }
+
+                    if (node.m_count > 0) {
+                        for (uint32_t i = node.m_first; i < node.m_first + node.m_count; i++) {
+                            const Triangle &t = m_triangles[i];
+                            for (uint32_t r = 0; r < RayPacket::SIZE; r++) {
+                                const float d[3] = { packet.m_directionX[r], packet.m_directionY[r], packet.m_directionZ[r] };
+                                const float p[3] = { d[1] * t.m_edge2[2] - d[2] * t.m_edge2[1],
+                                                     d[2] * t.m_edge2[0] - d[0] * t.m_edge2[2],
+                                                     d[0] * t.m_edge2[1] - d[1] * t.m_edge2[0] };
+                                const float det = t.m_edge1[0] * p[0] + t.m_edge1[1] * p[1] + t.m_edge1[2] * p[2];
+                                if (fabs(det) <= EPSILON * EPSILON) {
+                                    continue;
+                                }
+                                const float inverseDet = 1.0f / det;
+
+                                const float tv[3] = { packet.m_originX[r] - t.m_vertex[0], packet.m_originY[r] - t.m_vertex[1], packet.m_originZ[r] - t.m_vertex[2] };
+                                const float u = (tv[0] * p[0] + tv[1] * p[1] + tv[2] * p[2]) * inverseDet;
+                                if ( (u < 0) || (u > 1) ) {
+                                    continue;
+                                }
+
+                                const float q[3] = { tv[1] * t.m_edge1[2] - tv[2] * t.m_edge1[1],
+                                                     tv[2] * t.m_edge1[0] - tv[0] * t.m_edge1[2],
+                                                     tv[0] * t.m_edge1[1] - tv[1] * t.m_edge1[0] };
+                                const float v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inverseDet;
+                                if ( (v < 0) || ((u + v) > 1) ) {
+                                    continue;
+                                }
+
+                                const float distance = (t.m_edge2[0] * q[0] + t.m_edge2[1] * q[1] + t.m_edge2[2] * q[2]) * inverseDet;
+                                if ( (distance > EPSILON) && (distance < packet.m_distance[r]) ) {
+                                    packet.m_distance[r] = distance;
+                                    packet.m_hit[r] = i;
+                                }
+                            }
+                        }
+                    }
+                    else {
+                        // Push the far child first to visit the near one next.
+                        if (positive[node.m_axis]) {
+                            stack[stackSize++] = node.m_first + 1;
+                            stack[stackSize++] = node.m_first;
+                        }
+                        else {
+                            stack[stackSize++] = node.m_first;
+                            stack[stackSize++] = node.m_first + 1;
+                        }
+                    }
+                }
+#endif
+            }
+
+            void RaycastingScene::parallelFor(const uint32_t &numberOfTasks, const uint32_t &numberOfThreads, const std::function<void(const uint32_t &)> &task) {
+                uint32_t threads = (numberOfThreads > 0) ? numberOfThreads : std::thread::hardware_concurrency();
+                threads = max(static_cast<uint32_t>(1), min(threads, numberOfTasks));
+
+                // Threads fetch the next task until all are done to balance uneven workloads.
+                std::atomic<uint32_t> next(0);
+                auto worker = [&]() {
+                    uint32_t i = 0;
+                    while ((i = next.fetch_add(1)) < numberOfTasks) {
+                        task(i);
+                    }
+                };
+
+                vector<std::thread> workers;
+                for (uint32_t i = 1; i < threads; i++) {
+                    workers.push_back(std::thread(worker));
+                }
+                worker();
+                for (uint32_t i = 0; i < workers.size(); i++) {
+                    workers[i].join();
+                }
+            }
+
+        }
+    }
+} // opendlv::threeD::raycasting
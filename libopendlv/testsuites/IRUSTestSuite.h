@@ -0,0 +1,116 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_IRUSTESTSUITE_H_
+#define HESPERIA_IRUSTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/data/Container.h"
+#include "automotivedata/generated/automotive/miniature/SensorBoardData.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/OtherVehicleState.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/vehiclecontext/model/IRUS.h"
+
+using namespace std;
+using namespace odcore::data;
+using namespace opendlv::data::environment;
+using namespace opendlv::vehiclecontext::model;
+
+class IRUSTest : public CxxTest::TestSuite {
+    private:
+        string getConfiguration() {
+            stringstream sstr;
+            sstr << "global.scenario = none" << endl
+                 << "odsimirus.otherVehicle.timeout = 3" << endl
+                 << "odsimirus.numberOfSensors = 1" << endl
+                 << "odsimirus.sensor0.id = 0" << endl
+                 << "odsimirus.sensor0.name = Front" << endl
+                 << "odsimirus.sensor0.rotZ = 0" << endl
+                 << "odsimirus.sensor0.translation = (0.0;0.0;0.0)" << endl
+                 << "odsimirus.sensor0.angleFOV = 10" << endl
+                 << "odsimirus.sensor0.distanceFOV = 40" << endl
+                 << "odsimirus.sensor0.clampDistance = 39" << endl
+                 << "odsimirus.sensor0.showFOV = 0" << endl;
+            return sstr.str();
+        }
+
+        double getDistance(IRUS &irus) {
+            EgoState es(Point3(0, 0, 0), Point3(1, 0, 0), Point3(0, 0, 0), Point3(0, 0, 0));
+            vector<Container> results = irus.calculate(es);
+            TS_ASSERT(results.size() > 0);
+            TS_ASSERT(results.at(0).getDataType() == automotive::miniature::SensorBoardData::ID());
+            automotive::miniature::SensorBoardData sbd = results.at(0).getData<automotive::miniature::SensorBoardData>();
+            return sbd.getValueForKey_MapOfDistances(0);
+        }
+
+    public:
+        void testOtherVehicleExpiresWithoutUpdate() {
+            IRUS irus(getConfiguration());
+            irus.setup();
+
+            const OtherVehicleState ovs(1, Point3(12, 0, 0), Point3(1, 0, 0), Point3(0, 0, 0), Point3(0, 0, 0));
+
+            // Drive the per-cycle API as the standalone modules do.
+            irus.updateOtherVehicle(ovs);
+            irus.removeStaleOtherVehicles();
+            TS_ASSERT_DELTA(getDistance(irus), 10.0, 1e-6);
+
+            // The vehicle is kept while it is missing for less than the timeout...
+            irus.removeStaleOtherVehicles();
+            TS_ASSERT_DELTA(getDistance(irus), 10.0, 1e-6);
+            irus.removeStaleOtherVehicles();
+            TS_ASSERT_DELTA(getDistance(irus), 10.0, 1e-6);
+
+            // ...and refreshed by a new update.
+            irus.updateOtherVehicle(ovs);
+            irus.removeStaleOtherVehicles();
+            irus.removeStaleOtherVehicles();
+            irus.removeStaleOtherVehicles();
+            TS_ASSERT_DELTA(getDistance(irus), 10.0, 1e-6);
+
+            // Expired after three cycles without an update.
+            irus.removeStaleOtherVehicles();
+            TS_ASSERT_DELTA(getDistance(irus), -1.0, 1e-6);
+
+            irus.tearDown();
+        }
+
+        void testRemoveOtherVehicle() {
+            IRUS irus(getConfiguration());
+            irus.setup();
+
+            irus.updateOtherVehicle(OtherVehicleState(1, Point3(12, 0, 0), Point3(1, 0, 0), Point3(0, 0, 0), Point3(0, 0, 0)));
+            irus.removeStaleOtherVehicles();
+            TS_ASSERT_DELTA(getDistance(irus), 10.0, 1e-6);
+
+            irus.removeOtherVehicle(1);
+            irus.removeStaleOtherVehicles();
+            TS_ASSERT_DELTA(getDistance(irus), -1.0, 1e-6);
+
+            irus.tearDown();
+        }
+};
+
+#endif /*HESPERIA_IRUSTESTSUITE_H_*/
@@ -0,0 +1,185 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_OBSTACLEGRIDTESTSUITE_H_
+#define HESPERIA_OBSTACLEGRIDTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <vector>
+
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/ObstacleGrid.h"
+
+using namespace std;
+using namespace opendlv::data::environment;
+using namespace opendlv::vehiclecontext::model;
+
+class ObstacleGridTest : public CxxTest::TestSuite {
+    private:
+        Polygon createBox(const double &x, const double &y, const double &length, const double &width) {
+            Polygon p;
+            p.add(Point3(x, y, 0));
+            p.add(Point3(x + length, y, 0));
+            p.add(Point3(x + length, y + width, 0));
+            p.add(Point3(x, y + width, 0));
+            return p;
+        }
+
+    public:
+        void testEmptyGrid() {
+            ObstacleGrid grid(ObstacleGrid::DEFAULT_CELL_SIZE);
+
+            TS_ASSERT(grid.getNumberOfStaticEdges() == 0);
+            TS_ASSERT(grid.getNumberOfDynamicPolygons() == 0);
+            TS_ASSERT(grid.getNearestDistance(Point3(0, 0, 0), Point3(20, 2, 0), Point3(20, -2, 0)) < 0);
+        }
+
+        void testStaticPolygon() {
+            ObstacleGrid grid(ObstacleGrid::DEFAULT_CELL_SIZE);
+            grid.addStaticPolygon(createBox(10, -1, 2, 2));
+
+            TS_ASSERT(grid.getNumberOfStaticEdges() == 4);
+
+            // Facing the box.
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(20, 2, 0), Point3(20, -2, 0)), 10.0, 1e-9);
+
+            // Orientation of the triangle does not matter.
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(20, -2, 0), Point3(20, 2, 0)), 10.0, 1e-9);
+
+            // Facing away from the box.
+            TS_ASSERT(grid.getNearestDistance(Point3(0, 0, 0), Point3(-20, 2, 0), Point3(-20, -2, 0)) < 0);
+
+            // Box behind the range of the FOV.
+            TS_ASSERT(grid.getNearestDistance(Point3(0, 0, 0), Point3(5, 2, 0), Point3(5, -2, 0)) < 0);
+
+            // Box partly inside the FOV: Only the visible part counts.
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 5, 0), Point3(20, 5, 0), Point3(20, -5, 0)), sqrt(10.0 * 10.0 + 4.0 * 4.0), 1e-9);
+        }
+
+        void testNearestOfSeveralPolygons() {
+            ObstacleGrid grid(1.0);
+            grid.addStaticPolygon(createBox(30, -1, 2, 2));
+            grid.addStaticPolygon(createBox(7, -1, 2, 2));
+            grid.addStaticPolygon(createBox(15, -1, 2, 2));
+
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(40, 3, 0), Point3(40, -3, 0)), 7.0, 1e-9);
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(50, 0, 0), Point3(10, -3, 0), Point3(10, 3, 0)), 18.0, 1e-9);
+        }
+
+        void testDynamicPolygon() {
+            ObstacleGrid grid(ObstacleGrid::DEFAULT_CELL_SIZE);
+            grid.addStaticPolygon(createBox(20, -1, 2, 2));
+
+            grid.updateDynamicPolygon(1, createBox(10, -1, 2, 2));
+            TS_ASSERT(grid.getNumberOfDynamicPolygons() == 1);
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(40, 3, 0), Point3(40, -3, 0)), 10.0, 1e-9);
+
+            // Move the dynamic polygon closer.
+            grid.updateDynamicPolygon(1, createBox(4, -1, 2, 2));
+            TS_ASSERT(grid.getNumberOfDynamicPolygons() == 1);
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(40, 3, 0), Point3(40, -3, 0)), 4.0, 1e-9);
+
+            // Move the dynamic polygon out of the FOV.
+            grid.updateDynamicPolygon(1, createBox(4, 10, 2, 2));
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(40, 3, 0), Point3(40, -3, 0)), 20.0, 1e-9);
+
+            grid.updateDynamicPolygon(2, createBox(15, -1, 2, 2));
+            TS_ASSERT(grid.getNumberOfDynamicPolygons() == 2);
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(40, 3, 0), Point3(40, -3, 0)), 15.0, 1e-9);
+
+            grid.removeDynamicPolygon(2);
+            TS_ASSERT(grid.getNumberOfDynamicPolygons() == 1);
+            TS_ASSERT_DELTA(grid.getNearestDistance(Point3(0, 0, 0), Point3(40, 3, 0), Point3(40, -3, 0)), 20.0, 1e-9);
+        }
+
+        void testMovingDynamicPolygonsMatchFreshGrid() {
+            ObstacleGrid moved(1.0);
+
+            // Move some vehicles in small steps so that consecutive positions share most of their cells.
+            for (uint32_t step = 0; step < 50; step++) {
+                for (uint32_t id = 0; id < 5; id++) {
+                    moved.updateDynamicPolygon(id, createBox(2.0 + 0.3 * step, -10.0 + 4.0 * id + 0.1 * step, 4.0, 2.0));
+                }
+            }
+            moved.updateDynamicPolygon(5, createBox(30.0, 30.0, 4.0, 2.0));
+            moved.removeDynamicPolygon(5);
+
+            ObstacleGrid fresh(1.0);
+            for (uint32_t id = 0; id < 5; id++) {
+                fresh.updateDynamicPolygon(id, createBox(2.0 + 0.3 * 49, -10.0 + 4.0 * id + 0.1 * 49, 4.0, 2.0));
+            }
+            TS_ASSERT(moved.getNumberOfDynamicPolygons() == fresh.getNumberOfDynamicPolygons());
+
+            for (uint32_t i = 0; i < 72; i++) {
+                const double angle = i * 5.0 * M_PI / 180.0;
+                const Point3 apex(10.0, 0, 0);
+                const Point3 left(apex.getX() + 60.0 * cos(angle + 0.05), 60.0 * sin(angle + 0.05), 0);
+                const Point3 right(apex.getX() + 60.0 * cos(angle - 0.05), 60.0 * sin(angle - 0.05), 0);
+
+                TS_ASSERT_DELTA(moved.getNearestDistance(apex, left, right), fresh.getNearestDistance(apex, left, right), 1e-9);
+            }
+
+            // No cell may still refer to the removed or old positions.
+            TS_ASSERT_DELTA(moved.getNearestDistance(Point3(0, 0, 0), Point3(40, 42, 0), Point3(42, 40, 0)), -1.0, 1e-9);
+            TS_ASSERT_DELTA(moved.getNearestDistance(Point3(0, -10, 0), Point3(10, -9, 0), Point3(10, -11, 0)), -1.0, 1e-9);
+        }
+
+        void testCellSizeDoesNotChangeResults() {
+            ObstacleGrid fine(0.5);
+            ObstacleGrid coarse(1000.0);
+
+            uint32_t seed = 42;
+            for (uint32_t i = 0; i < 200; i++) {
+                seed = seed * 1103515245 + 12345;
+                const double x = static_cast<double>((seed >> 8) % 2000) / 10.0 - 100.0;
+                seed = seed * 1103515245 + 12345;
+                const double y = static_cast<double>((seed >> 8) % 2000) / 10.0 - 100.0;
+
+                fine.addStaticPolygon(createBox(x, y, 1.5, 0.7));
+                coarse.addStaticPolygon(createBox(x, y, 1.5, 0.7));
+            }
+
+            for (uint32_t i = 0; i < 72; i++) {
+                const double angle = i * 5.0 * M_PI / 180.0;
+                const double range = 60.0;
+                const Point3 apex(3.0, -2.0, 0);
+                const Point3 left(apex.getX() + range * cos(angle + 0.1), apex.getY() + range * sin(angle + 0.1), 0);
+                const Point3 right(apex.getX() + range * cos(angle - 0.1), apex.getY() + range * sin(angle - 0.1), 0);
+
+                TS_ASSERT_DELTA(fine.getNearestDistance(apex, left, right), coarse.getNearestDistance(apex, left, right), 1e-9);
+            }
+
+            // Re-indexing with another cell size.
+            fine.setCellSize(7.0);
+            TS_ASSERT_DELTA(fine.getCellSize(), 7.0, 1e-9);
+            for (uint32_t i = 0; i < 72; i++) {
+                const double angle = i * 5.0 * M_PI / 180.0;
+                const Point3 apex(0, 0, 0);
+                const Point3 left(80.0 * cos(angle + 0.05), 80.0 * sin(angle + 0.05), 0);
+                const Point3 right(80.0 * cos(angle - 0.05), 80.0 * sin(angle - 0.05), 0);
+
+                TS_ASSERT_DELTA(fine.getNearestDistance(apex, left, right), coarse.getNearestDistance(apex, left, right), 1e-9);
+            }
+        }
+};
+
+#endif /*HESPERIA_OBSTACLEGRIDTESTSUITE_H_*/
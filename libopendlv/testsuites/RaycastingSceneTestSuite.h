@@ -0,0 +1,273 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_RAYCASTINGSCENETESTSUITE_H_
+#define HESPERIA_RAYCASTINGSCENETESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <vector>
+
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/threeD/raycasting/RaycastingCamera.h"
+#include "opendlv/threeD/raycasting/RaycastingLidar.h"
+#include "opendlv/threeD/raycasting/RaycastingScene.h"
+
+using namespace std;
+using namespace opendlv::data::environment;
+using namespace opendlv::threeD::raycasting;
+
+class RaycastingSceneTest : public CxxTest::TestSuite {
+    private:
+        void addBox(RaycastingScene &scene, const Point3 &minimum, const Point3 &maximum, const Point3 &color) {
+            const Point3 p[8] = { Point3(minimum.getX(), minimum.getY(), minimum.getZ()),
+                                  Point3(maximum.getX(), minimum.getY(), minimum.getZ()),
+                                  Point3(maximum.getX(), maximum.getY(), minimum.getZ()),
+                                  Point3(minimum.getX(), maximum.getY(), minimum.getZ()),
+                                  Point3(minimum.getX(), minimum.getY(), maximum.getZ()),
+                                  Point3(maximum.getX(), minimum.getY(), maximum.getZ()),
+                                  Point3(maximum.getX(), maximum.getY(), maximum.getZ()),
+                                  Point3(minimum.getX(), maximum.getY(), maximum.getZ()) };
+            const uint32_t faces[6][4] = { {0, 1, 2, 3}, {4, 5, 6, 7}, {0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7} };
+            for (uint32_t i = 0; i < 6; i++) {
+                scene.addTriangle(p[faces[i][0]], p[faces[i][1]], p[faces[i][2]], color);
+                scene.addTriangle(p[faces[i][0]], p[faces[i][2]], p[faces[i][3]], color);
+            }
+        }
+
+        float castRay(const RaycastingScene &scene, const float *origin, const float *direction, const float &maximumDistance, uint32_t &hit) {
+            RayPacket packet;
+            for (uint32_t k = 0; k < RayPacket::SIZE; k++) {
+                packet.setRay(k, origin, direction, maximumDistance);
+            }
+            scene.intersect(packet);
+            hit = packet.m_hit[0];
+            return packet.m_distance[0];
+        }
+
+        float random(uint32_t &seed) {
+            seed = seed * 1103515245 + 12345;
+            return static_cast<float>((seed >> 8) % 10000) / 10000.0f;
+        }
+
+    public:
+        void testGround() {
+            RaycastingScene scene;
+            scene.build();
+
+            TS_ASSERT(scene.getNumberOfTriangles() == 0);
+
+            uint32_t hit = 0;
+            const float origin[3] = { 1, 2, 2 };
+            const float down[3] = { static_cast<float>(sqrt(0.5)), 0, static_cast<float>(-sqrt(0.5)) };
+            TS_ASSERT_DELTA(castRay(scene, origin, down, 100, hit), 2.0 * sqrt(2.0), 1e-4);
+            TS_ASSERT(hit == RaycastingScene::GROUND);
+
+            const float up[3] = { static_cast<float>(sqrt(0.5)), 0, static_cast<float>(sqrt(0.5)) };
+            castRay(scene, origin, up, 100, hit);
+            TS_ASSERT(hit == RaycastingScene::NO_HIT);
+
+            // Ground too far away.
+            castRay(scene, origin, down, 2, hit);
+            TS_ASSERT(hit == RaycastingScene::NO_HIT);
+
+            scene.setGround(false);
+            castRay(scene, origin, down, 100, hit);
+            TS_ASSERT(hit == RaycastingScene::NO_HIT);
+        }
+
+        void testBox() {
+            RaycastingScene scene;
+            addBox(scene, Point3(10, -1, 0), Point3(12, 1, 3), Point3(1, 0, 0));
+            scene.build();
+
+            TS_ASSERT(scene.getNumberOfTriangles() == 12);
+
+            uint32_t hit = 0;
+            const float origin[3] = { 0, 0, 1 };
+            const float forward[3] = { 1, 0, 0 };
+            TS_ASSERT_DELTA(castRay(scene, origin, forward, 100, hit), 10.0, 1e-4);
+            TS_ASSERT(hit < scene.getNumberOfTriangles());
+            TS_ASSERT_DELTA(scene.getColor(hit)[0], 1.0, 1e-6);
+            TS_ASSERT_DELTA(fabs(scene.getNormal(hit)[0]), 1.0, 1e-6);
+
+            const float backward[3] = { -1, 0, 0 };
+            castRay(scene, origin, backward, 100, hit);
+            TS_ASSERT(hit == RaycastingScene::NO_HIT);
+
+            // Looking down onto the roof.
+            const float above[3] = { 11, 0, 10 };
+            const float down[3] = { 0, 0, -1 };
+            TS_ASSERT_DELTA(castRay(scene, above, down, 100, hit), 7.0, 1e-4);
+            TS_ASSERT(hit < scene.getNumberOfTriangles());
+        }
+
+        void testBVHMatchesBruteForce() {
+            RaycastingScene scene;
+            scene.setGround(false);
+
+            vector<float> triangles;
+            uint32_t seed = 42;
+            for (uint32_t i = 0; i < 2000; i++) {
+                const float cx = 100.0f * random(seed) - 50.0f;
+                const float cy = 100.0f * random(seed) - 50.0f;
+                const float cz = 10.0f * random(seed);
+                for (uint32_t v = 0; v < 3; v++) {
+                    triangles.push_back(cx + 4.0f * random(seed) - 2.0f);
+                    triangles.push_back(cy + 4.0f * random(seed) - 2.0f);
+                    triangles.push_back(cz + 4.0f * random(seed) - 2.0f);
+                }
+                scene.addTriangle(Point3(triangles[9 * i], triangles[9 * i + 1], triangles[9 * i + 2]),
+                                  Point3(triangles[9 * i + 3], triangles[9 * i + 4], triangles[9 * i + 5]),
+                                  Point3(triangles[9 * i + 6], triangles[9 * i + 7], triangles[9 * i + 8]), Point3(1, 1, 1));
+            }
+            scene.build();
+
+            TS_ASSERT(scene.getNumberOfTriangles() == 2000);
+            TS_ASSERT(scene.getNumberOfNodes() > 1);
+
+            uint32_t numberOfHits = 0;
+            for (uint32_t i = 0; i < 1000; i++) {
+                const float origin[3] = { 120.0f * random(seed) - 60.0f, 120.0f * random(seed) - 60.0f, 12.0f * random(seed) - 1.0f };
+                float direction[3] = { random(seed) - 0.5f, random(seed) - 0.5f, 0.2f * (random(seed) - 0.5f) };
+                const float length = sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+                for (uint32_t a = 0; a < 3; a++) {
+                    direction[a] /= length;
+                }
+
+                // Brute force Moeller-Trumbore in double precision.
+                double expected = 200;
+                for (uint32_t t = 0; t < 2000; t++) {
+                    const float *v0 = &triangles[9 * t];
+                    const double e1[3] = { triangles[9 * t + 3] - v0[0], triangles[9 * t + 4] - v0[1], triangles[9 * t + 5] - v0[2] };
+                    const double e2[3] = { triangles[9 * t + 6] - v0[0], triangles[9 * t + 7] - v0[1], triangles[9 * t + 8] - v0[2] };
+                    const double p[3] = { direction[1] * e2[2] - direction[2] * e2[1], direction[2] * e2[0] - direction[0] * e2[2], direction[0] * e2[1] - direction[1] * e2[0] };
+                    const double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+                    if (fabs(det) < 1e-12) {
+                        continue;
+                    }
+                    const double s[3] = { origin[0] - v0[0], origin[1] - v0[1], origin[2] - v0[2] };
+                    const double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) / det;
+                    const double q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+                    const double v = (direction[0] * q[0] + direction[1] * q[1] + direction[2] * q[2]) / det;
+                    const double d = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) / det;
+                    if ( (u >= 0) && (v >= 0) && ((u + v) <= 1) && (d > 0) && (d < expected) ) {
+                        expected = d;
+                    }
+                }
+
+                uint32_t hit = 0;
+                const float distance = castRay(scene, origin, direction, 200, hit);
+                if (expected < 200) {
+                    numberOfHits++;
+                    TS_ASSERT(hit != RaycastingScene::NO_HIT);
+                    TS_ASSERT_DELTA(distance, expected, 1e-2);
+                }
+                else {
+                    TS_ASSERT(hit == RaycastingScene::NO_HIT);
+                }
+            }
+            TS_ASSERT(numberOfHits > 100);
+        }
+
+        void testCamera() {
+            RaycastingScene scene;
+            scene.setGroundColor(Point3(0, 1, 0));
+            scene.setSkyColor(Point3(0, 0, 1));
+            scene.build();
+
+            const uint32_t width = 9;
+            const uint32_t height = 7;
+            vector<unsigned char> image(width * height * 3);
+            vector<float> depth(width * height);
+
+            // Looking horizontally: Upper half is sky and lower half is ground.
+            RaycastingCamera camera(scene, width, height, 60, 100);
+            camera.setNumberOfThreads(2);
+            camera.render(Point3(0, 0, 2), 0.3, 0, &image[0], &depth[0]);
+
+            for (uint32_t x = 0; x < width; x++) {
+                const unsigned char *top = &image[3 * x];
+                TS_ASSERT(top[0] == 255);
+                TS_ASSERT(top[1] == 0);
+                TS_ASSERT_DELTA(depth[x], 0, 1e-6);
+
+                const unsigned char *bottom = &image[3 * ((height - 1) * width + x)];
+                TS_ASSERT(bottom[0] == 0);
+                TS_ASSERT(bottom[1] > 0);
+                TS_ASSERT(depth[(height - 1) * width + x] > 2);
+            }
+
+            // Center pixel of the last row.
+            const double angle = atan((1.0 - (height - 0.5) * 2.0 / height) * tan(30.0 * M_PI / 180.0));
+            TS_ASSERT_DELTA(depth[(height - 1) * width + width / 2], 2.0 / sin(-angle), 1e-3);
+        }
+
+        void testLidar() {
+            RaycastingScene scene;
+            addBox(scene, Point3(10, -50, 0), Point3(11, 50, 5), Point3(1, 1, 1));
+            scene.build();
+
+            vector<float> verticalAngles;
+            verticalAngles.push_back(-15);
+            verticalAngles.push_back(0);
+            verticalAngles.push_back(2);
+            verticalAngles.push_back(5);
+            verticalAngles.push_back(30);
+
+            RaycastingLidar lidar(scene, verticalAngles, 0, 360, 1, 100);
+            TS_ASSERT(lidar.getNumberOfLayers() == 5);
+            TS_ASSERT(lidar.getNumberOfAzimuths() == 360);
+            TS_ASSERT(lidar.getNumberOfPoints() == 1800);
+
+            vector<float> points(lidar.getNumberOfPoints() * RaycastingLidar::NUMBER_OF_COMPONENTS_PER_POINT);
+            const uint32_t reflections = lidar.scan(Point3(0, 0, 2), 0, &points[0]);
+            TS_ASSERT(reflections > 360);
+
+            // Azimuth 0 looks along the heading towards the wall.
+            TS_ASSERT_DELTA(points[0], 2.0 / sin(15.0 * M_PI / 180.0), 1e-3);
+            TS_ASSERT_DELTA(points[4], 10.0, 1e-3);
+            TS_ASSERT_DELTA(points[5], 0, 1e-6);
+            TS_ASSERT_DELTA(points[6], 0, 1e-6);
+            TS_ASSERT(points[7] > 250);
+            TS_ASSERT_DELTA(points[8], 10.0 / cos(2.0 * M_PI / 180.0), 1e-3);
+            TS_ASSERT_DELTA(points[12], 10.0 / cos(5.0 * M_PI / 180.0), 1e-3);
+
+            // Too steep to hit the wall.
+            TS_ASSERT_DELTA(points[16], 0, 1e-6);
+            TS_ASSERT_DELTA(points[19], 0, 1e-6);
+
+            // Azimuth 90 looks to the right; only the ground is hit.
+            const float *right = &points[90 * 5 * 4];
+            TS_ASSERT_DELTA(right[0], 2.0 / sin(15.0 * M_PI / 180.0), 1e-3);
+            TS_ASSERT_DELTA(right[1], 90, 1e-6);
+            TS_ASSERT_DELTA(right[4], 0, 1e-6);
+
+            // Heading along the Y-axis with a single thread: The wall is to the right.
+            vector<float> rotated(points.size());
+            lidar.setNumberOfThreads(1);
+            lidar.scan(Point3(0, 0, 2), M_PI / 2.0, &rotated[0]);
+            TS_ASSERT_DELTA(rotated[4], 0, 1e-6);
+            TS_ASSERT_DELTA(rotated[90 * 5 * 4 + 4], 10.0, 1e-3);
+            TS_ASSERT_DELTA(rotated[270 * 5 * 4 + 4], 0, 1e-6);
+        }
+};
+
+#endif /*HESPERIA_RAYCASTINGSCENETESTSUITE_H_*/
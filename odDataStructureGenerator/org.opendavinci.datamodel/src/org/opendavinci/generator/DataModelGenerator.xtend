@@ -123,6 +123,40 @@ class DataModelGenerator implements IGenerator {
   							 "bytes"-> "odcore::STRING_T"
   	)
 
+    /* This hashmap defines the maximum number of bytes of a value of the respective type in Proto wire format (-1 for variable length). */
+ 	val protoMaxSizeMap = newHashMap("double"-> 8,
+  							 "float"-> 4,
+  							 "int8"-> 2,
+  							 "uint8"-> 2,
+  							 "int16"-> 3,
+  							 "uint16"-> 3,
+  							 "int32"-> 5,
+  							 "uint32"-> 5,
+  							 "int64"-> 10,
+  							 "uint64"-> 10,
+  							 "bool"-> 1,
+  							 "char"-> 10,
+  							 "string"-> -1,
+  							 "bytes"-> -1
+  	)
+
+    /* This hashmap defines the Proto wire type of the respective type. */
+ 	val protoWireTypeMap = newHashMap("double"-> 1,
+  							 "float"-> 5,
+  							 "int8"-> 0,
+  							 "uint8"-> 0,
+  							 "int16"-> 0,
+  							 "uint16"-> 0,
+  							 "int32"-> 0,
+  							 "uint32"-> 0,
+  							 "int64"-> 0,
+  							 "uint64"-> 0,
+  							 "bool"-> 0,
+  							 "char"-> 0,
+  							 "string"-> 2,
+  							 "bytes"-> 2
+  	)
+
     /* This hashmap defines test values for attribues of the respective type used as a list. */
  	val testListValuesMap = newHashMap("double"-> #[1.0, 2.0, 3.0],
   							 "float"-> #[4.5, 5.5, 6.5],
@@ -185,6 +219,51 @@ class DataModelGenerator implements IGenerator {
         return enums
 	}
 
+    /* This method checks whether all attributes of a message can be encoded directly using ProtoWireFormat. */
+	def isDirectlySerializable(Message msg, HashMap<String, EnumDescription> enums) {
+		for (a : msg.attributes) {
+			if ((a.list != null) || (a.map != null) || (a.fixedarray != null)) {
+				return false
+			}
+			if ((a.scalar != null) && ((a.scalar.isPointer != null) || (!typeMap.containsKey(a.scalar.type) && !enums.containsKey(a.scalar.type)))) {
+				return false
+			}
+		}
+		return true
+	}
+
+    /* This method returns the number of bytes of a value encoded as VarInt. */
+	def int getVarIntSize(long value) {
+		var size = 1
+		var v = value
+		while (v > 127) {
+			v = v / 128
+			size = size + 1
+		}
+		return size
+	}
+
+    /* This method returns the upper bound of a directly serialized message or -1 if the message contains attributes of variable length. */
+	def int getMaxSerializedSize(Message msg, HashMap<String, EnumDescription> enums) {
+		var size = 0
+		for (a : msg.attributes) {
+			if (a.scalar != null) {
+				val key = Long.parseLong(a.scalar.id) * 8
+				if (enums.containsKey(a.scalar.type)) {
+					// Enums are encoded as int32.
+					size = size + getVarIntSize(key) + 5
+				}
+				else {
+					if (protoMaxSizeMap.get(a.scalar.type) < 0) {
+						return -1
+					}
+					size = size + getVarIntSize(key + protoWireTypeMap.get(a.scalar.type)) + protoMaxSizeMap.get(a.scalar.type)
+				}
+			}
+		}
+		return size
+	}
+
     /* This method generates the header file content. */
 	def generateProtoFileContent(Iterable<Message> msgs) '''
 // This is an auto-generated file from a .odvd message specification using OpenDaVINCI's odDataStructureGenerator.
@@ -441,6 +520,42 @@ class OPENDAVINCI_API «msg.message.substring(msg.message.lastIndexOf('.') + 1)
 
 		virtual ostream& operator<<(ostream &out) const;
 		virtual istream& operator>>(istream &in);
+		«IF msg.isDirectlySerializable(enums) /* Messages with primitive attributes only can be encoded directly. */»
+
+		«IF msg.getMaxSerializedSize(enums) >= 0»
+		/**
+		 * Upper bound for the number of bytes written by serializeTo.
+		 */
+		static const uint32_t MAX_SERIALIZED_SIZE = «msg.getMaxSerializedSize(enums)»;
+
+		«ENDIF»
+		/**
+		 * This method returns the number of bytes written by serializeTo.
+		 *
+		 * @return Number of bytes.
+		 */
+		uint32_t getSerializedSize() const;
+
+		/**
+		 * This method encodes this message in Proto wire format directly
+		 * into the given buffer bypassing SerializationFactory.
+		 *
+		 * @param buffer Buffer to write to.
+		 * @param size Size of the buffer.
+		 * @return Number of bytes written or 0 if the buffer is too small.
+		 */
+		uint32_t serializeTo(char *buffer, const uint32_t &size) const;
+
+		/**
+		 * This method decodes this message in Proto wire format directly
+		 * from the given buffer bypassing SerializationFactory.
+		 *
+		 * @param buffer Buffer to read from.
+		 * @param size Number of bytes to decode.
+		 * @return Number of bytes read or 0 if the data is malformed.
+		 */
+		uint32_t deserializeFrom(const char *buffer, const uint32_t &size);
+		«ENDIF»
 
 		virtual const string toString() const;
 
@@ -683,6 +798,9 @@ class OPENDAVINCI_API «msg.message.substring(msg.message.lastIndexOf('.') + 1)
 #include <opendavinci/odcore/serialization/Deserializer.h>
 #include <opendavinci/odcore/serialization/SerializationFactory.h>
 #include <opendavinci/odcore/serialization/Serializer.h>
+«IF msg.isDirectlySerializable(enums)»
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+«ENDIF»
 
 «IF msg.message.split("\\.").length > 1 /* Here, we include our own header file. */»
 #include "«toplevelIncludeFolder»/«includeDirectoryPrefix + "/" + msg.message.substring(0, msg.message.lastIndexOf('.')).replaceAll("\\.", "/") + "/" + msg.message.substring(msg.message.lastIndexOf('.') + 1)».h"
@@ -901,6 +1019,68 @@ namespace «s.get(i)» {
 		«ENDIF»
 		return in;
 	}
+	«IF msg.isDirectlySerializable(enums) /* Here, we generate the direct serialization methods. */»
+
+	«IF msg.getMaxSerializedSize(enums) >= 0»
+	const uint32_t «msg.message.substring(msg.message.lastIndexOf('.') + 1)»::MAX_SERIALIZED_SIZE;
+
+	«ENDIF»
+	uint32_t «msg.message.substring(msg.message.lastIndexOf('.') + 1)»::getSerializedSize() const {
+		uint32_t size = 0;
+		«FOR a : msg.attributes»
+		«IF a.scalar != null»
+		size += ProtoWireFormat::getSize(«a.scalar.id», «IF enums.containsKey(a.scalar.type)»static_cast<int32_t>(m_«a.scalar.name»)«ELSE»m_«a.scalar.name»«ENDIF»);
+		«ENDIF»
+		«ENDFOR»
+		return size;
+	}
+
+	uint32_t «msg.message.substring(msg.message.lastIndexOf('.') + 1)»::serializeTo(char *buffer, const uint32_t &size) const {
+		if ( (NULL == buffer) || «IF msg.getMaxSerializedSize(enums) >= 0»((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize()))«ELSE»(size < getSerializedSize())«ENDIF» ) {
+			return 0;
+		}
+
+		char *p = buffer;
+		«FOR a : msg.attributes»
+		«IF a.scalar != null»
+		p = ProtoWireFormat::write(p, «a.scalar.id», «IF enums.containsKey(a.scalar.type)»static_cast<int32_t>(m_«a.scalar.name»)«ELSE»m_«a.scalar.name»«ENDIF»);
+		«ENDIF»
+		«ENDFOR»
+		return static_cast<uint32_t>(p - buffer);
+	}
+
+	uint32_t «msg.message.substring(msg.message.lastIndexOf('.') + 1)»::deserializeFrom(const char *buffer, const uint32_t &size) {
+		const char *p = buffer;
+		const char *end = buffer + size;
+		while ( (NULL != p) && (p < end) ) {
+			uint32_t id = 0;
+			uint32_t type = 0;
+			if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+				switch (id) {
+					«FOR a : msg.attributes»
+					«IF a.scalar != null»
+					case «a.scalar.id»:
+						«IF enums.containsKey(a.scalar.type)»
+						{
+							int32_t int32t_«a.scalar.name» = 0;
+							p = ProtoWireFormat::read(p, end, type, int32t_«a.scalar.name»);
+							m_«a.scalar.name» = static_cast<«enums.get(a.scalar.type).m_enumNameIncludingMessageName.replaceAll("\\.", "::")»>(int32t_«a.scalar.name»);
+						}
+						«ELSE»
+						p = ProtoWireFormat::read(p, end, type, m_«a.scalar.name»);
+						«ENDIF»
+						break;
+					«ENDIF»
+					«ENDFOR»
+					default:
+						// Skip unknown fields.
+						p = ProtoWireFormat::skip(p, end, type);
+				}
+			}
+		}
+		return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+	}
+	«ENDIF»
 	'''
 
 	def generateImplementationFileConstants(Attribute a, Message msg) '''
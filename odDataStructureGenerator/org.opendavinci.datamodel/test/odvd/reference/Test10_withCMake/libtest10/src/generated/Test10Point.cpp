@@ -0,0 +1,174 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#include <memory>
+
+#include <opendavinci/odcore/serialization/Deserializer.h>
+#include <opendavinci/odcore/serialization/SerializationFactory.h>
+#include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+
+#include "test10/generated/Test10Point.h"
+
+	using namespace std;
+	using namespace odcore::base;
+	using namespace odcore::serialization;
+
+
+	Test10Point::Test10Point() :
+	    SerializableData(), Visitable()
+		, m_x(0)
+		, m_y(0)
+	{
+	}
+
+	Test10Point::Test10Point(
+		const float &val0, 
+		const float &val1
+	) :
+	    SerializableData(), Visitable()
+		, m_x(val0)
+		, m_y(val1)
+	{
+	}
+
+	Test10Point::Test10Point(const Test10Point &obj) :
+	    SerializableData(), Visitable()
+		, m_x(obj.m_x)
+		, m_y(obj.m_y)
+	{
+	}
+	
+	Test10Point::~Test10Point() {
+	}
+
+	Test10Point& Test10Point::operator=(const Test10Point &obj) {
+		m_x = obj.m_x;
+		m_y = obj.m_y;
+		return (*this);
+	}
+
+	int32_t Test10Point::ID() {
+		return 10;
+	}
+
+	const string Test10Point::ShortName() {
+		return "Test10Point";
+	}
+
+	const string Test10Point::LongName() {
+		return "Test10Point";
+	}
+
+	int32_t Test10Point::getID() const {
+		return Test10Point::ID();
+	}
+
+	const string Test10Point::getShortName() const {
+		return Test10Point::ShortName();
+	}
+
+	const string Test10Point::getLongName() const {
+		return Test10Point::LongName();
+	}
+
+	float Test10Point::getX() const {
+		return m_x;
+	}
+	
+	void Test10Point::setX(const float &val) {
+		m_x = val;
+	}
+	float Test10Point::getY() const {
+		return m_y;
+	}
+	
+	void Test10Point::setY(const float &val) {
+		m_y = val;
+	}
+
+	void Test10Point::accept(odcore::base::Visitor &v) {
+		v.beginVisit(ID(), ShortName(), LongName());
+		v.visit(1, "Test10Point.x", "x", m_x);
+		v.visit(2, "Test10Point.y", "y", m_y);
+		v.endVisit();
+	}
+
+	const string Test10Point::toString() const {
+		stringstream s;
+
+		s << "X: " << getX() << " ";
+		s << "Y: " << getY() << " ";
+
+		return s.str();
+	}
+
+	ostream& Test10Point::operator<<(ostream &out) const {
+		SerializationFactory& sf = SerializationFactory::getInstance();
+
+		std::shared_ptr<Serializer> s = sf.getSerializer(out);
+
+		s->write(1,
+				m_x);
+		s->write(2,
+				m_y);
+		return out;
+	}
+
+	istream& Test10Point::operator>>(istream &in) {
+		SerializationFactory& sf = SerializationFactory::getInstance();
+
+		std::shared_ptr<Deserializer> d = sf.getDeserializer(in);
+
+		d->read(1,
+				m_x);
+		d->read(2,
+				m_y);
+		return in;
+	}
+
+	const uint32_t Test10Point::MAX_SERIALIZED_SIZE;
+
+	uint32_t Test10Point::getSerializedSize() const {
+		uint32_t size = 0;
+		size += ProtoWireFormat::getSize(1, m_x);
+		size += ProtoWireFormat::getSize(2, m_y);
+		return size;
+	}
+
+	uint32_t Test10Point::serializeTo(char *buffer, const uint32_t &size) const {
+		if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+			return 0;
+		}
+
+		char *p = buffer;
+		p = ProtoWireFormat::write(p, 1, m_x);
+		p = ProtoWireFormat::write(p, 2, m_y);
+		return static_cast<uint32_t>(p - buffer);
+	}
+
+	uint32_t Test10Point::deserializeFrom(const char *buffer, const uint32_t &size) {
+		const char *p = buffer;
+		const char *end = buffer + size;
+		while ( (NULL != p) && (p < end) ) {
+			uint32_t id = 0;
+			uint32_t type = 0;
+			if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+				switch (id) {
+					case 1:
+						p = ProtoWireFormat::read(p, end, type, m_x);
+						break;
+					case 2:
+						p = ProtoWireFormat::read(p, end, type, m_y);
+						break;
+					default:
+						// Skip unknown fields.
+						p = ProtoWireFormat::skip(p, end, type);
+				}
+			}
+		}
+		return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+	}
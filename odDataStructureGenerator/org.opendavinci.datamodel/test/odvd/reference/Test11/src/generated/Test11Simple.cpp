@@ -9,6 +9,7 @@
 #include <opendavinci/odcore/serialization/Deserializer.h>
 #include <opendavinci/odcore/serialization/SerializationFactory.h>
 #include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
 
 #include "test11/generated/Test11Simple.h"
 
@@ -128,3 +129,46 @@
 				m_data2);
 		return in;
 	}
+
+	const uint32_t Test11Simple::MAX_SERIALIZED_SIZE;
+
+	uint32_t Test11Simple::getSerializedSize() const {
+		uint32_t size = 0;
+		size += ProtoWireFormat::getSize(1, m_data1);
+		size += ProtoWireFormat::getSize(2, m_data2);
+		return size;
+	}
+
+	uint32_t Test11Simple::serializeTo(char *buffer, const uint32_t &size) const {
+		if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+			return 0;
+		}
+
+		char *p = buffer;
+		p = ProtoWireFormat::write(p, 1, m_data1);
+		p = ProtoWireFormat::write(p, 2, m_data2);
+		return static_cast<uint32_t>(p - buffer);
+	}
+
+	uint32_t Test11Simple::deserializeFrom(const char *buffer, const uint32_t &size) {
+		const char *p = buffer;
+		const char *end = buffer + size;
+		while ( (NULL != p) && (p < end) ) {
+			uint32_t id = 0;
+			uint32_t type = 0;
+			if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+				switch (id) {
+					case 1:
+						p = ProtoWireFormat::read(p, end, type, m_data1);
+						break;
+					case 2:
+						p = ProtoWireFormat::read(p, end, type, m_data2);
+						break;
+					default:
+						// Skip unknown fields.
+						p = ProtoWireFormat::skip(p, end, type);
+				}
+			}
+		}
+		return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+	}
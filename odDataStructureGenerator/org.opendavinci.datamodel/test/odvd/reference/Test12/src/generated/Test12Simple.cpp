@@ -9,6 +9,7 @@
 #include <opendavinci/odcore/serialization/Deserializer.h>
 #include <opendavinci/odcore/serialization/SerializationFactory.h>
 #include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
 
 #include "test12/generated/Test12Simple.h"
 
@@ -218,3 +219,69 @@
 				m_attribute7);
 		return in;
 	}
+
+	uint32_t Test12Simple::getSerializedSize() const {
+		uint32_t size = 0;
+		size += ProtoWireFormat::getSize(1, m_attribute1);
+		size += ProtoWireFormat::getSize(2, m_attribute2);
+		size += ProtoWireFormat::getSize(3, m_attribute3);
+		size += ProtoWireFormat::getSize(4, m_attribute4);
+		size += ProtoWireFormat::getSize(5, m_attribute5);
+		size += ProtoWireFormat::getSize(6, m_attribute6);
+		size += ProtoWireFormat::getSize(7, m_attribute7);
+		return size;
+	}
+
+	uint32_t Test12Simple::serializeTo(char *buffer, const uint32_t &size) const {
+		if ( (NULL == buffer) || (size < getSerializedSize()) ) {
+			return 0;
+		}
+
+		char *p = buffer;
+		p = ProtoWireFormat::write(p, 1, m_attribute1);
+		p = ProtoWireFormat::write(p, 2, m_attribute2);
+		p = ProtoWireFormat::write(p, 3, m_attribute3);
+		p = ProtoWireFormat::write(p, 4, m_attribute4);
+		p = ProtoWireFormat::write(p, 5, m_attribute5);
+		p = ProtoWireFormat::write(p, 6, m_attribute6);
+		p = ProtoWireFormat::write(p, 7, m_attribute7);
+		return static_cast<uint32_t>(p - buffer);
+	}
+
+	uint32_t Test12Simple::deserializeFrom(const char *buffer, const uint32_t &size) {
+		const char *p = buffer;
+		const char *end = buffer + size;
+		while ( (NULL != p) && (p < end) ) {
+			uint32_t id = 0;
+			uint32_t type = 0;
+			if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+				switch (id) {
+					case 1:
+						p = ProtoWireFormat::read(p, end, type, m_attribute1);
+						break;
+					case 2:
+						p = ProtoWireFormat::read(p, end, type, m_attribute2);
+						break;
+					case 3:
+						p = ProtoWireFormat::read(p, end, type, m_attribute3);
+						break;
+					case 4:
+						p = ProtoWireFormat::read(p, end, type, m_attribute4);
+						break;
+					case 5:
+						p = ProtoWireFormat::read(p, end, type, m_attribute5);
+						break;
+					case 6:
+						p = ProtoWireFormat::read(p, end, type, m_attribute6);
+						break;
+					case 7:
+						p = ProtoWireFormat::read(p, end, type, m_attribute7);
+						break;
+					default:
+						// Skip unknown fields.
+						p = ProtoWireFormat::skip(p, end, type);
+				}
+			}
+		}
+		return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+	}
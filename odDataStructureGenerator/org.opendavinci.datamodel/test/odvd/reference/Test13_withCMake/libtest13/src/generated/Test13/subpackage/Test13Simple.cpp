@@ -0,0 +1,174 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#include <memory>
+
+#include <opendavinci/odcore/serialization/Deserializer.h>
+#include <opendavinci/odcore/serialization/SerializationFactory.h>
+#include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+
+#include "test13/generated/Test13/subpackage/Test13Simple.h"
+
+namespace test13 {
+	namespace subpackage {
+			using namespace std;
+			using namespace odcore::base;
+			using namespace odcore::serialization;
+		
+		
+			Test13Simple::Test13Simple() :
+			    SerializableData(), Visitable()
+				, m_buttonState(UNDEFINED) // TODO: Validation if the default value is of the desired type.
+			{
+			}
+		
+			Test13Simple::Test13Simple(
+				const Test13Simple::ButtonState &val0
+			) :
+			    SerializableData(), Visitable()
+				, m_buttonState(val0)
+			{
+			}
+		
+			Test13Simple::Test13Simple(const Test13Simple &obj) :
+			    SerializableData(), Visitable()
+				, m_buttonState(obj.m_buttonState)
+			{
+			}
+			
+			Test13Simple::~Test13Simple() {
+			}
+		
+			Test13Simple& Test13Simple::operator=(const Test13Simple &obj) {
+				m_buttonState = obj.m_buttonState;
+				return (*this);
+			}
+		
+			int32_t Test13Simple::ID() {
+				return 13;
+			}
+		
+			const string Test13Simple::ShortName() {
+				return "Test13Simple";
+			}
+		
+			const string Test13Simple::LongName() {
+				return "Test13.subpackage.Test13Simple";
+			}
+		
+			int32_t Test13Simple::getID() const {
+				return Test13Simple::ID();
+			}
+		
+			const string Test13Simple::getShortName() const {
+				return Test13Simple::ShortName();
+			}
+		
+			const string Test13Simple::getLongName() const {
+				return Test13Simple::LongName();
+			}
+		
+			Test13Simple::ButtonState Test13Simple::getButtonState() const {
+				return m_buttonState;
+			}
+			
+			void Test13Simple::setButtonState(const Test13Simple::ButtonState &val) {
+				m_buttonState = val;
+			}
+		
+			void Test13Simple::accept(odcore::base::Visitor &v) {
+				v.beginVisit(ID(), ShortName(), LongName());
+				int32_t int32t_buttonState = m_buttonState;
+				v.visit(1, "Test13Simple.buttonState", "buttonState", int32t_buttonState);
+				m_buttonState = static_cast<Test13Simple::ButtonState>(int32t_buttonState);
+				v.endVisit();
+			}
+		
+			const string Test13Simple::toString() const {
+				stringstream s;
+		
+				switch(getButtonState()) {
+					case PRESSED :
+					s << "ButtonState: Test13Simple::PRESSED (1) ";
+					break;
+					case UNDEFINED :
+					s << "ButtonState: Test13Simple::UNDEFINED (-1) ";
+					break;
+					case NOT_PRESSED :
+					s << "ButtonState: Test13Simple::NOT_PRESSED (0) ";
+					break;
+				}
+		
+				return s.str();
+			}
+		
+			ostream& Test13Simple::operator<<(ostream &out) const {
+				SerializationFactory& sf = SerializationFactory::getInstance();
+		
+				std::shared_ptr<Serializer> s = sf.getSerializer(out);
+		
+				int32_t int32t_buttonState = m_buttonState;
+				s->write(1,
+						int32t_buttonState);
+				return out;
+			}
+		
+			istream& Test13Simple::operator>>(istream &in) {
+				SerializationFactory& sf = SerializationFactory::getInstance();
+		
+				std::shared_ptr<Deserializer> d = sf.getDeserializer(in);
+		
+				int32_t int32t_buttonState = 0;
+				d->read(1,
+						int32t_buttonState);
+				m_buttonState = static_cast<Test13Simple::ButtonState>(int32t_buttonState);
+				return in;
+			}
+		
+			const uint32_t Test13Simple::MAX_SERIALIZED_SIZE;
+		
+			uint32_t Test13Simple::getSerializedSize() const {
+				uint32_t size = 0;
+				size += ProtoWireFormat::getSize(1, static_cast<int32_t>(m_buttonState));
+				return size;
+			}
+		
+			uint32_t Test13Simple::serializeTo(char *buffer, const uint32_t &size) const {
+				if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+					return 0;
+				}
+		
+				char *p = buffer;
+				p = ProtoWireFormat::write(p, 1, static_cast<int32_t>(m_buttonState));
+				return static_cast<uint32_t>(p - buffer);
+			}
+		
+			uint32_t Test13Simple::deserializeFrom(const char *buffer, const uint32_t &size) {
+				const char *p = buffer;
+				const char *end = buffer + size;
+				while ( (NULL != p) && (p < end) ) {
+					uint32_t id = 0;
+					uint32_t type = 0;
+					if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+						switch (id) {
+							case 1:
+								{
+									int32_t int32t_buttonState = 0;
+									p = ProtoWireFormat::read(p, end, type, int32t_buttonState);
+									m_buttonState = static_cast<Test13Simple::ButtonState>(int32t_buttonState);
+								}
+								break;
+							default:
+								// Skip unknown fields.
+								p = ProtoWireFormat::skip(p, end, type);
+						}
+					}
+				}
+				return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+			}
+	} // subpackage
+} // test13
@@ -9,6 +9,7 @@
 #include <opendavinci/odcore/serialization/Deserializer.h>
 #include <opendavinci/odcore/serialization/SerializationFactory.h>
 #include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
 
 #include "test14/generated/subpackage/Test14Simple.h"
 
@@ -126,4 +127,46 @@ namespace subpackage {
 			m_buttonState = static_cast<Test14Simple::ButtonState>(int32t_buttonState);
 			return in;
 		}
+	
+		const uint32_t Test14Simple::MAX_SERIALIZED_SIZE;
+	
+		uint32_t Test14Simple::getSerializedSize() const {
+			uint32_t size = 0;
+			size += ProtoWireFormat::getSize(1, static_cast<int32_t>(m_buttonState));
+			return size;
+		}
+	
+		uint32_t Test14Simple::serializeTo(char *buffer, const uint32_t &size) const {
+			if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+				return 0;
+			}
+	
+			char *p = buffer;
+			p = ProtoWireFormat::write(p, 1, static_cast<int32_t>(m_buttonState));
+			return static_cast<uint32_t>(p - buffer);
+		}
+	
+		uint32_t Test14Simple::deserializeFrom(const char *buffer, const uint32_t &size) {
+			const char *p = buffer;
+			const char *end = buffer + size;
+			while ( (NULL != p) && (p < end) ) {
+				uint32_t id = 0;
+				uint32_t type = 0;
+				if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+					switch (id) {
+						case 1:
+							{
+								int32_t int32t_buttonState = 0;
+								p = ProtoWireFormat::read(p, end, type, int32t_buttonState);
+								m_buttonState = static_cast<Test14Simple::ButtonState>(int32t_buttonState);
+							}
+							break;
+						default:
+							// Skip unknown fields.
+							p = ProtoWireFormat::skip(p, end, type);
+					}
+				}
+			}
+			return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+		}
 } // subpackage
@@ -0,0 +1,149 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#ifndef SUB_STRUCTURE_TEST20B_H
+#define SUB_STRUCTURE_TEST20B_H
+
+#include "opendavinci/odcore/opendavinci.h"
+
+
+#include "opendavinci/odcore/base/Visitable.h"
+#include "opendavinci/odcore/data/SerializableData.h"
+
+
+namespace sub {
+	namespace structure {
+		using namespace std;
+		
+		class OPENDAVINCI_API Test20b : public odcore::data::SerializableData, public odcore::base::Visitable {
+			public:
+				Test20b();
+		
+				Test20b(
+				const uint32_t &val0
+				);
+		
+				virtual ~Test20b();
+		
+				/**
+				 * Copy constructor.
+				 *
+				 * @param obj Reference to an object of this class.
+				 */
+				Test20b(const Test20b &obj);
+		
+				/**
+				 * Assignment operator.
+				 *
+				 * @param obj Reference to an object of this class.
+				 * @return Reference to this instance.
+				 */
+				Test20b& operator=(const Test20b &obj);
+		
+			public:
+				/**
+				 * @return val2.
+				 */
+				uint32_t getVal2() const;
+				
+				/**
+				 * This method sets val2.
+				 *
+				 * @param val Value for val2.
+				 */
+				void setVal2(const uint32_t &val);
+		
+			public:
+				/**
+				 * This method returns the message id.
+				 *
+				 * @return Message id.
+				 */
+				static int32_t ID();
+		
+				/**
+				 * This method returns the short message name.
+				 *
+				 * @return Short message name.
+				 */
+				static const string ShortName();
+		
+				/**
+				 * This method returns the long message name include package/sub structure.
+				 *
+				 * @return Long message name.
+				 */
+				static const string LongName();
+		
+				/**
+				 * This method returns the message id.
+				 *
+				 * @return Message id.
+				 */
+				virtual int32_t getID() const;
+		
+				/**
+				 * This method returns the short message name.
+				 *
+				 * @return Short message name.
+				 */
+				virtual const string getShortName() const;
+		
+				/**
+				 * This method returns the long message name include package/sub structure.
+				 *
+				 * @return Long message name.
+				 */
+				virtual const string getLongName() const;
+		
+			public:
+				virtual void accept(odcore::base::Visitor &v);
+		
+				virtual ostream& operator<<(ostream &out) const;
+				virtual istream& operator>>(istream &in);
+		
+				/**
+				 * Upper bound for the number of bytes written by serializeTo.
+				 */
+				static const uint32_t MAX_SERIALIZED_SIZE = 6;
+		
+				/**
+				 * This method returns the number of bytes written by serializeTo.
+				 *
+				 * @return Number of bytes.
+				 */
+				uint32_t getSerializedSize() const;
+		
+				/**
+				 * This method encodes this message in Proto wire format directly
+				 * into the given buffer bypassing SerializationFactory.
+				 *
+				 * @param buffer Buffer to write to.
+				 * @param size Size of the buffer.
+				 * @return Number of bytes written or 0 if the buffer is too small.
+				 */
+				uint32_t serializeTo(char *buffer, const uint32_t &size) const;
+		
+				/**
+				 * This method decodes this message in Proto wire format directly
+				 * from the given buffer bypassing SerializationFactory.
+				 *
+				 * @param buffer Buffer to read from.
+				 * @param size Number of bytes to decode.
+				 * @return Number of bytes read or 0 if the data is malformed.
+				 */
+				uint32_t deserializeFrom(const char *buffer, const uint32_t &size);
+		
+				virtual const string toString() const;
+		
+			private:
+				uint32_t m_val2;
+		
+		};
+	} // structure
+} // sub
+
+#endif /*SUB_STRUCTURE_TEST20B_H*/
@@ -9,6 +9,7 @@
 #include <opendavinci/odcore/serialization/Deserializer.h>
 #include <opendavinci/odcore/serialization/SerializationFactory.h>
 #include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
 
 #include "test20/generated/sub/structure/Test20b.h"
 
@@ -112,5 +113,43 @@ namespace sub {
 						m_val2);
 				return in;
 			}
+		
+			const uint32_t Test20b::MAX_SERIALIZED_SIZE;
+		
+			uint32_t Test20b::getSerializedSize() const {
+				uint32_t size = 0;
+				size += ProtoWireFormat::getSize(1, m_val2);
+				return size;
+			}
+		
+			uint32_t Test20b::serializeTo(char *buffer, const uint32_t &size) const {
+				if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+					return 0;
+				}
+		
+				char *p = buffer;
+				p = ProtoWireFormat::write(p, 1, m_val2);
+				return static_cast<uint32_t>(p - buffer);
+			}
+		
+			uint32_t Test20b::deserializeFrom(const char *buffer, const uint32_t &size) {
+				const char *p = buffer;
+				const char *end = buffer + size;
+				while ( (NULL != p) && (p < end) ) {
+					uint32_t id = 0;
+					uint32_t type = 0;
+					if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+						switch (id) {
+							case 1:
+								p = ProtoWireFormat::read(p, end, type, m_val2);
+								break;
+							default:
+								// Skip unknown fields.
+								p = ProtoWireFormat::skip(p, end, type);
+						}
+					}
+				}
+				return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+			}
 	} // structure
 } // sub
@@ -0,0 +1,117 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#include <memory>
+
+#include <opendavinci/odcore/serialization/Deserializer.h>
+#include <opendavinci/odcore/serialization/SerializationFactory.h>
+#include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+
+#include "test2/generated/Test2b.h"
+
+	using namespace std;
+	using namespace odcore::base;
+	using namespace odcore::serialization;
+
+
+	Test2b::Test2b() :
+	    SerializableData(), Visitable()
+	{
+	}
+
+
+	Test2b::Test2b(const Test2b &obj) :
+	    SerializableData(), Visitable()
+	{
+		(void)obj; // Avoid unused parameter warning.
+	}
+	
+	Test2b::~Test2b() {
+	}
+
+	Test2b& Test2b::operator=(const Test2b &obj) {
+		(void)obj; // Avoid unused parameter warning.
+		return (*this);
+	}
+
+	int32_t Test2b::ID() {
+		return 3;
+	}
+
+	const string Test2b::ShortName() {
+		return "Test2b";
+	}
+
+	const string Test2b::LongName() {
+		return "Test2b";
+	}
+
+	int32_t Test2b::getID() const {
+		return Test2b::ID();
+	}
+
+	const string Test2b::getShortName() const {
+		return Test2b::ShortName();
+	}
+
+	const string Test2b::getLongName() const {
+		return Test2b::LongName();
+	}
+
+
+	void Test2b::accept(odcore::base::Visitor &v) {
+		v.beginVisit(ID(), ShortName(), LongName());
+		v.endVisit();
+	}
+
+	const string Test2b::toString() const {
+		stringstream s;
+
+
+		return s.str();
+	}
+
+	ostream& Test2b::operator<<(ostream &out) const {
+		return out;
+	}
+
+	istream& Test2b::operator>>(istream &in) {
+		return in;
+	}
+
+	const uint32_t Test2b::MAX_SERIALIZED_SIZE;
+
+	uint32_t Test2b::getSerializedSize() const {
+		uint32_t size = 0;
+		return size;
+	}
+
+	uint32_t Test2b::serializeTo(char *buffer, const uint32_t &size) const {
+		if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+			return 0;
+		}
+
+		char *p = buffer;
+		return static_cast<uint32_t>(p - buffer);
+	}
+
+	uint32_t Test2b::deserializeFrom(const char *buffer, const uint32_t &size) {
+		const char *p = buffer;
+		const char *end = buffer + size;
+		while ( (NULL != p) && (p < end) ) {
+			uint32_t id = 0;
+			uint32_t type = 0;
+			if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+				switch (id) {
+					default:
+						// Skip unknown fields.
+						p = ProtoWireFormat::skip(p, end, type);
+				}
+			}
+		}
+		return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+	}
@@ -9,6 +9,7 @@
 #include <opendavinci/odcore/serialization/Deserializer.h>
 #include <opendavinci/odcore/serialization/SerializationFactory.h>
 #include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
 
 #include "test7/generated/testpackage/Test7A.h"
 
@@ -147,4 +148,52 @@ namespace testpackage {
 					m_attribute3);
 			return in;
 		}
+	
+		const uint32_t Test7A::MAX_SERIALIZED_SIZE;
+	
+		uint32_t Test7A::getSerializedSize() const {
+			uint32_t size = 0;
+			size += ProtoWireFormat::getSize(1, m_attribute1);
+			size += ProtoWireFormat::getSize(2, m_attribute2);
+			size += ProtoWireFormat::getSize(3, m_attribute3);
+			return size;
+		}
+	
+		uint32_t Test7A::serializeTo(char *buffer, const uint32_t &size) const {
+			if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+				return 0;
+			}
+	
+			char *p = buffer;
+			p = ProtoWireFormat::write(p, 1, m_attribute1);
+			p = ProtoWireFormat::write(p, 2, m_attribute2);
+			p = ProtoWireFormat::write(p, 3, m_attribute3);
+			return static_cast<uint32_t>(p - buffer);
+		}
+	
+		uint32_t Test7A::deserializeFrom(const char *buffer, const uint32_t &size) {
+			const char *p = buffer;
+			const char *end = buffer + size;
+			while ( (NULL != p) && (p < end) ) {
+				uint32_t id = 0;
+				uint32_t type = 0;
+				if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+					switch (id) {
+						case 1:
+							p = ProtoWireFormat::read(p, end, type, m_attribute1);
+							break;
+						case 2:
+							p = ProtoWireFormat::read(p, end, type, m_attribute2);
+							break;
+						case 3:
+							p = ProtoWireFormat::read(p, end, type, m_attribute3);
+							break;
+						default:
+							// Skip unknown fields.
+							p = ProtoWireFormat::skip(p, end, type);
+					}
+				}
+			}
+			return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+		}
 } // testpackage
@@ -0,0 +1,199 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#include <memory>
+
+#include <opendavinci/odcore/serialization/Deserializer.h>
+#include <opendavinci/odcore/serialization/SerializationFactory.h>
+#include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+
+#include "test7/generated/testpackage/Test7A.h"
+
+namespace testpackage {
+		using namespace std;
+		using namespace odcore::base;
+		using namespace odcore::serialization;
+	
+	
+		Test7A::Test7A() :
+		    SerializableData(), Visitable()
+			, m_attribute1(false)
+			, m_attribute2('\0')
+			, m_attribute3(0)
+		{
+		}
+	
+		Test7A::Test7A(
+			const bool &val0, 
+			const char &val1, 
+			const int32_t &val2
+		) :
+		    SerializableData(), Visitable()
+			, m_attribute1(val0)
+			, m_attribute2(val1)
+			, m_attribute3(val2)
+		{
+		}
+	
+		Test7A::Test7A(const Test7A &obj) :
+		    SerializableData(), Visitable()
+			, m_attribute1(obj.m_attribute1)
+			, m_attribute2(obj.m_attribute2)
+			, m_attribute3(obj.m_attribute3)
+		{
+		}
+		
+		Test7A::~Test7A() {
+		}
+	
+		Test7A& Test7A::operator=(const Test7A &obj) {
+			m_attribute1 = obj.m_attribute1;
+			m_attribute2 = obj.m_attribute2;
+			m_attribute3 = obj.m_attribute3;
+			return (*this);
+		}
+	
+		int32_t Test7A::ID() {
+			return 7;
+		}
+	
+		const string Test7A::ShortName() {
+			return "Test7A";
+		}
+	
+		const string Test7A::LongName() {
+			return "testpackage.Test7A";
+		}
+	
+		int32_t Test7A::getID() const {
+			return Test7A::ID();
+		}
+	
+		const string Test7A::getShortName() const {
+			return Test7A::ShortName();
+		}
+	
+		const string Test7A::getLongName() const {
+			return Test7A::LongName();
+		}
+	
+		bool Test7A::getAttribute1() const {
+			return m_attribute1;
+		}
+		
+		void Test7A::setAttribute1(const bool &val) {
+			m_attribute1 = val;
+		}
+		char Test7A::getAttribute2() const {
+			return m_attribute2;
+		}
+		
+		void Test7A::setAttribute2(const char &val) {
+			m_attribute2 = val;
+		}
+		int32_t Test7A::getAttribute3() const {
+			return m_attribute3;
+		}
+		
+		void Test7A::setAttribute3(const int32_t &val) {
+			m_attribute3 = val;
+		}
+	
+		void Test7A::accept(odcore::base::Visitor &v) {
+			v.beginVisit(ID(), ShortName(), LongName());
+			v.visit(1, "Test7A.attribute1", "attribute1", m_attribute1);
+			v.visit(2, "Test7A.attribute2", "attribute2", m_attribute2);
+			v.visit(3, "Test7A.attribute3", "attribute3", m_attribute3);
+			v.endVisit();
+		}
+	
+		const string Test7A::toString() const {
+			stringstream s;
+	
+			s << "Attribute1: " << getAttribute1() << " ";
+			s << "Attribute2: " << getAttribute2() << " ";
+			s << "Attribute3: " << getAttribute3() << " ";
+	
+			return s.str();
+		}
+	
+		ostream& Test7A::operator<<(ostream &out) const {
+			SerializationFactory& sf = SerializationFactory::getInstance();
+	
+			std::shared_ptr<Serializer> s = sf.getSerializer(out);
+	
+			s->write(1,
+					m_attribute1);
+			s->write(2,
+					m_attribute2);
+			s->write(3,
+					m_attribute3);
+			return out;
+		}
+	
+		istream& Test7A::operator>>(istream &in) {
+			SerializationFactory& sf = SerializationFactory::getInstance();
+	
+			std::shared_ptr<Deserializer> d = sf.getDeserializer(in);
+	
+			d->read(1,
+					m_attribute1);
+			d->read(2,
+					m_attribute2);
+			d->read(3,
+					m_attribute3);
+			return in;
+		}
+	
+		const uint32_t Test7A::MAX_SERIALIZED_SIZE;
+	
+		uint32_t Test7A::getSerializedSize() const {
+			uint32_t size = 0;
+			size += ProtoWireFormat::getSize(1, m_attribute1);
+			size += ProtoWireFormat::getSize(2, m_attribute2);
+			size += ProtoWireFormat::getSize(3, m_attribute3);
+			return size;
+		}
+	
+		uint32_t Test7A::serializeTo(char *buffer, const uint32_t &size) const {
+			if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+				return 0;
+			}
+	
+			char *p = buffer;
+			p = ProtoWireFormat::write(p, 1, m_attribute1);
+			p = ProtoWireFormat::write(p, 2, m_attribute2);
+			p = ProtoWireFormat::write(p, 3, m_attribute3);
+			return static_cast<uint32_t>(p - buffer);
+		}
+	
+		uint32_t Test7A::deserializeFrom(const char *buffer, const uint32_t &size) {
+			const char *p = buffer;
+			const char *end = buffer + size;
+			while ( (NULL != p) && (p < end) ) {
+				uint32_t id = 0;
+				uint32_t type = 0;
+				if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+					switch (id) {
+						case 1:
+							p = ProtoWireFormat::read(p, end, type, m_attribute1);
+							break;
+						case 2:
+							p = ProtoWireFormat::read(p, end, type, m_attribute2);
+							break;
+						case 3:
+							p = ProtoWireFormat::read(p, end, type, m_attribute3);
+							break;
+						default:
+							// Skip unknown fields.
+							p = ProtoWireFormat::skip(p, end, type);
+					}
+				}
+			}
+			return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+		}
+} // testpackage
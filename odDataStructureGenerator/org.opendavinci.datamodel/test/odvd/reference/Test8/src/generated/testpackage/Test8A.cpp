@@ -9,6 +9,7 @@
 #include <opendavinci/odcore/serialization/Deserializer.h>
 #include <opendavinci/odcore/serialization/SerializationFactory.h>
 #include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
 
 #include "test8/generated/testpackage/Test8A.h"
 
@@ -111,4 +112,42 @@ namespace testpackage {
 					m_attribute1);
 			return in;
 		}
+	
+		const uint32_t Test8A::MAX_SERIALIZED_SIZE;
+	
+		uint32_t Test8A::getSerializedSize() const {
+			uint32_t size = 0;
+			size += ProtoWireFormat::getSize(1, m_attribute1);
+			return size;
+		}
+	
+		uint32_t Test8A::serializeTo(char *buffer, const uint32_t &size) const {
+			if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+				return 0;
+			}
+	
+			char *p = buffer;
+			p = ProtoWireFormat::write(p, 1, m_attribute1);
+			return static_cast<uint32_t>(p - buffer);
+		}
+	
+		uint32_t Test8A::deserializeFrom(const char *buffer, const uint32_t &size) {
+			const char *p = buffer;
+			const char *end = buffer + size;
+			while ( (NULL != p) && (p < end) ) {
+				uint32_t id = 0;
+				uint32_t type = 0;
+				if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+					switch (id) {
+						case 1:
+							p = ProtoWireFormat::read(p, end, type, m_attribute1);
+							break;
+						default:
+							// Skip unknown fields.
+							p = ProtoWireFormat::skip(p, end, type);
+					}
+				}
+			}
+			return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+		}
 } // testpackage
@@ -0,0 +1,153 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#include <memory>
+
+#include <opendavinci/odcore/serialization/Deserializer.h>
+#include <opendavinci/odcore/serialization/SerializationFactory.h>
+#include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+
+#include "test8/generated/testpackage/Test8B.h"
+
+namespace testpackage {
+		using namespace std;
+		using namespace odcore::base;
+		using namespace odcore::serialization;
+	
+	
+		Test8B::Test8B() :
+		    SerializableData(), Visitable()
+			, m_attribute1(true) // TODO: Validation if the default value is of the desired type.
+		{
+		}
+	
+		Test8B::Test8B(
+			const bool &val0
+		) :
+		    SerializableData(), Visitable()
+			, m_attribute1(val0)
+		{
+		}
+	
+		Test8B::Test8B(const Test8B &obj) :
+		    SerializableData(), Visitable()
+			, m_attribute1(obj.m_attribute1)
+		{
+		}
+		
+		Test8B::~Test8B() {
+		}
+	
+		Test8B& Test8B::operator=(const Test8B &obj) {
+			m_attribute1 = obj.m_attribute1;
+			return (*this);
+		}
+	
+		int32_t Test8B::ID() {
+			return 9;
+		}
+	
+		const string Test8B::ShortName() {
+			return "Test8B";
+		}
+	
+		const string Test8B::LongName() {
+			return "testpackage.Test8B";
+		}
+	
+		int32_t Test8B::getID() const {
+			return Test8B::ID();
+		}
+	
+		const string Test8B::getShortName() const {
+			return Test8B::ShortName();
+		}
+	
+		const string Test8B::getLongName() const {
+			return Test8B::LongName();
+		}
+	
+		bool Test8B::getAttribute1() const {
+			return m_attribute1;
+		}
+		
+		void Test8B::setAttribute1(const bool &val) {
+			m_attribute1 = val;
+		}
+	
+		void Test8B::accept(odcore::base::Visitor &v) {
+			v.beginVisit(ID(), ShortName(), LongName());
+			v.visit(1, "Test8B.attribute1", "attribute1", m_attribute1);
+			v.endVisit();
+		}
+	
+		const string Test8B::toString() const {
+			stringstream s;
+	
+			s << "Attribute1: " << getAttribute1() << " ";
+	
+			return s.str();
+		}
+	
+		ostream& Test8B::operator<<(ostream &out) const {
+			SerializationFactory& sf = SerializationFactory::getInstance();
+	
+			std::shared_ptr<Serializer> s = sf.getSerializer(out);
+	
+			s->write(1,
+					m_attribute1);
+			return out;
+		}
+	
+		istream& Test8B::operator>>(istream &in) {
+			SerializationFactory& sf = SerializationFactory::getInstance();
+	
+			std::shared_ptr<Deserializer> d = sf.getDeserializer(in);
+	
+			d->read(1,
+					m_attribute1);
+			return in;
+		}
+	
+		const uint32_t Test8B::MAX_SERIALIZED_SIZE;
+	
+		uint32_t Test8B::getSerializedSize() const {
+			uint32_t size = 0;
+			size += ProtoWireFormat::getSize(1, m_attribute1);
+			return size;
+		}
+	
+		uint32_t Test8B::serializeTo(char *buffer, const uint32_t &size) const {
+			if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+				return 0;
+			}
+	
+			char *p = buffer;
+			p = ProtoWireFormat::write(p, 1, m_attribute1);
+			return static_cast<uint32_t>(p - buffer);
+		}
+	
+		uint32_t Test8B::deserializeFrom(const char *buffer, const uint32_t &size) {
+			const char *p = buffer;
+			const char *end = buffer + size;
+			while ( (NULL != p) && (p < end) ) {
+				uint32_t id = 0;
+				uint32_t type = 0;
+				if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+					switch (id) {
+						case 1:
+							p = ProtoWireFormat::read(p, end, type, m_attribute1);
+							break;
+						default:
+							// Skip unknown fields.
+							p = ProtoWireFormat::skip(p, end, type);
+					}
+				}
+			}
+			return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+		}
+} // testpackage
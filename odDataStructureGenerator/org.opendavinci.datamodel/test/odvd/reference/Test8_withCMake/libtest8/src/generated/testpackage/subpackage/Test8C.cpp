@@ -0,0 +1,153 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#include <memory>
+
+#include <opendavinci/odcore/serialization/Deserializer.h>
+#include <opendavinci/odcore/serialization/SerializationFactory.h>
+#include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+
+#include "test8/generated/testpackage/subpackage/Test8C.h"
+
+namespace testpackage {
+	namespace subpackage {
+			using namespace std;
+			using namespace odcore::base;
+			using namespace odcore::serialization;
+		
+		
+			Test8C::Test8C() :
+			    SerializableData(), Visitable()
+				, m_attribute1("")
+			{
+			}
+		
+			Test8C::Test8C(
+				const std::string &val0
+			) :
+			    SerializableData(), Visitable()
+				, m_attribute1(val0)
+			{
+			}
+		
+			Test8C::Test8C(const Test8C &obj) :
+			    SerializableData(), Visitable()
+				, m_attribute1(obj.m_attribute1)
+			{
+			}
+			
+			Test8C::~Test8C() {
+			}
+		
+			Test8C& Test8C::operator=(const Test8C &obj) {
+				m_attribute1 = obj.m_attribute1;
+				return (*this);
+			}
+		
+			int32_t Test8C::ID() {
+				return 10;
+			}
+		
+			const string Test8C::ShortName() {
+				return "Test8C";
+			}
+		
+			const string Test8C::LongName() {
+				return "testpackage.subpackage.Test8C";
+			}
+		
+			int32_t Test8C::getID() const {
+				return Test8C::ID();
+			}
+		
+			const string Test8C::getShortName() const {
+				return Test8C::ShortName();
+			}
+		
+			const string Test8C::getLongName() const {
+				return Test8C::LongName();
+			}
+		
+			std::string Test8C::getAttribute1() const {
+				return m_attribute1;
+			}
+			
+			void Test8C::setAttribute1(const std::string &val) {
+				m_attribute1 = val;
+			}
+		
+			void Test8C::accept(odcore::base::Visitor &v) {
+				v.beginVisit(ID(), ShortName(), LongName());
+				v.visit(1, "Test8C.attribute1", "attribute1", m_attribute1);
+				v.endVisit();
+			}
+		
+			const string Test8C::toString() const {
+				stringstream s;
+		
+				s << "Attribute1: " << getAttribute1() << " ";
+		
+				return s.str();
+			}
+		
+			ostream& Test8C::operator<<(ostream &out) const {
+				SerializationFactory& sf = SerializationFactory::getInstance();
+		
+				std::shared_ptr<Serializer> s = sf.getSerializer(out);
+		
+				s->write(1,
+						m_attribute1);
+				return out;
+			}
+		
+			istream& Test8C::operator>>(istream &in) {
+				SerializationFactory& sf = SerializationFactory::getInstance();
+		
+				std::shared_ptr<Deserializer> d = sf.getDeserializer(in);
+		
+				d->read(1,
+						m_attribute1);
+				return in;
+			}
+		
+			uint32_t Test8C::getSerializedSize() const {
+				uint32_t size = 0;
+				size += ProtoWireFormat::getSize(1, m_attribute1);
+				return size;
+			}
+		
+			uint32_t Test8C::serializeTo(char *buffer, const uint32_t &size) const {
+				if ( (NULL == buffer) || (size < getSerializedSize()) ) {
+					return 0;
+				}
+		
+				char *p = buffer;
+				p = ProtoWireFormat::write(p, 1, m_attribute1);
+				return static_cast<uint32_t>(p - buffer);
+			}
+		
+			uint32_t Test8C::deserializeFrom(const char *buffer, const uint32_t &size) {
+				const char *p = buffer;
+				const char *end = buffer + size;
+				while ( (NULL != p) && (p < end) ) {
+					uint32_t id = 0;
+					uint32_t type = 0;
+					if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+						switch (id) {
+							case 1:
+								p = ProtoWireFormat::read(p, end, type, m_attribute1);
+								break;
+							default:
+								// Skip unknown fields.
+								p = ProtoWireFormat::skip(p, end, type);
+						}
+					}
+				}
+				return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+			}
+	} // subpackage
+} // testpackage
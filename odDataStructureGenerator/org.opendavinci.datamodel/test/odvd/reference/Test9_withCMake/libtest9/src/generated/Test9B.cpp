@@ -0,0 +1,151 @@
+/*
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ *
+ * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
+ */
+
+#include <memory>
+
+#include <opendavinci/odcore/serialization/Deserializer.h>
+#include <opendavinci/odcore/serialization/SerializationFactory.h>
+#include <opendavinci/odcore/serialization/Serializer.h>
+#include <opendavinci/odcore/serialization/ProtoWireFormat.h>
+
+#include "test9/generated/Test9B.h"
+
+	using namespace std;
+	using namespace odcore::base;
+	using namespace odcore::serialization;
+
+
+	Test9B::Test9B() :
+	    SerializableData(), Visitable()
+		, m_attribute1(true) // TODO: Validation if the default value is of the desired type.
+	{
+	}
+
+	Test9B::Test9B(
+		const bool &val0
+	) :
+	    SerializableData(), Visitable()
+		, m_attribute1(val0)
+	{
+	}
+
+	Test9B::Test9B(const Test9B &obj) :
+	    SerializableData(), Visitable()
+		, m_attribute1(obj.m_attribute1)
+	{
+	}
+	
+	Test9B::~Test9B() {
+	}
+
+	Test9B& Test9B::operator=(const Test9B &obj) {
+		m_attribute1 = obj.m_attribute1;
+		return (*this);
+	}
+
+	int32_t Test9B::ID() {
+		return 10;
+	}
+
+	const string Test9B::ShortName() {
+		return "Test9B";
+	}
+
+	const string Test9B::LongName() {
+		return "Test9B";
+	}
+
+	int32_t Test9B::getID() const {
+		return Test9B::ID();
+	}
+
+	const string Test9B::getShortName() const {
+		return Test9B::ShortName();
+	}
+
+	const string Test9B::getLongName() const {
+		return Test9B::LongName();
+	}
+
+	bool Test9B::getAttribute1() const {
+		return m_attribute1;
+	}
+	
+	void Test9B::setAttribute1(const bool &val) {
+		m_attribute1 = val;
+	}
+
+	void Test9B::accept(odcore::base::Visitor &v) {
+		v.beginVisit(ID(), ShortName(), LongName());
+		v.visit(1, "Test9B.attribute1", "attribute1", m_attribute1);
+		v.endVisit();
+	}
+
+	const string Test9B::toString() const {
+		stringstream s;
+
+		s << "Attribute1: " << getAttribute1() << " ";
+
+		return s.str();
+	}
+
+	ostream& Test9B::operator<<(ostream &out) const {
+		SerializationFactory& sf = SerializationFactory::getInstance();
+
+		std::shared_ptr<Serializer> s = sf.getSerializer(out);
+
+		s->write(1,
+				m_attribute1);
+		return out;
+	}
+
+	istream& Test9B::operator>>(istream &in) {
+		SerializationFactory& sf = SerializationFactory::getInstance();
+
+		std::shared_ptr<Deserializer> d = sf.getDeserializer(in);
+
+		d->read(1,
+				m_attribute1);
+		return in;
+	}
+
+	const uint32_t Test9B::MAX_SERIALIZED_SIZE;
+
+	uint32_t Test9B::getSerializedSize() const {
+		uint32_t size = 0;
+		size += ProtoWireFormat::getSize(1, m_attribute1);
+		return size;
+	}
+
+	uint32_t Test9B::serializeTo(char *buffer, const uint32_t &size) const {
+		if ( (NULL == buffer) || ((size < MAX_SERIALIZED_SIZE) && (size < getSerializedSize())) ) {
+			return 0;
+		}
+
+		char *p = buffer;
+		p = ProtoWireFormat::write(p, 1, m_attribute1);
+		return static_cast<uint32_t>(p - buffer);
+	}
+
+	uint32_t Test9B::deserializeFrom(const char *buffer, const uint32_t &size) {
+		const char *p = buffer;
+		const char *end = buffer + size;
+		while ( (NULL != p) && (p < end) ) {
+			uint32_t id = 0;
+			uint32_t type = 0;
+			if (NULL != (p = ProtoWireFormat::readKey(p, end, id, type))) {
+				switch (id) {
+					case 1:
+						p = ProtoWireFormat::read(p, end, type, m_attribute1);
+						break;
+					default:
+						// Skip unknown fields.
+						p = ProtoWireFormat::skip(p, end, type);
+				}
+			}
+		}
+		return (NULL == p) ? 0 : static_cast<uint32_t>(p - buffer);
+	}
@@ -32,6 +32,7 @@ namespace core { namespace wrapper { class Image; } }
 namespace camgen {
 
 class OpenGLGrabber;
+class RaycastingGrabber;
 
     using namespace std;
 
@@ -128,6 +129,7 @@ class OpenGLGrabber;
             static CamGen* m_singleton;
             opendlv::data::environment::EgoState m_egoState;
             OpenGLGrabber *m_grabber;
+            RaycastingGrabber *m_raycastingGrabber;
             std::shared_ptr<core::wrapper::Image> m_image;
 
             float m_translationX;
@@ -155,6 +157,16 @@ class OpenGLGrabber;
              * This method draws the three dimensional scene.
              */
             void drawScene();
+
+            /**
+             * This method shares information about the current image.
+             */
+            void sendSharedImage();
+
+            /**
+             * This method raycasts images without OpenGL until the module is stopped.
+             */
+            void runHeadless();
     };
 
 } // camgen
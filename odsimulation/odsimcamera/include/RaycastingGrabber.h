@@ -0,0 +1,106 @@
+/**
+ * camgen - Camera stream generator (part of simulation environment)
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CAMGEN_RAYCASTINGGRABBER_H_
+#define CAMGEN_RAYCASTINGGRABBER_H_
+
+#include <memory>
+#include <vector>
+
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"
+#include "opendlv/data/camera/ImageGrabberID.h"
+#include "opendlv/io/camera/ImageGrabber.h"
+#include "opendlv/threeD/raycasting/RaycastingCamera.h"
+#include "opendlv/threeD/raycasting/RaycastingScene.h"
+
+namespace core { namespace wrapper { class Image; } }
+namespace odcore { namespace wrapper { class SharedMemory; } }
+namespace opendlv { namespace data { namespace camera { class ImageGrabberCalibration; } } }
+namespace opendlv { namespace data { namespace environment { class EgoState; } } }
+
+namespace camgen {
+
+    using namespace std;
+
+    /**
+     * This class implements a grabber providing images that are
+     * raycasted on the CPU from a given scenario. Thus, it does not
+     * require any OpenGL context and can be used on headless systems.
+     * Next to the BGR image, a depth map with the distances in m is
+     * provided in the shared memory "odsimcamera.depth".
+     */
+    class RaycastingGrabber : public opendlv::io::camera::ImageGrabber {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            RaycastingGrabber(const RaycastingGrabber &);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            RaycastingGrabber& operator=(const RaycastingGrabber &);
+
+        public:
+            /**
+             * Constructor.
+             *
+             * @param kvc KeyValueConfiguration.
+             * @param imageGrabberID Identifier for this image grabber.
+             * @param imageGrabberCalibration Calibration information for this grabber.
+             * @param egoState Current ego state.
+             */
+            RaycastingGrabber(const odcore::base::KeyValueConfiguration &kvc,
+                              const opendlv::data::camera::ImageGrabberID &imageGrabberID,
+                              const opendlv::data::camera::ImageGrabberCalibration &imageGrabberCalibration,
+                              opendlv::data::environment::EgoState &egoState);
+
+            virtual ~RaycastingGrabber();
+
+            virtual void delay();
+
+            virtual std::shared_ptr<core::wrapper::Image> getNextImage();
+
+            /**
+             * @return Shared memory containing the depth map of the last image.
+             */
+            std::shared_ptr<odcore::wrapper::SharedMemory> getDepth() const;
+
+        private:
+            odcore::base::KeyValueConfiguration m_kvc;
+            std::shared_ptr<core::wrapper::Image> m_image;
+            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+            std::shared_ptr<odcore::wrapper::SharedMemory> m_depth;
+            opendlv::threeD::raycasting::RaycastingScene m_scene;
+            std::shared_ptr<opendlv::threeD::raycasting::RaycastingCamera> m_camera;
+            opendlv::data::environment::EgoState &m_egoState;
+    };
+
+} // camgen
+
+#endif /*CAMGEN_RAYCASTINGGRABBER_H_*/
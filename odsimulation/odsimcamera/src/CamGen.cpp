@@ -32,8 +32,11 @@
 
 #include "CamGen.h"
 #include "OpenGLGrabber.h"
+#include "RaycastingGrabber.h"
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendlv/core/wrapper/Image.h"
 #include "opendlv/data/camera/ImageGrabberCalibration.h"
@@ -86,6 +89,7 @@ namespace camgen {
         TimeTriggeredConferenceClientModule(argc, argv, "odsimcamera"),
         m_egoState(),
         m_grabber(NULL),
+        m_raycastingGrabber(NULL),
         m_image(),
         m_translationX(0),
         m_translationY(0),
@@ -98,13 +102,11 @@ namespace camgen {
         m_mouseButton(0) {
 
         CamGen::m_singleton = this;
-
-        int32_t ac = argc;
-        glutInit(&ac, argv);
     }
 
     CamGen::~CamGen() {
         OPENDAVINCI_CORE_DELETE_POINTER(m_grabber);
+        OPENDAVINCI_CORE_DELETE_POINTER(m_raycastingGrabber);
     }
 
     CamGen& CamGen::getInstance() {
@@ -112,6 +114,23 @@ namespace camgen {
     }
 
     void CamGen::setUp() {
+        KeyValueConfiguration kvc = getKeyValueConfiguration();
+
+        // Headless mode raycasts the images on the CPU without any OpenGL context.
+        bool headless = false;
+        try {
+            headless = (kvc.getValue<uint32_t>("odsimcamera.headless") == 1);
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+
+        ImageGrabberID id("Test");
+        ImageGrabberCalibration calibration;
+
+        if (headless) {
+            m_raycastingGrabber = new RaycastingGrabber(kvc, id, calibration, m_egoState);
+            return;
+        }
+
         // Catch system exit.
         atexit(exit_func);
 
@@ -119,17 +138,18 @@ namespace camgen {
         initGL();
 
         // Setup grabber.
-        KeyValueConfiguration kvc = getKeyValueConfiguration();
-
-        ImageGrabberID id("Test");
-        ImageGrabberCalibration calibration;
-
         m_grabber = new OpenGLGrabber(kvc, id, calibration, m_egoState);
     }
 
     void CamGen::tearDown() {}
 
     void CamGen::initGlut() {
+        // GLUT is only initialized when a display is needed.
+        int32_t argc = 1;
+        char name[] = "odsimcamera";
+        char *argv[] = { name, NULL };
+        glutInit(&argc, argv);
+
         glutInitDisplayMode(GLUT_DEPTH | GLUT_DOUBLE| GLUT_RGB);
         glutInitWindowPosition(50, 50);
         glutInitWindowSize(640, 480);
@@ -158,6 +178,22 @@ namespace camgen {
 
         frameCounter++;
 
+        sendSharedImage();
+
+        if ((frameCounter % 20) == 0) {
+            clock_t end = clock();
+            clock_t duration = end - start;
+            double seconds = (1000.0 * duration) / CLOCKS_PER_SEC;
+            seconds /= 1000.0;
+            cerr << "FPS: " << (frameCounter / seconds) << endl;
+            frameCounter = 0;
+            start = clock();
+        }
+
+        m_grabber->delay();
+    }
+
+    void CamGen::sendSharedImage() {
         // Share information about this image.
         if (m_image.get()) {
             odcore::data::image::SharedImage si;
@@ -171,18 +207,30 @@ namespace camgen {
             Container c(si);
             getConference().send(c);
         }
+    }
 
-        if ((frameCounter % 20) == 0) {
-            clock_t end = clock();
-            clock_t duration = end - start;
-            double seconds = (1000.0 * duration) / CLOCKS_PER_SEC;
-            seconds /= 1000.0;
-            cerr << "FPS: " << (frameCounter / seconds) << endl;
-            frameCounter = 0;
-            start = clock();
-        }
+    void CamGen::runHeadless() {
+        while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+            Container container = getKeyValueDataStore().get(opendlv::data::environment::EgoState::ID());
+            m_egoState = container.getData<opendlv::data::environment::EgoState>();
 
-        m_grabber->delay();
+            m_image = m_raycastingGrabber->getNextImage();
+
+            sendSharedImage();
+
+            // Share information about the depth map.
+            if ( (m_image.get()) && (m_raycastingGrabber->getDepth().get()) ) {
+                odcore::data::image::SharedImage si;
+                si.setWidth(m_image->getWidth());
+                si.setHeight(m_image->getHeight());
+                si.setBytesPerPixel(sizeof(float));
+                si.setSize(si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+                si.setName(m_raycastingGrabber->getDepth()->getName());
+
+                Container c(si);
+                getConference().send(c);
+            }
+        }
     }
 
     void CamGen::processMouseMotion(int32_t x, int32_t y) {
@@ -291,6 +339,11 @@ namespace camgen {
     }
 
     odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode CamGen::body() {
+        if (m_raycastingGrabber != NULL) {
+            runHeadless();
+            return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+        }
+
         while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
             // Trigger event processing.
             glutMainLoopEvent();
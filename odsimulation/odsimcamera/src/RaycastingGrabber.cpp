@@ -0,0 +1,121 @@
+/**
+ * camgen - Camera stream generator (part of simulation environment)
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "RaycastingGrabber.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/io/URL.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendlv/core/wrapper/ImageFactory.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/scenario/SCNXArchiveFactory.h"
+
+namespace core { namespace wrapper { class Image; } }
+namespace opendlv { namespace data { namespace camera { class ImageGrabberCalibration; } } }
+namespace opendlv { namespace scenario { class SCNXArchive; } }
+
+namespace camgen {
+
+    using namespace std;
+    using namespace odcore::base;
+    using namespace odcore::io;
+    using namespace opendlv::data::camera;
+    using namespace opendlv::data::environment;
+    using namespace opendlv::scenario;
+    using namespace opendlv::threeD::raycasting;
+
+    RaycastingGrabber::RaycastingGrabber(const KeyValueConfiguration &kvc, const ImageGrabberID &imageGrabberID, const ImageGrabberCalibration &imageGrabberCalibration, opendlv::data::environment::EgoState &egoState) :
+            ImageGrabber(imageGrabberID, imageGrabberCalibration),
+            m_kvc(kvc),
+            m_image(),
+            m_sharedMemory(),
+            m_depth(),
+            m_scene(),
+            m_camera(),
+            m_egoState(egoState) {
+
+        const URL urlOfSCNXFile(m_kvc.getValue<string>("global.scenario"));
+        if (urlOfSCNXFile.isValid()) {
+            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+
+            // Triangulate the scenario and its complex models once.
+            m_scene.addSCNXArchive(scnxArchive);
+            m_scene.build();
+            cerr << "RaycastingGrabber: " << m_scene.getNumberOfTriangles() << " triangles." << endl;
+
+            // Same view as rendered by OpenGL: 60 DEG vertical field of view and a far plane at 20m.
+            m_camera = std::shared_ptr<RaycastingCamera>(new RaycastingCamera(m_scene, 640, 480, 60, 20));
+
+            uint32_t numberOfThreads = 0;
+            try {
+                numberOfThreads = m_kvc.getValue<uint32_t>("odsimcamera.threads");
+            }
+            catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+            m_camera->setNumberOfThreads(numberOfThreads);
+
+            m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory("odsimcamera", 640 * 480 * 3);
+            m_depth = odcore::wrapper::SharedMemoryFactory::createSharedMemory("odsimcamera.depth", 640 * 480 * sizeof(float));
+
+            if ( (m_sharedMemory.get()) && (m_sharedMemory->isValid()) ) {
+                m_image = std::shared_ptr<core::wrapper::Image>(core::wrapper::ImageFactory::getInstance().getImage(640, 480, core::wrapper::Image::BGR_24BIT, static_cast<char*>(m_sharedMemory->getSharedMemory())));
+            }
+
+            if (m_image.get()) {
+                cerr << "RaycastingGrabber initialized." << endl;
+            }
+        }
+    }
+
+    RaycastingGrabber::~RaycastingGrabber() {}
+
+    void RaycastingGrabber::delay() {
+        Thread::usleepFor(1000 * 10);
+    }
+
+    std::shared_ptr<odcore::wrapper::SharedMemory> RaycastingGrabber::getDepth() const {
+        return m_depth;
+    }
+
+    std::shared_ptr<core::wrapper::Image> RaycastingGrabber::getNextImage() {
+        if ( (m_sharedMemory.get()) && (m_sharedMemory->isValid()) && (m_depth.get()) && (m_depth->isValid()) ) {
+            // Look from 2.8m above the ego position at the ground 15m ahead.
+            const Point3 eye(m_egoState.getPosition().getX(), m_egoState.getPosition().getY(), 2.8);
+            const double heading = m_egoState.getRotation().getAngleXY();
+            const double pitch = -atan2(2.8, 15.0);
+
+            m_sharedMemory->lock();
+            m_depth->lock();
+            {
+                m_camera->render(eye, heading, pitch, static_cast<unsigned char*>(m_sharedMemory->getSharedMemory()), static_cast<float*>(m_depth->getSharedMemory()));
+            }
+            m_depth->unlock();
+            m_sharedMemory->unlock();
+        }
+
+        return m_image;
+    }
+
+} // camgen
@@ -21,6 +21,7 @@
 #define IRUS_H_
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/FIFOQueue.h"
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 
@@ -70,6 +71,9 @@ namespace irus {
             virtual void setUp();
 
             virtual void tearDown();
+
+        private:
+            odcore::base::FIFOQueue m_FIFO_OtherVehicles;
     };
 
 } // irus
@@ -25,6 +25,7 @@
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/OtherVehicleState.h"
 #include "opendlv/vehiclecontext/model/IRUS.h"
 
 namespace odcore { namespace base { class KeyValueDataStore; } }
@@ -37,7 +38,8 @@ namespace irus {
     using namespace opendlv::data::environment;
 
     IRUS::IRUS(const int32_t &argc, char **argv) :
-        TimeTriggeredConferenceClientModule(argc, argv, "odsimirus") {}
+        TimeTriggeredConferenceClientModule(argc, argv, "odsimirus"),
+        m_FIFO_OtherVehicles() {}
 
     IRUS::~IRUS() {}
 
@@ -54,6 +56,9 @@ namespace irus {
         opendlv::vehiclecontext::model::IRUS irus(config);
         irus.setup();
 
+        // Other vehicles are dynamic obstacles for the sensors.
+        addDataStoreFor(opendlv::data::environment::OtherVehicleState::ID(), m_FIFO_OtherVehicles);
+
         // Use the most recent EgoState available.
         KeyValueDataStore &kvs = getKeyValueDataStore();
 
@@ -62,6 +67,16 @@ namespace irus {
             Container c = kvs.get(opendlv::data::environment::EgoState::ID());
             EgoState es = c.getData<EgoState>();
 
+            // Update all other vehicles that have moved since the last cycle.
+            const uint32_t SIZE = m_FIFO_OtherVehicles.getSize();
+            for (uint32_t i = 0; i < SIZE; i++) {
+                Container ovs = m_FIFO_OtherVehicles.leave();
+                irus.updateOtherVehicle(ovs.getData<OtherVehicleState>());
+            }
+
+            // Forget other vehicles that are no longer reported.
+            irus.removeStaleOtherVehicles();
+
             // Calculate result and propagate it.
             vector<Container> toBeSent = irus.calculate(es);
             if (toBeSent.size() > 0) {
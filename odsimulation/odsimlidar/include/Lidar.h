@@ -0,0 +1,97 @@
+/**
+ * odsimlidar - Lidar data generator (part of simulation environment)
+ * Copyright (C) 2017 Christian Berger
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef LIDAR_H_
+#define LIDAR_H_
+
+#include <memory>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
+#include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
+#include "opendlv/threeD/raycasting/RaycastingLidar.h"
+#include "opendlv/threeD/raycasting/RaycastingScene.h"
+
+namespace odcore { namespace data { namespace pointcloud { class CompactPointCloudCodec; } } }
+namespace odcore { namespace wrapper { class SharedMemory; } }
+
+namespace lidar {
+
+    using namespace std;
+
+    /**
+     * This class simulates a rotating multi-layer lidar by raycasting
+     * the scenario on the CPU. Each scan is provided as SharedPointCloud
+     * in the shared memory "odsimlidar" and as CompactPointCloud.
+     */
+    class Lidar : public odcore::base::module::TimeTriggeredConferenceClientModule {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            Lidar(const Lidar &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            Lidar& operator=(const Lidar &/*obj*/);
+
+        public:
+            /**
+             * Constructor.
+             *
+             * @param argc Number of command line arguments.
+             * @param argv Command line arguments.
+             */
+            Lidar(const int32_t &argc, char **argv);
+
+            virtual ~Lidar();
+
+            odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode body();
+
+        private:
+            virtual void setUp();
+
+            virtual void tearDown();
+
+        private:
+            opendlv::threeD::raycasting::RaycastingScene m_scene;
+            std::shared_ptr<opendlv::threeD::raycasting::RaycastingLidar> m_lidar;
+            std::shared_ptr<odcore::data::pointcloud::CompactPointCloudCodec> m_codec;
+            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+            vector<float> m_points;
+            double m_mountX;
+            double m_mountZ;
+            uint32_t m_numberOfBitsForIntensity;
+    };
+
+} // lidar
+
+#endif /*LIDAR_H_*/
@@ -0,0 +1,193 @@
+/**
+ * odsimlidar - Lidar data generator (part of simulation environment)
+ * Copyright (C) 2017 Christian Berger
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Lidar.h"
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/pointcloud/CompactPointCloudCodec.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/io/URL.h"
+#include "opendavinci/odcore/strings/StringToolbox.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/generated/odcore/data/CompactPointCloud.h"
+#include "opendavinci/generated/odcore/data/SharedPointCloud.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/scenario/SCNXArchiveFactory.h"
+
+namespace odcore { namespace base { class KeyValueDataStore; } }
+namespace opendlv { namespace scenario { class SCNXArchive; } }
+
+namespace lidar {
+
+    using namespace std;
+    using namespace odcore::base;
+    using namespace odcore::data;
+    using namespace odcore::io;
+    using namespace opendlv::data::environment;
+    using namespace opendlv::scenario;
+    using namespace opendlv::threeD::raycasting;
+
+    Lidar::Lidar(const int32_t &argc, char **argv) :
+        TimeTriggeredConferenceClientModule(argc, argv, "odsimlidar"),
+        m_scene(),
+        m_lidar(),
+        m_codec(),
+        m_sharedMemory(),
+        m_points(),
+        m_mountX(0),
+        m_mountZ(1.9),
+        m_numberOfBitsForIntensity(0) {}
+
+    Lidar::~Lidar() {}
+
+    void Lidar::setUp() {
+        KeyValueConfiguration kvc = getKeyValueConfiguration();
+
+        // Default layout of a 16 layer lidar.
+        vector<float> verticalAngles;
+        for (int32_t angle = -15; angle <= 15; angle += 2) {
+            verticalAngles.push_back(static_cast<float>(angle));
+        }
+        try {
+            const vector<string> tokens = odcore::strings::StringToolbox::split(kvc.getValue<string>("odsimlidar.verticalAngles"), ',');
+            if (tokens.size() > 0) {
+                verticalAngles.clear();
+                for (uint32_t i = 0; i < tokens.size(); i++) {
+                    stringstream sstr(tokens.at(i));
+                    float angle = 0;
+                    sstr >> angle;
+                    verticalAngles.push_back(angle);
+                }
+            }
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+
+        float startAzimuth = 0;
+        float endAzimuth = 360;
+        float azimuthIncrement = 0.2f;
+        double range = 100;
+        uint32_t numberOfThreads = 0;
+        try {
+            startAzimuth = kvc.getValue<float>("odsimlidar.startAzimuth");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+        try {
+            endAzimuth = kvc.getValue<float>("odsimlidar.endAzimuth");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+        try {
+            azimuthIncrement = kvc.getValue<float>("odsimlidar.azimuthIncrement");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+        try {
+            range = kvc.getValue<double>("odsimlidar.range");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+        try {
+            m_mountX = kvc.getValue<double>("odsimlidar.mount.x");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+        try {
+            m_mountZ = kvc.getValue<double>("odsimlidar.mount.z");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+        try {
+            m_numberOfBitsForIntensity = kvc.getValue<uint32_t>("odsimlidar.intensityBits");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+        try {
+            numberOfThreads = kvc.getValue<uint32_t>("odsimlidar.threads");
+        }
+        catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {}
+
+        const URL urlOfSCNXFile(kvc.getValue<string>("global.scenario"));
+        if (urlOfSCNXFile.isValid()) {
+            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+
+            // Triangulate the scenario and its complex models once.
+            m_scene.addSCNXArchive(scnxArchive);
+            m_scene.build();
+            cerr << "odsimlidar: " << m_scene.getNumberOfTriangles() << " triangles." << endl;
+        }
+
+        m_lidar = std::shared_ptr<RaycastingLidar>(new RaycastingLidar(m_scene, verticalAngles, startAzimuth, endAzimuth, azimuthIncrement, range));
+        m_lidar->setNumberOfThreads(numberOfThreads);
+
+        m_codec = std::shared_ptr<odcore::data::pointcloud::CompactPointCloudCodec>(new odcore::data::pointcloud::CompactPointCloudCodec(verticalAngles));
+
+        m_points.resize(m_lidar->getNumberOfPoints() * RaycastingLidar::NUMBER_OF_COMPONENTS_PER_POINT);
+        m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory("odsimlidar", m_points.size() * sizeof(float));
+    }
+
+    void Lidar::tearDown() {}
+
+    odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode Lidar::body() {
+        // Use the most recent EgoState available.
+        KeyValueDataStore &kvs = getKeyValueDataStore();
+
+        SharedPointCloud spc;
+        spc.setName("odsimlidar");
+        spc.setSize(m_lidar->getNumberOfPoints() * RaycastingLidar::NUMBER_OF_COMPONENTS_PER_POINT * sizeof(float));
+        spc.setWidth(m_lidar->getNumberOfPoints());
+        spc.setHeight(1);
+        spc.setNumberOfComponentsPerPoint(RaycastingLidar::NUMBER_OF_COMPONENTS_PER_POINT);
+        spc.setComponentDataType(SharedPointCloud::FLOAT_T);
+        spc.setUserInfo(SharedPointCloud::POLAR_INTENSITY);
+
+        while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+            // Get current EgoState.
+            Container c = kvs.get(opendlv::data::environment::EgoState::ID());
+            EgoState es = c.getData<EgoState>();
+
+            const double heading = es.getRotation().getAngleXY();
+            const Point3 position(es.getPosition().getX() + m_mountX * cos(heading), es.getPosition().getY() + m_mountX * sin(heading), m_mountZ);
+
+            if ( (m_sharedMemory.get()) && (m_sharedMemory->isValid()) && (!m_points.empty()) ) {
+                // Scan without blocking readers of the previous scan.
+                m_lidar->scan(position, heading, &m_points[0]);
+                CompactPointCloud cpc = m_codec->encode(spc, &m_points[0], CompactPointCloud::CM, static_cast<uint8_t>(m_numberOfBitsForIntensity), CompactPointCloud::HIGHER_BITS);
+
+                m_sharedMemory->lock();
+                {
+                    memcpy(m_sharedMemory->getSharedMemory(), &m_points[0], m_points.size() * sizeof(float));
+                }
+                m_sharedMemory->unlock();
+
+                Container spcContainer(spc);
+                getConference().send(spcContainer);
+
+                Container cpcContainer(cpc);
+                getConference().send(cpcContainer);
+            }
+        }
+
+        return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+    }
+
+} // lidar
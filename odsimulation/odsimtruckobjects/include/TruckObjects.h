@@ -21,6 +21,7 @@
 #define TRUCKOBJECTS_H_
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/FIFOQueue.h"
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 
@@ -69,6 +70,9 @@ namespace gcdc16 {
             virtual void setUp();
 
             virtual void tearDown();
+
+        private:
+            odcore::base::FIFOQueue m_FIFO_OtherVehicles;
     };
 
 } // irus
@@ -26,6 +26,7 @@
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/OtherVehicleState.h"
 #include "opendlv/vehiclecontext/model/IRUS.h"
 #include "automotivedata/generated/automotive/miniature/SensorBoardData.h"
 #include "odvdopendlv/generated/opendlv/perception/Object.h"
@@ -41,7 +42,8 @@ namespace gcdc16 {
     using namespace opendlv::data::environment;
 
     TruckObjects::TruckObjects(const int32_t &argc, char **argv) :
-        TimeTriggeredConferenceClientModule(argc, argv, "odsimirus") {}
+        TimeTriggeredConferenceClientModule(argc, argv, "odsimirus"),
+        m_FIFO_OtherVehicles() {}
 
     TruckObjects::~TruckObjects() {}
 
@@ -58,6 +60,9 @@ namespace gcdc16 {
         opendlv::vehiclecontext::model::IRUS irus(config);
         irus.setup();
 
+        // Other vehicles are dynamic obstacles for the sensors.
+        addDataStoreFor(opendlv::data::environment::OtherVehicleState::ID(), m_FIFO_OtherVehicles);
+
         // Use the most recent EgoState available.
         KeyValueDataStore &kvs = getKeyValueDataStore();
 
@@ -66,6 +71,16 @@ namespace gcdc16 {
             Container c = kvs.get(opendlv::data::environment::EgoState::ID());
             EgoState es = c.getData<EgoState>();
 
+            // Update all other vehicles that have moved since the last cycle.
+            const uint32_t SIZE = m_FIFO_OtherVehicles.getSize();
+            for (uint32_t i = 0; i < SIZE; i++) {
+                Container ovs = m_FIFO_OtherVehicles.leave();
+                irus.updateOtherVehicle(ovs.getData<OtherVehicleState>());
+            }
+
+            // Forget other vehicles that are no longer reported.
+            irus.removeStaleOtherVehicles();
+
             // Calculate result and propagate it.
             vector<Container> toBeSent = irus.calculate(es);
             if (toBeSent.size() > 0) {
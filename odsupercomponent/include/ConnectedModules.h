@@ -31,6 +31,7 @@
 namespace odcore { namespace data { namespace dmcp { class ModuleDescriptor; } } }
 namespace odcore { namespace data { namespace dmcp { class PulseMessage; } } }
 namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace data { class TimeStamp; } }
 
 namespace odsupercomponent {
 
@@ -90,8 +91,59 @@ class ConnectedModule;
              */
             vector<odcore::data::Container> pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore);
 
+            /**
+             * This method sends a pulse to all modules of a group at once
+             * and waits for all their ACK messages before the next group
+             * is pulsed. Thus, a cycle lasts as long as the slowest module
+             * per group instead of the sum of all modules' runtimes.
+             *
+             * @param pm PulseMessage to be sent.
+             * @param timeout Timeout in milliseconds to wait for all ACK messages of a group.
+             * @param yield Time in microseconds to sleep after a group was executed.
+             * @param modulesToIgnore List of modules that do not get a pulse.
+             * @param groups Ordered groups of module names; modules that are not listed belong to the first group.
+             */
+            void pulse_ack_parallel(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore, const vector<vector<string> > &groups);
+
+            /**
+             * This method works like pulse_ack_parallel but in addition
+             * collects the containers of all modules. The containers
+             * are returned in the same order as by pulse_ack_containers,
+             * i.e. group by group and sorted by module name within a
+             * group, regardless of the order in which the ACK messages
+             * arrived.
+             *
+             * @param pm PulseMessage to be sent.
+             * @param timeout Timeout in milliseconds to wait for all ACK messages of a group.
+             * @param yield Time in microseconds to sleep after a group was executed.
+             * @param modulesToIgnore List of modules that do not get a pulse.
+             * @param groups Ordered groups of module names; modules that are not listed belong to the first group.
+             * @return Containers to be delivered in the next cycle.
+             */
+            vector<odcore::data::Container> pulse_ack_containers_parallel(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore, const vector<vector<string> > &groups);
+
             void deleteAllModules();
 
+        private:
+            /**
+             * This method assigns all modules that shall get a pulse to
+             * their groups.
+             *
+             * @param modulesToIgnore List of modules that do not get a pulse.
+             * @param groups Ordered groups of module names.
+             * @return Modules per group.
+             */
+            vector<vector<ConnectedModule*> > getModulesPerGroup(const vector<string> &modulesToIgnore, const vector<vector<string> > &groups);
+
+            /**
+             * This method computes the remaining time until a deadline.
+             *
+             * @param start Start of the waiting period.
+             * @param timeout Length of the waiting period in milliseconds.
+             * @return Remaining milliseconds.
+             */
+            static uint32_t getRemainingMilliseconds(const odcore::data::TimeStamp &start, const uint32_t &timeout);
+
         protected:
             odcore::base::Mutex m_modulesMutex;
             map<string, ConnectedModule*> m_modules;
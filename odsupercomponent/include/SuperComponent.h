@@ -164,6 +164,8 @@ class ConnectedModule;
             uint32_t m_yieldMicroseconds;
 
             vector<string> m_modulesToIgnore;
+            bool m_parallelPulses;
+            vector<vector<string> > m_pulseGroups;
             odcore::data::LogMessage::LogLevel m_logLevel;
             fstream *m_logFile;
     };
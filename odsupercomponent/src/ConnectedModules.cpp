@@ -175,6 +175,103 @@ namespace odsupercomponent {
         return allContainersToBeDeliveredInNextCycle;
     }
 
+    vector<vector<ConnectedModule*> > ConnectedModules::getModulesPerGroup(const vector<string> &modulesToIgnore, const vector<vector<string> > &groups) {
+        vector<vector<ConnectedModule*> > modulesPerGroup(groups.empty() ? 1 : groups.size());
+
+        Lock l(m_modulesMutex);
+
+        map<string, ConnectedModule*>::iterator iter;
+        for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
+            // Get the module's name with and without its identifier.
+            string s = iter->first;
+            transform(s.begin(), s.end(), s.begin(), ::tolower);
+            const string name = s.substr(0, s.rfind('-'));
+
+            // Check whether we have to skip this module when sending pulses.
+            if (find(modulesToIgnore.begin(), modulesToIgnore.end(), s) != modulesToIgnore.end()) {
+                continue;
+            }
+
+            // Modules that are not assigned to a group do not depend on other modules.
+            uint32_t group = 0;
+            for (uint32_t i = 0; i < groups.size(); i++) {
+                if ( (find(groups[i].begin(), groups[i].end(), s) != groups[i].end()) ||
+                     (find(groups[i].begin(), groups[i].end(), name) != groups[i].end()) ) {
+                    group = i;
+                    break;
+                }
+            }
+            modulesPerGroup[group].push_back(iter->second);
+        }
+
+        return modulesPerGroup;
+    }
+
+    uint32_t ConnectedModules::getRemainingMilliseconds(const TimeStamp &start, const uint32_t &timeout) {
+        const int64_t elapsed = (TimeStamp() - start).toMicroseconds() / 1000;
+        if (elapsed < 0) {
+            return timeout;
+        }
+        return (elapsed < timeout) ? static_cast<uint32_t>(timeout - elapsed) : 0;
+    }
+
+    void ConnectedModules::pulse_ack_parallel(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore, const vector<vector<string> > &groups) {
+        // m_modulesMutex is not held while waiting for the ACK messages as modules
+        // report their state changes meanwhile; disconnected modules are deleted
+        // only by the calling thread.
+        const vector<vector<ConnectedModule*> > modulesPerGroup = getModulesPerGroup(modulesToIgnore, groups);
+        for (vector<vector<ConnectedModule*> >::const_iterator group = modulesPerGroup.begin(); group != modulesPerGroup.end(); ++group) {
+            if (group->empty()) {
+                continue;
+            }
+
+            // Pulse all modules of this group at once...
+            const TimeStamp start;
+            for (vector<ConnectedModule*>::const_iterator module = group->begin(); module != group->end(); ++module) {
+                (*module)->getConnection().send_pulse_ack(pm);
+            }
+
+            // ...and wait until all of them have confirmed the processing of this pulse.
+            for (vector<ConnectedModule*>::const_iterator module = group->begin(); module != group->end(); ++module) {
+                (*module)->getConnection().wait_for_pulse_ack(getRemainingMilliseconds(start, timeout));
+            }
+
+            // Allow delivery of packets on OS level.
+            Thread::usleepFor(yield);
+        }
+    }
+
+    vector<Container> ConnectedModules::pulse_ack_containers_parallel(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore, const vector<vector<string> > &groups) {
+        vector<Container> allContainersToBeDeliveredInNextCycle;
+
+        // Cf. pulse_ack_parallel for why m_modulesMutex is not held here.
+        const vector<vector<ConnectedModule*> > modulesPerGroup = getModulesPerGroup(modulesToIgnore, groups);
+        for (vector<vector<ConnectedModule*> >::const_iterator group = modulesPerGroup.begin(); group != modulesPerGroup.end(); ++group) {
+            if (group->empty()) {
+                continue;
+            }
+
+            // Pulse all modules of this group at once...
+            const TimeStamp start;
+            for (vector<ConnectedModule*>::const_iterator module = group->begin(); module != group->end(); ++module) {
+                (*module)->getConnection().send_pulse_ack_containers(pm);
+            }
+
+            // ...and collect their containers in the modules' order to keep the result deterministic.
+            for (vector<ConnectedModule*>::const_iterator module = group->begin(); module != group->end(); ++module) {
+                vector<Container> containersToBeDeliveredInNextCycle = (*module)->getConnection().wait_for_pulse_ack_containers(getRemainingMilliseconds(start, timeout));
+
+                // Add newly received containers to the overall list.
+                allContainersToBeDeliveredInNextCycle.insert(allContainersToBeDeliveredInNextCycle.end(), containersToBeDeliveredInNextCycle.begin(), containersToBeDeliveredInNextCycle.end());
+            }
+
+            // Allow delivery of packets on OS level.
+            Thread::usleepFor(yield);
+        }
+
+        return allContainersToBeDeliveredInNextCycle;
+    }
+
     void ConnectedModules::deleteAllModules() {
         Lock l(m_modulesMutex);
         map<string, ConnectedModule*>::iterator iter;
@@ -82,6 +82,8 @@ namespace odsupercomponent {
         m_timeoutACKMilliseconds(0),
         m_yieldMicroseconds(0),
         m_modulesToIgnore(),
+        m_parallelPulses(false),
+        m_pulseGroups(),
         m_logLevel(odcore::data::LogMessage::NONE),
         m_logFile(NULL) {
 
@@ -120,6 +122,9 @@ namespace odsupercomponent {
         m_connectionServer = new connection::Server(serverInformation, m_configurationProvider);
         m_connectionServer->setConnectionHandler(this);
 
+        if (isSharedMemoryConference()) {
+            ContainerConferenceFactory::getInstance().setTransport(ContainerConferenceFactory::SHARED_MEMORY);
+        }
         m_conference = std::shared_ptr<ContainerConference>(ContainerConferenceFactory::getInstance().getContainerConference(getMultiCastGroup()));
         m_conference->setContainerListener(this);
 
@@ -270,6 +275,35 @@ namespace odsupercomponent {
                     // If "odsupercomponent.pulsetimeack.exclude" is not specified, just ignore exception.
                 }
 
+                try {
+                    m_parallelPulses = (m_configuration.getValue<uint32_t>("odsupercomponent.pulsetimeack.parallel") == 1);
+                }
+                catch(...) {
+                    // If "odsupercomponent.pulsetimeack.parallel" is not specified, modules are pulsed sequentially.
+                }
+
+                try {
+                    // Groups are separated by ';' and executed in their order; modules within a group are separated by ','.
+                    string s = m_configuration.getValue<string>("odsupercomponent.pulsetimeack.groups");
+                    transform(s.begin(), s.end(), s.begin(), ::tolower);
+
+                    const vector<string> groups = odcore::strings::StringToolbox::split(s, ';');
+                    for (vector<string>::const_iterator it = groups.begin(); it != groups.end(); ++it) {
+                        vector<string> group = odcore::strings::StringToolbox::split(*it, ',');
+                        for (vector<string>::iterator jt = group.begin(); jt != group.end(); ++jt) {
+                            odcore::strings::StringToolbox::trim(*jt);
+                        }
+                        m_pulseGroups.push_back(group);
+                    }
+                }
+                catch(...) {
+                    // If "odsupercomponent.pulsetimeack.groups" is not specified, all modules are pulsed at once in parallel mode.
+                }
+
+                if (m_parallelPulses) {
+                    CLOG1 << "[odsupercomponent]: Pulsing " << (m_pulseGroups.empty() ? 1 : m_pulseGroups.size()) << " group(s) of modules in parallel." << endl;
+                }
+
             }
         }
     }
@@ -379,7 +413,12 @@ namespace odsupercomponent {
                     // m_yieldMicroseconds specifies the amount of time that we are going to wait before
                     // we trigger the next module (send the pulse to it) to allow delivery of any packets
                     // on the OS level.
-                    m_modules.pulse_ack(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore);
+                    if (m_parallelPulses) {
+                        m_modules.pulse_ack_parallel(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore, m_pulseGroups);
+                    }
+                    else {
+                        m_modules.pulse_ack(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore);
+                    }
                 }
                 else if ( (m_managedLevel == odcore::data::dmcp::ServerInformation::ML_SIMULATION) || (m_managedLevel == odcore::data::dmcp::ServerInformation::ML_SIMULATION_RT) ) {
                     // Managed level ML_SIMULATION requires a confirmation from the dependent
@@ -394,19 +433,21 @@ namespace odsupercomponent {
                     // Set containers to be delivered to the connected modules.
                     pm.setListOfContainers(containersToBeDistributedToModules);
 
-                    // Replicate containers to real UDP conference for modules that are excluded from the ML.
-                    vector<Container>::iterator it = containersToBeDistributedToModules.begin();
-                    while (it != containersToBeDistributedToModules.end()) {
-                        m_conference->send(*it);
-                        it++;
-                        Thread::usleepFor(500);
-                    }
+                    // Replicate containers to real UDP conference for modules that are excluded from the ML;
+                    // they are packed into as few packets as possible and sent at once. The connected modules
+                    // get the containers with the pulse message and confirm them with their ACK.
+                    m_conference->sendBatch(containersToBeDistributedToModules);
 
                     // Clear containers from last cycle.
                     containersToBeDistributedToModules.clear();
 
                     // Save containers to be distributed in the next cycle.
-                    containersToBeDistributedToModules = m_modules.pulse_ack_containers(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore);
+                    if (m_parallelPulses) {
+                        containersToBeDistributedToModules = m_modules.pulse_ack_containers_parallel(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore, m_pulseGroups);
+                    }
+                    else {
+                        containersToBeDistributedToModules = m_modules.pulse_ack_containers(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore);
+                    }
                 }
 
                 // Increment the nomimal time slices.
@@ -148,6 +148,7 @@ class Example7SenderApp : public TimeTriggeredConferenceClientModule {
 
                 // Create container.
                 Container c(data);
+                c.setSenderStamp(getIdentifier());
 
                 // Send container.
                 getConference().send(c);
@@ -217,6 +218,66 @@ class Example7ReceiverApp : public TimeTriggeredConferenceClientModule {
         }
 };
 
+class Example7OrderReceiverApp : public TimeTriggeredConferenceClientModule {
+    public:
+        bool tearDownCalled;
+        mutable Mutex m_cyclesMutex;
+        uint32_t m_cyclesInOrder;
+        uint32_t m_cyclesOutOfOrder;
+        vector<uint32_t> m_sendersOfCurrentCycle;
+
+    public:
+        Example7OrderReceiverApp(const int32_t &argc, char **argv) :
+            TimeTriggeredConferenceClientModule(argc, argv, "example7receiver"),
+            tearDownCalled(false),
+            m_cyclesMutex(),
+            m_cyclesInOrder(0),
+            m_cyclesOutOfOrder(0),
+            m_sendersOfCurrentCycle() {}
+
+        void setUp() {}
+
+        void tearDown() {
+            tearDownCalled = true;
+        }
+
+        virtual void nextContainer(Container &c) {
+            TimeTriggeredConferenceClientModule::nextContainer(c);
+
+            // Containers from the last cycle are delivered right before the next cycle starts.
+            if (c.getDataType() == TestSuiteExample7Data::ID()) {
+                m_sendersOfCurrentCycle.push_back(c.getSenderStamp());
+            }
+        }
+
+        odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode body() {
+            while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+                // Once both senders are running, their containers must be ordered by module name.
+                if (m_sendersOfCurrentCycle.size() > 1) {
+                    Lock l(m_cyclesMutex);
+                    if ( (m_sendersOfCurrentCycle.size() == 2) && (m_sendersOfCurrentCycle[0] == 1) && (m_sendersOfCurrentCycle[1] == 2) ) {
+                        m_cyclesInOrder++;
+                    }
+                    else {
+                        m_cyclesOutOfOrder++;
+                    }
+                }
+                m_sendersOfCurrentCycle.clear();
+            }
+
+            return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+        }
+
+        uint32_t getCyclesInOrder() {
+            Lock l(m_cyclesMutex);
+            return m_cyclesInOrder;
+        }
+
+        uint32_t getCyclesOutOfOrder() {
+            Lock l(m_cyclesMutex);
+            return m_cyclesOutOfOrder;
+        }
+};
 
 class ConnectedClientModuleApp : public TimeTriggeredConferenceClientModule {
     public:
@@ -420,6 +481,327 @@ class ManagedLevelTest : public CxxTest::TestSuite {
             }
 #endif /*defined(__linux__) || (__OpenBSD__) || (__FreeBSD__) || (__arm__)*/
 
+#endif /*!defined(WIN32) && !defined(__APPLE__)*/
+        }
+
+        void testManagedLevelPulseTimeAckParallel_SenderReceiver() {
+// This test suite does not run properly on Win32 and MacOS and on qemu-arm-static. Thus, skip it for the time being...
+#if !defined(WIN32) && !defined(__APPLE__) && !defined(__arm__)
+
+// The following test case design pattern (singleton of system service & fork/waitpid) is only available on Linux, OpenBSD, and FreeBSD.
+#if defined(__linux__) || (__OpenBSD__) || (__FreeBSD__)
+            const uint32_t ONE_SECOND = 1*1000*1000;
+
+            // As the dependent modules replace the time factory, we need a separate process context for them by using the syscall fork.
+
+            pid_t child;
+            child = fork();
+
+            if (child == 0) {
+                // In child process.
+
+                // Create first component.
+                string c0_argv0("example7sender");
+                string c0_argv1("--cid=103");
+                string c0_argv2("--freq=10");
+                int32_t c0_argc = 3;
+                char **c0_argv;
+                c0_argv = new char*[c0_argc];
+                c0_argv[0] = const_cast<char*>(c0_argv0.c_str());
+                c0_argv[1] = const_cast<char*>(c0_argv1.c_str());
+                c0_argv[2] = const_cast<char*>(c0_argv2.c_str());
+
+                Example7ReceiverApp app1(c0_argc, c0_argv);
+                ConnectedClientModuleTestService ccms1(&app1);
+
+                // Create second component.
+                string c1_argv0("example7receiver");
+                string c1_argv1("--cid=103");
+                string c1_argv2("--freq=10");
+                int32_t c1_argc = 3;
+                char **c1_argv;
+                c1_argv = new char*[c1_argc];
+                c1_argv[0] = const_cast<char*>(c1_argv0.c_str());
+                c1_argv[1] = const_cast<char*>(c1_argv1.c_str());
+                c1_argv[2] = const_cast<char*>(c1_argv2.c_str());
+
+                const bool USE_RANDOM_WAIT = true;
+                Example7SenderApp app2(c1_argc, c1_argv, USE_RANDOM_WAIT);
+                ConnectedClientModuleTestService ccms2(&app2);
+
+                ccms1.start();
+                uint32_t cycles = 0;
+                const uint32_t MAX_CYCLES = 3;
+                while (cycles < MAX_CYCLES) {
+                    Thread::usleepFor(ONE_SECOND);
+                    cycles++;
+                }
+
+                ccms2.start();
+                cycles = 0;
+                const uint32_t TIMEOUT = 180;
+                while ((app1.getDiff() == 0) && (cycles < TIMEOUT)) {
+                    Thread::usleepFor(ONE_SECOND);
+                    cycles++;
+                }
+
+                // This test adds a delta to the execution trigger and thus, it should not fail as both components have a determined execution order.
+                TS_ASSERT(app1.getDiff() == 0);
+                TS_ASSERT(cycles == TIMEOUT);
+
+                TS_ASSERT(app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 0 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 100000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 200000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 300000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 400000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 500000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 600000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 700000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 800000 ||
+                          app1.getStartOfCurrentCycle().getFractionalMicroseconds() == 900000 );
+
+                TS_ASSERT(app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 0 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 100000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 200000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 300000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 400000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 500000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 600000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 700000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 800000 ||
+                          app2.getStartOfCurrentCycle().getFractionalMicroseconds() == 900000 );
+
+                ccms1.stop();
+                ccms2.stop();
+
+                TS_ASSERT(ccms1.isRunModuleCompleted());
+                TS_ASSERT(app1.tearDownCalled);
+                TS_ASSERT(ccms2.isRunModuleCompleted());
+                TS_ASSERT(app2.tearDownCalled);
+
+                uint32_t retVal = (!ccms1.isRunModuleCompleted() ? 1<<1 : 0) |
+                                  (!app1.tearDownCalled ? 1<<2 : 0) |
+                                  (!ccms2.isRunModuleCompleted() ? 1<<3 : 0) |
+                                  (!app2.tearDownCalled ? 1<<4 : 0) |
+                                  ((app1.getDiff() != 0) ? 1<<5 : 0);
+
+                // Leave child's process context.
+                exit(retVal);
+            }
+            else if (child > 0) {
+                // In parent process.
+
+                // Create a configuration.
+                stringstream configuration;
+                configuration << "global.buffer.memorySegmentSize = 2800000 # Size of a memory segment for a shared data stream in bytes." << endl
+                     << "global.buffer.numberOfMemorySegments = 20 # Number of memory segments used for buffering." << endl
+                     << "odsupercomponent.pulseshift.shift = 10000 # (in microseconds) If the managed level is pulse_shift, all connected modules will be informed about the supercomponent's real time by this increment per module. Thus, the execution times per modules are better aligned with supercomponent and the data exchange is somewhat more predictable." << endl
+                     << "odsupercomponent.pulsetimeack.timeout = 5000 # (in milliseconds) If the managed level is pulse_time_ack, this is the timeout for waiting for an ACK message from the dependent client." << endl
+                     << "odsupercomponent.pulsetimeack.yield = 5000 # (in microseconds) If the managed level is pulse_time_ack, the modules are triggered sequentially by sending pulses and waiting for acknowledgment messages. To allow the modules to deliver their respective containers, this yielding time is used to sleep before supercomponent sends the pulse messages the next module in this execution cycle. This value needs to be adjusted for networked simulations to ensure deterministic execution. " << endl
+                     << "odsupercomponent.pulsetimeack.exclude = cockpit,monitor # List of modules that will not get a pulse message from supercomponent." << endl
+                     << "odsupercomponent.pulsetimeack.parallel = 1 # Pulse all modules of a group at once and wait for all their ACKs." << endl
+                     << "odsupercomponent.pulsetimeack.groups = example7receiver;example7sender # Execution order of groups; modules within a group are pulsed in parallel." << endl;
+
+                fstream fout("configuration", ios::out);
+                TS_ASSERT(fout.good());
+                fout << configuration.str();
+                fout.close();
+
+                // Start the encapsulated supercomponent.
+                string sc_argv0("odsupercomponent");
+                string sc_argv1("--cid=103");
+                string sc_argv2("--freq=10");
+                string sc_argv3("--managed=pulse_time_ack");
+                int32_t sc_argc = 4;
+                char **sc_argv;
+                sc_argv = new char*[sc_argc];
+                sc_argv[0] = const_cast<char*>(sc_argv0.c_str());
+                sc_argv[1] = const_cast<char*>(sc_argv1.c_str());
+                sc_argv[2] = const_cast<char*>(sc_argv2.c_str());
+                sc_argv[3] = const_cast<char*>(sc_argv3.c_str());
+
+                SupercomponentService scs(sc_argc, sc_argv);
+                scs.start();
+
+                // Monitor the child's process and wait for its exit.
+                int status = 0;
+                do {
+                    pid_t w = waitpid(child, &status, WUNTRACED | WCONTINUED);
+                    TS_ASSERT(w > -1);
+                } while (!WIFEXITED(status) && !WIFSIGNALED(status));
+                TS_ASSERT(WIFEXITED(status));
+
+                if (WIFEXITED(status)) {
+                    TS_ASSERT(WEXITSTATUS(status) == 0);
+                }
+
+                scs.stop();
+
+                UNLINK("configuration");
+            }
+#endif /*defined(__linux__) || (__OpenBSD__) || (__FreeBSD__) || (__arm__)*/
+
+#endif /*!defined(WIN32) && !defined(__APPLE__)*/
+        }
+
+        void testManagedLevelSimulationParallel_ContainerOrder() {
+// This test suite does not run properly on Win32 and MacOS and on qemu-arm-static. Thus, skip it for the time being...
+#if !defined(WIN32) && !defined(__APPLE__) && !defined(__arm__)
+
+// The following test case design pattern (singleton of system service & fork/waitpid) is only available on Linux, OpenBSD, and FreeBSD.
+#if defined(__linux__) || (__OpenBSD__) || (__FreeBSD__)
+            const uint32_t ONE_SECOND = 1*1000*1000;
+
+            // As the dependent modules replace the time factory, we need a separate process context for them by using the syscall fork.
+
+            pid_t child;
+            child = fork();
+
+            if (child == 0) {
+                // In child process.
+
+                // Create receiving component.
+                string c0_argv0("example7receiver");
+                string c0_argv1("--cid=104");
+                string c0_argv2("--freq=10");
+                string c0_argv3("--id=3");
+                int32_t c0_argc = 4;
+                char **c0_argv;
+                c0_argv = new char*[c0_argc];
+                c0_argv[0] = const_cast<char*>(c0_argv0.c_str());
+                c0_argv[1] = const_cast<char*>(c0_argv1.c_str());
+                c0_argv[2] = const_cast<char*>(c0_argv2.c_str());
+                c0_argv[3] = const_cast<char*>(c0_argv3.c_str());
+
+                Example7OrderReceiverApp app1(c0_argc, c0_argv);
+                ConnectedClientModuleTestService ccms1(&app1);
+
+                // Create first sending component; it sleeps randomly and thus, its ACK arrives mostly last.
+                string c1_argv0("example7sender");
+                string c1_argv1("--cid=104");
+                string c1_argv2("--freq=10");
+                string c1_argv3("--id=1");
+                int32_t c1_argc = 4;
+                char **c1_argv;
+                c1_argv = new char*[c1_argc];
+                c1_argv[0] = const_cast<char*>(c1_argv0.c_str());
+                c1_argv[1] = const_cast<char*>(c1_argv1.c_str());
+                c1_argv[2] = const_cast<char*>(c1_argv2.c_str());
+                c1_argv[3] = const_cast<char*>(c1_argv3.c_str());
+
+                const bool USE_RANDOM_WAIT = true;
+                Example7SenderApp app2(c1_argc, c1_argv, USE_RANDOM_WAIT);
+                ConnectedClientModuleTestService ccms2(&app2);
+
+                // Create second sending component in the same group.
+                string c2_argv0("example7sender");
+                string c2_argv1("--cid=104");
+                string c2_argv2("--freq=10");
+                string c2_argv3("--id=2");
+                int32_t c2_argc = 4;
+                char **c2_argv;
+                c2_argv = new char*[c2_argc];
+                c2_argv[0] = const_cast<char*>(c2_argv0.c_str());
+                c2_argv[1] = const_cast<char*>(c2_argv1.c_str());
+                c2_argv[2] = const_cast<char*>(c2_argv2.c_str());
+                c2_argv[3] = const_cast<char*>(c2_argv3.c_str());
+
+                Example7SenderApp app3(c2_argc, c2_argv, !USE_RANDOM_WAIT);
+                ConnectedClientModuleTestService ccms3(&app3);
+
+                ccms1.start();
+                Thread::usleepFor(ONE_SECOND);
+                ccms3.start();
+                Thread::usleepFor(ONE_SECOND);
+                ccms2.start();
+
+                uint32_t cycles = 0;
+                const uint32_t TIMEOUT = 180;
+                const uint32_t MIN_CYCLES_IN_ORDER = 10;
+                while ((app1.getCyclesInOrder() < MIN_CYCLES_IN_ORDER) && (cycles < TIMEOUT)) {
+                    Thread::usleepFor(ONE_SECOND);
+                    cycles++;
+                }
+
+                // The containers of both senders are delivered in the order of the modules' names regardless of the order of their ACKs.
+                TS_ASSERT(app1.getCyclesInOrder() >= MIN_CYCLES_IN_ORDER);
+                TS_ASSERT(app1.getCyclesOutOfOrder() == 0);
+
+                ccms2.stop();
+                ccms3.stop();
+                ccms1.stop();
+
+                TS_ASSERT(ccms1.isRunModuleCompleted());
+                TS_ASSERT(app1.tearDownCalled);
+                TS_ASSERT(ccms2.isRunModuleCompleted());
+                TS_ASSERT(app2.tearDownCalled);
+                TS_ASSERT(ccms3.isRunModuleCompleted());
+                TS_ASSERT(app3.tearDownCalled);
+
+                uint32_t retVal = (!ccms1.isRunModuleCompleted() ? 1<<1 : 0) |
+                                  (!app1.tearDownCalled ? 1<<2 : 0) |
+                                  (!ccms2.isRunModuleCompleted() ? 1<<3 : 0) |
+                                  (!app2.tearDownCalled ? 1<<4 : 0) |
+                                  (!ccms3.isRunModuleCompleted() ? 1<<5 : 0) |
+                                  (!app3.tearDownCalled ? 1<<6 : 0) |
+                                  ((app1.getCyclesInOrder() < MIN_CYCLES_IN_ORDER) ? 1<<7 : 0) |
+                                  ((app1.getCyclesOutOfOrder() > 0) ? 1<<8 : 0);
+
+                // Leave child's process context.
+                exit(retVal);
+            }
+            else if (child > 0) {
+                // In parent process.
+
+                // Create a configuration.
+                stringstream configuration;
+                configuration << "global.buffer.memorySegmentSize = 2800000 # Size of a memory segment for a shared data stream in bytes." << endl
+                     << "global.buffer.numberOfMemorySegments = 20 # Number of memory segments used for buffering." << endl
+                     << "odsupercomponent.pulseshift.shift = 10000 # (in microseconds) If the managed level is pulse_shift, all connected modules will be informed about the supercomponent's real time by this increment per module. Thus, the execution times per modules are better aligned with supercomponent and the data exchange is somewhat more predictable." << endl
+                     << "odsupercomponent.pulsetimeack.timeout = 5000 # (in milliseconds) If the managed level is pulse_time_ack, this is the timeout for waiting for an ACK message from the dependent client." << endl
+                     << "odsupercomponent.pulsetimeack.yield = 5000 # (in microseconds) If the managed level is pulse_time_ack, the modules are triggered sequentially by sending pulses and waiting for acknowledgment messages. To allow the modules to deliver their respective containers, this yielding time is used to sleep before supercomponent sends the pulse messages the next module in this execution cycle. This value needs to be adjusted for networked simulations to ensure deterministic execution. " << endl
+                     << "odsupercomponent.pulsetimeack.exclude = cockpit,monitor # List of modules that will not get a pulse message from supercomponent." << endl
+                     << "odsupercomponent.pulsetimeack.parallel = 1 # Pulse all modules of a group at once and wait for all their ACKs." << endl
+                     << "odsupercomponent.pulsetimeack.groups = example7sender;example7receiver # Execution order of groups; modules within a group are pulsed in parallel." << endl;
+
+                fstream fout("configuration", ios::out);
+                TS_ASSERT(fout.good());
+                fout << configuration.str();
+                fout.close();
+
+                // Start the encapsulated supercomponent.
+                string sc_argv0("odsupercomponent");
+                string sc_argv1("--cid=104");
+                string sc_argv2("--freq=10");
+                string sc_argv3("--managed=simulation");
+                int32_t sc_argc = 4;
+                char **sc_argv;
+                sc_argv = new char*[sc_argc];
+                sc_argv[0] = const_cast<char*>(sc_argv0.c_str());
+                sc_argv[1] = const_cast<char*>(sc_argv1.c_str());
+                sc_argv[2] = const_cast<char*>(sc_argv2.c_str());
+                sc_argv[3] = const_cast<char*>(sc_argv3.c_str());
+
+                SupercomponentService scs(sc_argc, sc_argv);
+                scs.start();
+
+                // Monitor the child's process and wait for its exit.
+                int status = 0;
+                do {
+                    pid_t w = waitpid(child, &status, WUNTRACED | WCONTINUED);
+                    TS_ASSERT(w > -1);
+                } while (!WIFEXITED(status) && !WIFSIGNALED(status));
+                TS_ASSERT(WIFEXITED(status));
+                if (WIFEXITED(status)) {
+                    TS_ASSERT(WEXITSTATUS(status) == 0);
+                }
+
+                scs.stop();
+
+                UNLINK("configuration");
+            }
+#endif /*defined(__linux__) || (__OpenBSD__) || (__FreeBSD__) || (__arm__)*/
+
 #endif /*!defined(WIN32) && !defined(__APPLE__)*/
         }
 };
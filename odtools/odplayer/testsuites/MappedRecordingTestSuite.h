@@ -0,0 +1,340 @@
+/**
+ * odplayer - Tool for playing back recorded data
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef MAPPEDRECORDINGTESTSUITE_H_
+#define MAPPEDRECORDINGTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <opendavinci/odcore/base/Lock.h>
+#include <opendavinci/odcore/base/Thread.h>
+#include <opendavinci/odcore/data/Container.h>
+#include <opendavinci/odcore/data/TimeStamp.h>
+#include <opendavinci/odcore/io/URL.h>
+#include <opendavinci/odcore/wrapper/SharedMemory.h>
+#include <opendavinci/odcore/wrapper/SharedMemoryFactory.h>
+#include <opendavinci/odtools/player/MappedRecording.h>
+#include <opendavinci/odtools/player/Player.h>
+#include <opendavinci/odtools/player/RecMemIndex.h>
+#include <opendavinci/GeneratedHeaders_OpenDaVINCI.h>
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::io;
+using namespace odtools::player;
+
+class MappedRecordingTest : public CxxTest::TestSuite {
+    private:
+        /**
+         * This method writes a .rec file with non-monotonic sample
+         * time stamps and returns the file positions of its containers.
+         */
+        static void writeRecFile(const string &fileName, vector<uint64_t> &filePositions) {
+            fstream fout(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+            const TimeStamp sampleTimeStamps[] = { TimeStamp(4, 5), TimeStamp(2, 3), TimeStamp(0, 1), TimeStamp(2, 3), TimeStamp(1, 2) };
+            for (int32_t i = 0; i < 5; i++) {
+                filePositions.push_back(fout.tellp());
+
+                Container c(TimeStamp(i, 0));
+                c.setSampleTimeStamp(sampleTimeStamps[i]);
+                fout << c;
+            }
+            filePositions.push_back(fout.tellp());
+
+            fout.flush();
+            fout.close();
+        }
+
+        /**
+         * This method writes a .rec.mem file with SharedData containers;
+         * the memory dump following the last one can be truncated.
+         */
+        static void writeRecMemFile(const string &fileName, const uint32_t &lengthOfLastDump) {
+            fstream fout(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+            odcore::data::SharedData sd;
+            sd.setSize(10);
+            sd.setName("MappedRecordingTest");
+
+            const TimeStamp sampleTimeStamps[] = { TimeStamp(3, 41), TimeStamp(1, 21), TimeStamp(2, 31), TimeStamp(1, 21) };
+            for (int32_t i = 0; i < 4; i++) {
+                Container c(sd);
+                c.setSampleTimeStamp(sampleTimeStamps[i]);
+                fout << c;
+
+                stringstream data;
+                data << i << "BCDEFGHIJ";
+                fout.write(data.str().c_str(), (i < 3) ? data.str().size() : lengthOfLastDump);
+            }
+
+            fout.flush();
+            fout.close();
+        }
+
+        static void unlinkRecordings() {
+            UNLINK("MappedRecordingTest.rec");
+            UNLINK("MappedRecordingTest.rec.idx");
+            UNLINK("MappedRecordingTest.rec.mem");
+            UNLINK("MappedRecordingTest.rec.mem.idx");
+        }
+
+        /**
+         * This method returns the content of the shared memory segment
+         * used by the .rec.mem file.
+         */
+        static string getSharedMemoryContent(std::shared_ptr<odcore::wrapper::SharedMemory> &sp) {
+            string content;
+            if (NULL == sp.get()) {
+                sp = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory("MappedRecordingTest");
+            }
+            if ( (NULL != sp.get()) && sp->isValid() ) {
+                Lock l(sp);
+                content = string(static_cast<char*>(sp->getSharedMemory()), sp->getSize());
+            }
+            return content;
+        }
+
+        /**
+         * This method replays MappedRecordingTest.rec and describes every
+         * replayed container by its sample time stamp and its payload or
+         * the content of its shared memory segment. When threading, the
+         * containers are replayed in real time to give the caching
+         * threads a chance to read ahead.
+         */
+        static vector<string> replay(const bool &threading, const bool &mapRecording) {
+            vector<string> replayedContainers;
+
+            const URL u("file://MappedRecordingTest.rec");
+            const bool NO_AUTO_REWIND = false;
+            const uint32_t MEMORY_SEGMENT_SIZE = 10;
+            const uint32_t NUMBER_OF_MEMORY_SEGMENTS = 2;
+            Player p(u, NO_AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_MEMORY_SEGMENTS, threading, mapRecording);
+            TS_ASSERT(mapRecording == p.isRecFileMapped());
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> sp;
+            while (p.hasMoreData()) {
+                Container c = p.getNextContainerToBeSent();
+
+                stringstream sstr;
+                sstr << c.getSampleTimeStamp().toMicroseconds() << ":";
+                if (c.getDataType() == TimeStamp::ID()) {
+                    sstr << c.getData<TimeStamp>().toMicroseconds();
+                }
+                if (c.getDataType() == odcore::data::SharedData::ID()) {
+                    sstr << getSharedMemoryContent(sp);
+                }
+                replayedContainers.push_back(sstr.str());
+
+                if (threading) {
+                    Thread::usleepFor(p.getDelay());
+                }
+            }
+
+            return replayedContainers;
+        }
+
+    public:
+        void testReadContainerAndBounds() {
+            unlinkRecordings();
+
+            vector<uint64_t> filePositions;
+            writeRecFile("MappedRecordingTest.rec", filePositions);
+            const uint64_t SIZE_OF_RECORDING = filePositions.back();
+
+            MappedRecording mr("MappedRecordingTest.rec");
+            TS_ASSERT(mr.isValid());
+            TS_ASSERT(SIZE_OF_RECORDING == mr.getSize());
+
+            // All containers are decoded from their positions.
+            for (uint32_t i = 0; (i + 1) < filePositions.size(); i++) {
+                Container c;
+                TS_ASSERT((filePositions[i + 1] - filePositions[i]) == mr.readContainer(filePositions[i], c));
+                TS_ASSERT(TimeStamp::ID() == c.getDataType());
+                TS_ASSERT(TimeStamp(i, 0).toMicroseconds() == c.getData<TimeStamp>().toMicroseconds());
+            }
+
+            // The length is reduced at the end of the recording.
+            uint64_t length = 10;
+            const char *data = mr.getPointer(SIZE_OF_RECORDING - 3, length);
+            TS_ASSERT(NULL != data);
+            TS_ASSERT(3 == length);
+
+            length = 10;
+            data = mr.getPointer(0, length);
+            TS_ASSERT(NULL != data);
+            TS_ASSERT(10 == length);
+
+            // Positions at or past the end are rejected.
+            length = 1;
+            TS_ASSERT(NULL == mr.getPointer(SIZE_OF_RECORDING, length));
+            TS_ASSERT(0 == length);
+
+            length = 1;
+            TS_ASSERT(NULL == mr.getPointer(SIZE_OF_RECORDING + 4096, length));
+            TS_ASSERT(0 == length);
+
+            Container c;
+            TS_ASSERT(0 == mr.readContainer(SIZE_OF_RECORDING, c));
+            TS_ASSERT(0 == mr.readContainer(SIZE_OF_RECORDING + 4096, c));
+
+            // Moving the read-ahead window beyond the end is ignored.
+            mr.setReadAheadWindow(4096);
+            mr.followPosition(0);
+            mr.followPosition(SIZE_OF_RECORDING + 4096);
+            mr.followPosition(0);
+            TS_ASSERT(0 < mr.readContainer(0, c));
+
+            unlinkRecordings();
+        }
+
+        void testContainerTruncatedAtEndOfFile() {
+            unlinkRecordings();
+
+            vector<uint64_t> filePositions;
+            writeRecFile("MappedRecordingTest.rec", filePositions);
+
+            // Cut the last container in half.
+            const uint64_t SIZE_OF_LAST_CONTAINER = filePositions[5] - filePositions[4];
+            {
+                vector<char> recording(filePositions[4] + SIZE_OF_LAST_CONTAINER / 2);
+                fstream fin("MappedRecordingTest.rec", ios::in | ios::binary);
+                fin.read(&recording[0], recording.size());
+                fin.close();
+
+                fstream fout("MappedRecordingTest.rec", ios::out | ios::binary | ios::trunc);
+                fout.write(&recording[0], recording.size());
+                fout.close();
+            }
+
+            MappedRecording mr("MappedRecordingTest.rec");
+            TS_ASSERT(mr.isValid());
+            TS_ASSERT((filePositions[4] + SIZE_OF_LAST_CONTAINER / 2) == mr.getSize());
+
+            Container c;
+            TS_ASSERT((filePositions[4] - filePositions[3]) == mr.readContainer(filePositions[3], c));
+            TS_ASSERT(0 == mr.readContainer(filePositions[4], c));
+
+            uint64_t length = SIZE_OF_LAST_CONTAINER;
+            TS_ASSERT(NULL != mr.getPointer(filePositions[4], length));
+            TS_ASSERT((SIZE_OF_LAST_CONTAINER / 2) == length);
+
+            unlinkRecordings();
+        }
+
+        void testEmptyAndMissingFile() {
+            unlinkRecordings();
+
+            {
+                MappedRecording mr("MappedRecordingTest.rec");
+                TS_ASSERT(!mr.isValid());
+                TS_ASSERT(0 == mr.getSize());
+
+                uint64_t length = 1;
+                TS_ASSERT(NULL == mr.getPointer(0, length));
+                TS_ASSERT(0 == length);
+
+                Container c;
+                TS_ASSERT(0 == mr.readContainer(0, c));
+            }
+
+            fstream fout("MappedRecordingTest.rec", ios::out | ios::binary | ios::trunc);
+            fout.close();
+            {
+                MappedRecording mr("MappedRecordingTest.rec");
+                TS_ASSERT(!mr.isValid());
+            }
+
+            unlinkRecordings();
+        }
+
+        void testPlayerReplaysSameContainersWithoutMapping() {
+            unlinkRecordings();
+
+            vector<uint64_t> filePositions;
+            writeRecFile("MappedRecordingTest.rec", filePositions);
+            writeRecMemFile("MappedRecordingTest.rec.mem", 10);
+
+            const bool MAP_RECORDING = true;
+            const bool NO_THREADING = false;
+            const vector<string> replayedFromMapping = replay(NO_THREADING, MAP_RECORDING);
+            TS_ASSERT(9 == replayedFromMapping.size());
+            if (9 == replayedFromMapping.size()) {
+                TS_ASSERT(replayedFromMapping[2] == "1000021:1BCDEFGHIJ");
+                TS_ASSERT(replayedFromMapping[3] == "1000021:3BCDEFGHIJ");
+                TS_ASSERT(replayedFromMapping[7] == "3000041:0BCDEFGHIJ");
+            }
+
+            // Fall back to reading the files as streams, with and without the caching threads.
+            TS_ASSERT(replayedFromMapping == replay(NO_THREADING, !MAP_RECORDING));
+            TS_ASSERT(replayedFromMapping == replay(!NO_THREADING, !MAP_RECORDING));
+
+            unlinkRecordings();
+        }
+
+        void testRecMemIndexCopiesFromMapping() {
+            unlinkRecordings();
+
+            // The memory dump of the last container is truncated at the end of the .rec.mem file.
+            writeRecMemFile("MappedRecordingTest.rec.mem", 5);
+            const URL u("file://MappedRecordingTest.rec.mem");
+
+            const bool NO_THREADING = false;
+            const bool MAP_RECORDING = true;
+            vector<string> replayedFromMapping;
+            {
+                RecMemIndex rmi(u, 10, 2, NO_THREADING, MAP_RECORDING);
+                TS_ASSERT(rmi.isRecMemFileMapped());
+
+                std::shared_ptr<odcore::wrapper::SharedMemory> sp;
+                while (rmi.hasMoreData()) {
+                    Container c = rmi.makeNextRawMemoryEntryAvailable();
+                    stringstream sstr;
+                    sstr << c.getSampleTimeStamp().toMicroseconds() << ":" << getSharedMemoryContent(sp);
+                    replayedFromMapping.push_back(sstr.str());
+                }
+            }
+            TS_ASSERT(4 == replayedFromMapping.size());
+            if (4 == replayedFromMapping.size()) {
+                TS_ASSERT(replayedFromMapping[0] == "1000021:1BCDEFGHIJ");
+                TS_ASSERT(replayedFromMapping[2] == "2000031:2BCDEFGHIJ");
+                TS_ASSERT(replayedFromMapping[3] == "3000041:0BCDEFGHIJ");
+
+                // Only the available bytes of the truncated dump are copied.
+                TS_ASSERT(replayedFromMapping[1].substr(0, 13) == "1000021:3BCDE");
+            }
+
+            {
+                RecMemIndex rmi(u, 10, 2, NO_THREADING, !MAP_RECORDING);
+                TS_ASSERT(!rmi.isRecMemFileMapped());
+            }
+
+            unlinkRecordings();
+        }
+};
+
+#endif /*MAPPEDRECORDINGTESTSUITE_H_*/
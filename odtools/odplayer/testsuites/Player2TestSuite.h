@@ -48,6 +48,7 @@ class PlayerModule2Test : public CxxTest::TestSuite {
         void testEmptyFileAndException() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2TestEmpty.rec");
+            UNLINK("PlayerModule2TestEmpty.rec.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2TestEmpty.rec", ios::out | ios::binary | ios::trunc);
@@ -78,12 +79,15 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2TestEmpty.rec");
+            UNLINK("PlayerModule2TestEmpty.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrder() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -156,12 +160,15 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderRealtimeReplay() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -233,12 +240,15 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithDuplicateEntries() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -327,12 +337,15 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndException() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -405,6 +418,7 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndRewindAndException() {
@@ -486,6 +500,7 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndAutoRewind() {
@@ -574,6 +589,7 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(noExceptionThrown);
 
             UNLINK("PlayerModule2Test2.rec");
+            UNLINK("PlayerModule2Test2.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndAutoRewindEmptyRecMemFile() {
@@ -666,7 +682,9 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(noExceptionThrown);
 
             UNLINK("PlayerModule2Test2.rec");
+            UNLINK("PlayerModule2Test2.rec.idx");
             UNLINK("PlayerModule2Test2.rec.mem");
+            UNLINK("PlayerModule2Test2.rec.mem.idx");
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -674,7 +692,9 @@ class PlayerModule2Test : public CxxTest::TestSuite {
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTwoSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -907,13 +927,17 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTenSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1146,13 +1170,17 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTwoSegmentsEmptyRecFile() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1326,13 +1354,17 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTwoSegmentsRewind() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1573,7 +1605,9 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -1581,7 +1615,9 @@ class PlayerModule2Test : public CxxTest::TestSuite {
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedImageTwoSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1817,13 +1853,17 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedImageTenSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -2059,7 +2099,9 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -2067,7 +2109,9 @@ class PlayerModule2Test : public CxxTest::TestSuite {
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedPointCloudTenSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -2300,13 +2344,17 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedPointCloudTwoSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -2539,7 +2587,9 @@ class PlayerModule2Test : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -258,6 +258,7 @@ class PlayerModuleTest : public CxxTest::TestSuite,
             delete &(StreamFactory::getInstance());
 
             UNLINK("PlayerModuleTest.rec");
+            UNLINK("PlayerModuleTest.rec.idx");
 
             // "Ugly" cleaning up conference.
             ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
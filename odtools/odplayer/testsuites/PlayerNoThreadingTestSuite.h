@@ -48,6 +48,7 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
         void testEmptyFileAndException() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2TestEmpty.rec");
+            UNLINK("PlayerModule2TestEmpty.rec.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2TestEmpty.rec", ios::out | ios::binary | ios::trunc);
@@ -78,12 +79,15 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2TestEmpty.rec");
+            UNLINK("PlayerModule2TestEmpty.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrder() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -156,12 +160,15 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderRealtimeReplay() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -233,12 +240,15 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithDuplicateEntries() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -327,12 +337,15 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndException() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare record file.
             fstream fout("PlayerModule2Test.rec", ios::out | ios::binary | ios::trunc);
@@ -405,6 +418,7 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndRewindAndException() {
@@ -486,6 +500,88 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
+        }
+
+        void testCorrectMonotonicTemporalOrderAndSeek() {
+            cout << __FILE__ << " " << __LINE__ << endl;
+            // Prepare record file.
+            fstream fout("PlayerModule2TestSeek.rec", ios::out | ios::binary | ios::trunc);
+
+            // Write data with non-monotonic order.
+            TimeStamp ts1(4, 5);
+            TimeStamp ts2(2, 3);
+            TimeStamp ts3(0, 1);
+            TimeStamp ts4(1, 2);
+            TimeStamp ts5(3, 4);
+
+            Container c1(ts1);
+            c1.setSampleTimeStamp(ts1);
+            fout << c1;
+
+            Container c2(ts2);
+            c2.setSampleTimeStamp(ts2);
+            fout << c2;
+
+            Container c3(ts3);
+            c3.setSampleTimeStamp(ts3);
+            fout << c3;
+
+            Container c4(ts4);
+            c4.setSampleTimeStamp(ts4);
+            fout << c4;
+
+            Container c5(ts5);
+            c5.setSampleTimeStamp(ts5);
+            fout << c5;
+
+            fout.flush();
+            fout.close();
+
+            const URL u("file://PlayerModule2TestSeek.rec");
+
+            // Create Player instance.
+            const bool THREADING = false;
+            const bool NO_AUTO_REWIND = false;
+            const uint32_t MEMORY_SEGMENT_SIZE = 0;
+            const uint32_t NUMBER_OF_MEMORY_SEGMENTS = 0;
+            Player p2(u, NO_AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_MEMORY_SEGMENTS, THREADING);
+
+            // Jump forward to the first container sampled at or after 2.000003s.
+            TS_ASSERT(p2.seekTo(TimeStamp(2, 0)));
+            Container c = p2.getNextContainerToBeSent();
+            TS_ASSERT(p2.getDelay() == 0);
+            TS_ASSERT(ts2.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+            c = p2.getNextContainerToBeSent();
+            TS_ASSERT(p2.getDelay() == 1000001);
+            TS_ASSERT(ts5.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+
+            // Jump backwards.
+            TS_ASSERT(p2.seekTo(TimeStamp(1, 2)));
+            c = p2.getNextContainerToBeSent();
+            TS_ASSERT(ts4.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+
+            // There is nothing after the last container; the position is unchanged.
+            TS_ASSERT(!p2.seekTo(TimeStamp(10, 0)));
+            c = p2.getNextContainerToBeSent();
+            TS_ASSERT(ts2.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+
+            // Jump relatively to the time span of the recording.
+            TS_ASSERT(p2.seekToFraction(0));
+            c = p2.getNextContainerToBeSent();
+            TS_ASSERT(ts3.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+
+            TS_ASSERT(p2.seekToFraction(0.5));
+            c = p2.getNextContainerToBeSent();
+            TS_ASSERT(ts2.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+
+            TS_ASSERT(p2.seekToFraction(1.0));
+            c = p2.getNextContainerToBeSent();
+            TS_ASSERT(ts1.toMicroseconds() == c.getSampleTimeStamp().toMicroseconds());
+            TS_ASSERT(!p2.hasMoreData());
+
+            UNLINK("PlayerModule2TestSeek.rec");
+            UNLINK("PlayerModule2TestSeek.rec.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndAutoRewind() {
@@ -574,6 +670,7 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(noExceptionThrown);
 
             UNLINK("PlayerModule2Test2.rec");
+            UNLINK("PlayerModule2Test2.rec.idx");
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -581,7 +678,9 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTwoSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -814,13 +913,17 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTenSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1053,13 +1156,17 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTwoSegmentsEmptyRecFile() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1233,13 +1340,17 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedDataTwoSegmentsRewind() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1480,7 +1591,9 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -1488,7 +1601,9 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedImageTwoSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1724,13 +1839,17 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedImageTenSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -1966,7 +2085,9 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -1974,7 +2095,9 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedPointCloudTenSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -2207,13 +2330,17 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 
         void testCorrectMonotonicTemporalOrderAndExceptionFromReverseOrderWithExceptionSharedPointCloudTwoSegments() {
             cout << __FILE__ << " " << __LINE__ << endl;
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
 
             // Prepare .rec file.
             {
@@ -2446,7 +2573,9 @@ class PlayerModule2NoThreadingTest : public CxxTest::TestSuite {
             TS_ASSERT(exceptionCaught);
 
             UNLINK("PlayerModule2Test.rec");
+            UNLINK("PlayerModule2Test.rec.idx");
             UNLINK("PlayerModule2Test.rec.mem");
+            UNLINK("PlayerModule2Test.rec.mem.idx");
         }
 };
 
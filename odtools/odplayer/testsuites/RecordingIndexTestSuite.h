@@ -0,0 +1,439 @@
+/**
+ * odplayer - Tool for playing back recorded data
+ * Copyright (C) 2017 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RECORDINGINDEXTESTSUITE_H_
+#define RECORDINGINDEXTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <opendavinci/odcore/base/Lock.h>
+#include <opendavinci/odcore/data/Container.h>
+#include <opendavinci/odcore/data/TimeStamp.h>
+#include <opendavinci/odcore/io/URL.h>
+#include <opendavinci/odcore/wrapper/SharedMemory.h>
+#include <opendavinci/odcore/wrapper/SharedMemoryFactory.h>
+#include <opendavinci/odtools/player/Player.h>
+#include <opendavinci/odtools/player/RecMemIndex.h>
+#include <opendavinci/odtools/player/RecordingIndex.h>
+#include <opendavinci/GeneratedHeaders_OpenDaVINCI.h>
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::io;
+using namespace odtools::player;
+
+class RecordingIndexTest : public CxxTest::TestSuite {
+    private:
+        /**
+         * This method writes a .rec file with non-monotonic and duplicate
+         * sample time stamps; the payload tells the containers apart.
+         */
+        static void writeRecFile(const string &fileName, const int32_t &offset) {
+            fstream fout(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+            const TimeStamp sampleTimeStamps[] = { TimeStamp(4, 5), TimeStamp(2, 3), TimeStamp(0, 1), TimeStamp(2, 3), TimeStamp(1, 2) };
+            for (int32_t i = 0; i < 5; i++) {
+                Container c(TimeStamp(offset + i, 0));
+                c.setSampleTimeStamp(sampleTimeStamps[i]);
+                fout << c;
+            }
+
+            fout.flush();
+            fout.close();
+        }
+
+        /**
+         * This method writes a .rec.mem file with one SharedData
+         * container followed by a memory dump of 10 bytes per entry.
+         */
+        static void writeRecMemFile(const string &fileName, vector<uint64_t> &filePositions) {
+            fstream fout(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+            odcore::data::SharedData sd;
+            sd.setSize(10);
+            sd.setName("RecordingIndexTest");
+
+            const TimeStamp sampleTimeStamps[] = { TimeStamp(3, 41), TimeStamp(1, 21), TimeStamp(2, 31), TimeStamp(1, 21) };
+            for (int32_t i = 0; i < 4; i++) {
+                filePositions.push_back(fout.tellp());
+
+                Container c(sd);
+                c.setSampleTimeStamp(sampleTimeStamps[i]);
+                fout << c;
+
+                stringstream data;
+                data << i << "BCDEFGHIJ";
+                fout.write(data.str().c_str(), data.str().size());
+            }
+
+            fout.flush();
+            fout.close();
+        }
+
+        /**
+         * This method scans a recording like a Player without an index.
+         */
+        static vector<RecordingIndexEntry> scanRecFile(const string &fileName) {
+            vector<RecordingIndexEntry> entries;
+
+            fstream fin(fileName.c_str(), ios::in | ios::binary);
+            while (fin.good()) {
+                const uint64_t POS_BEFORE = fin.tellg();
+                    Container c;
+                    fin >> c;
+                const uint64_t POS_AFTER = fin.tellg();
+
+                if (!fin.eof()) {
+                    entries.push_back(RecordingIndexEntry(c.getSampleTimeStamp().toMicroseconds(), POS_BEFORE, c.getDataType(), c.getSenderStamp(), (POS_AFTER - POS_BEFORE), 0));
+                }
+            }
+            fin.close();
+
+            return entries;
+        }
+
+        static string readFile(const string &fileName) {
+            fstream fin(fileName.c_str(), ios::in | ios::binary);
+            stringstream sstr;
+            sstr << fin.rdbuf();
+            fin.close();
+            return sstr.str();
+        }
+
+        static void writeFile(const string &fileName, const string &data) {
+            fstream fout(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+            fout.write(data.c_str(), data.size());
+            fout.flush();
+            fout.close();
+        }
+
+        static bool isEqual(const vector<RecordingIndexEntry> &a, const vector<RecordingIndexEntry> &b) {
+            bool retVal = (a.size() == b.size());
+            for (uint32_t i = 0; retVal && (i < a.size()); i++) {
+                retVal &= (a[i].m_sampleTimeStamp == b[i].m_sampleTimeStamp);
+                retVal &= (a[i].m_filePosition == b[i].m_filePosition);
+                retVal &= (a[i].m_dataType == b[i].m_dataType);
+                retVal &= (a[i].m_senderStamp == b[i].m_senderStamp);
+                retVal &= (a[i].m_size == b[i].m_size);
+                retVal &= (a[i].m_sizeOfSharedMemorySegment == b[i].m_sizeOfSharedMemorySegment);
+            }
+            return retVal;
+        }
+
+        /**
+         * This method replays a recording and describes every replayed
+         * container by its sample time stamp and its payload or the
+         * content of its shared memory segment.
+         */
+        static vector<string> replay(const string &fileName) {
+            vector<string> replayedContainers;
+
+            const URL u("file://" + fileName);
+            const bool THREADING = false;
+            const bool NO_AUTO_REWIND = false;
+            const uint32_t MEMORY_SEGMENT_SIZE = 10;
+            const uint32_t NUMBER_OF_MEMORY_SEGMENTS = 2;
+            Player p(u, NO_AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_MEMORY_SEGMENTS, THREADING);
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> sp;
+            while (p.hasMoreData()) {
+                Container c = p.getNextContainerToBeSent();
+
+                stringstream sstr;
+                sstr << c.getSampleTimeStamp().toMicroseconds() << ":";
+                if (c.getDataType() == TimeStamp::ID()) {
+                    sstr << c.getData<TimeStamp>().toMicroseconds();
+                }
+                if (c.getDataType() == odcore::data::SharedData::ID()) {
+                    if (NULL == sp.get()) {
+                        sp = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(c.getData<odcore::data::SharedData>().getName());
+                    }
+                    if ( (NULL != sp.get()) && sp->isValid() ) {
+                        Lock l(sp);
+                        sstr << string(static_cast<char*>(sp->getSharedMemory()), sp->getSize());
+                    }
+                }
+                replayedContainers.push_back(sstr.str());
+            }
+
+            return replayedContainers;
+        }
+
+    public:
+        void testSaveAndLoad() {
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+
+            TS_ASSERT(RecordingIndex::getFileName("RecordingIndexTest.rec") == "RecordingIndexTest.rec.idx");
+
+            writeRecFile("RecordingIndexTest.rec", 0);
+            const vector<RecordingIndexEntry> entries = scanRecFile("RecordingIndexTest.rec");
+            TS_ASSERT(5 == entries.size());
+
+            vector<RecordingIndexEntry> loadedEntries;
+            TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+
+            TS_ASSERT(RecordingIndex::save("RecordingIndexTest.rec", entries));
+            TS_ASSERT((RecordingIndex::HEADER_SIZE + 5 * RecordingIndex::ENTRY_SIZE) == readFile("RecordingIndexTest.rec.idx").size());
+
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            TS_ASSERT(isEqual(entries, loadedEntries));
+
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+        }
+
+        void testWriteWhileRecording() {
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+
+            writeRecFile("RecordingIndexTest.rec", 0);
+            const vector<RecordingIndexEntry> entries = scanRecFile("RecordingIndexTest.rec");
+
+            {
+                RecordingIndex index("RecordingIndexTest.rec");
+                for (uint32_t i = 0; i < entries.size(); i++) {
+                    index.add(entries[i]);
+                }
+
+                // An index that is not finalized does not match any recording.
+                vector<RecordingIndexEntry> loadedEntries;
+                TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+
+                index.finalize();
+                TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+                TS_ASSERT(isEqual(entries, loadedEntries));
+
+                // Entries added after finalizing are ignored.
+                index.add(entries[0]);
+            }
+
+            vector<RecordingIndexEntry> loadedEntries;
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            TS_ASSERT(isEqual(entries, loadedEntries));
+
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+        }
+
+        void testStaleIndexIsRejected() {
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+            UNLINK("RecordingIndexTest2.rec");
+            UNLINK("RecordingIndexTest2.rec.idx");
+
+            vector<RecordingIndexEntry> loadedEntries;
+
+            // The recording has grown.
+            writeRecFile("RecordingIndexTest.rec", 0);
+            TS_ASSERT(RecordingIndex::save("RecordingIndexTest.rec", scanRecFile("RecordingIndexTest.rec")));
+            {
+                fstream fout("RecordingIndexTest.rec", ios::out | ios::binary | ios::app);
+                Container c(TimeStamp(5, 6));
+                c.setSampleTimeStamp(TimeStamp(5, 6));
+                fout << c;
+                fout.flush();
+                fout.close();
+            }
+            TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            TS_ASSERT(loadedEntries.empty());
+
+            // The recording was modified without changing its size.
+            writeRecFile("RecordingIndexTest.rec", 0);
+            TS_ASSERT(RecordingIndex::save("RecordingIndexTest.rec", scanRecFile("RecordingIndexTest.rec")));
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            {
+                string recording = readFile("RecordingIndexTest.rec");
+                recording[recording.size() - 1] = ~recording[recording.size() - 1];
+                writeFile("RecordingIndexTest.rec", recording);
+            }
+            TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            TS_ASSERT(loadedEntries.empty());
+
+            // The index belongs to a different recording of the same size.
+            writeRecFile("RecordingIndexTest.rec", 0);
+            writeRecFile("RecordingIndexTest2.rec", 10);
+            TS_ASSERT(readFile("RecordingIndexTest.rec").size() == readFile("RecordingIndexTest2.rec").size());
+            TS_ASSERT(RecordingIndex::save("RecordingIndexTest.rec", scanRecFile("RecordingIndexTest.rec")));
+            writeFile("RecordingIndexTest2.rec.idx", readFile("RecordingIndexTest.rec.idx"));
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            TS_ASSERT(!RecordingIndex::load("RecordingIndexTest2.rec", loadedEntries));
+            TS_ASSERT(loadedEntries.empty());
+
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+            UNLINK("RecordingIndexTest2.rec");
+            UNLINK("RecordingIndexTest2.rec.idx");
+        }
+
+        void testCorruptIndexIsRejected() {
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+
+            writeRecFile("RecordingIndexTest.rec", 0);
+            const uint64_t SIZE_OF_RECORDING = readFile("RecordingIndexTest.rec").size();
+            TS_ASSERT(RecordingIndex::save("RecordingIndexTest.rec", scanRecFile("RecordingIndexTest.rec")));
+            const string INDEX = readFile("RecordingIndexTest.rec.idx");
+
+            vector<RecordingIndexEntry> loadedEntries;
+
+            // Truncated header.
+            writeFile("RecordingIndexTest.rec.idx", INDEX.substr(0, RecordingIndex::HEADER_SIZE - 1));
+            TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+
+            // Wrong magic number.
+            {
+                string index = INDEX;
+                index[0] = 'X';
+                writeFile("RecordingIndexTest.rec.idx", index);
+                TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            }
+
+            // Unknown version.
+            {
+                string index = INDEX;
+                index[4] = RecordingIndex::VERSION + 1;
+                writeFile("RecordingIndexTest.rec.idx", index);
+                TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            }
+
+            // Truncated last entry.
+            writeFile("RecordingIndexTest.rec.idx", INDEX.substr(0, INDEX.size() - 1));
+            TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+
+            // Last entry pointing beyond the recording (file position is stored little endian at offset 8).
+            {
+                string index = INDEX;
+                const uint32_t OFFSET_OF_FILE_POSITION = RecordingIndex::HEADER_SIZE + 4 * RecordingIndex::ENTRY_SIZE + 8;
+                for (uint32_t i = 0; i < 8; i++) {
+                    index[OFFSET_OF_FILE_POSITION + i] = static_cast<char>((SIZE_OF_RECORDING >> (8 * i)) & 0xFF);
+                }
+                writeFile("RecordingIndexTest.rec.idx", index);
+                TS_ASSERT(!RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+                TS_ASSERT(loadedEntries.empty());
+            }
+
+            // The unmodified index is still accepted.
+            writeFile("RecordingIndexTest.rec.idx", INDEX);
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", loadedEntries));
+            TS_ASSERT(5 == loadedEntries.size());
+
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+        }
+
+        void testPlayerWithIndexReplaysSameOrderAsFullScan() {
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+            UNLINK("RecordingIndexTest.rec.mem");
+            UNLINK("RecordingIndexTest.rec.mem.idx");
+
+            writeRecFile("RecordingIndexTest.rec", 0);
+            vector<uint64_t> filePositions;
+            writeRecMemFile("RecordingIndexTest.rec.mem", filePositions);
+
+            // Without index files, the Player scans both recordings and writes their indices.
+            const vector<string> replayedWithoutIndex = replay("RecordingIndexTest.rec");
+            TS_ASSERT(9 == replayedWithoutIndex.size());
+
+            // Containers with equal sample time stamps are replayed in file order.
+            if (9 == replayedWithoutIndex.size()) {
+                TS_ASSERT(replayedWithoutIndex[2] == "1000021:1BCDEFGHIJ");
+                TS_ASSERT(replayedWithoutIndex[3] == "1000021:3BCDEFGHIJ");
+                TS_ASSERT(replayedWithoutIndex[4] == "2000003:1000000");
+                TS_ASSERT(replayedWithoutIndex[5] == "2000003:3000000");
+            }
+
+            vector<RecordingIndexEntry> entries;
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", entries));
+            TS_ASSERT(isEqual(scanRecFile("RecordingIndexTest.rec"), entries));
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec.mem", entries));
+            TS_ASSERT(4 == entries.size());
+
+            // The indices are used next time.
+            const vector<string> replayedWithIndex = replay("RecordingIndexTest.rec");
+            TS_ASSERT(replayedWithoutIndex == replayedWithIndex);
+
+            // A corrupt index is replaced after scanning again.
+            writeFile("RecordingIndexTest.rec.idx", "");
+            writeFile("RecordingIndexTest.rec.mem.idx", "");
+            const vector<string> replayedWithCorruptIndex = replay("RecordingIndexTest.rec");
+            TS_ASSERT(replayedWithoutIndex == replayedWithCorruptIndex);
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec", entries));
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec.mem", entries));
+
+            UNLINK("RecordingIndexTest.rec");
+            UNLINK("RecordingIndexTest.rec.idx");
+            UNLINK("RecordingIndexTest.rec.mem");
+            UNLINK("RecordingIndexTest.rec.mem.idx");
+        }
+
+        void testRecMemIndexWritesAndUsesIndex() {
+            UNLINK("RecordingIndexTest.rec.mem");
+            UNLINK("RecordingIndexTest.rec.mem.idx");
+
+            vector<uint64_t> filePositions;
+            writeRecMemFile("RecordingIndexTest.rec.mem", filePositions);
+            const URL u("file://RecordingIndexTest.rec.mem");
+
+            vector<int64_t> sampleTimeStampsWithoutIndex;
+            {
+                RecMemIndex rmi(u, 10, 2, false);
+                while (rmi.hasMoreData()) {
+                    sampleTimeStampsWithoutIndex.push_back(rmi.makeNextRawMemoryEntryAvailable().getSampleTimeStamp().toMicroseconds());
+                }
+            }
+            TS_ASSERT(4 == sampleTimeStampsWithoutIndex.size());
+
+            // Every entry describes a SharedData container and the dump of 10 bytes following it.
+            vector<RecordingIndexEntry> entries;
+            TS_ASSERT(RecordingIndex::load("RecordingIndexTest.rec.mem", entries));
+            TS_ASSERT(4 == entries.size());
+            for (uint32_t i = 0; i < entries.size(); i++) {
+                TS_ASSERT(filePositions[i] == entries[i].m_filePosition);
+                TS_ASSERT(odcore::data::SharedData::ID() == entries[i].m_dataType);
+                TS_ASSERT(10 == entries[i].m_sizeOfSharedMemorySegment);
+                if ((i + 1) < entries.size()) {
+                    TS_ASSERT((entries[i].m_filePosition + entries[i].m_size + 10) == filePositions[i + 1]);
+                }
+            }
+
+            vector<int64_t> sampleTimeStampsWithIndex;
+            {
+                RecMemIndex rmi(u, 10, 2, false);
+                while (rmi.hasMoreData()) {
+                    sampleTimeStampsWithIndex.push_back(rmi.makeNextRawMemoryEntryAvailable().getSampleTimeStamp().toMicroseconds());
+                }
+            }
+            TS_ASSERT(sampleTimeStampsWithoutIndex == sampleTimeStampsWithIndex);
+
+            UNLINK("RecordingIndexTest.rec.mem");
+            UNLINK("RecordingIndexTest.rec.mem.idx");
+        }
+};
+
+#endif /*RECORDINGINDEXTESTSUITE_H_*/
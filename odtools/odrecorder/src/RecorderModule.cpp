@@ -22,6 +22,7 @@
 #include "RecorderModule.h"
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odtools/recorder/Recorder.h"
+#include "opendavinci/odtools/recorder/RecordingWriter.h"
 #include "opendavinci/odtools/recorder/SharedDataListener.h"
 #include "opendavinci/generated/odcore/data/recorder/RecorderCommand.h"
 
@@ -74,8 +75,26 @@ namespace odrecorder {
         // Dump shared images and shared data?
         const bool DUMP_SHARED_DATA = getKeyValueConfiguration().getValue<uint32_t>("odrecorder.dumpshareddata") == 1;
 
+        // Containers are written in chunks by a separate thread; the chunk size and interval are optional.
+        uint32_t groupCommitSize = RecordingWriter::DEFAULT_GROUP_COMMIT_SIZE;
+        try {
+            groupCommitSize = getKeyValueConfiguration().getValue<uint32_t>("odrecorder.groupcommit.size");
+        }
+        catch(...) {}
+        uint32_t groupCommitInterval = RecordingWriter::DEFAULT_GROUP_COMMIT_INTERVAL_IN_MILLISECONDS;
+        try {
+            groupCommitInterval = getKeyValueConfiguration().getValue<uint32_t>("odrecorder.groupcommit.interval");
+        }
+        catch(...) {}
+        // Synchronize every chunk with the disk?
+        bool syncToDisk = false;
+        try {
+            syncToDisk = (getKeyValueConfiguration().getValue<uint32_t>("odrecorder.groupcommit.sync") == 1);
+        }
+        catch(...) {}
+
         // Actual "recording" interface.
-        Recorder r(recorderOutputURL, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA);
+        Recorder r(recorderOutputURL, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA, groupCommitSize, groupCommitInterval, syncToDisk);
 
         // Connect recorder's FIFOQueue to record all containers except for shared images/shared data.
         addDataStoreFor(r.getFIFO());
@@ -211,6 +211,9 @@ class RecorderTest : public CxxTest::TestSuite,
             fin.close();
 
             UNLINK("RecorderTest2.rec");
+            UNLINK("RecorderTest2.rec.idx");
+            UNLINK("RecorderTest2.rec.mem");
+            UNLINK("RecorderTest2.rec.mem.idx");
 
             // "Ugly" cleaning up conference.
             ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
@@ -23,11 +23,13 @@
 #include "cxxtest/TestSuite.h"
 
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/Service.h"
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
@@ -46,6 +48,13 @@
 #include "opendavinci/odcore/dmcp/connection/ConnectionHandler.h"
 #include "opendavinci/odcore/dmcp/connection/ModuleConnection.h"
 
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+
+#include "opendavinci/odtools/player/RecordingIndex.h"
+#include "opendavinci/odtools/recorder/Recorder.h"
+#include "opendavinci/odtools/recorder/RecordingWriter.h"
+
 #include "../include/RecorderModule.h"
 
 using namespace std;
@@ -204,12 +213,231 @@ class RecorderTest : public CxxTest::TestSuite,
             TS_ASSERT(fin.good());
             fin.close();
             UNLINK("RecorderTest.rec");
+            UNLINK("RecorderTest.rec.idx");
+            UNLINK("RecorderTest.rec.mem");
+            UNLINK("RecorderTest.rec.mem.idx");
 
             // "Ugly" cleaning up conference.
             ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
             ContainerConferenceFactory *ccf2 = &ccf;
             OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
         }
+
+        void testRecordingWriterGroupCommit() {
+            std::shared_ptr<ostream> out(new fstream("RecordingWriterTest.rec", ios::out | ios::binary | ios::trunc));
+
+            const uint32_t NUMBER_OF_CONTAINERS = 10000;
+            {
+                // Small queue and chunks to exercise backpressure and several commits.
+                const uint32_t CAPACITY = 16;
+                const uint32_t GROUP_COMMIT_SIZE = 4096;
+                const uint32_t GROUP_COMMIT_INTERVAL = 10;
+                odtools::recorder::RecordingWriter rw(out, "RecordingWriterTest.rec", NULL, CAPACITY, odtools::recorder::RecordingWriter::BLOCK, GROUP_COMMIT_SIZE, GROUP_COMMIT_INTERVAL);
+                rw.start();
+
+                for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                    TimeStamp ts(i, 0);
+                    Container c(ts);
+                    TS_ASSERT(rw.enqueue(c));
+                }
+                rw.stop();
+
+                TS_ASSERT(0 == rw.getNumberOfDroppedContainers());
+                TS_ASSERT(rw.getMaximumQueueDepth() <= CAPACITY);
+                TS_ASSERT(rw.getNumberOfCommits() > 1);
+                TS_ASSERT(rw.getNumberOfBytesWritten() > NUMBER_OF_CONTAINERS);
+            }
+            out.reset();
+
+            // All containers are written in order.
+            fstream fin("RecordingWriterTest.rec", ios::in | ios::binary);
+            uint32_t numberOfContainers = 0;
+            bool correctOrder = true;
+            while (fin.good()) {
+                Container c;
+                fin >> c;
+                if (fin.good() && (c.getDataType() == TimeStamp::ID())) {
+                    correctOrder &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(numberOfContainers));
+                    numberOfContainers++;
+                }
+            }
+            fin.close();
+
+            TS_ASSERT(correctOrder);
+            TS_ASSERT(NUMBER_OF_CONTAINERS == numberOfContainers);
+
+            UNLINK("RecordingWriterTest.rec");
+        }
+
+        void testRecordingWriterSkipsUnserializableContainers() {
+            UNLINK("RecordingWriterSkipTest.rec");
+            UNLINK("RecordingWriterSkipTest.rec.idx");
+
+            std::shared_ptr<ostream> out(new fstream("RecordingWriterSkipTest.rec", ios::out | ios::binary | ios::trunc));
+            {
+                odtools::player::RecordingIndex index("RecordingWriterSkipTest.rec");
+                {
+                    odtools::recorder::RecordingWriter rw(out, "RecordingWriterSkipTest.rec", &index);
+                    rw.start();
+
+                    TS_ASSERT(rw.enqueue(Container(TimeStamp(1, 0))));
+
+                    // The payload's length does not fit into the 24 bits of the container's header.
+                    Packet tooLarge("", string(0x1000000, 'A'), TimeStamp());
+                    TS_ASSERT(rw.enqueue(Container(tooLarge)));
+
+                    TS_ASSERT(rw.enqueue(Container(TimeStamp(2, 0))));
+                    rw.stop();
+                }
+                out.reset();
+                index.finalize();
+            }
+
+            // Neither the recording nor the index contain the skipped container.
+            vector<odtools::player::RecordingIndexEntry> entries;
+            TS_ASSERT(odtools::player::RecordingIndex::load("RecordingWriterSkipTest.rec", entries));
+            TS_ASSERT(2 == entries.size());
+
+            fstream fin("RecordingWriterSkipTest.rec", ios::in | ios::binary);
+            for (uint32_t i = 0; (i < entries.size()) && fin.good(); i++) {
+                const uint64_t POS_BEFORE = fin.tellg();
+                Container c;
+                fin >> c;
+
+                TS_ASSERT(POS_BEFORE == entries[i].m_filePosition);
+                TS_ASSERT(TimeStamp::ID() == c.getDataType());
+                TS_ASSERT(static_cast<int32_t>(i + 1) == c.getData<TimeStamp>().getSeconds());
+            }
+            fin.peek();
+            TS_ASSERT(fin.eof());
+            fin.close();
+
+            UNLINK("RecordingWriterSkipTest.rec");
+            UNLINK("RecordingWriterSkipTest.rec.idx");
+        }
+
+        void testRecorderWritesIndex() {
+            const bool THREADING[] = { false, true };
+            for (uint32_t t = 0; t < 2; t++) {
+                UNLINK("RecorderIndexTest.rec");
+                UNLINK("RecorderIndexTest.rec.idx");
+                UNLINK("RecorderIndexTest.rec.mem");
+                UNLINK("RecorderIndexTest.rec.mem.idx");
+
+                const uint32_t NUMBER_OF_CONTAINERS = 10;
+                {
+                    const bool NO_DUMP_SHARED_DATA = false;
+                    odtools::recorder::Recorder r("file://RecorderIndexTest.rec", 0, 0, THREADING[t], NO_DUMP_SHARED_DATA);
+                    for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                        TimeStamp ts(i, 0);
+                        Container c(ts);
+                        c.setSampleTimeStamp(TimeStamp(NUMBER_OF_CONTAINERS - i, 0));
+                        c.setSenderStamp(i);
+                        r.store(c);
+                    }
+                }
+                delete &(StreamFactory::getInstance());
+
+                vector<odtools::player::RecordingIndexEntry> entries;
+                TS_ASSERT(odtools::player::RecordingIndex::load("RecorderIndexTest.rec", entries));
+                TS_ASSERT(NUMBER_OF_CONTAINERS == entries.size());
+
+                // The index describes the containers as they are found in the recording.
+                fstream fin("RecorderIndexTest.rec", ios::in | ios::binary);
+                for (uint32_t i = 0; (i < entries.size()) && fin.good(); i++) {
+                    const uint64_t POS_BEFORE = fin.tellg();
+                        Container c;
+                        fin >> c;
+                    const uint64_t POS_AFTER = fin.tellg();
+
+                    TS_ASSERT(POS_BEFORE == entries[i].m_filePosition);
+                    TS_ASSERT((POS_AFTER - POS_BEFORE) == entries[i].m_size);
+                    TS_ASSERT(c.getSampleTimeStamp().toMicroseconds() == entries[i].m_sampleTimeStamp);
+                    TS_ASSERT(TimeStamp::ID() == entries[i].m_dataType);
+                    TS_ASSERT(i == entries[i].m_senderStamp);
+                    TS_ASSERT(0 == entries[i].m_sizeOfSharedMemorySegment);
+                }
+                fin.close();
+
+                UNLINK("RecorderIndexTest.rec");
+                UNLINK("RecorderIndexTest.rec.idx");
+                UNLINK("RecorderIndexTest.rec.mem");
+                UNLINK("RecorderIndexTest.rec.mem.idx");
+            }
+        }
+
+        void testRecorderWritesIndexForSharedData() {
+            UNLINK("RecorderIndexTestSHM.rec");
+            UNLINK("RecorderIndexTestSHM.rec.idx");
+            UNLINK("RecorderIndexTestSHM.rec.mem");
+            UNLINK("RecorderIndexTestSHM.rec.mem.idx");
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memory = odcore::wrapper::SharedMemoryFactory::createSharedMemory("RecorderIndexTestSHM", 10);
+            TS_ASSERT(memory->isValid());
+
+            const uint32_t NUMBER_OF_CONTAINERS = 3;
+            {
+                const bool NO_THREADING = false;
+                const bool DUMP_SHARED_DATA = true;
+                odtools::recorder::Recorder r("file://RecorderIndexTestSHM.rec", 100, 2, NO_THREADING, DUMP_SHARED_DATA);
+
+                odcore::data::SharedData sd;
+                sd.setName("RecorderIndexTestSHM");
+                sd.setSize(10);
+                for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                    {
+                        Lock l(memory);
+                        stringstream data;
+                        data << i << "BCDEFGHIJ";
+                        ::memcpy(memory->getSharedMemory(), data.str().c_str(), 10);
+                    }
+                    Container c(sd);
+                    c.setSampleTimeStamp(TimeStamp(i + 1, 0));
+                    r.store(c);
+                }
+            }
+            delete &(StreamFactory::getInstance());
+
+            // The .rec file is empty but has a matching index.
+            vector<odtools::player::RecordingIndexEntry> entries;
+            TS_ASSERT(odtools::player::RecordingIndex::load("RecorderIndexTestSHM.rec", entries));
+            TS_ASSERT(entries.empty());
+
+            // Every entry of the .rec.mem file points to a container followed by its memory dump.
+            TS_ASSERT(odtools::player::RecordingIndex::load("RecorderIndexTestSHM.rec.mem", entries));
+            TS_ASSERT(NUMBER_OF_CONTAINERS == entries.size());
+
+            fstream fin("RecorderIndexTestSHM.rec.mem", ios::in | ios::binary);
+            uint64_t expectedFilePosition = 0;
+            for (uint32_t i = 0; (i < entries.size()) && fin.good(); i++) {
+                TS_ASSERT(expectedFilePosition == entries[i].m_filePosition);
+                TS_ASSERT(odcore::data::SharedData::ID() == entries[i].m_dataType);
+                TS_ASSERT(TimeStamp(i + 1, 0).toMicroseconds() == entries[i].m_sampleTimeStamp);
+                TS_ASSERT(10 == entries[i].m_sizeOfSharedMemorySegment);
+
+                fin.seekg(entries[i].m_filePosition);
+                Container c;
+                fin >> c;
+                TS_ASSERT(odcore::data::SharedData::ID() == c.getDataType());
+                TS_ASSERT((entries[i].m_filePosition + entries[i].m_size) == static_cast<uint64_t>(fin.tellg()));
+
+                char data[10];
+                fin.read(data, 10);
+                stringstream expectedData;
+                expectedData << i << "BCDEFGHIJ";
+                TS_ASSERT(string(data, 10) == expectedData.str());
+
+                expectedFilePosition = entries[i].m_filePosition + entries[i].m_size + entries[i].m_sizeOfSharedMemorySegment;
+            }
+            fin.seekg(0, fin.end);
+            TS_ASSERT(expectedFilePosition == static_cast<uint64_t>(fin.tellg()));
+            fin.close();
+
+            UNLINK("RecorderIndexTestSHM.rec");
+            UNLINK("RecorderIndexTestSHM.rec.idx");
+            UNLINK("RecorderIndexTestSHM.rec.mem");
+            UNLINK("RecorderIndexTestSHM.rec.mem.idx");
+        }
 };
 
 #endif /*RECORDERTESTSUITE_H_*/